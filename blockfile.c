@@ -0,0 +1,454 @@
+#define _POSIX_C_SOURCE 200809L
+#include "blockfile.h"
+#include "parallel.h"
+
+// 压缩块文件：各块独立压缩，可以并行解压，也可以只读取其中一块。
+// 块内按列编码后再整体LZ压缩：
+//   学号列：与上一名学生的学号做前缀压缩（共享长度、后缀长度、后缀）；
+//   姓名列：块内字典（字典项数、各项长度和内容），随后每名学生一个字典下标；
+//   年龄列：每名学生1字节；
+//   成绩列：每科先存全部高字节，再存全部低字节，高字节取值少、重复多，便于压缩
+#define MAX_RAW_SIZE (1u << 28)     // 解压后单块大小上限
+#define NAME_TABLE_SIZE (2 * BLOCK_ROWS)
+
+// 编码一块：snapshot中从start起的rows名学生
+static int encode_block(const Snapshot *snapshot, int start, int rows, ByteBuffer *raw) {
+    // 学号
+    const char *previous = "";
+    for (int i = 0; i < rows; i++) {
+        const char *id = student_id_at(snapshot, start + i);
+        size_t shared = 0;
+        while (previous[shared] != '\0' && previous[shared] == id[shared]) {
+            shared++;
+        }
+        size_t len = strlen(id) - shared;
+        if (!buffer_put_varint(raw, shared) || !buffer_put_varint(raw, len) || !buffer_append(raw, id + shared, len)) {
+            return 0;
+        }
+        previous = id;
+    }
+
+    // 姓名：字符串堆中相同姓名的偏移相同，按偏移建字典
+    uint32_t table[NAME_TABLE_SIZE];      // 偏移+1，0为空位
+    uint32_t slots[NAME_TABLE_SIZE];      // 对应的字典下标
+    uint32_t dictionary[BLOCK_ROWS];      // 字典项的偏移
+    uint32_t row_index[BLOCK_ROWS];
+    uint32_t entries = 0;
+    memset(table, 0, sizeof(table));
+    for (int i = 0; i < rows; i++) {
+        uint32_t offset = cold_at(snapshot, start + i)->name;
+        uint32_t pos = (offset * 2654435761u) & (NAME_TABLE_SIZE - 1);
+        while (table[pos] != 0 && table[pos] != offset + 1) {
+            pos = (pos + 1) & (NAME_TABLE_SIZE - 1);
+        }
+        if (table[pos] == 0) {
+            table[pos] = offset + 1;
+            slots[pos] = entries;
+            dictionary[entries++] = offset;
+        }
+        row_index[i] = slots[pos];
+    }
+    if (!buffer_put_varint(raw, entries)) {
+        return 0;
+    }
+    for (uint32_t e = 0; e < entries; e++) {
+        const char *name = strheap_get(snapshot->strings, dictionary[e]);
+        size_t len = strlen(name);
+        if (!buffer_put_varint(raw, len) || !buffer_append(raw, name, len)) {
+            return 0;
+        }
+    }
+    for (int i = 0; i < rows; i++) {
+        if (!buffer_put_varint(raw, row_index[i])) {
+            return 0;
+        }
+    }
+
+    // 年龄和成绩
+    if (!buffer_reserve(raw, (size_t)rows * (1 + 2 * snapshot->schema.count))) {
+        return 0;
+    }
+    for (int i = 0; i < rows; i++) {
+        raw->data[raw->size++] = hot_at(snapshot, start + i)->age;
+    }
+    for (int k = 0; k < snapshot->schema.count; k++) {
+        for (int i = 0; i < rows; i++) {
+            raw->data[raw->size++] = (uint8_t)(score_at(snapshot, k, start + i) >> 8);
+        }
+        for (int i = 0; i < rows; i++) {
+            raw->data[raw->size++] = (uint8_t)score_at(snapshot, k, start + i);
+        }
+    }
+    return 1;
+}
+
+// 一批并行编码的块
+typedef struct {
+    const Snapshot *snapshot;
+    int first;                  // 本批第一个块的编号
+    ByteBuffer *packed;         // 各块压缩结果
+    BlockEntry *entries;
+    int failed;
+} EncodeBatch;
+
+static void encode_task(void *context, int index) {
+    EncodeBatch *batch = context;
+    int block = batch->first + index;
+    int start = block * BLOCK_ROWS;
+    int rows = batch->snapshot->count - start < BLOCK_ROWS ? batch->snapshot->count - start : BLOCK_ROWS;
+    BlockEntry *entry = &batch->entries[block];
+    ByteBuffer raw = {0};
+
+    if (!encode_block(batch->snapshot, start, rows, &raw) || raw.size > MAX_RAW_SIZE
+        || !lz_compress(raw.data, raw.size, &batch->packed[index])) {
+        __atomic_store_n(&batch->failed, 1, __ATOMIC_RELAXED);
+        buffer_free(&raw);
+        return;
+    }
+    entry->raw_size = (uint32_t)raw.size;
+    entry->packed_size = (uint32_t)batch->packed[index].size;
+    entry->rows = (uint32_t)rows;
+    const char *min_id = student_id_at(batch->snapshot, start);
+    const char *max_id = min_id;
+    for (int i = 1; i < rows; i++) {
+        const char *id = student_id_at(batch->snapshot, start + i);
+        if (strcmp(id, min_id) < 0) {
+            min_id = id;
+        }
+        if (strcmp(id, max_id) > 0) {
+            max_id = id;
+        }
+    }
+    snprintf(entry->min_id, sizeof(entry->min_id), "%s", min_id);
+    snprintf(entry->max_id, sizeof(entry->max_id), "%s", max_id);
+    buffer_free(&raw);
+}
+
+// 写入带长度前缀的字符串
+static void write_id(FILE *file, const char *id) {
+    uint16_t len = (uint16_t)strlen(id);
+    fwrite(&len, sizeof(len), 1, file);
+    fwrite(id, 1, len, file);
+}
+
+// 从文件当前位置写入全部块，随后写入块索引，*index_offset为索引位置。
+// 每批并行压缩若干块后按顺序写出，内存占用与学生数无关
+int write_blocks(const Snapshot *snapshot, FILE *file, uint64_t *index_offset) {
+    uint32_t blocks = (uint32_t)((snapshot->count + BLOCK_ROWS - 1) / BLOCK_ROWS);
+    int batch_size = parallel_threads() * 4;
+    BlockEntry *entries = calloc(blocks > 0 ? blocks : 1, sizeof(BlockEntry));
+    ByteBuffer *packed = calloc(batch_size, sizeof(ByteBuffer));
+    int ok = entries != NULL && packed != NULL;
+
+    for (uint32_t first = 0; ok && first < blocks; first += batch_size) {
+        int count = blocks - first < (uint32_t)batch_size ? (int)(blocks - first) : batch_size;
+        EncodeBatch batch = {snapshot, (int)first, packed, entries, 0};
+        parallel_for(count, encode_task, &batch);
+        ok = !batch.failed;
+        for (int i = 0; i < count; i++) {
+            if (ok) {
+                entries[first + i].offset = (uint64_t)ftello(file);
+                fwrite(packed[i].data, 1, packed[i].size, file);
+            }
+            packed[i].size = 0;
+        }
+    }
+
+    if (ok) {
+        *index_offset = (uint64_t)ftello(file);
+        uint32_t block_rows = BLOCK_ROWS;
+        fwrite(&blocks, sizeof(blocks), 1, file);
+        fwrite(&block_rows, sizeof(block_rows), 1, file);
+        for (uint32_t b = 0; b < blocks; b++) {
+            fwrite(&entries[b].offset, sizeof(uint64_t), 1, file);
+            fwrite(&entries[b].packed_size, sizeof(uint32_t), 1, file);
+            fwrite(&entries[b].raw_size, sizeof(uint32_t), 1, file);
+            fwrite(&entries[b].rows, sizeof(uint32_t), 1, file);
+            write_id(file, entries[b].min_id);
+            write_id(file, entries[b].max_id);
+        }
+    }
+    for (int i = 0; packed != NULL && i < batch_size; i++) {
+        buffer_free(&packed[i]);
+    }
+    free(packed);
+    free(entries);
+    return ok;
+}
+
+// 读取带长度前缀的学号
+static int read_id(FILE *file, char *id) {
+    uint16_t len;
+    if (fread(&len, sizeof(len), 1, file) != 1 || len >= MAX_ID_LEN || fread(id, 1, len, file) != len) {
+        return 0;
+    }
+    id[len] = '\0';
+    return 1;
+}
+
+// 读取块索引，成功返回1
+int read_block_index(FILE *file, uint64_t index_offset, BlockIndex *index) {
+    uint32_t blocks, block_rows;
+    memset(index, 0, sizeof(*index));
+    if (fseeko(file, (off_t)index_offset, SEEK_SET) != 0 || fread(&blocks, sizeof(blocks), 1, file) != 1
+        || fread(&block_rows, sizeof(block_rows), 1, file) != 1 || block_rows == 0 || block_rows > BLOCK_ROWS) {
+        return 0;
+    }
+    index->entries = malloc((blocks > 0 ? blocks : 1) * sizeof(BlockEntry));
+    if (index->entries == NULL) {
+        return 0;
+    }
+    for (uint32_t b = 0; b < blocks; b++) {
+        BlockEntry *entry = &index->entries[b];
+        if (fread(&entry->offset, sizeof(uint64_t), 1, file) != 1
+            || fread(&entry->packed_size, sizeof(uint32_t), 1, file) != 1
+            || fread(&entry->raw_size, sizeof(uint32_t), 1, file) != 1
+            || fread(&entry->rows, sizeof(uint32_t), 1, file) != 1
+            || !read_id(file, entry->min_id) || !read_id(file, entry->max_id)
+            || entry->rows == 0 || entry->rows > block_rows || entry->raw_size > MAX_RAW_SIZE
+            || entry->packed_size > entry->raw_size + entry->raw_size / 255 + 16
+            || entry->offset + entry->packed_size > index_offset) {
+            free_block_index(index);
+            return 0;
+        }
+    }
+    index->count = blocks;
+    return 1;
+}
+
+// 释放块索引
+void free_block_index(BlockIndex *index) {
+    free(index->entries);
+    memset(index, 0, sizeof(*index));
+}
+
+// 释放解码后的块
+void free_decoded_block(DecodedBlock *block) {
+    free(block->ids);
+    free(block->names);
+    free(block->names_data);
+    free(block->ages);
+    free(block->scores);
+    memset(block, 0, sizeof(*block));
+}
+
+// 解码一块的各列，成功返回1
+static int decode_columns(const uint8_t *pos, const uint8_t *end, int subjects, DecodedBlock *out) {
+    uint32_t rows = out->rows;
+    char previous[MAX_ID_LEN] = "";
+    for (uint32_t i = 0; i < rows; i++) {
+        uint64_t shared, len;
+        if (!get_varint(&pos, end, &shared) || !get_varint(&pos, end, &len) || shared > strlen(previous)
+            || shared + len >= MAX_ID_LEN || len > (uint64_t)(end - pos)) {
+            return 0;
+        }
+        memcpy(previous + shared, pos, len);
+        previous[shared + len] = '\0';
+        pos += len;
+        memcpy(out->ids[i], previous, MAX_ID_LEN);
+    }
+
+    // 姓名字典：各项连续存放在names_data中，以'\0'结尾
+    uint64_t entries;
+    if (!get_varint(&pos, end, &entries) || entries > rows) {
+        return 0;
+    }
+    const char *dictionary[BLOCK_ROWS];
+    char *text = out->names_data;
+    for (uint64_t e = 0; e < entries; e++) {
+        uint64_t len;
+        if (!get_varint(&pos, end, &len) || len > (uint64_t)(end - pos)) {
+            return 0;
+        }
+        memcpy(text, pos, len);
+        text[len] = '\0';
+        dictionary[e] = text;
+        text += len + 1;
+        pos += len;
+    }
+    for (uint32_t i = 0; i < rows; i++) {
+        uint64_t index;
+        if (!get_varint(&pos, end, &index) || index >= entries) {
+            return 0;
+        }
+        out->names[i] = dictionary[index];
+    }
+
+    if ((size_t)(end - pos) != (size_t)rows * (1 + 2 * subjects)) {
+        return 0;
+    }
+    memcpy(out->ages, pos, rows);
+    pos += rows;
+    for (int k = 0; k < subjects; k++) {
+        const uint8_t *high = pos, *low = pos + rows;
+        for (uint32_t i = 0; i < rows; i++) {
+            uint16_t score = (uint16_t)(high[i] << 8 | low[i]);
+            if (score > 100 * SCORE_SCALE) {
+                return 0;
+            }
+            out->scores[(size_t)k * rows + i] = score;
+        }
+        pos += 2 * rows;
+    }
+    return 1;
+}
+
+// 解压并解码一块，成功返回1
+int decode_block(const uint8_t *packed, const BlockEntry *entry, int subjects, DecodedBlock *out) {
+    memset(out, 0, sizeof(*out));
+    uint32_t rows = entry->rows;
+    uint8_t *raw = malloc(entry->raw_size > 0 ? entry->raw_size : 1);
+    out->rows = rows;
+    out->ids = malloc(rows * sizeof(*out->ids));
+    out->names = malloc(rows * sizeof(char *));
+    out->names_data = malloc((size_t)entry->raw_size + rows + 1);
+    out->ages = malloc(rows);
+    out->scores = malloc((size_t)rows * (subjects > 0 ? subjects : 1) * sizeof(uint16_t));
+
+    int ok = raw != NULL && out->ids != NULL && out->names != NULL && out->names_data != NULL
+             && out->ages != NULL && out->scores != NULL
+             && lz_decompress(packed, entry->packed_size, raw, entry->raw_size)
+             && decode_columns(raw, raw + entry->raw_size, subjects, out);
+    free(raw);
+    if (!ok) {
+        free_decoded_block(out);
+    }
+    return ok;
+}
+
+// 读取并解码一块，返回FILE_OK或错误状态
+int read_block(FILE *file, const BlockEntry *entry, int subjects, DecodedBlock *out) {
+    uint8_t *packed = malloc(entry->packed_size > 0 ? entry->packed_size : 1);
+    int status = FILE_OK;
+    if (packed == NULL) {
+        status = FILE_TOO_LARGE;
+    } else if (fseeko(file, (off_t)entry->offset, SEEK_SET) != 0
+               || fread(packed, 1, entry->packed_size, file) != entry->packed_size
+               || !decode_block(packed, entry, subjects, out)) {
+        status = FILE_READ_ERROR;
+    }
+    free(packed);
+    return status;
+}
+
+// 一批并行解码的块
+typedef struct {
+    const BlockEntry *entries;
+    uint8_t **packed;
+    DecodedBlock *decoded;
+    int *ok;
+    int subjects;
+} DecodeBatch;
+
+static void decode_task(void *context, int index) {
+    DecodeBatch *batch = context;
+    batch->ok[index] = decode_block(batch->packed[index], &batch->entries[index], batch->subjects,
+                                    &batch->decoded[index]);
+}
+
+// 读取全部块并追加到系统中：每批读入若干块，并行解码后按顺序追加
+int read_blocks(StudentSystem *system, FILE *file, uint64_t index_offset, uint32_t count, int subjects) {
+    BlockIndex index;
+    if (!read_block_index(file, index_offset, &index)) {
+        return FILE_READ_ERROR;
+    }
+    uint64_t total = 0;
+    for (uint32_t b = 0; b < index.count; b++) {
+        total += index.entries[b].rows;
+    }
+    if (total != count) {
+        free_block_index(&index);
+        return FILE_READ_ERROR;
+    }
+
+    int batch_size = parallel_threads() * 2;
+    uint8_t **packed = calloc(batch_size, sizeof(uint8_t *));
+    DecodedBlock *decoded = calloc(batch_size, sizeof(DecodedBlock));
+    int *ok = calloc(batch_size, sizeof(int));
+    int status = packed != NULL && decoded != NULL && ok != NULL ? FILE_OK : FILE_TOO_LARGE;
+
+    for (uint32_t first = 0; status == FILE_OK && first < index.count; first += batch_size) {
+        int n = index.count - first < (uint32_t)batch_size ? (int)(index.count - first) : batch_size;
+        for (int i = 0; status == FILE_OK && i < n; i++) {
+            const BlockEntry *entry = &index.entries[first + i];
+            packed[i] = malloc(entry->packed_size > 0 ? entry->packed_size : 1);
+            if (packed[i] == NULL) {
+                status = FILE_TOO_LARGE;
+            } else if (fseeko(file, (off_t)entry->offset, SEEK_SET) != 0
+                       || fread(packed[i], 1, entry->packed_size, file) != entry->packed_size) {
+                status = FILE_READ_ERROR;
+            }
+        }
+        if (status == FILE_OK) {
+            DecodeBatch batch = {&index.entries[first], packed, decoded, ok, subjects};
+            parallel_for(n, decode_task, &batch);
+        }
+
+        for (int i = 0; i < n; i++) {
+            if (status == FILE_OK && !ok[i]) {
+                status = FILE_READ_ERROR;
+            }
+            for (uint32_t r = 0; status == FILE_OK && r < decoded[i].rows; r++) {
+                Student s = {decoded[i].ids[r], decoded[i].names[r], decoded[i].ages[r], {0}, 0};
+                for (int k = 0; k < subjects; k++) {
+                    s.scores[k] = fixed_to_score(decoded[i].scores[(size_t)k * decoded[i].rows + r]);
+                }
+                if (!append_student(system, &s)) {
+                    status = FILE_TOO_LARGE;
+                }
+            }
+            if (ok[i]) {
+                free_decoded_block(&decoded[i]);
+            }
+            ok[i] = 0;
+            free(packed[i]);
+            packed[i] = NULL;
+        }
+    }
+
+    free(packed);
+    free(decoded);
+    free(ok);
+    free_block_index(&index);
+    return status;
+}
+
+// 按学号查找一名学生：只解码学号范围包含该学号的块。
+// 找到时填写out（姓名复制到name中，平均分由调用者计算）并返回FILE_OK，未找到返回FILE_NOT_FOUND
+int lookup_blocks(FILE *file, uint64_t index_offset, int subjects, const char *id,
+                  Student *out, char *name, size_t name_size) {
+    BlockIndex index;
+    if (!read_block_index(file, index_offset, &index)) {
+        return FILE_READ_ERROR;
+    }
+
+    int status = FILE_NOT_FOUND;
+    for (uint32_t b = 0; status == FILE_NOT_FOUND && b < index.count; b++) {
+        const BlockEntry *entry = &index.entries[b];
+        if (strcmp(id, entry->min_id) < 0 || strcmp(id, entry->max_id) > 0) {
+            continue;
+        }
+        DecodedBlock block;
+        status = read_block(file, entry, subjects, &block);
+        if (status == FILE_OK) {
+            status = FILE_NOT_FOUND;
+            for (uint32_t r = 0; r < block.rows; r++) {
+                if (strcmp(block.ids[r], id) != 0) {
+                    continue;
+                }
+                snprintf(name, name_size, "%s", block.names[r]);
+                out->id = id;
+                out->name = name;
+                out->age = block.ages[r];
+                for (int k = 0; k < subjects; k++) {
+                    out->scores[k] = fixed_to_score(block.scores[(size_t)k * block.rows + r]);
+                }
+                status = FILE_OK;
+                break;
+            }
+            free_decoded_block(&block);
+        }
+    }
+    free_block_index(&index);
+    return status;
+}
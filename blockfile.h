@@ -0,0 +1,45 @@
+#ifndef BLOCKFILE_H
+#define BLOCKFILE_H
+
+#include "student.h"
+#include "codec.h"
+
+#define BLOCK_ROWS 4096             // 每块学生数
+
+// 块索引中的一项：块的位置、大小和学号范围（按学号查找时跳过不可能包含该学号的块）
+typedef struct {
+    uint64_t offset;                // 块在文件中的位置
+    uint32_t packed_size;           // 压缩后字节数
+    uint32_t raw_size;              // 解压后字节数
+    uint32_t rows;                  // 学生数
+    char min_id[MAX_ID_LEN];
+    char max_id[MAX_ID_LEN];
+} BlockEntry;
+
+typedef struct {
+    BlockEntry *entries;
+    uint32_t count;
+} BlockIndex;
+
+// 解码后的一块
+typedef struct {
+    uint32_t rows;
+    char (*ids)[MAX_ID_LEN];
+    const char **names;             // 指向names_data中的姓名字典
+    char *names_data;
+    uint8_t *ages;
+    uint16_t *scores;               // 第i名学生第k科为 scores[k * rows + i]
+} DecodedBlock;
+
+// 函数声明
+int write_blocks(const Snapshot *snapshot, FILE *file, uint64_t *index_offset);
+int read_blocks(StudentSystem *system, FILE *file, uint64_t index_offset, uint32_t count, int subjects);
+int read_block_index(FILE *file, uint64_t index_offset, BlockIndex *index);
+void free_block_index(BlockIndex *index);
+int decode_block(const uint8_t *packed, const BlockEntry *entry, int subjects, DecodedBlock *out);
+void free_decoded_block(DecodedBlock *block);
+int read_block(FILE *file, const BlockEntry *entry, int subjects, DecodedBlock *out);
+int lookup_blocks(FILE *file, uint64_t index_offset, int subjects, const char *id,
+                  Student *out, char *name, size_t name_size);
+
+#endif
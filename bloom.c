@@ -0,0 +1,111 @@
+#include "bloom.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// FNV-1a 64位哈希
+static uint64_t hash_key(const char *key) {
+    uint64_t h = 14695981039346656037ULL;
+    for (const unsigned char *c = (const unsigned char *)key; *c; c++) {
+        h ^= *c;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// 分配全0的位数组，内存不足时停用过滤器
+static void new_bits(BloomFilter *filter) {
+    filter->bits = chunk_table_new(sizeof(uint64_t));
+    if (filter->bits != NULL && !chunk_table_reserve(&filter->bits, (uint32_t)(filter->bit_count / 64))) {
+        chunk_table_release(filter->bits);
+        filter->bits = NULL;
+    }
+}
+
+// 按容量分配位数组，成功返回1
+int bloom_init(BloomFilter *filter, int capacity) {
+    memset(filter, 0, sizeof(*filter));
+    if (capacity < 1) {
+        capacity = 1;
+    }
+    filter->bit_count = ((size_t)capacity * BLOOM_BITS_PER_KEY + 63) / 64 * 64;
+    new_bits(filter);
+    return filter->bits != NULL;
+}
+
+// 释放位数组
+void bloom_free(BloomFilter *filter) {
+    chunk_table_release(filter->bits);
+    filter->bits = NULL;
+    filter->bit_count = 0;
+}
+
+// 取过滤器的只读副本：共享位数组（之后原过滤器修改时写时复制），统计信息从0开始
+void bloom_share(BloomFilter *copy, const BloomFilter *filter) {
+    memset(copy, 0, sizeof(*copy));
+    copy->bits = filter->bits != NULL ? chunk_table_retain(filter->bits) : NULL;
+    copy->bit_count = filter->bit_count;
+    copy->key_count = filter->key_count;
+}
+
+// 清空所有位（用于删除学生后重建）：换用新的位数组，不改动共享的块
+void bloom_clear(BloomFilter *filter) {
+    chunk_table_release(filter->bits);
+    new_bits(filter);
+    filter->key_count = 0;
+    filter->stale_count = 0;
+}
+
+// 加入一个学号；用双重哈希 h1 + i*h2 生成各个位置
+void bloom_add(BloomFilter *filter, const char *key) {
+    uint64_t h = hash_key(key);
+    uint64_t h1 = h, h2 = (h >> 33) | 1;
+    filter->key_count++;
+    for (int i = 0; filter->bits != NULL && i < BLOOM_HASH_COUNT; i++) {
+        size_t bit = (h1 + i * h2) % filter->bit_count;
+        uint64_t *word = chunk_row_mut(&filter->bits, (uint32_t)(bit / 64));
+        if (word == NULL) {
+            // 复制块时内存不足：停用过滤器，查找退回逐个比较，结果仍然正确
+            chunk_table_release(filter->bits);
+            filter->bits = NULL;
+            return;
+        }
+        *word |= (uint64_t)1 << (bit % 64);
+    }
+}
+
+// 记录删除了一个学号。布隆过滤器不能清除位，留下的位只会增加误判、不会漏判，
+// 因此不必每次删除都重建；已删除的超过加入总数的1/4时返回1，由调用者重建（均摊每次删除O(1)）
+int bloom_remove(BloomFilter *filter) {
+    filter->stale_count++;
+    return filter->stale_count * 4 > filter->key_count;
+}
+
+// 返回0表示学号一定不存在，返回1表示可能存在
+int bloom_may_contain(BloomFilter *filter, const char *key) {
+    uint64_t h = hash_key(key);
+    uint64_t h1 = h, h2 = (h >> 33) | 1;
+    // 服务模式下多个读线程同时查询，计数用原子操作
+    __atomic_add_fetch(&filter->queries, 1, __ATOMIC_RELAXED);
+    for (int i = 0; filter->bits != NULL && i < BLOOM_HASH_COUNT; i++) {
+        size_t bit = (h1 + i * h2) % filter->bit_count;
+        const uint64_t *word = chunk_row(filter->bits, (uint32_t)(bit / 64));
+        if (!(*word & ((uint64_t)1 << (bit % 64)))) {
+            __atomic_add_fetch(&filter->rejected, 1, __ATOMIC_RELAXED);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// 按当前学号数量估算的理论误判率 (1 - e^(-kn/m))^k
+double bloom_expected_fp_rate(const BloomFilter *filter) {
+    double fill = 1.0 - exp(-(double)BLOOM_HASH_COUNT * filter->key_count / filter->bit_count);
+    return pow(fill, BLOOM_HASH_COUNT);
+}
+
+// 实际观测到的误判率：误判次数 / 不存在学号的查询次数
+double bloom_observed_fp_rate(const BloomFilter *filter) {
+    unsigned long absent = filter->rejected + filter->false_positives;
+    return absent == 0 ? 0.0 : (double)filter->false_positives / absent;
+}
@@ -0,0 +1,35 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "chunk.h"
+
+#define BLOOM_BITS_PER_KEY 10       // 每个学号约10位，误判率约1%
+#define BLOOM_HASH_COUNT 7          // 哈希函数个数（约为 10 * ln2）
+
+// 学号布隆过滤器：判定"一定不存在"时可跳过查找。
+// 位数组按64位字存放在块表中（每行一个字），与数据列一样被各版本共享，加入学号时只复制被改动的块
+typedef struct {
+    ChunkTable *bits;           // NULL表示内存不足已停用，此时一律判定可能存在
+    size_t bit_count;
+    int key_count;              // 已加入的学号数量（含已删除的）
+    int stale_count;            // 已删除但位仍留在过滤器中的学号数量
+    // 统计信息
+    unsigned long queries;      // 查询次数
+    unsigned long rejected;     // 直接判定不存在的次数
+    unsigned long false_positives; // 判定可能存在但实际不存在的次数
+} BloomFilter;
+
+// 函数声明
+int bloom_init(BloomFilter *filter, int capacity);
+void bloom_free(BloomFilter *filter);
+void bloom_share(BloomFilter *copy, const BloomFilter *filter);
+void bloom_clear(BloomFilter *filter);
+void bloom_add(BloomFilter *filter, const char *key);
+int bloom_remove(BloomFilter *filter);
+int bloom_may_contain(BloomFilter *filter, const char *key);
+double bloom_expected_fp_rate(const BloomFilter *filter);
+double bloom_observed_fp_rate(const BloomFilter *filter);
+
+#endif
@@ -0,0 +1,529 @@
+#define _POSIX_C_SOURCE 200809L
+#include "changefeed.h"
+#include "config.h"
+#include "protocol.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+// 段文件头。记录依次追加在文件头之后：长度(u32) + 序号(u64) 时间(u64) 类型(u8) + 内容，
+// 内容为修改前和/或修改后的学生记录（格式同 protocol.h），或科目设置
+typedef struct {
+    char magic[4];                  // "STCF"
+    uint32_t format;
+    uint64_t first_seq;             // 本段第一条记录的序号
+    uint64_t next_seq;              // 下一条记录的序号；之前的记录都已完整写入
+    uint32_t schema_length;         // 本段最近一条科目设置记录的内容，0表示本段还没有
+    uint8_t schema[CHANGEFEED_HEADER - 36];
+    uint64_t data_length;           // 文件头之后已完整写入的记录的字节数，之后的内容作废；
+                                    // 0为旧版写入的段（没有记录此项），以文件大小为准
+} FeedHeader;
+
+// 配置的变更流路径，未启用时返回0
+int change_feed_path(char *path, size_t size) {
+    return config_get("changefeed", path, size) && path[0] != '\0';
+}
+
+// 每段的大小上限
+static size_t segment_limit(void) {
+    char value[32];
+    if (config_get("changefeed_size", value, sizeof(value)) && atoi(value) > 0) {
+        return (size_t)atoi(value) << 20;
+    }
+    return (size_t)CHANGEFEED_SEGMENT_MB << 20;
+}
+
+static int write_all(int fd, const void *data, size_t size, off_t offset) {
+    const uint8_t *p = data;
+    while (size > 0) {
+        ssize_t n = pwrite(fd, p, size, offset);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return 0;
+        }
+        p += n;
+        size -= (size_t)n;
+        offset += n;
+    }
+    return 1;
+}
+
+static int read_header(int fd, FeedHeader *header) {
+    return pread(fd, header, sizeof(*header), 0) == (ssize_t)sizeof(*header)
+           && memcmp(header->magic, "STCF", 4) == 0 && header->format == CHANGEFEED_FORMAT
+           && header->schema_length <= sizeof(header->schema);
+}
+
+// 段中已完整写入的记录的字节数
+static uint64_t committed_length(int fd, const FeedHeader *header) {
+    struct stat st;
+    if (header->data_length > 0) {
+        return header->data_length;
+    }
+    return fstat(fd, &st) == 0 && st.st_size > CHANGEFEED_HEADER ? (uint64_t)st.st_size - CHANGEFEED_HEADER : 0;
+}
+
+static void init_header(FeedHeader *header, uint64_t first_seq) {
+    memset(header, 0, sizeof(*header));
+    memcpy(header->magic, "STCF", 4);
+    header->format = CHANGEFEED_FORMAT;
+    header->first_seq = first_seq;
+    header->next_seq = first_seq;
+}
+
+static void unlock_segment(struct ChangeFeed *feed) {
+    struct flock lock = {.l_type = F_UNLCK, .l_whence = SEEK_SET};
+    fcntl(feed->fd, F_SETLK, &lock);
+}
+
+// 对当前段加写锁：锁住的必须仍是该路径上的文件（期间可能被其他进程换成了新段），必要时重新打开；
+// 新建的文件写入文件头。成功返回1并读出文件头
+static int lock_segment(struct ChangeFeed *feed, FeedHeader *header) {
+    for (;;) {
+        if (feed->fd < 0) {
+            feed->fd = open(feed->path, O_RDWR | O_CREAT, 0644);
+            if (feed->fd < 0) {
+                return 0;
+            }
+        }
+        struct flock lock = {.l_type = F_WRLCK, .l_whence = SEEK_SET};
+        struct stat opened, current;
+        if (fcntl(feed->fd, F_SETLKW, &lock) != 0 || fstat(feed->fd, &opened) != 0) {
+            return 0;
+        }
+        if (stat(feed->path, &current) != 0 || current.st_ino != opened.st_ino || current.st_dev != opened.st_dev) {
+            close(feed->fd);            // 关闭即释放锁
+            feed->fd = -1;
+            continue;
+        }
+        int ok;
+        if (opened.st_size == 0) {
+            init_header(header, 1);
+            ok = write_all(feed->fd, header, sizeof(*header), 0);
+        } else {
+            ok = read_header(feed->fd, header);
+        }
+        if (!ok) {
+            unlock_segment(feed);
+        }
+        return ok;
+    }
+}
+
+// 追加一条记录的开头
+static size_t begin_record(Message *records, uint64_t seq, int op) {
+    size_t start = proto_begin_frame(records);
+    message_put_u64(records, seq);
+    message_put_u64(records, (uint64_t)time(NULL));
+    message_put_u8(records, (uint8_t)op);
+    return start;
+}
+
+// 当前段超过大小上限时换新段：先把当前段链接为"<路径>.1"，再用新段原子地替换当前路径，
+// 读者和写者任何时候都能打开当前段
+static void rotate_segment(struct ChangeFeed *feed, const FeedHeader *header) {
+    char older[sizeof(feed->path) + 8], fresh[sizeof(feed->path) + 8];
+    snprintf(older, sizeof(older), "%s.1", feed->path);
+    snprintf(fresh, sizeof(fresh), "%s.new", feed->path);
+    FeedHeader next;
+    init_header(&next, header->next_seq);
+    int fd = open(fresh, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return;
+    }
+    int ok = write_all(fd, &next, sizeof(next), 0);
+    close(fd);
+    unlink(older);
+    if (!ok || link(feed->path, older) != 0 || rename(fresh, feed->path) != 0) {
+        unlink(fresh);
+    }
+}
+
+// 开始写入：锁住当前段，读出文件头。加载数据后的第一条变更之前记下加载；
+// 科目设置与本段最近记下的不同时，先记下科目设置。失败时只提示，不影响修改本身
+static int begin_append(StudentSystem *system, FeedHeader *header, Message *records, uint64_t *seq) {
+    struct ChangeFeed *feed = system->changes;
+    if (!lock_segment(feed, header)) {
+        fprintf(stderr, "警告：无法写入变更流 %s！\n", feed->path);
+        return 0;
+    }
+    message_init(records);
+    *seq = header->next_seq;
+    if (feed->load_pending) {
+        size_t start = begin_record(records, (*seq)++, CHANGE_LOADED);
+        proto_end_frame(records, start);
+    }
+    Message schema;
+    message_init(&schema);
+    proto_put_schema(&schema, &system->schema);
+    int schema_changed = schema.bytes.size != header->schema_length
+                         || memcmp(schema.bytes.data, header->schema, header->schema_length) != 0;
+    if (schema_changed && schema.bytes.size <= sizeof(header->schema)) {
+        size_t start = begin_record(records, (*seq)++, CHANGE_SCHEMA);
+        message_put(records, schema.bytes.data, schema.bytes.size);
+        proto_end_frame(records, start);
+        memcpy(header->schema, schema.bytes.data, schema.bytes.size);
+        header->schema_length = (uint32_t)schema.bytes.size;
+    }
+    message_free(&schema);
+    return 1;
+}
+
+// 写入已编码的记录并解锁。
+// 记录写在已完整写入的部分之后（先截掉上次中途失败或崩溃留下的残余），同步到磁盘后
+// 再更新文件头中的序号和长度，读者只读到已完整写入的记录
+static void finish_append(StudentSystem *system, FeedHeader *header, Message *records, uint64_t seq) {
+    struct ChangeFeed *feed = system->changes;
+    uint64_t length = committed_length(feed->fd, header);
+    off_t end = CHANGEFEED_HEADER + (off_t)length;
+    header->next_seq = seq;
+    header->data_length = length + records->bytes.size;
+    if (records->failed || ftruncate(feed->fd, end) != 0
+        || !write_all(feed->fd, records->bytes.data, records->bytes.size, end) || fdatasync(feed->fd) != 0
+        || !write_all(feed->fd, header, sizeof(*header), 0)) {
+        fprintf(stderr, "警告：无法写入变更流 %s！\n", feed->path);
+    } else {
+        feed->load_pending = 0;
+        system->change_seq = seq;
+        if ((size_t)end + records->bytes.size >= feed->segment_limit) {
+            rotate_segment(feed, header);
+        }
+    }
+    unlock_segment(feed);
+    message_free(records);
+}
+
+// 编码一条变更；position 只用于 CHANGE_SAVED
+static void put_change(Message *records, uint64_t seq, const StudentSystem *system, int op,
+                       const Student *before, const Student *after, uint64_t position) {
+    size_t start = begin_record(records, seq, op);
+    if (before != NULL) {
+        proto_put_student(records, system->schema.count, before);
+    }
+    if (after != NULL) {
+        proto_put_student(records, system->schema.count, after);
+    }
+    if (op == CHANGE_SAVED) {
+        message_put_u64(records, position);
+    }
+    proto_end_frame(records, start);
+}
+
+// 写入一条变更；成批写入期间只编码到batch中，序号留到写入时填
+static void append_change(StudentSystem *system, int op, const Student *before, const Student *after,
+                          uint64_t position) {
+    FeedHeader header;
+    Message records;
+    uint64_t seq;
+    if (system->changes->batching) {
+        put_change(&system->changes->batch, 0, system, op, before, after, position);
+        return;
+    }
+    if (!begin_append(system, &header, &records, &seq)) {
+        return;
+    }
+    put_change(&records, seq++, system, op, before, after, position);
+    finish_append(system, &header, &records, seq);
+}
+
+// 按配置启用变更流（加载数据之后调用，加载本身不是变更），未配置时返回1且不启用
+int attach_change_feed(StudentSystem *system) {
+    char path[256];
+    if (system->changes != NULL || !change_feed_path(path, sizeof(path))) {
+        return 1;
+    }
+    struct ChangeFeed *feed = calloc(1, sizeof(*feed));
+    if (feed == NULL) {
+        return 0;
+    }
+    snprintf(feed->path, sizeof(feed->path), "%s", path);
+    feed->fd = -1;
+    feed->segment_limit = segment_limit();
+    feed->load_pending = 1;
+    system->changes = feed;
+    system->change_seq = 0;
+    return 1;
+}
+
+void close_change_feed(StudentSystem *system) {
+    if (system->changes != NULL) {
+        changes_end_batch(system);
+        if (system->changes->fd >= 0) {
+            close(system->changes->fd);
+        }
+        free(system->changes);
+        system->changes = NULL;
+    }
+}
+
+void changes_insert(StudentSystem *system, int index) {
+    if (system->changes != NULL) {
+        Student after;
+        get_student(system, index, &after);
+        append_change(system, CHANGE_INSERT, NULL, &after, 0);
+    }
+}
+
+// 批量添加了下标 first 起的 count 名学生（添加时未启用变更流）：全部记录编码后一次写入，只加锁和更新文件头一次
+void changes_insert_range(StudentSystem *system, int first, int count) {
+    if (system->changes == NULL || count <= 0) {
+        return;
+    }
+    int batching = system->changes->batching;
+    changes_begin_batch(system);
+    for (int i = first; i < first + count; i++) {
+        Student after;
+        get_student(system, i, &after);
+        put_change(&system->changes->batch, 0, system, CHANGE_INSERT, NULL, &after, 0);
+    }
+    if (!batching) {
+        changes_end_batch(system);
+    }
+}
+
+void changes_update(StudentSystem *system, const Student *before, int index) {
+    if (system->changes != NULL) {
+        Student after;
+        get_student(system, index, &after);
+        append_change(system, CHANGE_UPDATE, before, &after, 0);
+    }
+}
+
+void changes_delete(StudentSystem *system, int index) {
+    if (system->changes != NULL) {
+        Student before;
+        get_student(system, index, &before);
+        append_change(system, CHANGE_DELETE, &before, NULL, 0);
+    }
+}
+
+void changes_reset(StudentSystem *system) {
+    if (system->changes != NULL) {
+        append_change(system, CHANGE_RESET, NULL, NULL, 0);
+    }
+}
+
+// 重新加载了数据文件：不立即记录，下一条变更之前再记下加载
+void changes_loaded(StudentSystem *system) {
+    if (system->changes != NULL) {
+        system->changes->load_pending = 1;
+        system->change_seq = 0;
+    }
+}
+
+// 保存了取自 change_seq 为 position 时的快照。加载后没有写入过变更时文件与加载时相同，不必记录
+void changes_saved(StudentSystem *system, uint64_t position) {
+    if (system->changes != NULL && position > 0) {
+        append_change(system, CHANGE_SAVED, NULL, NULL, position);
+    }
+}
+
+// 开始成批写入：之后的变更先编码在内存中，由 changes_end_batch 一次写入
+void changes_begin_batch(StudentSystem *system) {
+    if (system->changes != NULL && !system->changes->batching) {
+        system->changes->batching = 1;
+        message_init(&system->changes->batch);
+    }
+}
+
+// 结束成批写入：依次填入序号后一起写入，加锁、同步磁盘和更新文件头都只做一次
+void changes_end_batch(StudentSystem *system) {
+    struct ChangeFeed *feed = system->changes;
+    if (feed == NULL || !feed->batching) {
+        return;
+    }
+    feed->batching = 0;
+    FeedHeader header;
+    Message records;
+    uint64_t seq;
+    if ((feed->batch.bytes.size > 0 || feed->batch.failed) && begin_append(system, &header, &records, &seq)) {
+        // 通常前面没有加载或科目设置记录，直接使用已编码的记录，不再复制
+        size_t pos = records.bytes.size;
+        if (pos == 0) {
+            message_free(&records);
+            records = feed->batch;
+            message_init(&feed->batch);
+        } else {
+            message_put(&records, feed->batch.bytes.data, feed->batch.bytes.size);
+            records.failed |= feed->batch.failed;
+        }
+        while (!records.failed && pos < records.bytes.size) {
+            uint8_t *frame = records.bytes.data + pos;
+            for (int i = 0; i < 8; i++) {
+                frame[PROTO_FRAME_HEADER + i] = (uint8_t)(seq >> (8 * i));
+            }
+            seq++;
+            pos += PROTO_FRAME_HEADER + proto_frame_length(frame);
+        }
+        finish_append(system, &header, &records, seq);
+    }
+    message_free(&feed->batch);
+}
+
+// 读取时的缓冲区
+typedef struct {
+    Schema schema;
+    Message older;                  // "<路径>.1"段的全部记录
+    Message current;                // 当前段的全部记录
+    char before_id[MAX_ID_LEN];
+    char after_id[MAX_ID_LEN];
+    char before_name[STRHEAP_SEGMENT_SIZE];
+    char after_name[STRHEAP_SEGMENT_SIZE];
+} FeedReader;
+
+// 把一段中已完整写入的记录读入data（段大小有上限）。
+// 不能用fdopen(dup(fd))再fclose，关闭任一描述符都会释放该文件上的锁
+static int load_segment(int fd, const FeedHeader *header, Message *data) {
+    size_t size = (size_t)committed_length(fd, header);
+    if (!message_reserve(data, size) || pread(fd, data->bytes.data, size, CHANGEFEED_HEADER) != (ssize_t)size) {
+        return 0;
+    }
+    data->bytes.size = size;
+    return 1;
+}
+
+// 处理一段中序号在[from, 段的next_seq)内的记录；科目设置记录总要解析，以便解释之后的成绩
+static int visit_segment(const FeedHeader *header, const Message *data, uint64_t from, FeedReader *r,
+                         void (*visit)(const ChangeRecord *record, void *context), void *context) {
+    Reader records;
+    reader_init(&records, data->bytes.data, data->bytes.size);
+    for (uint64_t seq = header->first_seq; seq < header->next_seq;) {
+        uint32_t length = reader_u32(&records);
+        const uint8_t *body = reader_bytes(&records, length);
+        if (body == NULL || length < 17) {
+            return FEED_ERROR;
+        }
+        Reader reader;
+        reader_init(&reader, body, length);
+        ChangeRecord record;
+        memset(&record, 0, sizeof(record));
+        record.seq = reader_u64(&reader);
+        record.time = (int64_t)reader_u64(&reader);
+        record.op = reader_u8(&reader);
+        record.schema = &r->schema;
+        seq = record.seq + 1;
+        if (record.op == CHANGE_SCHEMA && !proto_get_schema(&reader, &r->schema)) {
+            return FEED_ERROR;
+        }
+        if (record.seq < from) {
+            continue;
+        }
+        if (record.op == CHANGE_SAVED) {
+            record.position = reader_u64(&reader);
+        } else if (record.op == CHANGE_LOADED) {
+            record.position = record.seq + 1;
+        }
+        record.has_before = record.op == CHANGE_UPDATE || record.op == CHANGE_DELETE;
+        record.has_after = record.op == CHANGE_INSERT || record.op == CHANGE_UPDATE;
+        if ((record.has_before && !proto_get_student(&reader, &record.before, r->before_id, r->before_name,
+                                                     sizeof(r->before_name)))
+            || (record.has_after && !proto_get_student(&reader, &record.after, r->after_id, r->after_name,
+                                                       sizeof(r->after_name)))
+            || reader.failed) {
+            return FEED_ERROR;
+        }
+        visit(&record, context);
+    }
+    return FEED_OK;
+}
+
+// 打开当前段并加读锁，读出文件头。锁住的必须仍是该路径上的文件（期间可能刚被换成了新段）
+static int open_current(const char *path, int *fd_out, FeedHeader *header) {
+    int fd;
+    for (;;) {
+        fd = open(path, O_RDONLY);
+        if (fd < 0) {
+            return errno == ENOENT ? FEED_MISSING : FEED_ERROR;
+        }
+        struct flock lock = {.l_type = F_RDLCK, .l_whence = SEEK_SET};
+        struct stat opened, current;
+        if (fcntl(fd, F_SETLKW, &lock) != 0 || fstat(fd, &opened) != 0) {
+            close(fd);
+            return FEED_ERROR;
+        }
+        if (stat(path, &current) == 0 && current.st_ino == opened.st_ino && current.st_dev == opened.st_dev) {
+            break;
+        }
+        close(fd);
+    }
+    if (!read_header(fd, header)) {
+        close(fd);
+        return FEED_MISSING;            // 写入端刚创建，还没有文件头
+    }
+    *fd_out = fd;
+    return FEED_OK;
+}
+
+// 读出下一条记录的序号（之前的记录都已可读），只读文件头
+int change_feed_head(const char *path, uint64_t *next_seq) {
+    int fd;
+    FeedHeader header;
+    int status = open_current(path, &fd, &header);
+    if (status == FEED_OK) {
+        *next_seq = header.next_seq;
+        close(fd);
+    }
+    return status;
+}
+
+// 从序号from起按顺序读取变更，对每条调用visit；from为0时从仍保留的最早记录起。
+// 起始序号的记录已被丢弃时返回FEED_GAP，oldest（可为NULL）置为仍保留的最早序号。
+// 只在把记录读入内存期间持有当前段的读锁，处理记录时不妨碍写入；没有新记录时只读文件头
+int read_changes(const char *path, uint64_t from, void (*visit)(const ChangeRecord *record, void *context),
+                 void *context, uint64_t *oldest) {
+    int fd;
+    FeedHeader header;
+    int status = open_current(path, &fd, &header);
+    if (status != FEED_OK) {
+        return status;
+    }
+
+    char older_path[sizeof(((struct ChangeFeed *)0)->path) + 8];
+    snprintf(older_path, sizeof(older_path), "%s.1", path);
+    FeedHeader older;
+    int older_fd = open(older_path, O_RDONLY);
+    int has_older = older_fd >= 0 && read_header(older_fd, &older) && older.next_seq == header.first_seq;
+    uint64_t first = has_older ? older.first_seq : header.first_seq;
+    if (oldest != NULL) {
+        *oldest = first;
+    }
+    if (from == 0) {
+        from = first;
+    }
+
+    FeedReader *reader = from < header.next_seq ? calloc(1, sizeof(FeedReader)) : NULL;
+    if (from >= header.next_seq) {
+        status = from > header.next_seq ? FEED_GAP : FEED_OK;
+    } else if (reader == NULL) {
+        status = FEED_ERROR;
+    } else if (from < first) {
+        status = FEED_GAP;
+    } else {
+        int use_older = has_older && from < header.first_seq;
+        if ((use_older && !load_segment(older_fd, &older, &reader->older))
+            || !load_segment(fd, &header, &reader->current)) {
+            status = FEED_ERROR;
+        }
+        close(fd);                      // 释放读锁
+        fd = -1;
+        if (status == FEED_OK && use_older) {
+            status = visit_segment(&older, &reader->older, from, reader, visit, context);
+        }
+        if (status == FEED_OK) {
+            status = visit_segment(&header, &reader->current, from, reader, visit, context);
+        }
+        message_free(&reader->older);
+        message_free(&reader->current);
+    }
+    free(reader);
+    if (older_fd >= 0) {
+        close(older_fd);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    return status;
+}
@@ -0,0 +1,82 @@
+#ifndef CHANGEFEED_H
+#define CHANGEFEED_H
+
+#include "student.h"
+#include "protocol.h"
+
+#define CHANGEFEED_FORMAT 1
+#define CHANGEFEED_HEADER 4096      // 文件头大小，记录从此处开始
+#define CHANGEFEED_SEGMENT_MB 4     // 默认每段大小（MB），可由配置项 changefeed_size 修改
+
+// 变更流：学生的每次添加、修改、删除按顺序编号写入文件（配置项 changefeed 指定路径，未设置时不启用），
+// 下游按序号增量读取，不必重新加载整个数据文件。记录带修改前后的学生信息。
+// 文件超过段大小时，当前段改名为"<路径>.1"（替换更早的一段），新段从下一个序号开始；
+// 读取的起始序号早于保留的最早记录时，需要重新读取全部数据。
+// 保存和加载数据文件也各记一条，只读副本（replica.h）据此确定从数据文件的哪个序号起重放变更。
+// 多个进程可以同时写入同一变更流，序号由文件锁保证唯一且连续。
+// 记录同步到磁盘后才在文件头中记下序号和长度，写入中途出错或崩溃不会留下读者可见的残缺记录。
+// 每次写入都要同步一次磁盘；连续的多次修改可以放在 changes_begin_batch 和 changes_end_batch 之间，
+// 合并为一次写入（组提交），结束之前这些变更尚未持久，调用者应在结束后才确认修改。
+
+// 变更类型
+enum {
+    CHANGE_INSERT = 1,              // 添加：修改后
+    CHANGE_UPDATE,                  // 修改：修改前 + 修改后
+    CHANGE_DELETE,                  // 删除：修改前
+    CHANGE_RESET,                   // 整体替换（重新加载、恢复快照）：下游应重新读取全部数据
+    CHANGE_SCHEMA,                  // 科目设置，之后记录中的成绩按此解释；每段以它开头
+    CHANGE_SAVED,                   // 保存了数据文件：文件包含 position 之前的全部变更
+    CHANGE_LOADED                   // 进程加载了数据文件，此后的变更以文件内容为起点（写入第一条变更前记下）
+};
+
+// 读取结果
+enum {
+    FEED_OK = 0,
+    FEED_MISSING,                   // 变更流文件不存在
+    FEED_GAP,                       // 起始序号的记录已被丢弃
+    FEED_ERROR
+};
+
+// 读出的一条变更；学生信息中的字符串在回调返回后失效
+typedef struct {
+    uint64_t seq;
+    int64_t time;                   // 写入时间（Unix时间）
+    int op;
+    const Schema *schema;           // 当前的科目设置
+    uint64_t position;              // CHANGE_SAVED、CHANGE_LOADED：数据文件已包含此序号之前的变更
+    int has_before;
+    int has_after;
+    Student before;
+    Student after;
+} ChangeRecord;
+
+// 打开的变更流（写入端）
+struct ChangeFeed {
+    char path[256];
+    int fd;
+    size_t segment_limit;
+    int load_pending;               // 加载数据后还没有写入变更，下一条变更前先写加载记录
+    int batching;                   // changes_begin_batch 之后：变更只编码到batch中，changes_end_batch 时一次写入
+    Message batch;                  // 尚未写入的记录，序号在写入时填入
+};
+
+// 函数声明
+int change_feed_path(char *path, size_t size);
+int attach_change_feed(StudentSystem *system);
+void close_change_feed(StudentSystem *system);
+int change_feed_head(const char *path, uint64_t *next_seq);
+int read_changes(const char *path, uint64_t from, void (*visit)(const ChangeRecord *record, void *context),
+                 void *context, uint64_t *oldest);
+
+// 存储访问函数在修改学生时调用（roster.c）
+void changes_insert(StudentSystem *system, int index);
+void changes_insert_range(StudentSystem *system, int first, int count);
+void changes_update(StudentSystem *system, const Student *before, int index);
+void changes_delete(StudentSystem *system, int index);
+void changes_reset(StudentSystem *system);
+void changes_loaded(StudentSystem *system);
+void changes_saved(StudentSystem *system, uint64_t position);
+void changes_begin_batch(StudentSystem *system);
+void changes_end_batch(StudentSystem *system);
+
+#endif
@@ -0,0 +1,125 @@
+#include "chunk.h"
+#include <stdlib.h>
+#include <string.h>
+
+// 数据块的字节数
+#define chunk_bytes(table) (sizeof(Chunk) + (size_t)CHUNK_ROWS * (table)->elem_size)
+
+// 创建空块表
+ChunkTable *chunk_table_new(uint32_t elem_size) {
+    ChunkTable *table = malloc(sizeof(ChunkTable));
+    if (table != NULL) {
+        table->refs = 1;
+        table->elem_size = elem_size;
+        table->count = 0;
+    }
+    return table;
+}
+
+// 释放数据块的一个引用
+static void chunk_release(Chunk *chunk) {
+    if (__atomic_sub_fetch(&chunk->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+        free(chunk);
+    }
+}
+
+// 释放块表的一个引用，最后一个引用释放时一并释放其数据块
+void chunk_table_release(ChunkTable *table) {
+    if (table == NULL || __atomic_sub_fetch(&table->refs, 1, __ATOMIC_ACQ_REL) != 0) {
+        return;
+    }
+    for (uint32_t c = 0; c < table->count; c++) {
+        chunk_release(table->chunks[c]);
+    }
+    free(table);
+}
+
+// 块表是否被其他版本共享
+#define is_shared(object) (__atomic_load_n(&(object)->refs, __ATOMIC_ACQUIRE) > 1)
+
+// 复制一份块表（块数至少为count），与原表共享所有数据块
+static ChunkTable *table_copy(const ChunkTable *table, uint32_t count) {
+    ChunkTable *copy = malloc(sizeof(ChunkTable) + (size_t)count * sizeof(Chunk *));
+    if (copy == NULL) {
+        return NULL;
+    }
+    copy->refs = 1;
+    copy->elem_size = table->elem_size;
+    copy->count = table->count;
+    for (uint32_t c = 0; c < table->count; c++) {
+        copy->chunks[c] = table->chunks[c];
+        __atomic_add_fetch(&copy->chunks[c]->refs, 1, __ATOMIC_RELAXED);
+    }
+    return copy;
+}
+
+// 取得独占的块表（被共享时复制），块表至少能存放count个块，成功返回1
+static int table_own(ChunkTable **table, uint32_t count) {
+    ChunkTable *old = *table;
+    if (count < old->count) {
+        count = old->count;
+    }
+    if (is_shared(old)) {
+        ChunkTable *copy = table_copy(old, count);
+        if (copy == NULL) {
+            return 0;
+        }
+        chunk_table_release(old);
+        *table = copy;
+    } else if (count > old->count) {
+        ChunkTable *grown = realloc(old, sizeof(ChunkTable) + (size_t)count * sizeof(Chunk *));
+        if (grown == NULL) {
+            return 0;
+        }
+        *table = grown;
+    }
+    return 1;
+}
+
+// 确保块表能存放rows行（新块内容为0），成功返回1
+int chunk_table_reserve(ChunkTable **table, uint32_t rows) {
+    uint32_t count = (rows + CHUNK_MASK) >> CHUNK_BITS;
+    if (count <= (*table)->count) {
+        return 1;
+    }
+    if (!table_own(table, count)) {
+        return 0;
+    }
+    ChunkTable *t = *table;
+    while (t->count < count) {
+        Chunk *chunk = calloc(1, chunk_bytes(t));
+        if (chunk == NULL) {
+            return 0;
+        }
+        chunk->refs = 1;
+        t->chunks[t->count++] = chunk;
+    }
+    return 1;
+}
+
+// 取得第row行（可写）：块表或数据块被快照共享时先复制一份。内存不足返回NULL
+void *chunk_row_mut(ChunkTable **table, uint32_t row) {
+    if (is_shared(*table) && !table_own(table, 0)) {
+        return NULL;
+    }
+    ChunkTable *t = *table;
+    Chunk *chunk = t->chunks[row >> CHUNK_BITS];
+    if (is_shared(chunk)) {
+        Chunk *copy = malloc(chunk_bytes(t));
+        if (copy == NULL) {
+            return NULL;
+        }
+        // 只复制数据部分：引用计数可能正被其他线程修改
+        memcpy(copy->data, chunk->data, (size_t)CHUNK_ROWS * t->elem_size);
+        copy->refs = 1;
+        chunk_release(chunk);
+        t->chunks[row >> CHUNK_BITS] = copy;
+        chunk = copy;
+    }
+    return chunk->data + (size_t)(row & CHUNK_MASK) * t->elem_size;
+}
+
+// 统计块表占用的内存（字节，共享的数据块也计入）
+size_t chunk_table_memory(const ChunkTable *table) {
+    return sizeof(ChunkTable) + table->count * (sizeof(Chunk *) + chunk_bytes(table));
+}
@@ -0,0 +1,52 @@
+#ifndef CHUNK_H
+#define CHUNK_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define CHUNK_BITS 12
+#define CHUNK_ROWS (1u << CHUNK_BITS)   // 每块4096行，是64的倍数，按64行一组扫描时不会跨块
+#define CHUNK_MASK (CHUNK_ROWS - 1)
+
+// 数据块：可被多个块表共享，引用计数为0时释放
+typedef struct {
+    int refs;
+    int reserved;
+    uint8_t data[];
+} Chunk;
+
+// 块表：一列数据按固定行数分块存放。
+// 快照与当前数据共享块表和数据块，修改前才复制被修改的部分（写时复制）。
+// 引用计数用原子操作维护，快照可以在其他线程中释放
+typedef struct {
+    int refs;                   // 引用此块表的版本数
+    uint32_t elem_size;         // 每行字节数
+    uint32_t count;             // 已分配的块数
+    Chunk *chunks[];
+} ChunkTable;
+
+// 函数声明
+ChunkTable *chunk_table_new(uint32_t elem_size);
+int chunk_table_reserve(ChunkTable **table, uint32_t rows);
+void chunk_table_release(ChunkTable *table);
+void *chunk_row_mut(ChunkTable **table, uint32_t row);
+size_t chunk_table_memory(const ChunkTable *table);
+
+// 增加块表的引用（取快照时）
+static inline ChunkTable *chunk_table_retain(ChunkTable *table) {
+    __atomic_add_fetch(&table->refs, 1, __ATOMIC_RELAXED);
+    return table;
+}
+
+// 取得第row行（只读）
+static inline const void *chunk_row(const ChunkTable *table, uint32_t row) {
+    return table->chunks[row >> CHUNK_BITS]->data + (size_t)(row & CHUNK_MASK) * table->elem_size;
+}
+
+// 取得从第row行开始、同一块内连续的行（只读），*rows为连续的行数
+static inline const void *chunk_span(const ChunkTable *table, uint32_t row, uint32_t *rows) {
+    *rows = CHUNK_ROWS - (row & CHUNK_MASK);
+    return chunk_row(table, row);
+}
+
+#endif
@@ -0,0 +1,1294 @@
+#include "cli.h"
+#include "query.h"
+#include "history.h"
+#include "config.h"
+#include "extsort.h"
+#include "server.h"
+#include "client.h"
+#include "loadgen.h"
+#include "http.h"
+#include "shared.h"
+#include "shmroster.h"
+#include "changefeed.h"
+#include "filesync.h"
+#include "fileio.h"
+#include "import.h"
+#include "json.h"
+
+// 命令执行结果
+enum {
+    CMD_OK = 0,
+    CMD_ERROR = 1
+};
+
+// 打印命令行帮助
+static void print_usage() {
+    printf("用法: student_management [命令] [参数]\n");
+    printf("不带命令时进入交互菜单。\n\n");
+    printf("命令:\n");
+    printf("  search <条件>   按条件查找学生，如 \"math < 60 and age >= 18\"\n");
+    printf("  export [条件]   以CSV格式导出（全部或符合条件的）学生到标准输出\n");
+    printf("  delete <条件>   批量删除符合条件的学生并保存\n");
+    printf("  import <CSV文件> [解析线程数]\n");
+    printf("                  从CSV文件（格式同 export）批量导入学生并保存，跳过已存在的学号和格式不正确的记录；\n");
+    printf("                  读取、解析校验、插入分阶段并行，结束时报告各阶段的计数\n");
+    printf("  stats           显示统计信息\n");
+    printf("  stats --streaming, export --streaming [条件]\n");
+    printf("                  不加载全部数据，逐段读取数据文件统计或导出（适合超出内存的数据）\n");
+    printf("  schema          显示科目设置\n");
+    printf("  sort <排序键> [--output 文件]\n");
+    printf("                  按排序键（如 \"average desc, id asc\"）排序数据文件，输出CSV或写为数据文件；\n");
+    printf("                  数据超出内存时分段排序后归并（内存上限由配置项 sort_memory 设置，单位MB）\n");
+    printf("  lookup <学号>   不加载全部数据，直接在数据文件中按学号查找\n");
+    printf("  changes [起始序号]\n");
+    printf("                  以JSON行输出变更流中从起始序号起的添加、修改、删除（需在配置中设置 changefeed）\n");
+    printf("  convert plain|compressed  把数据文件转换为普通或压缩格式\n");
+    printf("  snapshot take|show|export|restore|drop <快照名>\n");
+    printf("                  创建、查看、导出、恢复或删除快照（在批处理中使用）\n");
+    printf("  snapshot list   列出快照\n");
+    printf("  term close <学期名>  把当前成绩结转为一个学期，追加到历史文件\n");
+    printf("  term list       列出已结转的学期\n");
+    printf("  term show [学期名]   显示某学期（默认最近一个）的成绩\n");
+    printf("  trend <学号>    显示一名学生各学期及当前的成绩\n");
+    printf("  shm publish     把数据发布到POSIX共享内存（名称由配置项 shm_name 设置，默认 %s），\n", SHM_NAME);
+    printf("                  再次发布时整体换为新的一代\n");
+    printf("  shm info | get <学号> | search <条件> | stats\n");
+    printf("                  只读挂载共享内存中的数据，就地查找、查询或统计（不读数据文件）\n");
+    printf("  shm remove      删除共享内存中的数据\n");
+    printf("  stress [线程数] [秒数]\n");
+    printf("                  并发压力测试（99%%查找、1%%修改，修改不保存），比较互斥锁与RCU的读吞吐量\n");
+    printf("  batch [文件]    从文件（默认标准输入）逐行执行以上命令\n");
+    printf("  serve           以服务模式运行：数据常驻内存，通过Unix域套接字响应客户端请求，\n");
+    printf("                  Ctrl+C 停止并保存（套接字路径由配置项 socket 设置，默认 %s）\n", PROTO_SOCKET);
+    printf("                  配置了 http_port 时另在 127.0.0.1 上提供HTTP/JSON接口：\n");
+    printf("                  /students/<学号>  /search?q=<条件>  /stats  /top?n=10&by=<排序规则>\n");
+    printf("  replica <数据文件> <变更流>\n");
+    printf("                  以只读副本运行：加载主服务的数据文件，持续应用其变更流中的修改，\n");
+    printf("                  同 serve 一样响应查询（拒绝修改）；HTTP接口另有 /replication 复制状态\n");
+    printf("  client get <学号> | search <条件> | stats | delete <学号> | save | replica\n");
+    printf("  client add|modify <学号> <姓名> <年龄> <各科成绩...>\n");
+    printf("                  向运行中的服务发送请求（replica 显示只读副本的复制状态）\n");
+    printf("  client bench [http] [连接数] [秒数]\n");
+    printf("                  压测服务端的按学号查询：流水线与批量两种方式、每批1~128个请求，\n");
+    printf("                  报告吞吐量和p50/p99延迟（默认4个连接、每项3秒）；加 http 时压测HTTP接口\n");
+    printf("  help            显示此帮助信息\n\n");
+    printf("条件语法: 字段 运算符 值，可用 and / or / not 与括号组合\n");
+    printf("  字段: id name age average（或 学号 姓名 年龄 平均分），以及各科目名或别名（如 math 或 数学）\n");
+    printf("  运算符: < <= > >= == != ^=（前缀匹配，如 name ^= \"张\"）\n");
+}
+
+// 编译并执行查询，结果写入selection；失败时输出错误到stderr
+static int select_students(StudentSystem *system, const char *expression, Selection *selection) {
+    Query query;
+    if (!query_compile(&query, &system->schema, expression)) {
+        fprintf(stderr, "查询错误：%s\n", query.error);
+        return 0;
+    }
+    if (!query_execute(&query, system, selection)) {
+        fprintf(stderr, "错误：内存不足！\n");
+        return 0;
+    }
+    return 1;
+}
+
+// 输出一个CSV字段，必要时加引号
+static void write_csv_field(FILE *out, const char *text) {
+    if (strpbrk(text, ",\"\n") == NULL) {
+        fputs(text, out);
+        return;
+    }
+    fputc('"', out);
+    for (const char *c = text; *c; c++) {
+        if (*c == '"') {
+            fputc('"', out);
+        }
+        fputc(*c, out);
+    }
+    fputc('"', out);
+}
+
+// 输出CSV表头
+static void write_csv_header(const Schema *schema, FILE *out) {
+    fprintf(out, "id,name,age");
+    for (int k = 0; k < schema->count; k++) {
+        fputc(',', out);
+        write_csv_field(out, subject_key(schema, k));
+    }
+    fprintf(out, ",average\n");
+}
+
+// 输出一名学生的CSV行
+static void write_csv_row(const Schema *schema, const Student *s, FILE *out) {
+    write_csv_field(out, s->id);
+    fputc(',', out);
+    write_csv_field(out, s->name);
+    fprintf(out, ",%d", s->age);
+    for (int k = 0; k < schema->count; k++) {
+        fprintf(out, ",%.2f", s->scores[k]);
+    }
+    fprintf(out, ",%.2f\n", s->average_score);
+}
+
+// 以CSV格式导出快照中的学生；selection为NULL时导出全部
+static void export_csv(const Snapshot *snapshot, const Selection *selection, FILE *out) {
+    write_csv_header(&snapshot->schema, out);
+    for (int i = 0; i < snapshot->count; i++) {
+        if (selection != NULL && !selection_test(selection, i)) {
+            continue;
+        }
+        Student s;
+        snapshot_get_student(snapshot, i, &s);
+        write_csv_row(&snapshot->schema, &s, out);
+    }
+}
+
+// 流式导出：逐段读取数据文件，按条件筛选后写出，不加载全部数据
+static int stream_export_command(StudentSystem *system, const char *expression) {
+    StudentStream stream;
+    int status = stream_open(&stream, FILENAME);
+    if (status == FILE_NOT_FOUND) {
+        // 没有数据文件时与加载后的空数据相同
+        write_csv_header(&system->schema, stdout);
+        return CMD_OK;
+    }
+    if (status != FILE_OK) {
+        fprintf(stderr, "错误：读取数据文件 %s 失败！\n", FILENAME);
+        return CMD_ERROR;
+    }
+
+    Query query;
+    if (*expression != '\0' && !query_compile(&query, &stream.schema, expression)) {
+        fprintf(stderr, "查询错误：%s\n", query.error);
+        stream_close(&stream);
+        return CMD_ERROR;
+    }
+
+    write_csv_header(&stream.schema, stdout);
+    const StreamChunk *chunk;
+    while ((chunk = stream_next_chunk(&stream)) != NULL) {
+        for (uint32_t base = 0; base < chunk->rows.rows; base += QUERY_BLOCK) {
+            int n = chunk->rows.rows - base < QUERY_BLOCK ? (int)(chunk->rows.rows - base) : QUERY_BLOCK;
+            uint64_t mask = *expression != '\0' ? query_match_chunk(&query, chunk, base, n) : ~(uint64_t)0;
+            for (int i = 0; i < n; i++) {
+                if ((mask >> i) & 1) {
+                    Student s;
+                    stream_get_student(&stream, chunk, base + i, &s);
+                    write_csv_row(&stream.schema, &s, stdout);
+                }
+            }
+        }
+    }
+    status = stream.status;
+    stream_close(&stream);
+    if (status != FILE_OK) {
+        fprintf(stderr, "错误：读取数据文件 %s 失败！\n", FILENAME);
+        return CMD_ERROR;
+    }
+    return CMD_OK;
+}
+
+// 排序结果写为CSV
+static int csv_sink_begin(void *context, const Schema *schema, uint32_t count) {
+    (void)count;
+    *(const Schema **)context = schema;
+    write_csv_header(schema, stdout);
+    return 1;
+}
+
+static int csv_sink_write(void *context, const SortRecord *record) {
+    const Schema *schema = *(const Schema **)context;
+    Student s = {record->id, record->name, record->age, {0}, fixed_to_score(record->average)};
+    for (int k = 0; k < schema->count; k++) {
+        s.scores[k] = fixed_to_score(record->scores[k]);
+    }
+    write_csv_row(schema, &s, stdout);
+    return !ferror(stdout);
+}
+
+// 排序结果写为数据文件
+typedef struct {
+    DataFile data;
+    const char *filename;
+} FileSink;
+
+static int file_sink_begin(void *context, const Schema *schema, uint32_t count) {
+    FileSink *sink = context;
+    return create_data_file(&sink->data, sink->filename, schema, count) == FILE_OK;
+}
+
+static int file_sink_write(void *context, const SortRecord *record) {
+    FileSink *sink = context;
+    write_data_record(&sink->data, record->id, record->name, record->age, record->scores);
+    return 1;
+}
+
+// sort 命令：外部排序数据文件，结果以CSV输出或写为数据文件（--output），不加载全部数据
+static int sort_command(int argc, char *argv[]) {
+    const char *output = NULL;
+    char keys[512] = "";
+    size_t used = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output = argv[++i];
+            continue;
+        }
+        int written = snprintf(keys + used, sizeof(keys) - used, used > 0 ? " %s" : "%s", argv[i]);
+        if (written < 0 || (size_t)written >= sizeof(keys) - used) {
+            fprintf(stderr, "错误：命令参数过长！\n");
+            return CMD_ERROR;
+        }
+        used += written;
+    }
+    if (keys[0] == '\0') {
+        fprintf(stderr, "错误：sort 需要排序键，如 \"average desc, id asc\"！\n");
+        return CMD_ERROR;
+    }
+
+    StudentStream stream;
+    int status = stream_open(&stream, FILENAME);
+    if (status != FILE_OK) {
+        fprintf(stderr, status == FILE_NOT_FOUND ? "错误：数据文件 %s 不存在！\n" : "错误：读取数据文件 %s 失败！\n",
+                FILENAME);
+        return CMD_ERROR;
+    }
+    SortSpec spec;
+    if (!sort_spec_parse(&spec, &stream.schema, keys)) {
+        fprintf(stderr, "排序键错误：%s\n", spec.error);
+        stream_close(&stream);
+        return CMD_ERROR;
+    }
+
+    const Schema *csv_schema = NULL;
+    FileSink file_sink = {{0}, output};
+    SortSink sink = {csv_sink_begin, csv_sink_write, &csv_schema};
+    int lock = -1;
+    if (output != NULL) {
+        // 与保存一样加锁替换输出文件，其他进程据文件头的代数发现这次替换
+        sink = (SortSink){file_sink_begin, file_sink_write, &file_sink};
+        lock = lock_data_file(output);
+    }
+
+    SortReport report = {0};
+    status = output != NULL && lock < 0 ? FILE_WRITE_ERROR : external_sort(&stream, &spec, sort_memory(), &sink, &report);
+    stream_close(&stream);
+    if (output != NULL) {
+        if (status == FILE_OK) {
+            status = commit_data_file(&file_sink.data, output);
+        } else {
+            abort_data_file(&file_sink.data);
+        }
+        unlock_data_file(lock);
+    }
+    if (status != FILE_OK) {
+        if (report.error[0] != '\0') {
+            fprintf(stderr, "错误：排序失败：%s！\n", report.error);
+        } else {
+            fprintf(stderr, "错误：排序失败！\n");
+        }
+        return CMD_ERROR;
+    }
+    FILE *out = output != NULL ? stdout : stderr;
+    if (report.runs == 0) {
+        fprintf(out, "已排序 %u 名学生（在内存中完成）", report.count);
+    } else {
+        fprintf(out, "已排序 %u 名学生（%d 个顺串，归并 %d 趟）", report.count, report.runs, report.passes);
+    }
+    fprintf(out, output != NULL ? "，已写入 %s\n" : "\n", output);
+    return CMD_OK;
+}
+
+// 把一段学生计入统计结果
+static void accumulate_chunk(const StudentStream *stream, const StreamChunk *chunk, Statistics *stats) {
+    const DecodedBlock *rows = &chunk->rows;
+    int first = stats->count == 0;
+    for (int k = 0; k < stream->schema.count; k++) {
+        const uint16_t *column = rows->scores + (size_t)k * rows->rows;
+        if (first) {
+            stats->highest[k] = stats->lowest[k] = column[0];
+        }
+        for (uint32_t i = 0; i < rows->rows; i++) {
+            stats->totals[k] += column[i];
+            stats->highest[k] = column[i] > stats->highest[k] ? column[i] : stats->highest[k];
+            stats->lowest[k] = column[i] < stats->lowest[k] ? column[i] : stats->lowest[k];
+        }
+    }
+    for (uint32_t i = 0; i < rows->rows; i++) {
+        uint16_t average = chunk->averages[i];
+        stats->total_average += average;
+        if ((first && i == 0) || average > stats->max_average) {
+            stats->max_average = average;
+            snprintf(stats->max_id, sizeof(stats->max_id), "%s", rows->ids[i]);
+            snprintf(stats->max_name, sizeof(stats->max_name), "%s", rows->names[i]);
+        }
+        if ((first && i == 0) || average < stats->min_average) {
+            stats->min_average = average;
+            snprintf(stats->min_id, sizeof(stats->min_id), "%s", rows->ids[i]);
+            snprintf(stats->min_name, sizeof(stats->min_name), "%s", rows->names[i]);
+        }
+    }
+    stats->count += (int)rows->rows;
+}
+
+// 流式统计：逐段读取数据文件并累加，不加载全部数据
+static int stream_stats_command(void) {
+    StudentStream stream;
+    int status = stream_open(&stream, FILENAME);
+    if (status == FILE_NOT_FOUND) {
+        printf("系统中没有学生记录！\n");
+        return CMD_OK;
+    }
+    if (status != FILE_OK) {
+        fprintf(stderr, "错误：读取数据文件 %s 失败！\n", FILENAME);
+        return CMD_ERROR;
+    }
+
+    Statistics stats;
+    memset(&stats, 0, sizeof(stats));
+    const StreamChunk *chunk;
+    while ((chunk = stream_next_chunk(&stream)) != NULL) {
+        accumulate_chunk(&stream, chunk, &stats);
+    }
+    status = stream.status;
+    Schema schema = stream.schema;
+    stream_close(&stream);
+
+    if (status != FILE_OK) {
+        fprintf(stderr, "错误：读取数据文件 %s 失败！\n", FILENAME);
+        return CMD_ERROR;
+    }
+    if (stats.count == 0) {
+        printf("系统中没有学生记录！\n");
+        return CMD_OK;
+    }
+    print_statistics(&schema, &stats);
+    return CMD_OK;
+}
+
+// 加载成绩历史，没有历史文件时为空
+static int load_history(History *history) {
+    history_init(history);
+    int status = history_load(history, HISTORY_FILENAME);
+    if (status == FILE_OK && history->truncated > 0) {
+        fprintf(stderr, "警告：历史文件 %s 末尾有 %ld 字节未写完的学期（上次结转中断），已截去。\n",
+                HISTORY_FILENAME, history->truncated);
+    }
+    if (status == FILE_OK || status == FILE_NOT_FOUND) {
+        return 1;
+    }
+    fprintf(stderr, "错误：读取历史文件 %s 失败！\n", HISTORY_FILENAME);
+    return 0;
+}
+
+// 按科目权重计算定点成绩的平均分
+static float weighted_average(const Schema *schema, const uint16_t *scores) {
+    return fixed_to_score(schema_average(schema, scores));
+}
+
+// 打印一行历史成绩：标签、各科、平均分
+static void print_history_row(const Schema *schema, const char *label, const uint16_t *scores) {
+    printf("%-12s", label);
+    for (int k = 0; k < schema->count; k++) {
+        printf(" %-8.2f", fixed_to_score(scores[k]));
+    }
+    printf(" %-8.2f\n", weighted_average(schema, scores));
+}
+
+// 打印历史成绩表头
+static void print_history_header(const Schema *schema, const char *label) {
+    printf("%-12s", label);
+    for (int k = 0; k < schema->count; k++) {
+        printf(" %-8s", subject_label(schema, k));
+    }
+    printf(" %-8s\n", "平均分");
+}
+
+// term 命令：close / list / show
+static int term_command(StudentSystem *system, const char *arg) {
+    char action[16] = "";
+    const char *name = arg + strcspn(arg, " \t");
+    snprintf(action, sizeof(action), "%.*s", (int)(name - arg), arg);
+    while (*name == ' ' || *name == '\t') {
+        name++;
+    }
+
+    History history;
+    if (!load_history(&history)) {
+        return CMD_ERROR;
+    }
+    int status = CMD_OK;
+
+    if (strcmp(action, "close") == 0) {
+        if (*name == '\0' || strlen(name) >= TERM_NAME_LEN) {
+            fprintf(stderr, "错误：term close 需要学期名（少于%d字节）！\n", TERM_NAME_LEN);
+            status = CMD_ERROR;
+        } else if (history_find_term(&history, name) != -1) {
+            fprintf(stderr, "错误：学期 %s 已存在！\n", name);
+            status = CMD_ERROR;
+        } else if (history_close_term(&history, system, name, HISTORY_FILENAME) != FILE_OK) {
+            fprintf(stderr, "错误：无法写入历史文件 %s！\n", HISTORY_FILENAME);
+            status = CMD_ERROR;
+        } else {
+            printf("已将 %d 名学生的成绩结转为学期 %s。\n", system->count, name);
+        }
+    } else if (strcmp(action, "list") == 0) {
+        for (int t = 0; t < history.count; t++) {
+            const Term *term = &history.terms[t];
+            size_t bytes = 0;
+            for (int c = 0; c <= term->schema.count; c++) {
+                bytes += term->columns[c].size;
+            }
+            printf("%-12s %8u 名学生  %d 科  %10zu 字节%s\n", term->name, term->rows, term->schema.count,
+                   bytes, term->keyframe ? "  （关键学期）" : "");
+        }
+        printf("共 %d 个学期，占用内存 %.1f KB\n", history.count, history_memory(&history) / 1024.0);
+    } else if (strcmp(action, "show") == 0) {
+        int t = *name != '\0' ? history_find_term(&history, name) : history.count - 1;
+        TermTable table;
+        if (t == -1) {
+            fprintf(stderr, "错误：没有学期 %s！\n", *name != '\0' ? name : "（尚未结转）");
+            status = CMD_ERROR;
+        } else if (!history_read_term(&history, t, &table)) {
+            fprintf(stderr, "错误：历史文件 %s 已损坏！\n", HISTORY_FILENAME);
+            status = CMD_ERROR;
+        } else {
+            const Schema *schema = &history.terms[t].schema;
+            uint16_t scores[MAX_SUBJECTS];
+            printf("学期 %s：\n", history.terms[t].name);
+            print_history_header(schema, "学号");
+            for (uint32_t i = 0; i < table.rows; i++) {
+                for (int k = 0; k < schema->count; k++) {
+                    scores[k] = table.scores[k][i];
+                }
+                print_history_row(schema, table.ids[i], scores);
+            }
+            term_table_free(&table);
+        }
+    } else {
+        fprintf(stderr, "错误：term 需要 close、list 或 show！\n");
+        status = CMD_ERROR;
+    }
+
+    history_free(&history);
+    return status;
+}
+
+// trend 命令：一名学生各学期的成绩，最后一行为当前成绩
+static int trend_command(StudentSystem *system, const char *id) {
+    History history;
+    if (!load_history(&history)) {
+        return CMD_ERROR;
+    }
+
+    int status = CMD_OK;
+    uint16_t (*scores)[MAX_SUBJECTS] = malloc((history.count + 1) * sizeof(*scores));
+    uint8_t *present = malloc(history.count + 1);
+    if (scores == NULL || present == NULL) {
+        fprintf(stderr, "错误：内存不足！\n");
+        status = CMD_ERROR;
+    } else if (!history_student(&history, id, scores, present)) {
+        fprintf(stderr, "错误：历史文件 %s 已损坏！\n", HISTORY_FILENAME);
+        status = CMD_ERROR;
+    } else {
+        int index = find_student_by_id(system, id);
+        int found = index != -1;
+        if (found) {
+            printf("学号: %s  姓名: %s\n", id, student_name_at(system, index));
+        }
+        // 科目设置变化时重新打印表头
+        const Schema *shown = NULL;
+        for (int t = 0; t < history.count; t++) {
+            if (!present[t]) {
+                continue;
+            }
+            const Schema *schema = &history.terms[t].schema;
+            if (shown == NULL || !schema_same_subjects(shown, schema)) {
+                print_history_header(schema, "学期");
+                shown = schema;
+            }
+            print_history_row(schema, history.terms[t].name, scores[t]);
+            found = 1;
+        }
+        if (index != -1) {
+            if (shown == NULL || !schema_same_subjects(shown, &system->schema)) {
+                print_history_header(&system->schema, "学期");
+            }
+            for (int k = 0; k < system->schema.count; k++) {
+                scores[history.count][k] = score_at(system, k, index);
+            }
+            print_history_row(&system->schema, "当前", scores[history.count]);
+        }
+        if (!found) {
+            printf("未找到学号为 %s 的学生！\n", id);
+        }
+    }
+
+    free(scores);
+    free(present);
+    history_free(&history);
+    return status;
+}
+
+// snapshot 命令：take / list / show / export / restore / drop
+static int snapshot_command(StudentSystem *system, const char *arg, int *modified) {
+    char action[16] = "";
+    const char *name = arg + strcspn(arg, " \t");
+    snprintf(action, sizeof(action), "%.*s", (int)(name - arg), arg);
+    while (*name == ' ' || *name == '\t') {
+        name++;
+    }
+
+    if (strcmp(action, "list") == 0) {
+        for (int i = 0; i < system->snapshot_count; i++) {
+            const Snapshot *snapshot = &system->snapshots[i];
+            char when[32];
+            strftime(when, sizeof(when), "%Y-%m-%d %H:%M:%S", localtime(&snapshot->taken));
+            printf("%-16s %s  %d 名学生\n", snapshot->name, when, snapshot->count);
+        }
+        printf("共 %d 个快照\n", system->snapshot_count);
+        return CMD_OK;
+    }
+
+    if (*name == '\0' || strlen(name) >= SNAPSHOT_NAME_LEN) {
+        fprintf(stderr, "错误：snapshot %s 需要快照名（少于%d字节）！\n", action, SNAPSHOT_NAME_LEN);
+        return CMD_ERROR;
+    }
+    int index = find_snapshot(system, name);
+
+    if (strcmp(action, "take") == 0) {
+        if (index != -1) {
+            fprintf(stderr, "错误：快照 %s 已存在！\n", name);
+            return CMD_ERROR;
+        }
+        if (!keep_snapshot(system, name)) {
+            fprintf(stderr, "错误：内存不足！\n");
+            return CMD_ERROR;
+        }
+        printf("已创建快照 %s（%d 名学生）。\n", name, system->count);
+        return CMD_OK;
+    }
+
+    if (strcmp(action, "show") != 0 && strcmp(action, "export") != 0
+        && strcmp(action, "restore") != 0 && strcmp(action, "drop") != 0) {
+        fprintf(stderr, "错误：snapshot 需要 take、list、show、export、restore 或 drop！\n");
+        return CMD_ERROR;
+    }
+    if (index == -1) {
+        fprintf(stderr, "错误：没有快照 %s！\n", name);
+        return CMD_ERROR;
+    }
+    const Snapshot *snapshot = &system->snapshots[index];
+
+    if (strcmp(action, "show") == 0) {
+        Student s;
+        print_table_header(&snapshot->schema);
+        for (int i = 0; i < snapshot->count; i++) {
+            snapshot_get_student(snapshot, i, &s);
+            print_student_row(&snapshot->schema, &s);
+        }
+    } else if (strcmp(action, "export") == 0) {
+        export_csv(snapshot, NULL, stdout);
+    } else if (strcmp(action, "restore") == 0) {
+        if (!restore_snapshot(system, snapshot)) {
+            fprintf(stderr, "错误：内存不足！\n");
+            return CMD_ERROR;
+        }
+        *modified = 1;
+        printf("已恢复到快照 %s（%d 名学生）。\n", name, system->count);
+    } else {
+        drop_snapshot(system, index);
+        printf("已删除快照 %s。\n", name);
+    }
+    return CMD_OK;
+}
+
+// 加锁保存数据文件，先合并其他进程在加载后的保存；双方修改了同一名学生时不保存
+static int save_merged(StudentSystem *system, int compressed) {
+    MergeReport report;
+    int status = save_data_file(system, FILENAME, compressed, 0, &report);
+    print_merge_report(stderr, &report);
+    if (status == FILE_CONFLICT) {
+        fprintf(stderr, "错误：修改未保存，请重新执行命令！\n");
+        return CMD_ERROR;
+    }
+    if (status != FILE_OK) {
+        fprintf(stderr, "错误：无法保存数据文件 %s！\n", FILENAME);
+        return CMD_ERROR;
+    }
+    return CMD_OK;
+}
+
+// convert 命令：按指定格式重写数据文件
+static int convert_command(StudentSystem *system, const char *format) {
+    int compressed;
+    if (strcmp(format, "compressed") == 0) {
+        compressed = 1;
+    } else if (strcmp(format, "plain") == 0) {
+        compressed = 0;
+    } else {
+        fprintf(stderr, "错误：convert 需要 plain 或 compressed！\n");
+        return CMD_ERROR;
+    }
+
+    if (save_merged(system, compressed) != CMD_OK) {
+        return CMD_ERROR;
+    }
+
+    FILE *file = fopen(FILENAME, "rb");
+    long size = 0;
+    if (file != NULL) {
+        fseek(file, 0, SEEK_END);
+        size = ftell(file);
+        fclose(file);
+    }
+    printf("已将 %d 名学生写为%s格式，文件大小 %.1f KB（读写方式：%s）。\n", system->count, compressed ? "压缩" : "普通",
+           size / 1024.0, fileio_backend());
+    if (compressed != compression_enabled()) {
+        printf("提示：之后保存时的格式由 %s 中的 compress 项决定。\n", CONFIG_FILENAME);
+    }
+    return CMD_OK;
+}
+
+// lookup 命令：不加载数据，直接在数据文件中按学号查找
+static int lookup_command(const char *id) {
+    Schema schema;
+    Student s;
+    char name[STRHEAP_SEGMENT_SIZE];
+    switch (lookup_data_file(FILENAME, id, &schema, &s, name, sizeof(name))) {
+        case FILE_OK:
+            print_student_detail(&schema, &s);
+            printf("平均分: %.2f\n", s.average_score);
+            return CMD_OK;
+        case FILE_NOT_FOUND:
+            printf("未找到学号为 %s 的学生！\n", id);
+            return CMD_ERROR;
+        default:
+            fprintf(stderr, "错误：读取数据文件 %s 失败！\n", FILENAME);
+            return CMD_ERROR;
+    }
+}
+
+// 以一行JSON输出一条变更
+static void print_change(const ChangeRecord *record, void *context) {
+    static const char *const names[] = {"", "insert", "update", "delete", "reset", "schema", "saved", "loaded"};
+    Message *line = context;
+    line->bytes.size = 0;
+    json_put_raw(line, "{\"seq\":");
+    json_put_int(line, (long long)record->seq);
+    json_put_raw(line, ",\"time\":");
+    json_put_int(line, record->time);
+    json_put_raw(line, ",\"op\":");
+    json_put_string(line, record->op >= CHANGE_INSERT && record->op <= CHANGE_LOADED ? names[record->op] : "unknown");
+    if (record->op == CHANGE_SCHEMA) {
+        json_put_raw(line, ",\"subjects\":[");
+        for (int k = 0; k < record->schema->count; k++) {
+            if (k > 0) {
+                message_put_u8(line, ',');
+            }
+            json_put_string(line, subject_key(record->schema, k));
+        }
+        message_put_u8(line, ']');
+    }
+    if (record->op == CHANGE_SAVED) {
+        json_put_raw(line, ",\"position\":");
+        json_put_int(line, (long long)record->position);
+    }
+    if (record->has_before) {
+        json_put_raw(line, ",\"before\":");
+        json_put_student_view(line, record->schema, &record->before);
+    }
+    if (record->has_after) {
+        json_put_raw(line, ",\"after\":");
+        json_put_student_view(line, record->schema, &record->after);
+    }
+    json_put_raw(line, "}\n");
+    fwrite(line->bytes.data, 1, line->bytes.size, stdout);
+}
+
+// changes 命令：从起始序号（默认为保留的最早记录）起以JSON行输出变更流
+static int changes_command(const char *from) {
+    char path[256];
+    if (!change_feed_path(path, sizeof(path))) {
+        fprintf(stderr, "错误：未启用变更流（在 %s 中设置 changefeed）！\n", CONFIG_FILENAME);
+        return CMD_ERROR;
+    }
+    Message line;
+    message_init(&line);
+    uint64_t start = from != NULL ? strtoull(from, NULL, 10) : 0, oldest = 0;
+    int status = read_changes(path, start, print_change, &line, &oldest);
+    message_free(&line);
+    switch (status) {
+        case FEED_OK:
+        case FEED_MISSING:              // 还没有任何变更
+            return CMD_OK;
+        case FEED_GAP:
+            fprintf(stderr, "错误：变更流中没有从序号 %llu 起的记录（最早为 %llu），请重新读取全部数据！\n",
+                    (unsigned long long)start, (unsigned long long)oldest);
+            return CMD_ERROR;
+        default:
+            fprintf(stderr, "错误：读取变更流 %s 失败！\n", path);
+            return CMD_ERROR;
+    }
+}
+
+// replica 命令：以只读副本运行，跟随主服务的数据文件和变更流；不启用本进程的变更流，也不写数据文件
+static int replica_command(StudentSystem *system, int argc, char *argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "错误：replica 需要主服务的数据文件和变更流路径！\n");
+        return CMD_ERROR;
+    }
+    Replica *replica = malloc(sizeof(Replica));
+    if (replica == NULL) {
+        fprintf(stderr, "错误：内存不足！\n");
+        return CMD_ERROR;
+    }
+    int status = CMD_ERROR;
+    if (open_replica(replica, system, argv[1], argv[2])) {
+        char path[256];
+        proto_socket_path(path, sizeof(path));
+        status = run_server(system, path, replica) ? CMD_OK : CMD_ERROR;
+    }
+    free(replica);
+    return status;
+}
+
+// 输出客户端请求失败的原因
+static int client_failed(const Client *client) {
+    fprintf(stderr, "错误：%s！\n", client->error);
+    return CMD_ERROR;
+}
+
+// 逐名显示查找结果
+typedef struct {
+    const Schema *schema;
+    int found;
+} FoundStudents;
+
+static void print_found_student(const Student *s, void *context) {
+    FoundStudents *found = context;
+    if (found->found == 0) {
+        print_table_header(found->schema);
+    }
+    print_student_row(found->schema, s);
+    found->found++;
+}
+
+// 由命令行参数组成学生记录：学号 姓名 年龄 各科成绩
+static int parse_student_args(const Schema *schema, int argc, char *argv[], Student *s) {
+    if (argc != 3 + schema->count) {
+        fprintf(stderr, "错误：需要 学号 姓名 年龄 以及 %d 门科目的成绩！\n", schema->count);
+        return 0;
+    }
+    memset(s, 0, sizeof(*s));
+    s->id = argv[0];
+    s->name = argv[1];
+    s->age = atoi(argv[2]);
+    for (int k = 0; k < schema->count; k++) {
+        char *end;
+        s->scores[k] = strtof(argv[3 + k], &end);
+        if (*end != '\0' || !is_valid_score(s->scores[k])) {
+            fprintf(stderr, "错误：%s成绩不正确！\n", subject_label(schema, k));
+            return 0;
+        }
+    }
+    calculate_average(schema, s);
+    return 1;
+}
+
+// 显示只读副本的复制状态
+static void print_replica_status(const ReplicaStatus *replica) {
+    uint64_t behind = replica->primary > replica->applied ? replica->primary - replica->applied : 0;
+    printf("已应用到序号: %llu\n", (unsigned long long)replica->applied);
+    printf("主服务序号:   %llu（落后 %llu 条）\n", (unsigned long long)replica->primary,
+           (unsigned long long)behind);
+    printf("复制延迟:     %lld 秒\n", (long long)replica->lag_seconds);
+    printf("状态:         %s\n", replica->waiting ? "等待主服务保存后重新加载" : "跟随中");
+    printf("最近检查:     %lld 秒前\n", (long long)(time(NULL) - replica->checked));
+}
+
+// client 命令：向运行中的服务发送一个请求；argv[0] 为 client
+static int client_command(int argc, char *argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "错误：client 需要操作（get/search/stats/add/modify/delete/save/replica/bench）！\n");
+        return CMD_ERROR;
+    }
+    const char *op = argv[1];
+    char path[256];
+    proto_socket_path(path, sizeof(path));
+    if (strcmp(op, "bench") == 0) {
+        int http = argc >= 3 && strcmp(argv[2], "http") == 0;
+        int port = http ? http_port() : 0;
+        if (http && port == 0) {
+            fprintf(stderr, "错误：未配置 http_port！\n");
+            return CMD_ERROR;
+        }
+        int connections = argc >= 3 + http ? atoi(argv[2 + http]) : 4;
+        int seconds = argc >= 4 + http ? atoi(argv[3 + http]) : 3;
+        return run_load_generator(path, port, connections, seconds) ? CMD_OK : CMD_ERROR;
+    }
+    Client *client = malloc(sizeof(Client));
+    if (client == NULL) {
+        fprintf(stderr, "错误：内存不足！\n");
+        return CMD_ERROR;
+    }
+    int status = client_connect(client, path);
+    if (status != PROTO_OK) {
+        client_failed(client);
+        client_close(client);
+        free(client);
+        return CMD_ERROR;
+    }
+
+    int result = CMD_OK;
+    Student s;
+    if (strcmp(op, "get") == 0 && argc == 3) {
+        status = client_get(client, argv[2], &s);
+        if (status == PROTO_OK) {
+            print_student_detail(&client->schema, &s);
+            printf("平均分: %.2f\n", s.average_score);
+        } else if (status == PROTO_NOT_FOUND) {
+            printf("未找到学号为 %s 的学生！\n", argv[2]);
+            result = CMD_ERROR;
+        }
+    } else if (strcmp(op, "search") == 0 && argc >= 3) {
+        char expression[512] = "";
+        size_t used = 0;
+        for (int i = 2; i < argc && used < sizeof(expression); i++) {
+            used += snprintf(expression + used, sizeof(expression) - used, used > 0 ? " %s" : "%s", argv[i]);
+        }
+        FoundStudents found = {&client->schema, 0};
+        status = client_search(client, expression, print_found_student, &found);
+        if (status == PROTO_OK) {
+            printf("共找到 %d 名学生。\n", found.found);
+        }
+    } else if (strcmp(op, "stats") == 0 && argc == 2) {
+        Statistics stats;
+        status = client_stats(client, &stats);
+        if (status == PROTO_OK && stats.count == 0) {
+            printf("系统中没有学生记录！\n");
+        } else if (status == PROTO_OK) {
+            print_statistics(&client->schema, &stats);
+        }
+    } else if ((strcmp(op, "add") == 0 || strcmp(op, "modify") == 0) && argc >= 3) {
+        if (!parse_student_args(&client->schema, argc - 2, argv + 2, &s)) {
+            result = CMD_ERROR;
+        } else {
+            status = op[0] == 'a' ? client_add(client, &s) : client_modify(client, &s);
+            if (status == PROTO_OK) {
+                printf(op[0] == 'a' ? "学生添加成功！\n" : "学生信息修改成功！\n");
+            }
+        }
+    } else if (strcmp(op, "delete") == 0 && argc == 3) {
+        status = client_delete(client, argv[2]);
+        if (status == PROTO_OK) {
+            printf("学生删除成功！\n");
+        }
+    } else if (strcmp(op, "save") == 0 && argc == 2) {
+        status = client_save(client);
+        if (status == PROTO_OK) {
+            printf("数据保存成功！\n");
+        }
+    } else if (strcmp(op, "replica") == 0 && argc == 2) {
+        ReplicaStatus replica;
+        status = client_replica(client, &replica);
+        if (status == PROTO_OK) {
+            print_replica_status(&replica);
+        } else if (status == PROTO_NOT_FOUND) {
+            fprintf(stderr, "错误：服务不是只读副本！\n");
+            result = CMD_ERROR;
+        }
+    } else {
+        fprintf(stderr, "错误：client %s 的参数不正确（使用 help 查看帮助）！\n", op);
+        result = CMD_ERROR;
+    }
+
+    if (result == CMD_OK && status != PROTO_OK) {
+        result = client_failed(client);
+    }
+    client_close(client);
+    free(client);
+    return result;
+}
+
+// import 命令：从CSV文件导入学生，参数为文件名和可选的解析线程数
+static int import_command(StudentSystem *system, const char *arg, int *modified) {
+    char filename[512];
+    snprintf(filename, sizeof(filename), "%s", arg);
+    int workers = 0;
+    char *last = strrchr(filename, ' ');
+    if (last != NULL && last[1] != '\0' && strspn(last + 1, "0123456789") == strlen(last + 1)) {
+        workers = atoi(last + 1);
+        *last = '\0';
+    }
+    if (filename[0] == '\0') {
+        fprintf(stderr, "错误：import 需要CSV文件！\n");
+        return CMD_ERROR;
+    }
+
+    ImportReport report;
+    int status = import_csv(system, filename, workers, &report);
+    if (status != FILE_OK) {
+        fprintf(stderr, "错误：导入 %s 失败：%s！\n", filename, report.error);
+        if (report.inserted > 0) {
+            fprintf(stderr, "已读入 %d 条记录，插入的 %d 名学生%s。\n", report.records, report.inserted,
+                    report.rolled_back ? "已撤销" : "未能撤销（内存不足），数据未保存");
+        }
+        return CMD_ERROR;
+    }
+    if (report.inserted > 0) {
+        *modified = 1;
+    }
+    print_import_report(stdout, &report);
+    return CMD_OK;
+}
+
+// 执行一条命令；modified用于记录数据是否被修改
+static int execute_command(StudentSystem *system, const char *name, const char *arg, int *modified) {
+    if (strcmp(name, "search") == 0) {
+        if (*arg == '\0') {
+            fprintf(stderr, "错误：search 需要查询条件！\n");
+            return CMD_ERROR;
+        }
+        return display_matching_students(system, arg) < 0 ? CMD_ERROR : CMD_OK;
+    }
+
+    if (strcmp(name, "export") == 0) {
+        Selection selection;
+        if (*arg != '\0' && !select_students(system, arg, &selection)) {
+            return CMD_ERROR;
+        }
+        Snapshot snapshot;
+        take_snapshot(system, &snapshot);
+        export_csv(&snapshot, *arg != '\0' ? &selection : NULL, stdout);
+        release_snapshot(&snapshot);
+        if (*arg != '\0') {
+            selection_free(&selection);
+        }
+        return CMD_OK;
+    }
+
+    if (strcmp(name, "delete") == 0) {
+        if (*arg == '\0') {
+            fprintf(stderr, "错误：delete 需要查询条件！\n");
+            return CMD_ERROR;
+        }
+        Selection selection;
+        if (!select_students(system, arg, &selection)) {
+            return CMD_ERROR;
+        }
+        int removed = remove_selected_students(system, &selection);
+        selection_free(&selection);
+        if (removed > 0) {
+            *modified = 1;
+        }
+        printf("已删除 %d 名学生。\n", removed);
+        return CMD_OK;
+    }
+
+    if (strcmp(name, "import") == 0) {
+        return import_command(system, arg, modified);
+    }
+
+    if (strcmp(name, "stats") == 0) {
+        calculate_statistics(system);
+        return CMD_OK;
+    }
+
+    if (strcmp(name, "schema") == 0) {
+        char text[1024];
+        schema_format(&system->schema, text, sizeof(text));
+        printf("科目（名称/别名:权重）: %s\n", text);
+        return CMD_OK;
+    }
+
+    if (strcmp(name, "snapshot") == 0) {
+        return snapshot_command(system, arg, modified);
+    }
+
+    if (strcmp(name, "convert") == 0) {
+        return convert_command(system, arg);
+    }
+
+    if (strcmp(name, "term") == 0) {
+        return term_command(system, arg);
+    }
+
+    if (strcmp(name, "trend") == 0) {
+        if (*arg == '\0') {
+            fprintf(stderr, "错误：trend 需要学号！\n");
+            return CMD_ERROR;
+        }
+        return trend_command(system, arg);
+    }
+
+    if (strcmp(name, "stress") == 0) {
+        int threads = 4, seconds = 3;
+        sscanf(arg, "%d %d", &threads, &seconds);
+        if (seconds < 1) {
+            fprintf(stderr, "错误：测试时间至少1秒！\n");
+            return CMD_ERROR;
+        }
+        return shared_stress(system, threads, seconds) ? CMD_OK : CMD_ERROR;
+    }
+
+    if (strcmp(name, "help") == 0) {
+        print_usage();
+        return CMD_OK;
+    }
+
+    fprintf(stderr, "未知命令: %s（使用 help 查看帮助）\n", name);
+    return CMD_ERROR;
+}
+
+// 加载数据文件，命令行模式下提示输出到stderr
+static int load_quietly(StudentSystem *system) {
+    int status = read_data_file(system, FILENAME);
+    if (status == FILE_OK || status == FILE_NOT_FOUND) {
+        if (!attach_change_feed(system)) {
+            fprintf(stderr, "警告：内存不足，变更流未启用！\n");
+        }
+        return 1;
+    }
+    fprintf(stderr, "错误：读取数据文件 %s 失败！\n", FILENAME);
+    return 0;
+}
+
+// 修改过数据时保存
+static int save_if_modified(StudentSystem *system, int modified) {
+    return modified ? save_merged(system, compression_enabled()) : CMD_OK;
+}
+
+// shm search：在共享内存上就地查询
+static int shm_search(const ShmRoster *roster, const char *expression) {
+    const Schema *schema = &roster->header->schema;
+    Query query;
+    Selection selection;
+    if (!query_compile(&query, schema, expression)) {
+        fprintf(stderr, "查询错误：%s\n", query.error);
+        return CMD_ERROR;
+    }
+    if (!query_execute_shm(&query, roster, &selection)) {
+        fprintf(stderr, "错误：内存不足！\n");
+        return CMD_ERROR;
+    }
+    int found = selection_count(&selection);
+    if (found > 0) {
+        print_table_header(schema);
+        for (int i = 0; i < selection.count; i++) {
+            if (selection_test(&selection, i)) {
+                Student s;
+                shm_get_student(roster, (uint32_t)i, &s);
+                print_student_row(schema, &s);
+            }
+        }
+    }
+    printf("共找到 %d 名学生。\n", found);
+    selection_free(&selection);
+    return CMD_OK;
+}
+
+// shm 命令：publish 加载数据文件后发布到共享内存，其余操作只读挂载已发布的数据
+static int shm_command(StudentSystem *system, int argc, char *argv[]) {
+    char name[SHM_NAME_LEN];
+    shm_default_name(name, sizeof(name));
+    const char *op = argc >= 2 ? argv[1] : "";
+
+    if (strcmp(op, "publish") == 0) {
+        uint64_t generation;
+        if (!load_quietly(system)) {
+            return CMD_ERROR;
+        }
+        if (!shm_publish(system, name, &generation)) {
+            fprintf(stderr, "错误：无法发布到共享内存 %s！\n", name);
+            return CMD_ERROR;
+        }
+        printf("已发布到共享内存 %s：第 %llu 代，%d 名学生\n", name, (unsigned long long)generation, system->count);
+        return CMD_OK;
+    }
+    if (strcmp(op, "remove") == 0) {
+        if (!shm_remove(name)) {
+            fprintf(stderr, "错误：共享内存 %s 中没有已发布的数据！\n", name);
+            return CMD_ERROR;
+        }
+        printf("已删除共享内存 %s\n", name);
+        return CMD_OK;
+    }
+
+    ShmRoster roster;
+    if (!shm_attach(&roster, name)) {
+        fprintf(stderr, "错误：共享内存 %s 中没有已发布的数据（先运行 shm publish）！\n", name);
+        return CMD_ERROR;
+    }
+    const ShmHeader *header = roster.header;
+    int status = CMD_OK;
+    if (strcmp(op, "info") == 0 && argc == 2) {
+        char published[32];
+        strftime(published, sizeof(published), "%Y-%m-%d %H:%M:%S", localtime(&header->published));
+        printf("共享内存 %s：第 %llu 代，%u 名学生，%.1f KB，发布于 %s\n", name,
+               (unsigned long long)header->generation, header->count, header->size / 1024.0, published);
+    } else if (strcmp(op, "get") == 0 && argc == 3) {
+        int index = shm_find_student(&roster, argv[2]);
+        if (index == -1) {
+            printf("未找到学号为 %s 的学生！\n", argv[2]);
+            status = CMD_ERROR;
+        } else {
+            Student s;
+            shm_get_student(&roster, (uint32_t)index, &s);
+            print_student_detail(&header->schema, &s);
+            printf("平均分: %.2f\n", s.average_score);
+        }
+    } else if (strcmp(op, "search") == 0 && argc >= 3) {
+        char expression[512] = "";
+        size_t used = 0;
+        for (int i = 2; i < argc && used < sizeof(expression); i++) {
+            used += snprintf(expression + used, sizeof(expression) - used, used > 0 ? " %s" : "%s", argv[i]);
+        }
+        status = shm_search(&roster, expression);
+    } else if (strcmp(op, "stats") == 0 && argc == 2) {
+        if (header->count == 0) {
+            printf("系统中没有学生记录！\n");
+        } else {
+            print_statistics(&header->schema, &header->stats);
+        }
+    } else {
+        fprintf(stderr, "错误：shm 的参数不正确（使用 help 查看帮助）！\n");
+        status = CMD_ERROR;
+    }
+    shm_detach(&roster);
+    return status;
+}
+
+// 批处理模式：逐行读取并执行命令，空行和#开头的行被忽略
+int run_batch(StudentSystem *system, FILE *input) {
+    char line[512];
+    int modified = 0;
+    int status = CMD_OK;
+
+    while (fgets(line, sizeof(line), input) != NULL) {
+        line[strcspn(line, "\r\n")] = '\0';
+
+        char *name = line;
+        while (*name == ' ' || *name == '\t') {
+            name++;
+        }
+        if (*name == '\0' || *name == '#') {
+            continue;
+        }
+
+        char *arg = name + strcspn(name, " \t");
+        if (*arg != '\0') {
+            *arg++ = '\0';
+            while (*arg == ' ' || *arg == '\t') {
+                arg++;
+            }
+        }
+
+        if (strcmp(name, "batch") == 0) {
+            fprintf(stderr, "错误：batch 不能嵌套使用！\n");
+            status = CMD_ERROR;
+            continue;
+        }
+        if (execute_command(system, name, arg, &modified) != CMD_OK) {
+            status = CMD_ERROR;
+        }
+    }
+
+    if (save_if_modified(system, modified) != CMD_OK) {
+        status = CMD_ERROR;
+    }
+    return status;
+}
+
+// 命令行模式入口：argv[0] 为命令名，其余参数拼接为命令参数
+int run_command_line(StudentSystem *system, int argc, char *argv[]) {
+    if (strcmp(argv[0], "help") == 0 || strcmp(argv[0], "--help") == 0) {
+        print_usage();
+        return CMD_OK;
+    }
+
+    if (strcmp(argv[0], "sort") == 0) {
+        return sort_command(argc, argv);
+    }
+
+    if (strcmp(argv[0], "client") == 0) {
+        return client_command(argc, argv);
+    }
+
+    if (strcmp(argv[0], "shm") == 0) {
+        return shm_command(system, argc, argv);
+    }
+
+    if (strcmp(argv[0], "changes") == 0) {
+        return changes_command(argc >= 2 ? argv[1] : NULL);
+    }
+
+    if (strcmp(argv[0], "replica") == 0) {
+        return replica_command(system, argc, argv);
+    }
+
+    if (strcmp(argv[0], "lookup") == 0) {
+        if (argc < 2) {
+            fprintf(stderr, "错误：lookup 需要学号！\n");
+            return CMD_ERROR;
+        }
+        return lookup_command(argv[1]);
+    }
+
+    // 拼接命令参数，--streaming 单独识别
+    int streaming = 0;
+    char arg[512] = "";
+    size_t used = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--streaming") == 0) {
+            streaming = 1;
+            continue;
+        }
+        int written = snprintf(arg + used, sizeof(arg) - used, used > 0 ? " %s" : "%s", argv[i]);
+        if (written < 0 || (size_t)written >= sizeof(arg) - used) {
+            fprintf(stderr, "错误：命令参数过长！\n");
+            return CMD_ERROR;
+        }
+        used += written;
+    }
+
+    if (streaming) {
+        if (strcmp(argv[0], "stats") == 0) {
+            return stream_stats_command();
+        }
+        if (strcmp(argv[0], "export") == 0) {
+            return stream_export_command(system, arg);
+        }
+        fprintf(stderr, "错误：--streaming 只能用于 stats 和 export！\n");
+        return CMD_ERROR;
+    }
+
+    if (!load_quietly(system)) {
+        return CMD_ERROR;
+    }
+
+    if (strcmp(argv[0], "batch") == 0) {
+        if (argc < 2) {
+            return run_batch(system, stdin);
+        }
+        FILE *input = fopen(argv[1], "r");
+        if (input == NULL) {
+            fprintf(stderr, "错误：无法打开批处理文件 %s！\n", argv[1]);
+            return CMD_ERROR;
+        }
+        int status = run_batch(system, input);
+        fclose(input);
+        return status;
+    }
+
+    if (strcmp(argv[0], "serve") == 0) {
+        char path[256];
+        proto_socket_path(path, sizeof(path));
+        return run_server(system, path, NULL) ? CMD_OK : CMD_ERROR;
+    }
+
+    int modified = 0;
+    int status = execute_command(system, argv[0], arg, &modified);
+    if (status == CMD_OK) {
+        status = save_if_modified(system, modified);
+    }
+    return status;
+}
@@ -0,0 +1,10 @@
+#ifndef CLI_H
+#define CLI_H
+
+#include "student.h"
+
+// 函数声明
+int run_command_line(StudentSystem *system, int argc, char *argv[]);
+int run_batch(StudentSystem *system, FILE *input);
+
+#endif
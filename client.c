@@ -0,0 +1,323 @@
+#define _POSIX_C_SOURCE 200809L
+#include "client.h"
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// 完整发送size字节
+static int send_all(int fd, const uint8_t *data, size_t size) {
+    while (size > 0) {
+        ssize_t n = send(fd, data, size, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return 0;
+        }
+        data += n;
+        size -= (size_t)n;
+    }
+    return 1;
+}
+
+// 完整接收size字节
+static int receive_all(int fd, uint8_t *data, size_t size) {
+    while (size > 0) {
+        ssize_t n = recv(fd, data, size, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return 0;
+        }
+        data += n;
+        size -= (size_t)n;
+    }
+    return 1;
+}
+
+// 在待发送的请求之后开始一个请求帧：写入帧头和操作码
+static void queue_request(Client *client, int op) {
+    client->frame = proto_begin_frame(&client->request);
+    message_put_u8(&client->request, (uint8_t)op);
+}
+
+// 开始一个请求（丢弃未发送的请求）
+static void begin_request(Client *client, int op) {
+    client->request.bytes.size = 0;
+    client->request.failed = 0;
+    queue_request(client, op);
+}
+
+// 写完当前请求帧，过长时撤下该帧并返回PROTO_INVALID
+static int end_request(Client *client) {
+    if (client->request.failed
+        || client->request.bytes.size - client->frame - PROTO_FRAME_HEADER > PROTO_MAX_REQUEST) {
+        client->request.bytes.size = client->frame;
+        client->request.failed = 0;
+        snprintf(client->error, sizeof(client->error), "请求过长");
+        return PROTO_INVALID;
+    }
+    proto_end_frame(&client->request, client->frame);
+    return PROTO_OK;
+}
+
+// 发出全部待发送的请求
+static int send_requests(Client *client) {
+    int ok = send_all(client->fd, client->request.bytes.data, client->request.bytes.size);
+    client->request.bytes.size = 0;
+    if (!ok) {
+        snprintf(client->error, sizeof(client->error), "与服务端的连接中断");
+        return CLIENT_IO_ERROR;
+    }
+    return PROTO_OK;
+}
+
+// 取得状态对应的失败原因
+static void describe_status(Client *client, int status, Reader *reader) {
+    if (status == PROTO_INVALID || status == PROTO_ERROR) {
+        if (!reader_str16(reader, client->error, sizeof(client->error))) {
+            snprintf(client->error, sizeof(client->error), "未知错误");
+        }
+    } else if (status == PROTO_NOT_FOUND) {
+        snprintf(client->error, sizeof(client->error), "学生不存在");
+    } else if (status == PROTO_EXISTS) {
+        snprintf(client->error, sizeof(client->error), "学号已存在");
+    }
+}
+
+// 接收下一个响应，帧体存入client->response，reader定位在状态之后；返回状态
+static int receive_response(Client *client, Reader *reader) {
+    uint8_t header[PROTO_FRAME_HEADER];
+    if (!receive_all(client->fd, header, sizeof(header))) {
+        snprintf(client->error, sizeof(client->error), "与服务端的连接中断");
+        return CLIENT_IO_ERROR;
+    }
+
+    uint32_t length = proto_frame_length(header);
+    client->response.bytes.size = 0;
+    client->response.failed = 0;
+    if (length == 0 || length > PROTO_MAX_RESPONSE) {
+        snprintf(client->error, sizeof(client->error), "响应格式不正确");
+        return CLIENT_IO_ERROR;
+    }
+    if (!message_reserve(&client->response, length)) {
+        snprintf(client->error, sizeof(client->error), "内存不足");
+        return CLIENT_IO_ERROR;
+    }
+    if (!receive_all(client->fd, client->response.bytes.data, length)) {
+        snprintf(client->error, sizeof(client->error), "与服务端的连接中断");
+        return CLIENT_IO_ERROR;
+    }
+    client->response.bytes.size = length;
+
+    reader_init(reader, client->response.bytes.data, length);
+    int status = reader_u8(reader);
+    describe_status(client, status, reader);
+    return status;
+}
+
+// 发送请求并接收响应，reader定位在状态之后；返回状态
+static int call(Client *client, Reader *reader) {
+    int status = end_request(client);
+    if (status == PROTO_OK) {
+        status = send_requests(client);
+    }
+    return status == PROTO_OK ? receive_response(client, reader) : status;
+}
+
+// 响应内容不完整
+static int malformed(Client *client) {
+    snprintf(client->error, sizeof(client->error), "响应格式不正确");
+    return CLIENT_IO_ERROR;
+}
+
+// 连接服务端并取得科目设置，成功返回PROTO_OK
+int client_connect(Client *client, const char *path) {
+    memset(client, 0, sizeof(*client));
+    client->fd = -1;
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(address.sun_path)) {
+        snprintf(client->error, sizeof(client->error), "套接字路径过长");
+        return CLIENT_IO_ERROR;
+    }
+    strcpy(address.sun_path, path);
+
+    client->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (client->fd < 0 || connect(client->fd, (struct sockaddr *)&address, sizeof(address)) != 0) {
+        snprintf(client->error, sizeof(client->error), "无法连接 %s（服务未启动？）", path);
+        return CLIENT_IO_ERROR;
+    }
+
+    Reader reader;
+    begin_request(client, PROTO_SCHEMA);
+    int status = call(client, &reader);
+    if (status == PROTO_OK && !proto_get_schema(&reader, &client->schema)) {
+        status = malformed(client);
+    }
+    return status;
+}
+
+void client_close(Client *client) {
+    if (client->fd >= 0) {
+        close(client->fd);
+    }
+    message_free(&client->request);
+    message_free(&client->response);
+    client->fd = -1;
+}
+
+// 按学号取一名学生
+int client_get(Client *client, const char *id, Student *out) {
+    Reader reader;
+    begin_request(client, PROTO_GET);
+    message_put_str8(&client->request, id);
+    int status = call(client, &reader);
+    if (status == PROTO_OK && !proto_get_student(&reader, out, client->id, client->name, sizeof(client->name))) {
+        status = malformed(client);
+    }
+    return status;
+}
+
+// 按条件查找，对每名符合条件的学生调用visit
+int client_search(Client *client, const char *expression,
+                  void (*visit)(const Student *s, void *context), void *context) {
+    Reader reader;
+    begin_request(client, PROTO_SEARCH);
+    message_put_str16(&client->request, expression);
+    int status = call(client, &reader);
+    if (status != PROTO_OK) {
+        return status;
+    }
+    uint32_t count = reader_u32(&reader);
+    for (uint32_t i = 0; i < count; i++) {
+        Student s;
+        if (!proto_get_student(&reader, &s, client->id, client->name, sizeof(client->name))) {
+            return malformed(client);
+        }
+        visit(&s, context);
+    }
+    return reader.failed ? malformed(client) : PROTO_OK;
+}
+
+int client_stats(Client *client, Statistics *stats) {
+    Reader reader;
+    begin_request(client, PROTO_STATS);
+    int status = call(client, &reader);
+    if (status == PROTO_OK && !proto_get_statistics(&reader, client->schema.count, stats)) {
+        status = malformed(client);
+    }
+    return status;
+}
+
+// 发送一个只带学生记录的修改请求
+static int send_student(Client *client, int op, const Student *s) {
+    Reader reader;
+    begin_request(client, op);
+    proto_put_student(&client->request, client->schema.count, s);
+    return call(client, &reader);
+}
+
+int client_add(Client *client, const Student *s) {
+    return send_student(client, PROTO_ADD, s);
+}
+
+int client_modify(Client *client, const Student *s) {
+    return send_student(client, PROTO_MODIFY, s);
+}
+
+int client_delete(Client *client, const char *id) {
+    Reader reader;
+    begin_request(client, PROTO_DELETE);
+    message_put_str8(&client->request, id);
+    return call(client, &reader);
+}
+
+// 请求服务端保存数据文件
+int client_save(Client *client) {
+    Reader reader;
+    begin_request(client, PROTO_SAVE);
+    return call(client, &reader);
+}
+
+// 取只读副本的复制状态；服务不是副本时返回 PROTO_NOT_FOUND
+int client_replica(Client *client, ReplicaStatus *replica) {
+    Reader reader;
+    begin_request(client, PROTO_REPLICA);
+    int status = call(client, &reader);
+    if (status == PROTO_OK && !proto_get_replica(&reader, replica)) {
+        status = malformed(client);
+    }
+    return status;
+}
+
+// 排入一个按学号查询的请求（暂不发送）
+int client_queue_get(Client *client, const char *id) {
+    queue_request(client, PROTO_GET);
+    message_put_str8(&client->request, id);
+    return end_request(client);
+}
+
+// 发出已排入的请求
+int client_flush(Client *client) {
+    return send_requests(client);
+}
+
+// 取回下一个按学号查询的响应
+int client_receive_get(Client *client, Student *out) {
+    Reader reader;
+    int status = receive_response(client, &reader);
+    if (status == PROTO_OK && !proto_get_student(&reader, out, client->id, client->name, sizeof(client->name))) {
+        status = malformed(client);
+    }
+    return status;
+}
+
+// 批量按学号查询；整批失败时返回相应状态，各查询自身的状态交给visit
+int client_get_batch(Client *client, const char *const *ids, int count,
+                     void (*visit)(int index, int status, const Student *s, void *context), void *context) {
+    if (count < 0 || count > PROTO_MAX_BATCH) {
+        snprintf(client->error, sizeof(client->error), "一批最多 %d 个请求", PROTO_MAX_BATCH);
+        return PROTO_INVALID;
+    }
+    Reader reader;
+    begin_request(client, PROTO_BATCH);
+    message_put_u16(&client->request, (uint16_t)count);
+    for (int i = 0; i < count; i++) {
+        size_t start = proto_begin_frame(&client->request);
+        message_put_u8(&client->request, PROTO_GET);
+        message_put_str8(&client->request, ids[i]);
+        proto_end_frame(&client->request, start);
+    }
+    int status = call(client, &reader);
+    if (status != PROTO_OK) {
+        return status;
+    }
+    if (reader_u16(&reader) != count) {
+        return malformed(client);
+    }
+    for (int i = 0; i < count; i++) {
+        uint32_t length = reader_u32(&reader);
+        const uint8_t *body = reader_bytes(&reader, length);
+        if (body == NULL || length == 0) {
+            return malformed(client);
+        }
+        Reader item;
+        reader_init(&item, body, length);
+        Student s;
+        int result = reader_u8(&item);
+        if (result == PROTO_OK) {
+            if (!proto_get_student(&item, &s, client->id, client->name, sizeof(client->name))) {
+                return malformed(client);
+            }
+            visit(i, result, &s, context);
+        } else {
+            describe_status(client, result, &item);
+            visit(i, result, NULL, context);
+        }
+    }
+    return PROTO_OK;
+}
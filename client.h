@@ -0,0 +1,44 @@
+#ifndef CLIENT_H
+#define CLIENT_H
+
+#include "student.h"
+#include "protocol.h"
+
+#define CLIENT_IO_ERROR (-1)        // 连接失败或中断（其余结果为 PROTO_* 状态）
+
+// 服务模式的客户端。连接时取得科目设置，学生记录按此解析；
+// 返回的学生记录中的学号和姓名指向客户端内的缓冲区，下一次请求前有效
+typedef struct {
+    int fd;
+    Schema schema;
+    Message request;                // 待发送的请求帧（流水线时可有多个）
+    size_t frame;                   // 正在填写的请求帧在request中的起点
+    Message response;               // 最近一次响应的帧体
+    char error[MAX_NAME_LEN];       // 最近一次失败的原因
+    char id[MAX_ID_LEN];
+    char name[STRHEAP_SEGMENT_SIZE];
+} Client;
+
+// 函数声明
+int client_connect(Client *client, const char *path);
+void client_close(Client *client);
+int client_get(Client *client, const char *id, Student *out);
+int client_search(Client *client, const char *expression,
+                  void (*visit)(const Student *s, void *context), void *context);
+int client_stats(Client *client, Statistics *stats);
+int client_add(Client *client, const Student *s);
+int client_modify(Client *client, const Student *s);
+int client_delete(Client *client, const char *id);
+int client_save(Client *client);
+int client_replica(Client *client, ReplicaStatus *replica);
+
+// 流水线：先排入若干请求，一次发出，再按顺序逐个取回响应
+int client_queue_get(Client *client, const char *id);
+int client_flush(Client *client);
+int client_receive_get(Client *client, Student *out);
+
+// 批量：多个按学号查询放在一个请求帧中，visit按顺序收到每个查询的状态和结果（不存在时为NULL）
+int client_get_batch(Client *client, const char *const *ids, int count,
+                     void (*visit)(int index, int status, const Student *s, void *context), void *context);
+
+#endif
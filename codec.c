@@ -0,0 +1,215 @@
+#include "codec.h"
+#include <stdlib.h>
+#include <string.h>
+
+// 确保还能追加extra字节，成功返回1
+int buffer_reserve(ByteBuffer *buffer, size_t extra) {
+    if (buffer->size + extra <= buffer->capacity) {
+        return 1;
+    }
+    size_t capacity = buffer->capacity ? buffer->capacity * 2 : 256;
+    while (capacity < buffer->size + extra) {
+        capacity *= 2;
+    }
+    uint8_t *data = realloc(buffer->data, capacity);
+    if (data == NULL) {
+        return 0;
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+    return 1;
+}
+
+// 追加一段字节
+int buffer_append(ByteBuffer *buffer, const void *data, size_t len) {
+    if (!buffer_reserve(buffer, len)) {
+        return 0;
+    }
+    memcpy(buffer->data + buffer->size, data, len);
+    buffer->size += len;
+    return 1;
+}
+
+// 追加一个变长整数（每字节7位，最高位表示后面还有字节）
+int buffer_put_varint(ByteBuffer *buffer, uint64_t value) {
+    if (!buffer_reserve(buffer, 10)) {
+        return 0;
+    }
+    while (value >= 0x80) {
+        buffer->data[buffer->size++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    buffer->data[buffer->size++] = (uint8_t)value;
+    return 1;
+}
+
+// 释放多余的容量（数据写完后长期保存时使用）
+void buffer_shrink(ByteBuffer *buffer) {
+    if (buffer->size == 0 || buffer->size == buffer->capacity) {
+        return;
+    }
+    uint8_t *data = realloc(buffer->data, buffer->size);
+    if (data != NULL) {
+        buffer->data = data;
+        buffer->capacity = buffer->size;
+    }
+}
+
+// 释放缓冲区
+void buffer_free(ByteBuffer *buffer) {
+    free(buffer->data);
+    memset(buffer, 0, sizeof(*buffer));
+}
+
+// 读取一个变长整数并前移读位置，数据不完整时返回0
+int get_varint(const uint8_t **pos, const uint8_t *end, uint64_t *value) {
+    uint64_t result = 0;
+    int shift = 0;
+    const uint8_t *p = *pos;
+    while (p < end && shift < 64) {
+        uint8_t byte = *p++;
+        result |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            *pos = p;
+            *value = result;
+            return 1;
+        }
+        shift += 7;
+    }
+    return 0;
+}
+
+// LZ压缩：字节流由若干序列组成，每个序列为
+//   标记字节（高4位字面量长度，低4位匹配长度-4，取15时后接255递增的扩展字节）、字面量、
+//   2字节匹配距离；最后一个序列只有字面量。匹配用4字节哈希查找最近一次出现的位置
+#define LZ_MIN_MATCH 4
+#define LZ_LAST_LITERALS 5          // 末尾至少保留的字面量字节，保证最后一个序列只有字面量
+#define LZ_HASH_BITS 13
+#define LZ_MAX_DISTANCE 65535
+
+static uint32_t read32(const uint8_t *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// 写入长度的扩展字节
+static void put_length(uint8_t **op, size_t length) {
+    while (length >= 255) {
+        *(*op)++ = 255;
+        length -= 255;
+    }
+    *(*op)++ = (uint8_t)length;
+}
+
+// 压缩src追加到out，成功返回1
+int lz_compress(const uint8_t *src, size_t size, ByteBuffer *out) {
+    // 最坏情况下每255字节字面量多1字节长度
+    if (!buffer_reserve(out, size + size / 255 + 16)) {
+        return 0;
+    }
+    uint32_t table[1 << LZ_HASH_BITS];
+    memset(table, 0, sizeof(table));
+    uint8_t *op = out->data + out->size;
+    size_t anchor = 0, i = 0;
+
+    while (size >= LZ_LAST_LITERALS + LZ_MIN_MATCH && i + LZ_MIN_MATCH + LZ_LAST_LITERALS <= size) {
+        uint32_t seq = read32(src + i);
+        uint32_t h = (seq * 2654435761u) >> (32 - LZ_HASH_BITS);
+        size_t ref = table[h];
+        table[h] = (uint32_t)i;
+        if (ref >= i || i - ref > LZ_MAX_DISTANCE || read32(src + ref) != seq) {
+            i++;
+            continue;
+        }
+
+        size_t match = LZ_MIN_MATCH;
+        while (i + match + LZ_LAST_LITERALS < size && src[ref + match] == src[i + match]) {
+            match++;
+        }
+        size_t literals = i - anchor;
+        uint8_t *token = op++;
+        *token = (uint8_t)((literals >= 15 ? 15 : literals) << 4);
+        if (literals >= 15) {
+            put_length(&op, literals - 15);
+        }
+        memcpy(op, src + anchor, literals);
+        op += literals;
+        *op++ = (uint8_t)((i - ref) & 0xff);
+        *op++ = (uint8_t)((i - ref) >> 8);
+        size_t extra = match - LZ_MIN_MATCH;
+        *token |= (uint8_t)(extra >= 15 ? 15 : extra);
+        if (extra >= 15) {
+            put_length(&op, extra - 15);
+        }
+        i += match;
+        anchor = i;
+    }
+
+    size_t literals = size - anchor;
+    *op++ = (uint8_t)((literals >= 15 ? 15 : literals) << 4);
+    if (literals >= 15) {
+        put_length(&op, literals - 15);
+    }
+    memcpy(op, src + anchor, literals);
+    op += literals;
+    out->size = (size_t)(op - out->data);
+    return 1;
+}
+
+// 读取长度的扩展字节
+static int get_length(const uint8_t **ip, const uint8_t *end, size_t *length) {
+    uint8_t byte;
+    do {
+        if (*ip >= end) {
+            return 0;
+        }
+        byte = *(*ip)++;
+        *length += byte;
+    } while (byte == 255);
+    return 1;
+}
+
+// 解压到dst，解压后长度须恰为dst_size；数据损坏时返回0
+int lz_decompress(const uint8_t *src, size_t size, uint8_t *dst, size_t dst_size) {
+    const uint8_t *ip = src, *end = src + size;
+    uint8_t *op = dst, *op_end = dst + dst_size;
+
+    while (ip < end) {
+        uint8_t token = *ip++;
+        size_t literals = token >> 4;
+        if (literals == 15 && !get_length(&ip, end, &literals)) {
+            return 0;
+        }
+        if (literals > (size_t)(end - ip) || literals > (size_t)(op_end - op)) {
+            return 0;
+        }
+        memcpy(op, ip, literals);
+        ip += literals;
+        op += literals;
+        if (ip == end) {
+            break;
+        }
+
+        if (end - ip < 2) {
+            return 0;
+        }
+        size_t distance = ip[0] | (size_t)ip[1] << 8;
+        ip += 2;
+        size_t match = token & 15;
+        if (match == 15 && !get_length(&ip, end, &match)) {
+            return 0;
+        }
+        match += LZ_MIN_MATCH;
+        if (distance == 0 || distance > (size_t)(op - dst) || match > (size_t)(op_end - op)) {
+            return 0;
+        }
+        // 匹配可能与输出重叠，逐字节复制
+        const uint8_t *ref = op - distance;
+        for (size_t j = 0; j < match; j++) {
+            op[j] = ref[j];
+        }
+        op += match;
+    }
+    return op == op_end;
+}
@@ -0,0 +1,28 @@
+#ifndef CODEC_H
+#define CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 可增长的字节缓冲区
+typedef struct {
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+} ByteBuffer;
+
+// 函数声明
+int buffer_reserve(ByteBuffer *buffer, size_t extra);
+int buffer_append(ByteBuffer *buffer, const void *data, size_t len);
+int buffer_put_varint(ByteBuffer *buffer, uint64_t value);
+void buffer_shrink(ByteBuffer *buffer);
+void buffer_free(ByteBuffer *buffer);
+int get_varint(const uint8_t **pos, const uint8_t *end, uint64_t *value);
+int lz_compress(const uint8_t *src, size_t size, ByteBuffer *out);
+int lz_decompress(const uint8_t *src, size_t size, uint8_t *dst, size_t dst_size);
+
+// zigzag编码：把有符号差值映射为小的无符号数（0,-1,1,-2... -> 0,1,2,3...）
+#define zigzag_encode(v) (((uint64_t)(v) << 1) ^ (uint64_t)((int64_t)(v) >> 63))
+#define zigzag_decode(u) ((int64_t)((u) >> 1) ^ -(int64_t)((u) & 1))
+
+#endif
@@ -0,0 +1,133 @@
+#define _POSIX_C_SOURCE 200809L
+#include "collate.h"
+#include "config.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+
+// 姓名的排序键：每个字符换成一个排序单元，ASCII字符1字节（原值），其余字符3字节（首字节不小于0x80），
+// 键中不含'\0'，按字节比较（strcmp/memcmp）即为按排序方式比较。
+// 表中的汉字按其在排序表中的序号排在最后；其余字符按码位，非法的UTF-8字节排在所有码位之后
+
+#define CJK_FIRST 0x4E00
+#define CJK_COUNT 0x5200            // 基本区 U+4E00-U+9FFF
+#define INVALID_BASE 0x110000       // 非法字节b按码位 INVALID_BASE + b 处理
+
+static int mode = COLLATE_PINYIN;
+static uint16_t weights[CJK_COUNT]; // 汉字在排序表中的序号（从1开始），0表示不在表中
+static pthread_once_t loaded = PTHREAD_ONCE_INIT;
+
+// 解码一个UTF-8字符并前移*text，非法字节单独成为一个字符
+static uint32_t next_char(const unsigned char **text) {
+    const unsigned char *s = *text;
+    uint32_t c = s[0];
+    int extra = c >= 0xF0 && c <= 0xF4 ? 3 : c >= 0xE0 ? 2 : c >= 0xC2 && c < 0xE0 ? 1 : 0;
+    if (c >= 0x80 && extra == 0) {
+        *text = s + 1;
+        return INVALID_BASE + c;
+    }
+    uint32_t code = extra == 3 ? c & 0x07 : extra == 2 ? c & 0x0F : extra == 1 ? c & 0x1F : c;
+    for (int i = 1; i <= extra; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            *text = s + 1;
+            return INVALID_BASE + c;
+        }
+        code = (code << 6) | (s[i] & 0x3F);
+    }
+    *text = s + 1 + extra;
+    return code;
+}
+
+// 读取配置并由排序表建立序号表（只执行一次）
+static void load_tables(void) {
+    char value[32];
+    if (config_get("name_order", value, sizeof(value))) {
+        if (strcmp(value, "stroke") == 0 || strcmp(value, "笔画") == 0) {
+            mode = COLLATE_STROKE;
+        } else if (strcmp(value, "bytes") == 0 || strcmp(value, "字节") == 0) {
+            mode = COLLATE_BYTES;
+        }
+    }
+    if (mode == COLLATE_BYTES) {
+        return;
+    }
+
+    const unsigned char *order = (const unsigned char *)(mode == COLLATE_STROKE ? collate_stroke_order
+                                                                                : collate_pinyin_order);
+    uint16_t weight = 0;
+    while (*order) {
+        uint32_t c = next_char(&order);
+        if (c >= CJK_FIRST && c < CJK_FIRST + CJK_COUNT) {
+            weights[c - CJK_FIRST] = ++weight;
+        }
+    }
+}
+
+// 当前的姓名排序方式
+int collate_mode(void) {
+    pthread_once(&loaded, load_tables);
+    return mode;
+}
+
+// 下一个字符的排序单元（按3字节大端读出的值，ASCII字符为 值<<16），字符串结束时为0
+static uint32_t next_unit(const unsigned char **text) {
+    if (**text == '\0') {
+        return 0;
+    }
+    uint32_t c = next_char(text);
+    if (c < 0x80) {
+        return c << 16;
+    }
+    uint32_t weight = c >= CJK_FIRST && c < CJK_FIRST + CJK_COUNT ? weights[c - CJK_FIRST] : 0;
+    if (weight != 0) {
+        return (0xE0u + (weight >> 14)) << 16 | (0x80 | ((weight >> 7) & 0x7F)) << 8 | (0x80 | (weight & 0x7F));
+    }
+    return (0x80u + (c >> 14)) << 16 | (0x80 | ((c >> 7) & 0x7F)) << 8 | (0x80 | (c & 0x7F));
+}
+
+// 计算字符串的排序键写入key（至多size-1字节，以'\0'结尾），返回完整的键长（不含'\0'）
+size_t collate_key(const char *text, char *key, size_t size) {
+    if (collate_mode() == COLLATE_BYTES) {
+        size_t len = strlen(text);
+        if (size > 0) {
+            size_t n = len < size - 1 ? len : size - 1;
+            memcpy(key, text, n);
+            key[n] = '\0';
+        }
+        return len;
+    }
+
+    const unsigned char *s = (const unsigned char *)text;
+    size_t len = 0;
+    uint32_t unit;
+    while ((unit = next_unit(&s)) != 0) {
+        unsigned char bytes[3] = {unit >> 16, (unit >> 8) & 0xFF, unit & 0xFF};
+        int n = unit < 0x800000 ? 1 : 3;
+        for (int i = 0; i < n; i++, len++) {
+            if (len + 1 < size) {
+                key[len] = (char)bytes[i];
+            }
+        }
+    }
+    if (size > 0) {
+        key[len < size ? len : size - 1] = '\0';
+    }
+    return len;
+}
+
+// 按排序方式比较两个字符串，结果与比较二者的排序键相同（逐字符计算，不需要缓冲区）
+int collate_compare(const char *a, const char *b) {
+    if (collate_mode() == COLLATE_BYTES) {
+        return strcmp(a, b);
+    }
+    const unsigned char *x = (const unsigned char *)a, *y = (const unsigned char *)b;
+    for (;;) {
+        uint32_t ux = next_unit(&x), uy = next_unit(&y);
+        if (ux != uy) {
+            return ux < uy ? -1 : 1;
+        }
+        if (ux == 0) {
+            return 0;
+        }
+    }
+}
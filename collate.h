@@ -0,0 +1,24 @@
+#ifndef COLLATE_H
+#define COLLATE_H
+
+#include <stddef.h>
+
+#define COLLATE_KEY_LEN(len) ((len) * 3 + 1) // 长度为len的字符串的排序键最多占用的字节（含结尾的'\0'）
+
+// 姓名排序方式（配置项 name_order）
+enum {
+    COLLATE_PINYIN = 0,         // 按拼音（默认）
+    COLLATE_STROKE,             // 按笔画
+    COLLATE_BYTES               // 按UTF-8字节
+};
+
+// 排序表（collate_table.c）
+extern const char collate_pinyin_order[];
+extern const char collate_stroke_order[];
+
+// 函数声明
+int collate_mode(void);
+size_t collate_key(const char *text, char *key, size_t size);
+int collate_compare(const char *a, const char *b);
+
+#endif
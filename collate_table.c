@@ -0,0 +1,1316 @@
+// 汉字排序表：按拼音和按笔画排列的基本区汉字（U+4E00-U+9FFF），与 CLDR 中文排序规则的顺序一致。
+// collate.c 首次使用时由此建立每个汉字的序号表；表中没有的汉字按码位排在所有表中汉字之前
+#include "collate.h"
+
+// 按拼音排列
+const char collate_pinyin_order[] =
+    "阿呵锕嗄啊哎哀唉埃娭挨欸溾嗳銰锿噯鎄啀捱皑溰嘊敱敳皚癌騃毐昹娾矮"
+    "蔼躷濭藹霭靄艾伌爱砹硋隘嗌塧嫒愛碍叆暧瑷閡僾壒嬡懓薆鴱懝曖璦餲皧"
+    "瞹馤礙譪譺鑀靉鱫安侒峖桉氨庵菴谙媕萻葊痷腤鹌蓭誝鞌鞍盦諳馣盫鵪韽"
+    "鶕玵啽雸儑垵俺唵埯铵隌揞罯銨犴岸按洝荌案胺豻堓婩晻暗錌闇鮟黯肮骯"
+    "卬岇昂昻枊盎醠凹柪梎軪爊敖厫隞嗷嗸嶅廒滶獓蔜遨摮熬獒璈磝翱聱螯謷"
+    "謸翺鳌鏖鰲鷔鼇抝芺拗袄镺媪媼襖岙扷坳垇岰傲奡奥奧嫯慠骜隩墺嶴懊澳"
+    "擙鏊驁翶八仈扒朳玐夿岜芭峇柭疤哵巼捌粑羓蚆釛釟豝鲃叐犮抜坺妭拔茇"
+    "炦癹胈菝詙跋軷颰魃墢鼥把钯鈀靶坝弝爸垻耙跁鲅鲌鮊覇矲霸壩灞欛巴叭"
+    "吧笆紦罢魞罷挀掰擘白百佰柏栢捭瓸粨絔摆擺襬庍拝败拜敗猈稗蛽粺贁韛"
+    "竡薭扳攽班般颁斑搬斒頒瘢鳻螌褩癍辬阪坂岅昄板版瓪钣粄舨鈑蝂魬闆办"
+    "半伴坢姅怑拌绊柈秚湴絆鉡靽辦瓣扮螁邦垹帮捠梆浜邫幇幚縍幫鞤绑綁榜"
+    "牓膀髈玤蚌傍棒棓谤塝搒稖蒡蜯磅镑艕謗鎊勹包孢苞枹胞笣煲龅蕔褒襃闁"
+    "齙窇嫑雹薄宝怉饱保鸨宲珤堡堢媬葆寚飽褓駂鳵緥鴇賲寳寶靌勽报抱豹趵"
+    "铇菢蚫袌報鉋鲍靤骲暴髱虣鮑儤曓爆忁鑤鸔佨藵陂卑杯盃桮悲揹椑禆碑鹎"
+    "錃藣鵯北鉳贝孛狈貝邶备昁牬苝背郥钡俻倍悖狽被偝偹梖珼鄁備僃惫焙琲"
+    "軰辈愂碚蓓犕褙誖鞁骳輩鋇憊糒鞴鐾呗唄禙奔泍贲栟犇锛錛本苯奙畚翉楍"
+    "坋坌倴捹桳渀笨逩撪獖輽伻祊奟崩絣閍傰嵭痭嘣綳甭埄埲绷菶琣琫繃鞛泵"
+    "迸逬塴甏镚蹦鏰蠯揼屄偪毴逼楅豍螕鵖鲾鎞鰏荸鼻匕比夶朼佊吡妣沘疕彼"
+    "柀秕俾笔粃舭啚筆鄙箄聛貏币必毕闭佖坒庇诐邲妼怭怶枈畀苾哔柲毖珌疪"
+    "荜陛毙狴畢笓粊袐铋婢庳敝梐萆閇閉堛弻弼愊愎湢皕筚詖貱賁赑嗶彃滗滭"
+    "煏痹痺睤腷蓖蓽蜌裨跸鉍閟飶幣弊熚獙碧箅箆綼蔽鄪馝潷獘罼駜髲壁嬖廦"
+    "篦篳縪薜觱避鮅斃濞臂蹕髀奰璧鄨鏎饆繴襞襣鞸韠魓躃躄驆贔鐴鷝鷩鼊匂"
+    "萞幤襅嬶边辺砭笾揙猵编煸牑甂箯編蝙邉鍽鳊邊鞭鯾鯿籩贬扁窆匾貶惼萹"
+    "碥稨褊糄鴘藊卞弁匥忭抃汳汴苄釆变玣便変昪覍徧缏遍閞辡緶艑辧辨辩辫"
+    "辮辯變峅炞灬杓标飑骉髟淲彪猋脿颩墂幖摽滮蔈颮骠標熛膘瘭磦镖飙飚儦"
+    "颷瀌藨謤爂臕贆鏢穮镳飆飇飈驃鑣驫表婊裱諘褾錶檦俵鳔鰾飊憋蟞鳖鱉鼈"
+    "虌龞別别咇莂蛂徶襒蹩瘪癟彆汃邠玢砏宾彬梹傧斌椕滨缤槟瑸豩賓賔镔儐"
+    "濒濱虨豳檳璸瀕霦繽鑌顮摈殡膑髩擯鬂殯臏髌鬓髕鬢氞濵冫仌仒氷冰兵掤"
+    "丙邴陃怲抦秉苪昞昺柄炳饼眪窉蛃摒禀稟鈵鉼餅餠鞞并並併幷庰倂栤病竝"
+    "偋傡寎棅誁鮩靐垪鞆鋲癶帗拨波癷玻剝剥哱盋砵袚钵饽紴缽菠袰碆鉢僠嶓"
+    "撥播餑鮁蹳驋鱍仢伯犻肑驳帛狛瓝苩侼勃胉郣亳挬浡瓟秡袯钹铂脖舶袹博"
+    "渤葧鹁愽搏猼鈸鉑馎僰煿牔箔艊蔔馛駁踣鋍镈馞駮襏豰嚗懪礡簙鎛餺鵓犦"
+    "髆髉欂襮礴鑮跛箥簸孹檗糪譒蘗卜啵萡膊峬庯逋晡鈽誧鳪轐醭卟补哺捕喸"
+    "補鵏不布佈吥步咘怖抪歨歩柨钚勏埔埗悑捗荹部钸埠瓿蔀踄郶餔篰餢簿嚓"
+    "擦攃礤遪囃偲婇猜才犲材财財裁溨纔毝采倸啋寀彩採睬跴綵踩埰菜棌蔡縩"
+    "参參叄飡骖叅喰湌傪嬠餐驂残蚕惭殘慚蝅慙嬱蠶蠺惨朁慘憯穇篸黪黲灿掺"
+    "孱粲摻澯薒燦璨謲儏爘仓仺伧沧苍鸧倉舱傖嵢滄獊蒼艙螥鶬藏鑶賶濸罉欌"
+    "撡操糙曺曹嘈嶆漕蓸槽褿艚螬鏪艸草愺懆騲肏鄵襙艹冊册侧厕恻拺测敇畟"
+    "側厠笧粣萗廁惻測策萴筞筴蓛墄箣憡簎嵾岑涔笒梣曽噌层曾層嶒竲驓蹭叉"
+    "扠杈肞臿挿偛嗏插揷馇銟锸艖疀鍤餷秅垞查茬茶嵖搽猹靫槎詧察碴檫衩蹅"
+    "镲鑔奼汊岔侘诧姹差紁詫芆拆钗釵侪柴豺祡喍儕齜茝虿袃訍瘥蠆囆辿觇梴"
+    "搀覘裧鉆鋓幨襜攙婵谗棎湹禅馋煘缠僝獑蝉誗鋋儃嬋廛潹潺緾澶磛禪毚鄽"
+    "镡瀍蟬儳劖蟾酁嚵巉瀺欃纏纒躔镵艬讒鑱饞产刬旵丳斺浐剗谄啴產産铲阐"
+    "蒇剷嵼摌滻嘽幝蕆諂閳骣燀簅冁繟譂辴鏟闡囅灛讇忏硟摲懴颤懺羼韂顫壥"
+    "伥昌倀娼淐猖菖阊晿琩裮锠錩閶鲳鯧鼚仧兏肠苌镸尝偿常徜瓺萇甞腸嘗塲"
+    "嫦瑺膓鋿償嚐鲿鏛鱨厂场昶惝場僘厰廠氅鋹怅玚畅倡鬯唱悵焻瑒暢畼誯韔"
+    "敞椙蟐抄弨怊欩钞訬焯超鈔勦牊晁巢巣朝鄛鼌漅嘲樔潮窲罺轈鼂謿吵炒眧"
+    "焣煼麨巐仦仯耖觘车伡車俥砗唓莗硨蛼扯偖撦屮彻坼迠烢聅掣硩頙徹撤澈"
+    "勶瞮爡抻郴捵琛嗔綝瞋諃賝縝謓尘臣忱沈沉辰陈迧茞宸莀莐陳敐訦谌軙愖"
+    "揨鈂煁蔯塵樄瘎霃螴諶薼麎曟鷐趻硶碜墋夦磣踸鍖贂醦衬疢龀趁趂榇齓儬"
+    "齔儭嚫谶櫬襯讖烥晨阷泟柽爯棦浾琤称偁蛏湞牚赪僜憆摚稱靗撐撑緽橕瞠"
+    "赬頳檉竀穪蟶鏳鏿饓丞成朾呈承枨诚郕乗城娍宬峸洆荿乘埕挰晟珹脀掁珵"
+    "碀窚脭铖堘惩棖椉程筬絾裎塍塖溗誠畻酲鋮憕澂澄橙檙瀓懲騬侱徎悜逞骋"
+    "庱睈騁秤鯎吃侙哧彨胵蚩鸱瓻眵笞喫訵嗤媸摛痴絺噄瞝誺螭鴟癡魑齝彲黐"
+    "弛池驰迟坻岻茌持竾荎歭蚳赿筂貾遅趍遟馳箎墀漦踟遲篪謘尺叺呎侈卶齿"
+    "垑胣恥粎耻蚇袳欼歯袲裭鉹褫齒彳叱斥杘灻赤饬抶勅恜炽勑翄翅敕烾痓啻"
+    "湁硳飭傺痸腟跮鉓雴憏瘈翤遫銐慗瘛翨熾懘趩饎鶒鷘妛麶充冲忡沖茺浺珫"
+    "翀舂嘃摏徸憃憧衝罿艟蹖虫崇崈隀褈緟蝩蟲爞宠埫寵铳揰銃抽婤搊瘳篘犨"
+    "犫仇怞俦帱栦惆紬绸菗椆畴絒愁皗稠筹裯酧綢踌儔雔嚋嬦幬懤薵燽雠疇籌"
+    "躊醻讎讐丑丒吜杻杽侴偢瞅醜矁魗臭臰遚殠酬出岀初摴樗貙齣刍除芻厨滁"
+    "蒢豠锄媰耡蒭蜍趎鉏雏犓蕏廚篨鋤橱幮櫉藸躇雛櫥蹰鶵躕処杵础椘储楮褚"
+    "濋儲檚礎齭鸀齼亍处竌怵拀绌豖柷欪竐俶敊畜埱珿絀處傗琡鄐搐滀蓫触踀"
+    "閦儊嘼諔憷斶歜臅黜觸矗楚榋橻璴蟵欻歘揣搋膗啜嘬膪踹巛川氚穿剶猭瑏"
+    "伝传舡舩船圌遄傳椽暷篅輲舛荈喘歂僢踳汌串玔钏釧賗鶨刅疮窓窗牎摐牕"
+    "瘡窻床牀噇幢闯傸摤磢闖创怆刱剏剙凔創愴吹炊垂倕埀陲捶菙搥棰椎腄槌"
+    "锤箠錘鎚顀龡旾杶春萅堾媋暙椿瑃箺蝽橁輴膥櫄鰆鶞纯陙唇浱純莼淳脣湻"
+    "犉滣蒓漘蓴醇醕錞鯙偆萶惷睶賰蠢鹑鶉逴踔戳辶辵娕娖婼惙涰绰腏辍酫綽"
+    "趠輟龊擉磭繛歠嚽齪鑡呲疵赼趀偨跐縒骴髊蠀齹词珁垐柌祠茈茨堲瓷詞辝"
+    "慈甆辞磁雌鹚糍辤飺餈嬨濨薋鴜礠辭鶿鷀此佌泚玼皉紪鮆朿次伺佽刺刾庛"
+    "茦栨莿絘蛓赐螆賜匆囪囱苁忩枞怱悤棇焧葱漗聡蓯蔥骢暰樅樬熜瑽璁緫聦"
+    "聪燪瞛篵聰蟌鍯繱鏦騘驄从丛従婃孮徖從悰淙琮慒漎潀潨誴賨賩樷藂叢灇"
+    "欉爜憁謥茐凑湊腠辏輳粗觕麁麄麤徂殂促猝脨酢瘄蔟誎趗噈憱踧醋瘯簇縬"
+    "蹙鼀蹴蹵顣汆撺鋑镩蹿攛躥鑹櫕巑欑穳窜殩熶篡簒竄爨崔催凗缞墔嶉慛摧"
+    "榱獕槯磪縗鏙漼璀趡皠伜忰疩倅粋紣翆脃脆啐啛悴淬萃毳焠脺瘁粹綷翠膵"
+    "膬濢竁襊顇臎乼邨村皴踆澊竴存侟拵刌忖寸吋籿搓瑳遳磋撮蹉醝虘嵯嵳痤"
+    "睉矬蒫蔖鹾酂鹺躦脞剉剒厝夎挫莝莡措逪斮棤锉蓌错歵銼錯咑哒耷荅笚嗒"
+    "搭褡噠撘鎝达迖呾妲怛沓炟羍荙畗剳匒畣笪逹答詚達阘靼薘鞑蟽鎉躂鐽韃"
+    "龖龘打大汏眔垯瘩墶燵繨呆呔獃懛歹逮傣代轪垈岱帒甙绐迨骀带待怠柋殆"
+    "玳贷帯軑埭帶紿袋軚貸軩瑇廗叇曃緿鴏戴艜黛簤蹛瀻霴襶黱靆鮘丹妉单担"
+    "単眈砃耼耽郸聃躭單媅殚瘅匰箪褝鄲頕儋勯擔殫甔癉襌簞聸伔刐抌玬瓭胆"
+    "衴疸紞掸赕亶撢撣澸黕膽黮旦但帎沊狚诞柦疍啖啗弹惮淡萏蛋啿弾氮腅蜑"
+    "觛窞誕僤噉馾髧嘾彈憚憺暺澹禫蓞駳鴠癚嚪繵贉霮饏泹当珰裆筜當噹澢璫"
+    "襠簹艡蟷挡党谠擋譡黨攩灙欓讜氹凼圵宕砀垱荡档菪婸愓瓽逿嵣雼潒碭儅"
+    "瞊蕩趤壋檔璗盪礑簜蘯闣铛鐺刀刂叨忉朷氘舠釖鱽魛捯导岛島捣祷禂搗隝"
+    "嶋嶌導隯壔嶹擣蹈禱到倒悼焘盗菿盜道稲箌翢噵稻衜檤衟燾翿軇瓙纛屶陦"
+    "椡槝嘚恴淂惪棏锝徳德鍀地的得脦扥扽灯登豋噔嬁燈璒竳簦覴蹬朩等戥邓"
+    "凳鄧隥墱嶝瞪磴镫櫈鐙艠氐仾低奃彽袛羝隄堤趆滴樀镝磾鍉鞮廸狄籴苖迪"
+    "唙敌涤荻梑笛觌靮滌馰髢嘀嫡翟蔋蔐頔敵篴嚁藡豴蹢鬄鏑糴覿鸐厎坘诋邸"
+    "阺呧底弤抵拞茋柢牴砥埞掋菧觝詆軧聜骶坔弟旳杕玓怟俤帝埊娣递逓偙啇"
+    "啲梊焍珶眱祶第菂谛釱媂棣渧睇缔蒂僀禘腣遞鉪墑墬摕碲蔕蝃遰慸甋締嶳"
+    "諦踶螮鯳嗲甸敁掂傎厧嵮滇槇槙瘨颠蹎巅顚顛癫巓巔攧癲齻典奌点婰猠敟"
+    "跕碘蒧蕇踮點嚸电佃阽坫店垫扂玷钿婝惦淀奠琔殿蜔電墊壂橂橝澱靛癜簟"
+    "驔椣刁叼汈虭凋奝弴彫蛁琱貂碉鳭殦瞗雕鮉鲷鼦鯛鵰扚屌弔伄吊钓窎訋调"
+    "掉釣铞铫竨蓧銱雿魡調瘹窵鋽藋鑃簓爹跌褺苵迭垤峌恎挕昳绖胅瓞眣戜谍"
+    "喋堞惵揲畳絰耋臷詄趃镻叠殜牃牒嵽碟蜨褋艓蝶諜蹀鲽曡疉鰈疊氎哋耊眰"
+    "幉疂丁仃叮帄玎疔盯钉耵虰酊釘靪奵顶頂鼎嵿鼑濎薡鐤订忊饤矴定訂飣啶"
+    "铤椗腚碇锭碠蝊鋌錠磸顁萣聢丟丢铥銩东冬咚岽東苳昸氡倲鸫埬娻崠崬涷"
+    "笗菄徚氭蝀鴤鼕鯟鶇董墥嬞懂箽蕫諌动冻侗垌姛峒恫挏栋洞胨迵凍戙胴動"
+    "硐棟湩絧腖働駧霘鮗鶫吺唗都兜兠蔸橷篼阧抖枓枡陡唞蚪鈄斗豆郖浢荳逗"
+    "饾鬥梪毭脰酘痘閗窦鬦餖斣闘竇鬪鬭鬬乧艔厾剢阇嘟督醏闍毒独涜读渎椟"
+    "牍犊碡裻読蝳獨錖凟匵嬻瀆櫝殰牘犢瓄皾騳黩讀豄贕韣髑鑟韇韥黷讟笃堵"
+    "帾琽赌睹覩賭篤芏妒杜肚妬度荰秺渡靯镀螙殬鍍簵蠧蠹耑偳剬媏端褍鍴短"
+    "段断塅缎葮椴煅瑖腶碫锻緞毈簖鍛斷躖籪襨垖堆塠嵟痽磓鴭鐜頧队对兊兌"
+    "兑対祋怼陮隊碓綐對憞憝濧薱镦懟瀩譈鐓吨惇敦蜳墩墪撴獤噸撉橔犜礅蹲"
+    "蹾驐盹趸躉伅囤庉沌炖盾砘逇钝顿遁鈍楯頓遯潡燉踲碷多夛咄哆畓剟崜掇"
+    "敠毲裰嚉夺铎剫敓敚喥悳敪痥鈬奪凙踱鮵鐸朶哚垛垜挅挆埵缍椯趓躱躲憜"
+    "綞亸鍺軃嚲奲刴剁陊陏饳尮柁柮炨桗堕舵惰跢跥跺飿墮嶞墯鵽朵枤妸妿娿"
+    "婀屙钶痾讹吪囮迗俄娥峨峩涐莪珴訛皒睋鈋锇鹅蛾磀誐頟额魤隲額鵝鵞譌"
+    "鰪枙砈頋噁騀厄屵戹歺岋阨呃扼苊阸呝砐轭咢咹垩姶峉匎恶砨蚅饿偔卾堊"
+    "悪掠略硆谔軛鄂阏堮崿惡愕湂萼豟軶遌遏鈪廅搤搹琧腭詻僫蝁锷魥鹗蕚頞"
+    "颚餓噩覨諤閼餩貖鍔鳄歞顎礘櫮鰐鶚讍齃鑩齶鱷擜鵈诶誒奀恩蒽煾峎摁鞥"
+    "儿而児侕兒陑峏洏荋栭胹唲袻鸸粫聏輀鲕隭髵鮞鴯轜厼尒尓尔耳迩洱饵栮"
+    "毦珥铒爾餌駬薾邇趰二弍弐佴刵咡贰貮衈貳誀鉺樲发沷発傠發酦彂醱乏伐"
+    "姂垡浌疺罚茷阀栰砝筏瞂罰閥罸橃藅佱法灋珐琺髪蕟髮鍅帆訉番勫噃嬏幡"
+    "憣蕃旙旛繙翻藩轓颿籓飜鱕凡凢凣忛杋柉矾籵钒烦舧笲棥渢煩緐墦樊橎燔"
+    "璠膰薠繁襎羳蹯瀪瀿礬蘩鐇鐢蠜鷭反払返釩氾犯奿汎泛饭范贩畈軓婏梵盕"
+    "笵販軬飯飰滼嬎範舤匚方邡汸芳枋牥钫淓蚄鈁鴋防妨房肪埅鲂魴鰟仿访彷"
+    "纺昉昘瓬眆倣旊紡舫訪髣鶭放趽坊堏錺飞妃非飛啡婓渄绯菲扉猆靟裶緋蜚"
+    "霏鲱餥馡騑騛飝肥淝腓蜰蟦朏匪诽奜悱斐棐榧翡蕜誹篚吠芾废杮沸狒肺昲"
+    "胇费俷剕厞疿陫屝萉廃費痱镄廢曊癈鼣濷櫠鯡鐨靅婔暃分吩帉纷芬昐氛哛"
+    "衯兺紛翂兝棻訜酚鈖雰朆燓餴饙坟妢岎汾朌枌炃肦羒蚠蚡梤棼焚蒶馚隫墳"
+    "幩濆蕡魵橨燌豮鼢羵鼖豶轒鐼馩黂粉黺份弅奋忿秎偾愤粪僨憤奮膹糞鲼瀵"
+    "鱝竕躮丰风仹凨凬妦沣沨凮枫封疯盽砜風峯峰偑桻烽崶猦葑锋楓犎蜂瘋碸"
+    "僼篈鄷鋒檒闏豐鏠酆寷灃蘴霻蠭靊飌麷冯夆捀浲逢堸馮摓漨綘艂讽覂唪諷"
+    "凤奉甮俸湗焨煈缝赗鳯鳳鴌縫賵琒溄鎽蘕覅仏坲梻紑裦缶否妚缹缻殕雬鴀"
+    "伕邞呋妋姇玞肤怤柎砆荂衭垺娐尃荴旉紨趺麸痡稃跗鈇筟綒鄜孵豧敷膚鳺"
+    "麩糐麬麱懯乀巿弗伏凫甶佛冹刜孚扶芙芣咈岪彿怫拂服枎泭绂绋苻茀俘垘"
+    "柫氟洑炥玸畉畐祓罘茯郛韨哹栿浮砩莩蚨匐桴涪烰琈符笰紱紼翇艴菔虙幅"
+    "棴絥罦葍福粰綍艀蜉辐鉘鉜颫鳧榑稪箙韍幞澓蝠髴鴔諨踾輻鮄癁襆黻鵩鶝"
+    "呒抚乶府弣拊斧俌俛胕郙鳬俯釜釡捬辅焤盙腑滏蜅腐輔嘸撨撫頫鬴簠黼阝"
+    "父讣付妇负附坿竎阜驸复峊祔訃負赴蚥袝陚偩冨副婦蚹媍富復秿萯蛗詂赋"
+    "圑椱缚腹鲋複褔赙緮蕧蝜蝮賦駙嬔縛輹鮒賻鍑鍢鳆覆馥鰒夫甫咐袱酜傅椨"
+    "覄禣鮲旮呷嘎嘠钆尜噶錷尕玍尬魀侅该郂陔垓姟峐荄晐赅畡祴絯該豥賅忋"
+    "改絠丐乢匃匄阣杚钙盖摡溉葢鈣隑戤概槩蓋賌漑槪瓂甘忓芉迀攼杆玕肝坩"
+    "泔矸苷乹柑竿疳酐乾粓亁凲尲尴筸漧鳱尶尷魐仠扞皯秆衦赶敢桿笴稈感澉"
+    "趕橄擀簳鰔鳡鱤干旰汵盰绀倝凎淦紺詌骭幹榦檊贑赣贛灨冈罓冮刚杠纲肛"
+    "岡牨疘矼缸钢剛罡堈掆釭棡犅堽綱罁鋼鎠岗崗港焵筻槓戅戆皋羔羙高皐髙"
+    "臯滜槔睾膏槹橰篙糕餻櫜鷎鼛鷱夰杲菒搞缟暠槀槁稾稿镐縞藁檺藳吿告勂"
+    "叝诰郜祮祰锆煰筶禞誥鋯韟戈仡圪犵纥戓肐牫疙咯牱哥胳袼鸽割搁滒戨歌"
+    "鴐鴚擱謌鴿鎶呄佮匌挌茖阁革敋格鬲愅臵葛蛒裓隔嗝塥滆觡搿槅膈閣閤獦"
+    "镉鞈韐骼諽輵鮯韚轕鞷騔哿舸个各虼個硌铬嗰箇彁櫊给給根跟哏艮亘亙茛"
+    "揯刯庚畊浭耕菮搄焿絚赓鹒緪縆羮賡羹鶊郠哽埂峺挭绠耿莄梗綆鲠骾鯁更"
+    "堩暅掶椩工弓公厷功攻杛供玜糼肱宫宮恭躬龚匑塨幊愩觥躳熕碽髸觵龏龔"
+    "廾巩汞拱拲栱珙輁鋛鞏共贡羾唝貢莻蚣慐勾佝沟钩袧缑鈎溝鉤緱褠篝鞲韝"
+    "芶岣狗苟枸玽耇耉笱耈蚼豿坸构诟购垢姤茩冓够夠訽媾彀搆詬遘雊構煹觏"
+    "撀覯購估呱姑孤沽泒苽柧轱唂罛鸪笟菰蛄觚軱軲辜酤鈲箍箛嫴橭鮕鴣鶻夃"
+    "古扢汩诂谷股牯骨唃罟羖钴啒淈脵蛊蛌尳愲蓇詁馉鹄榾毂鈷鼓鼔嘏榖皷鹘"
+    "穀縎糓薣濲皼臌轂餶瀔盬瞽蠱固故凅顾堌崓崮梏牿棝祻雇痼稒锢僱錮鲴鯝"
+    "顧咕峠逧傦菇篐瓜刮胍栝鸹歄煱聒趏劀緺踻銽颳鴰騧冎叧剐剮寡卦坬诖挂"
+    "啩掛罣絓罫褂詿颪乖掴摑拐枴柺箉夬叏怪恠关观官冠覌倌棺蒄窤関瘝癏観"
+    "闗鳏關鰥觀鱞莞馆琯痯筦管輨舘錧館鳤毌丱贯泴悺惯掼涫貫悹祼慣摜潅遦"
+    "樌盥罆雚鏆灌爟瓘矔礶鹳罐鑵鱹鸛光灮侊炗炛咣垙姯洸茪桄烡胱僙輄銧黆"
+    "广広犷廣獷臩俇珖逛臦撗炚欟归圭妫龟规邽皈茥闺帰珪胿亀傀硅窐袿規媯"
+    "廆椝瑰郌嫢摫閨鲑嬀槻槼螝璝膭鮭龜巂歸鬶騩瓌鬹櫷宄氿朹轨庋佹匦诡陒"
+    "垝姽恑攱癸軌鬼庪祪匭晷湀蛫觤詭厬瞡簋蟡攰刽刿昋柜炔贵桂桧猤筀貴蓕"
+    "跪匱劊劌嶡撌槶檜瞶禬簂櫃癐襘鳜鞼鱖鱥椢丨衮惃绲袞袬辊滚蓘滾緄蔉磙"
+    "輥鲧鮌鯀棍睔睴璭謴呙咼埚郭堝崞鈛锅墎瘑嘓彉濄蝈鍋彍蟈囯囶囻国圀國"
+    "帼腘幗慖漍聝蔮膕虢馘果惈淉猓菓馃椁槨粿綶蜾裹輠錁餜鐹过過啯哈铪蛤"
+    "奤丷咍咳嗨还孩頦骸還海胲烸酼醢亥妎骇害氦嗐餀駭饚塰嚡佄炶顸蚶酣頇"
+    "嫨谽憨馠歛鼾邗含邯函咁肣凾虷唅圅娢浛崡晗梒涵焓琀寒嵅韩甝筨蜬澏鋡"
+    "魽韓丆厈罕浫喊蔊阚豃鬫汉屽汗闬旱岾哻垾悍捍涆猂莟晘晥焊菡釬閈皔睅"
+    "傼蛿颔馯撖漢蜭貋暵熯銲鋎憾撼翰螒頷顄駻譀雗瀚蘫鶾兯爳夯苀迒斻杭绗"
+    "珩笐航蚢颃貥筕絎頏魧沆垳茠蒿嚆薅薧毜蚝毫椃嗥獆貉噑獔豪嘷獋諕儫嚎"
+    "壕濠籇蠔譹好郝号昊昦秏哠峼恏悎浩耗晧淏傐皓鄗滈聕號暤暭澔皜皞曍皡"
+    "薃皥鎬颢灏顥鰝灝竓诃抲欱喝訶嗬蠚禾合何劾厒咊和姀河郃峆曷柇狢盇籺"
+    "紇阂饸哬敆核盉盍荷啝涸渮盒秴菏萂蚵龁惒訸颌楁毼澕詥貈輅鉌阖鲄熆鹖"
+    "麧頜篕翮螛魺礉闔鞨齕覈鶡皬鑉龢佫垎贺袔焃賀嗃煂碋熇褐赫鹤穒翯壑癋"
+    "謞爀鶮鶴靎鸖靏粭靍黒黑嘿潶拫痕鞎佷很狠詪恨亨哼悙啈脝姮恆恒桁烆胻"
+    "鸻横橫衡鴴蘅鑅堼涥鵆噷叿吽呍灴轰哄訇烘軣揈渹焢硡谾薨輷嚝鍧轟仜弘"
+    "妅红吰宏汯玒纮闳宖泓苰垬娂洪竑紅荭虹峵浤紘翃耾硔紭谹鸿渱竤粠葒葓"
+    "鈜閎綋翝谼潂鉷鞃魟鋐彋蕻霐黉霟鴻黌晎嗊讧訌閧撔澋澒銾闂鬨齁侯矦鄇"
+    "喉帿猴葔瘊睺篌糇翭骺翵鍭餱鯸吼犼后郈厚垕後洉逅堠豞鲎鲘鮜鱟候乯匢"
+    "虍呼垀忽昒曶泘苸恗烀轷匫唿惚淴虖軤嘑寣滹雐幠戯歑膴謼囫抇弧狐瓳胡"
+    "壶隺壷斛焀喖壺媩搰湖猢絗葫楜煳瑚嘝蔛鹕槲箶蝴衚魱縠螜醐頶觳鍸餬鵠"
+    "瀫鬍鰗鶘鶦乕汻虎浒俿萀琥虝滸乥互弖戶户戸冱冴芐帍护沍沪岵怙戽昈枑"
+    "怘祜笏婟扈瓠楛嗀綔鄠雽嫭嫮摢滬蔰槴熩鳸簄鍙嚛鹱護鳠韄頀鱯鸌乎粐唬"
+    "糊錿鯱花芲哗嘩蒊錵华姡骅華釪釫铧滑猾搳撶磆蕐螖鋘譁鏵驊鷨化划夻杹"
+    "画话崋桦婳畫嬅畵觟話劃摦樺嫿槬澅諣黊繣舙譮埖婲椛硴糀璍誮怀徊淮槐"
+    "褢踝懐褱懷瀤櫰耲蘹坏咶諙壊壞蘾犿歓鴅鵍酄嚾懽獾讙貛驩环郇峘洹狟荁"
+    "桓萈萑寏絙雈綄羦貆鉮锾圜嬛寰澴缳阛環豲鍰镮鹮糫繯轘鐶闤鬟瓛缓緩攌"
+    "幻奂肒奐宦唤换浣涣烉患梙焕逭喚喛嵈愌換渙痪睆煥瑍豢漶瘓槵鲩擐澣藧"
+    "鯇鰀欢瞣歡巟肓荒衁朚塃慌皇偟凰隍黄喤堭媓崲徨惶湟葟遑黃楻煌瑝墴潢"
+    "獚锽熿璜篁篊艎蝗癀磺穔諻簧蟥鍠餭鳇趪韹鐄騜兤鰉鱑鷬怳恍炾宺晄奛谎"
+    "幌詤熀謊櫎愰滉榥曂皝鎤皩晃縨灰诙咴恢拻挥洃虺袆晖烣珲豗婎媈揮翚辉"
+    "隓暉楎煇禈詼幑睳褘噅撝噕翬輝麾徽隳瀈蘳鰴囘回囬佪廻廽恛洄茴迴烠蚘"
+    "逥痐蛔蛕蜖鮰悔毀毁毇檓燬譭卉汇会讳泋哕浍绘芔荟诲恚恵烩贿彗晦秽喙"
+    "惠湏絵缋翙阓匯彙彚會滙詯賄颒僡嘒瘣蔧誨圚寭慧憓暳槥潓蕙噦嬒徻橞殨"
+    "澮濊獩薈薉諱頮燴璯篲藱餯嚖瞺穢繢蟪櫘繪翽譓儶鏸闠孈鐬靧譿顪屷灳璤"
+    "懳昏昬荤婚惛涽阍棔殙葷睧睯閽忶浑梡馄堚渾琿魂餛繉轋鼲鯶诨俒倱圂掍"
+    "混焝溷慁觨諢吙剨耠锪劐嚄鍃豁攉騞佸活秮秳火伙邩钬鈥漷夥沎或货咟砉"
+    "俰捇眓获閄掝祸貨惑旤楇湱禍蒦奯濩獲霍檴謋矆穫镬嚯瀖耯艧藿蠖嚿曤臛"
+    "癨矐鑊靃丌讥击刉叽饥乩刏圾机玑肌芨矶鸡枅咭姫迹剞唧姬屐积笄飢基绩"
+    "喞嵆嵇敧朞犄筓缉赍勣嗘畸稘跡跻鳮僟毄箕銈嘰槣畿稽緝觭賫躸齑墼機激"
+    "璣禨積襀錤隮擊磯簊績羁賷鄿櫅耭蹟雞譏韲鶏譤鐖饑躋鞿鷄齎羇虀鑇覉鑙"
+    "齏羈鸄覊亼及伋吉岌彶忣汲级即极皀亟佶诘郆钑卽姞急狤皍笈級揤疾脊觙"
+    "偮卙庴焏谻戢棘極殛湒集塉嫉愱楫蒺趌槉禝耤膌銡嶯撃潗濈瘠箿蕀蕺踖鹡"
+    "橶檝螏擮藉襋蹐鍓艥籍轚鏶霵鶺鷑雦雧几己丮妀犱泲虮挤掎鱾幾戟鈘嵴麂"
+    "魢撠擠穖蟣魕彐彑旡计记伎纪坖妓忌技芰际剂季哜垍峜既洎济紀茍茤荠計"
+    "剤紒继觊記偈寂寄徛悸旣梞済祭塈惎臮葪蔇兾痵継蓟裚褀際鬾暨漃漈稩穊"
+    "誋跽霁鲚暩稷諅鲫冀劑曁穄薊髻嚌檕濟繋罽薺覬檵鵋齌懻癠穧蘎骥鯚瀱繼"
+    "蘮鱀蘻霽鰶鰿鱭驥亽辑樭輯廭癪加乫夹伽夾抸佳拁泇茄迦枷毠浃珈埉家浹"
+    "痂梜笳耞袈傢猳葭跏犌腵鉫嘉鉿镓豭貑鎵麚圿忦扴郏荚郟唊恝莢戛袷铗戞"
+    "蛱裌颊蛺跲鞂餄鋏頬頰鴶鵊甲仮岬叚玾胛斚贾钾假婽徦斝椵賈鉀榎槚瘕檟"
+    "价驾架嫁幏榢價駕稼糘戋奸尖幵坚歼间冿戔玪肩艰姦姧兼监偂堅惤猏笺菅"
+    "菺豜湔牋犍缄葌間搛椷椾煎瑊睷碊缣蒹豣監箋樫熞緘蕑蕳鲣鳽鹣熸篯縑艱"
+    "鞬餰馢麉瀐鞯鳒礛覸鵳瀸鐧櫼殲鶼韀鰹囏虃鑯韉囝拣枧俭柬茧倹挸捡笕减"
+    "剪梘检湕趼堿揀揃検減睑硷裥詃锏弿暕瑐筧简絸谫戩戬碱儉翦撿檢藆襇襉"
+    "謇蹇瞼礆簡繭謭鬋鰎鹸瀽蠒鐗劗鹻籛譾襺鹼见件見建饯剑洊牮荐贱俴健剣"
+    "栫涧珔舰剱徤渐袸谏釼寋旔楗毽溅腱臶葥践賎鉴键僭榗漸蔪劍劎澗箭糋諓"
+    "賤趝踐踺劒劔薦諫鋻鍵餞瞷磵螹鍳擶濺繝瀳覵鏩艦譼轞鐱鑑鑒鑬鑳彅墹橺"
+    "礀殱江姜将茳浆畕豇將葁畺摪翞僵漿螀壃缰薑橿殭螿鳉疅礓疆繮韁鱂讲奖"
+    "桨傋蒋奨奬蔣槳獎耩膙講顜匞夅弜降洚绛弶袶絳酱勥滰嵹摾彊犟糡醤糨醬"
+    "謽匠杢櫤艽芁交郊姣娇峧浇茭茮骄胶椒焦蛟跤僬嘄虠鲛嬌嶕嶣憍澆膠蕉燋"
+    "膲礁穚鮫鵁鹪簥蟭轇鐎鷍驕鷦鷮臫角佼侥恔挢狡绞饺捁晈烄皎矫脚铰搅湫"
+    "絞剿敫湬煍腳賋僥摷暞踋鉸餃儌劋徺撟撹隦徼憿敽敿燞缴曒璬矯皦蟜繳譑"
+    "孂攪灚鱎叫呌峤挍訆珓窌轿较敎教窖滘較嘂嘦斠漖酵噍嶠潐噭嬓獥藠趭轎"
+    "醮譥皭釂鵤櫵纐阶疖皆接掲痎秸菨階喈嗟堦媘嫅揭椄湝脻街煯稭擑蝔癤謯"
+    "鶛卩卪孑尐节讦刦刧劫岊昅刼劼杰疌衱拮洁结迼倢桀莭訐偼婕崨捷袺傑喼"
+    "結絜颉嵥楬楶滐睫節蜐蝍詰鉣魝截榤碣竭蓵鲒潔羯誱踕鞊幯鍻鮚巀櫭蠞蠘"
+    "蠽毑媎解觧飷檞丯介吤岕庎戒芥屆届玠界畍疥砎衸诫借悈蚧徣堺楐琾蛶骱"
+    "犗誡褯魪鎅躤姐桝巾今斤钅兓金津矜荕衿觔埐珒紟惍堻筋釿嶜鹶黅襟仅尽"
+    "侭卺巹紧堇菫僅厪谨锦嫤廑漌盡緊蓳馑槿瑾儘錦謹饉伒劤劲妗近进枃勁浕"
+    "荩晉晋浸烬赆唫琎祲進寖搢溍禁缙靳墐暜瑨僸凚歏殣璡觐噤濅縉賮嚍嬧濜"
+    "藎燼璶覲贐齽釒砛琻壗坕坙巠京泾经茎亰秔荆荊涇莖婛惊旌旍猄経菁晶稉"
+    "腈葏粳經兢精聙鲸鵛鯨鶁鶄麖鼱驚麠井丼阱刭坓宑汫汬肼剄穽颈景儆頚幜"
+    "憬憼暻燛璟璥頸蟼警妌净弪径迳俓婙浄胫倞凈弳徑痉竞逕婧桱梷淨竫脛竟"
+    "敬痙竧靓傹靖境獍誩踁静靚曔镜靜濪瀞鏡競竸睛橸燝冂冋坰扃埛絅駉駫蘏"
+    "蘔冏囧泂炅迥侰炯逈浻烱煚窘颎綗僒煛熲澃褧丩勼纠朻牞究糺鸠糾赳阄萛"
+    "啾揂揪揫鳩摎樛鬏鬮九久乆乣奺灸玖舏韭紤酒镹韮匛旧臼咎疚柩柾倃捄桕"
+    "匓厩救媨就廄廐舅僦廏慦殧舊鹫匶鯦麔齨鷲汣杦欍凥刟抅匊居拘泃狙苴驹"
+    "挶疽痀眗砠罝陱娵婮崌掬梮涺菹椐琚腒趄跔锔裾雎艍蜛踘踙鋦駒鮈鴡鞠鞫"
+    "鶋局泦侷狊桔毩啹婅淗焗菊郹椈毱湨犑輂僪粷跼閰諊趜躹橘檋駶鵙蹫鵴巈"
+    "蘜鶪鼳驧咀弆沮举莒挙椇筥榉榘蒟龃聥舉踽擧櫸齟欅巨句乬巪讵姖岠怇拒"
+    "洰苣邭具怐怚拠昛歫炬秬钜俱倨倶冣剧粔耟蚷袓埧埾惧据詎距犋跙鉅飓虡"
+    "豦锯寠愳窭聚駏劇勮屦踞鮔壉懅據澽窶遽鋸屨颶貗簴躆醵懼鐻矩爠襷姢娟"
+    "捐涓焆瓹脧裐鹃勬镌鎸鵑鐫蠲卷呟帣埍捲菤锩臇錈奆劵巻倦勌桊狷绢隽淃"
+    "眷鄄睊絭罥雋睠絹飬慻蔨餋獧縳羂噘撅撧屩蹻亅孒孓决刔氒诀弡抉決芵泬"
+    "玦玨挗珏疦砄绝虳觉倔捔欮蚗崛掘斍桷殌覐觖訣赽趹逫傕厥焳絕絶覚趉鈌"
+    "劂勪瑴谲駃嶥憰熦爴獗瘚蕝蕨鴂鴃噱憠橛橜爵臄镢蟨蟩屫爑譎蹶蹷鶌匷嚼"
+    "矍覺鐍鐝爝觼彏戄攫玃鷢欔矡龣貜躩钁军君均汮姰袀軍钧莙蚐桾皲菌鈞碅"
+    "皸皹覠銁銞鲪麇鍕鮶麏麕呁俊郡陖埈峻捃浚馂骏晙焌珺棞畯竣儁箘箟蜠寯"
+    "懏餕燇濬駿鵔鵘攈攟咔咖喀衉擖卡佧胩鉲垰裃开奒揩锎開鐦凯剀垲恺闿铠"
+    "凱剴嘅慨蒈塏嵦愷楷輆暟锴鍇鎧闓颽忾炌炏欬烗勓愒愾鎎刊栞勘龛堪嵁戡"
+    "龕冚坎侃砍莰偘埳惂欿塪歁槛輡檻顑竷轗看衎崁墈瞰磡闞矙忼闶砊粇康嫝"
+    "嵻慷漮槺穅糠躿鏮鱇扛摃亢伉匟邟囥抗犺炕钪鈧閌尻髛丂攷考拷洘栲烤稁"
+    "鲓燺铐犒銬靠鮳鯌匼苛柯牁珂科胢轲疴砢趷棵萪軻颏嗑搕犐稞窠鈳榼薖颗"
+    "樖瞌磕蝌錒醘顆髁礚壳揢殼翗可坷岢炣渇嵑敤渴嶱礍克刻剋勀勊客恪娔尅"
+    "课堁氪骒缂愙溘锞碦緙艐課礊騍嵙肎肯肻垦恳啃豤龈墾錹懇齦掯裉褃劥阬"
+    "吭坑妔挳硁牼硜铿硻摼誙銵鍞鏗空倥埪崆悾涳硿箜錓鵼孔恐控鞚躻抠芤眍"
+    "剾彄摳瞘口劶叩扣敂冦宼寇釦窛筘滱蔲蔻瞉簆鷇扝刳矻郀枯胐哭桍堀崫圐"
+    "跍窟骷鮬狜苦库俈绔庫秙趶焅袴喾絝裤瘔酷廤褲嚳夸姱誇侉咵垮銙挎胯跨"
+    "骻舿蒯擓巜凷块快侩郐哙狯脍塊筷鲙儈墤鄶噲廥獪膾旝糩鱠圦宽寛寬臗髋"
+    "髖欵款歀窾窽鑧匡劻诓邼匩哐恇洭框硄筐誆軭忹抂狂诳軖誑鵟夼儣懭卝邝"
+    "圹纩况旷岲況矿昿贶眖眶絖貺軦鉱鄺壙黋懬曠爌躀矌礦穬纊鑛砿絋筺亏刲"
+    "岿悝盔窥聧窺虧顝闚巋蘬奎晆逵鄈隗頄馗喹揆葵骙戣暌楏楑魁睽蝰頯櫆藈"
+    "鍨鍷騤夔蘷巙虁犪躨煃跬頍蹞尯匮欳喟媿愦愧溃腃蒉馈瞆嘳嬇憒潰篑聩聭"
+    "蕢樻謉餽簣聵籄鐀饋鑎坤昆堃婫崐崑晜猑菎裈焜琨髠裩貇锟髡鹍蜫褌髨瑻"
+    "醌錕鲲騉鯤鵾鶤悃捆阃壸梱祵硱稇裍壼稛綑閫閸齫困涃睏堒尡潉熴扩拡括"
+    "挄桰筈萿葀蛞阔廓頢髺擴濶闊鞟懖霩鞹鬠韕垃拉柆翋菈搚邋旯剌砬揦磖喇"
+    "藞腊揧楋瘌蜡蝋辢辣蝲臈攋爉臘鬎瓎镴鯻蠟鑞啦溂鞡嚹来來俫倈崃徕涞莱"
+    "郲婡崍庲徠梾淶猍萊逨棶琜筙铼箂錸騋鯠鶆麳唻赉睐睞赖賚濑賴頼顂癞鵣"
+    "瀨瀬籁藾櫴癩襰籟兰岚拦栏婪惏嵐葻阑蓝谰厱澜褴儖斓篮懢燣燷藍襕镧闌"
+    "璼襤譋幱攔瀾灆籃繿蘭斕欄礷襴囒灡籣欗讕躝钄韊览浨揽缆榄漤罱醂壈懒"
+    "覧擥嬾懶孄覽孏攬灠囕欖顲纜烂滥燗嚂濫爁爛瓓爤鑭糷爦襽啷勆郎郞欴狼"
+    "阆嫏廊斏桹琅蓈榔瑯硠稂锒筤艆蜋螂躴鋃鎯駺朗朖烺塱蓢樃誏朤埌崀浪莨"
+    "蒗閬唥郒捞撈劳労牢窂哰唠崂浶勞痨铹僗嘮嶗憥癆磱簩蟧醪鐒顟髝耂老佬"
+    "咾姥恅狫荖栳铑銠潦橑轑涝烙耢酪嫪憦澇躼橯耮軂珯硓粩蛯朥鮱肋仂阞乐"
+    "叻忇扐氻艻玏泐竻砳楽韷樂簕鳓鰳了饹餎勒雷嫘缧蔂畾擂檑縲礌镭櫑瓃羸"
+    "礧纍罍蘲蠝鐳轠儽壨鑘靁虆欙纝鼺厽耒诔垒絫腂傫誄樏磊蕌磥蕾儡壘癗藟"
+    "櫐礨灅蘽讄鑸鸓泪洡类涙淚累酹銇頛頪錑攂颣類纇蘱禷塁嘞鱩崚塄棱楞碐"
+    "稜輘薐冷倰堎愣睖踜刕杝厘剓离荲骊悡梨梩梸犁琍粚菞喱棃犂鹂剺漓睝筣"
+    "缡艃蓠蜊嫠孷樆璃盠貍糎蔾褵鋫鲡黎篱縭罹錅蟍謧醨嚟藜邌釐離斄瓈鏫鯬"
+    "鵹黧囄攡灕蘺蠡騹孋廲劙鑗穲籬纚驪鱺鸝礼里俚峛峢娌峲浬逦理锂粴裏豊"
+    "鋰鲤兣澧禮鯉蟸醴鳢邐鱧欚力历厉屴立吏朸丽利励呖坜沥苈例岦戾枥沴疠"
+    "苙隶俐俪栎疬砅茘荔赲轹郦唎悧栗栛涖猁珕砺砾秝莅莉唳婯笠粒粝脷蚸蛎"
+    "傈凓厤棙痢蛠詈跞雳厯塛慄搮溧蒚蒞鉝鳨厲暦歴瑮綟蜧蝷勵曆歷篥隷鴗巁"
+    "濿癘磿隸鬁儮曞櫔爄犡禲蠇鎘嚦壢攊櫟瀝瓅矋礪藶麗櫪爏瓑皪盭礫糲蠣儷"
+    "癧礰蠫酈鷅麜囇攦觻躒轢欐讈轣攭瓥靂鱱鱳靋李栃哩娳狸裡檪鯏俩倆奁连"
+    "帘怜涟莲連梿联裢亷嗹廉慩溓漣蓮匲奩槤熑覝劆匳噒嫾憐磏聫褳鲢濂濓縺"
+    "翴聮薕螊櫣燫聯臁謰蹥鎌镰簾蠊鬑鐮鰱籢籨敛琏脸裣摙璉蔹嬚斂臉鄻襝羷"
+    "蘞练炼恋浰殓僆堜媡湅萰链楝煉瑓潋練澰錬殮鍊鏈瀲蘝鰊戀纞聨良俍凉梁"
+    "涼椋辌粮粱墚綡踉樑輬糧両两兩唡啢掚脼裲緉蜽魉魎亮哴悢谅辆喨晾湸量"
+    "輌諒輛鍄煷簗撩蹽辽疗聊僚寥嵺憀漻膋嘹嫽寮嶚嶛敹獠缭遼暸燎璙膫療鹩"
+    "屪廫簝繚蟟豂賿蹘鐐髎藔飉鷯叾钌釕鄝蓼憭瞭曢镽爒尥尦炓料尞廖撂窷镣"
+    "爎列劣冽劽姴挒洌茢迾哷埒埓栵浖烈捩猎脟蛚裂煭睙聗趔巤颲儠鮤鴷擸獵"
+    "犣躐鬛鬣鱲毟咧挘烮猟拎厸邻林临冧矝啉崊淋晽琳粦痳碄箖粼鄰隣嶙潾獜"
+    "遴斴暽燐璘辚霖瞵磷臨繗翷麐轔壣瀶鏻鳞驎鱗麟菻亃凛凜撛廩廪懍懔澟檁"
+    "檩癛癝吝恡悋赁焛賃僯蔺橉甐膦閵疄藺蹸躏躙躪轥刢灵囹坽夌姈岺彾泠狑"
+    "苓昤朎柃玲瓴凌皊砱秢竛铃陵鸰婈掕棂淩琌笭紷绫羚翎聆舲菱蛉衑祾詅跉"
+    "軨裬鈴閝零龄綾蔆霊駖澪蕶錂魿鲮鴒鹷燯霛霝齢酃鯪孁蘦齡櫺醽靈欞爧麢"
+    "龗阾岭袊领領嶺令另呤炩伶蓤霗瀮溜熘蹓刘沠畄浏流留旈琉畱硫裗媹嵧旒"
+    "蒥蓅遛馏骝榴瑠飗劉瑬瘤磂镏駠鹠橊璢疁镠癅蟉駵嚠懰瀏藰鎏鎦麍鏐飀騮"
+    "飅鰡鶹驑柳栁珋桺绺锍鉚飹綹熮罶鋶橮嬼羀六畂翏塯廇澑磟鹨霤餾雡鐂飂"
+    "鬸鷚桞囖龙屸咙泷茏昽栊珑胧眬砻竜笼聋隆湰滝嶐漋蕯癃篭龍嚨巃巄瀧簼"
+    "蘢鏧霳曨朧櫳爖瓏矓礱礲襱龒籠聾蠪蠬豅躘鑨靇驡鸗陇垄垅拢篢儱隴壟壠"
+    "攏竉龓哢挵梇徿贚槞窿瞜剅娄偻婁溇蒌僂楼廔慺漊蔞遱樓熡耧蝼耬艛螻謱"
+    "軁髅鞻髏嵝搂塿嶁摟甊篓簍陋屚漏瘘镂瘺瘻鏤喽嘍噜撸卢庐芦垆泸炉栌胪"
+    "轳鸬玈舻颅鲈魲盧櫚嚧壚廬攎瀘獹璷蘆曥櫨爐瓐臚矑籚纑罏艫蠦轤鑪顱髗"
+    "鱸鸕黸卤虏掳鹵硵鲁虜塷滷蓾樐魯擄橹磠镥嚕擼瀂櫓氌艣鏀艪鐪鑥圥甪陆"
+    "侓坴彔录峍勎赂辂陸娽淕淥渌硉菉逯鹿椂琭禄祿僇剹勠盝睩碌稑賂路塶廘"
+    "摝漉箓粶蔍戮樚熝膔觮趢踛辘醁潞穋蕗錄録錴璐簏螰簶蹗轆騄鹭簬鏕鯥鵦"
+    "鵱麓鏴露騼籙虂鷺枦舮鈩澛氇驴郘闾榈閭馿氀膢藘鷜驢吕呂侣侶挔捛捋旅"
+    "梠祣稆铝屡絽缕屢膂褛鋁履膐褸儢穞縷穭寽垏律虑率绿嵂氯葎滤綠緑慮箻"
+    "膟勴繂濾櫖爈鑢焒娈孪峦挛栾鸾脔滦銮鵉圝奱孌孿巒攣曫欒灓羉臠圞灤虊"
+    "鑾癴癵鸞卵乱釠亂畧锊稤圙鋝鋢擽抡掄仑伦囵沦纶侖轮倫陯圇婨崘崙惀淪"
+    "菕棆腀綸蜦踚輪錀鯩埨碖稐耣论溣論磮罗啰頱囉罖猡脶萝逻椤腡覙锣箩骡"
+    "镙螺羅覶鏍儸覼騾攞玀蘿邏欏驘鸁籮鑼饠剆倮蓏裸躶瘰蠃臝曪癳泺峈洛络"
+    "荦骆洜珞硦笿絡落嗠摞漯犖鉻雒駱鮥鴼鵅濼纙呣妈孖媽嬤嬷麻痲蔴犘蟇马"
+    "玛码蚂馬溤瑪碼螞鎷鰢鷌犸杩祃閁骂唛傌獁睰嘜榪禡罵駡礣鬕亇吗嗎遤嘛"
+    "嫲蟆埋薶霾买荬買嘪蕒鷶劢迈佅売麦卖脉脈麥衇勱賣邁霡霢嫚颟姏悗蛮僈"
+    "谩慲馒樠瞒瞞鞔謾饅鳗顢鬗鬘鰻蠻屘満睌满滿螨襔蟎鏋矕曼鄤墁幔慢摱漫"
+    "獌缦蔄蔓槾熳澷镘縵鏝蘰牤邙吂忙汒芒尨杗杧氓盲恾笀茫哤娏庬浝狵牻硭"
+    "釯铓痝蛖鋩駹莽莾硥茻壾漭蟒蠎猫貓毛矛枆牦茅茆旄罞兞渵軞酕堥锚嫹髦"
+    "氂犛蝥髳錨蟊鶜冇卯夘乮戼峁泖昴铆笷蓩冃皃芼冐茂冒柕眊贸耄袤覒媢帽"
+    "萺貿鄚愗暓楙毷瑁瞀貌鄮蝐懋么麼嚒濹嚜癦呅坆沒没枚玫苺栂眉娒脄莓梅"
+    "珻脢郿堳媒嵋湄湈猸睂葿楣楳煤瑂禖塺槑酶镅鹛鋂霉穈徾鎇矀攗蘪鶥黴毎"
+    "每凂美挴浼媄嵄渼媺腜镁嬍燘鎂黣妹抺沬旀昧祙袂眛媚寐痗跊鬽煝睸韎魅"
+    "篃蝞躾门扪玧钔門閅捫菛璊鍆亹虋闷焖悶暪燜懑懣们們椚甿虻冡莔萌萠盟"
+    "蒙甍儚橗瞢蕄蝱鄳鄸幪懞濛曚朦檬氋矇礞鯍鹲艨蘉矒霿靀饛顭鼆鸏勐猛瓾"
+    "锰艋蜢懜獴錳懵蠓鯭孟梦夢溕夣霥掹擝咪眯瞇冞弥罙祢迷猕谜蒾詸謎醚彌"
+    "擟糜縻麊麋禰靡瀰獼麛镾戂攠瓕蘼爢醾醿鸍釄米芈侎沵羋弭洣敉眫脒渳葞"
+    "蔝銤濔孊灖冖糸汨沕宓泌觅峚祕宻秘密淧淿覓覔幂谧塓幎覛嘧榓滵漞熐蔤"
+    "蜜鼏冪樒幦濗藌謐櫁簚羃宀芇眠婂绵媔棉綿緜臱蝒嬵檰櫋矈矊矏丏汅免沔"
+    "黾勉眄娩偭冕勔渑喕愐湎缅葂絻腼黽緬麫澠鮸靣面糆麪麺麵喵苗媌描瞄鹋"
+    "緢鶓鱙杪眇秒淼渺缈篎緲藐邈妙庙玅竗庿廟乜吀咩哶孭灭烕覕搣滅蔑薎鴓"
+    "幭懱篾櫗蠛衊鑖鱴民姄岷忞怋旻旼苠珉盿砇罠崏捪琘缗敯瑉痻碈鈱緍緡錉"
+    "鴖鍲皿冺刡闵抿泯勄敃闽悯敏笢惽湣閔愍暋閩僶慜憫潣簢鳘蠠鰵垊笽名明"
+    "鸣洺眀茗冥朙眳铭鄍嫇溟猽蓂暝榠銘鳴瞑螟覭佲姳凕慏酩命椧詺掵谬謬摸"
+    "谟嫫馍摹模膜麽摩橅磨糢謨嚤擵饃嚩嚰蘑髍魔劘饝抹懡末劰圽妺帓歾歿殁"
+    "沫茉陌帞昩枺唜皌眜眿砞秣莈莫眽粖絈湐蛨貃嗼塻寞漠獏蓦貊暯銆靺嫼黙"
+    "瘼瞐瞙镆魩墨默瀎謩貘藦蟔鏌爅驀礳纆耱庅怽尛魹麿哞牟侔劺恈洠眸谋蛑"
+    "缪踎鉾謀瞴繆鍪鴾麰某毪氁墲母亩牡坶姆峔牳畆畒胟畝畞砪畮鉧踇木仫朰"
+    "目沐狇炑牧苜毣莯蚞钼募雮墓幕幙慔楘睦鉬慕暮艒霂穆縸鞪凩拇嗯拏拿挐"
+    "嗱镎鎿乸哪雫那妠纳肭娜衲钠納袦捺笝豽軜貀鈉蒳靹魶腉熋摨孻乃奶艿氖"
+    "疓妳廼迺倷釢嬭奈柰耏耐萘渿鼐褦螚錼囡男枏枬侽南柟娚畘莮难喃暔楠諵"
+    "難赧揇湳萳腩蝻戁婻遖囔乪嚢譨囊蠰鬞馕欜饢擃曩攮灢儾齉孬呶怓挠峱硇"
+    "铙猱蛲詉碙撓嶩憹蟯夒譊鐃巎垴恼悩脑匘堖惱嫐瑙腦碯獶獿闹婥淖閙鬧臑"
+    "脳疒讷抐眲訥吶呐呢娞馁脮腇餒鮾鯘內内氝錗恁嫩嫰能妮尼坭怩泥籾倪屔"
+    "秜郳铌埿婗淣猊蚭棿跜腝聣蜺觬貎輗霓鲵鯓鯢麑齯臡伱你拟抳狔苨柅旎晲"
+    "孴鈮馜儗儞隬擬薿檷聻屰氼伲迡昵胒逆匿眤堄惄嫟愵溺睨腻暱縌誽膩嬺袮"
+    "拈蔫年秊秥鲇鮎鲶黏鯰涊捻淰焾跈辇辗撚撵碾輦簐蹍攆蹨躎卄廿念姩唸埝"
+    "艌鼰哖鵇嬢孃酿醸釀娘鸟茑袅鳥嫋裊蔦樢嬝褭嬲尿脲捏揑苶帇圼枿陧涅痆"
+    "聂臬啮惗菍隉喦敜湼嗫嵲踂噛摰槷踗镊镍嶭篞臲錜颞蹑嚙聶鎳闑孼孽櫱籋"
+    "蘖囁齧糱糵蠥鑈囓讘躡鑷顳钀巕囜您拰脌宁咛拧狞苧柠聍寍寕甯寗寜寧儜"
+    "凝嚀嬣擰獰薴檸聹鑏鬡鸋橣矃佞侫泞濘澝妞牛汼忸扭狃纽炄钮紐莥鈕靵衂"
+    "牜农侬哝浓脓秾農儂辳噥濃蕽檂燶禯膿穠襛醲欁繷弄挊癑齈羺啂槈耨獳檽"
+    "鎒鐞譳奴孥驽笯駑伮努弩砮胬怒傉搙女钕籹釹沑恧朒衄奻渜暖煖煗餪疟虐"
+    "硸瘧黁郍挪梛傩儺橠诺喏掿逽愞搦锘搻榒稬諾蹃糑懦懧糥穤糯喔噢哦筽讴"
+    "沤欧殴瓯鸥塸漚歐毆熰甌鴎櫙謳鏂鷗膒齵吘呕偶腢嘔耦蕅藕怄慪藲妑皅趴"
+    "舥啪葩杷爬掱琶筢潖帊帕怕袙拍俳徘排猅棑牌輫簰簲犤廹哌派湃蒎鎃眅砙"
+    "畨潘攀爿洀盘跘媻幋蒰搫槃盤磐縏磻蹒瀊蟠蹣鎜鞶冸判沜拚泮炍叛牉盼畔"
+    "聁袢詊溿頖鋬襻鑻鵥乓沗胮雱滂膖霶厐庞厖逄旁舽嫎徬螃鳑龎龐嗙耪覫炐"
+    "肨胖抛拋脬刨咆垉庖狍炰爮袍匏軳鞄麃麅跑奅泡炮疱皰砲麭礟礮萢褜呸怌"
+    "肧柸胚衃醅阫陪培毰赔锫裴裵賠駍俖伂沛佩帔姵斾旆浿珮配笩辔馷嶏霈轡"
+    "蓜喷噴歕瓫盆湓葐呠翸喯匉怦抨恲砰梈烹硑軯閛漰嘭澎磞芃朋挷竼倗莑堋"
+    "弸彭棚椖塳硼稝蓬鹏槰樥熢憉輣篣膨錋韸髼蟚蟛鬅纄韼鵬騯鬔鑝捧淎皏剻"
+    "掽椪碰踫篷丕伓伾批纰邳坯披抷炋狉砒悂秛秠紕铍旇翍耚豾鈈鈚鈹鉟銔劈"
+    "磇駓髬噼錍魾鮍憵礔礕霹皮阰芘岯枇毞狓肶毗毘疲蚍郫陴啤埤崥蚽蚾豼焷"
+    "琵脾腗鲏罴膍蜱魮壀篺螷貔鵧羆朇鼙匹庀疋仳圮苉脴痞銢諀鴄擗噽癖嚭屁"
+    "淠渒揊釽媲嫓睥辟潎稫僻澼嚊甓疈譬闢鷿鸊榌囨偏媥犏篇翩鍂鶣骈胼腁楄"
+    "楩賆跰諚骿蹁駢騈覑谝貵諞片骗騗騙魸剽慓缥飘旚翲螵犥飃飄魒嫖瓢竂薸"
+    "闝殍彯瞟篻縹醥皫顠票僄勡嘌徱漂氕撇撆暼瞥丿苤鐅嫳姘拼礗穦馪驞玭贫"
+    "娦貧琕嫔频頻嬪獱薲嚬矉蠙颦顰品榀牝汖聘乒甹俜娉涄砯聠艵竮頩平评凭"
+    "呯坪泙苹郱屏帡枰洴玶胓荓瓶屛帲淜萍蚲幈焩甁缾蓱蛢評軿鲆凴慿箳輧憑"
+    "鮃檘簈蘋岼塀钋坡岥泊颇溌鉕頗鏺婆嘙蔢鄱皤謈櫇叵尀钷笸駊岶炇迫敀昢"
+    "洦珀烞破砶釙粕蒪魄醗泼桲潑剖娝抔抙捊掊裒箁錇咅哣婄犃廍仆攴扑陠噗"
+    "撲潽擈鯆匍莆脯菩菐葡蒱蒲僕酺墣獛璞濮瞨穙镤襥纀鏷圤朴圃浦烳普溥谱"
+    "諩樸氆檏镨譜蹼鐠铺舖舗鋪瀑曝巬巭駇贌七迉沏妻柒倛凄栖桤郪娸悽桼淒"
+    "萋攲期棲欺蛣僛嘁慽榿漆緀慼槭諆諿霋蹊魌鏚鶈亓祁齐圻岐岓忯芪亝其奇"
+    "斉歧畁祇祈肵俟疧竒剘斊旂耆脐蚑蚔蚚颀埼崎帺掑淇猉畦萁萕跂軝釮骐骑"
+    "棊棋琦琪祺蛴愭碁碕锜頎鬿旗粸綥綦綨蜝蜞齊璂禥蕲踑錡鲯懠濝藄檱櫀臍"
+    "騎騏鳍蘄鯕鵸鶀麒纃艩蠐鬐鰭玂麡乞邔企屺岂芑启呇杞玘盀唘豈起啓啔婍"
+    "啟绮晵棨綮綺諬闙气讫忔気汔迄弃汽矵芞呮泣炁盵咠契砌栔氣訖唭欫夡棄"
+    "湆湇葺碛摖暣甈碶噐憇器憩磜磧磩罊蟿鼜缼戚渏褄緕螧簯簱籏掐葜拤跒酠"
+    "圶冾帢恰洽殎硈愘髂鞐千仟阡圱圲奷扦汘芊迁佥岍杄汧瓩茾欦臤钎拪牵粁"
+    "兛悭蚈谸铅婜孯牽釺掔谦鈆雃僉愆签鉛骞鹐慳搴撁箞諐遷褰謙顅檶攐攑櫏"
+    "簽鵮孅攓騫鬝鬜籤韆仱岒忴扲拑前钤歬虔钱钳掮揵軡媊鈐靬鉗墘榩箝銭潛"
+    "潜羬蕁橬錢黔黚騝濳騚灊鰬凵浅肷淺脥嗛嵰遣槏膁蜸谴缱繾譴欠刋芡俔茜"
+    "倩悓堑傔嵌棈椠慊皘蒨塹歉綪蔳儙槧篏輤篟壍縴鰜竏鎆鏲籖鑓呛羌戕戗斨"
+    "枪玱羗猐跄椌溬腔嗆蜣锖嶈戧槍牄瑲羫锵篬錆謒蹌镪蹡鎗鏘丬強强墙嫱蔷"
+    "樯漒蔃墻嬙廧薔檣牆艢蘠抢羟搶羥墏繈襁繦鏹炝唴熗羻嗴獇悄硗郻嵪跷鄡"
+    "鄥劁敲毃踍锹墝頝骹墽幧橇燆缲磽鍫鍬繑趬蹺鐰乔侨荍荞桥硚菬喬僑谯嘺"
+    "嫶憔蕎鞒樵橋癄瞧礄藮趫鐈鞽顦巧釥愀髜俏诮陗峭帩窍殻翘誚髚僺撬撽鞘"
+    "韒竅翹譙躈槗犞癿聺且切妾怯郄匧窃悏挈洯惬淁笡愜蛪朅箧緁锲篋踥穕藒"
+    "鍥鯜鐑竊苆倿媫籡亲侵钦衾骎媇嵚欽綅誛嶔親顉駸鮼寴庈芩芹埁珡秦耹菦"
+    "蚙捦菳琴琹禽鈙雂勤嗪嫀溱靲慬噙擒斳鳹懄檎澿瘽螓懃蠄鬵鵭坅昑笉梫赾"
+    "寑锓寝寢鋟螼吢吣抋沁唚菣揿搇撳瀙藽狅靑青氢轻倾卿郬圊埥寈氫淸清傾"
+    "蜻輕鲭鑋夝甠剠勍情殑晴棾氰葝暒擏樈擎檠黥苘顷请庼頃廎漀請檾庆凊掅"
+    "殸碃箐靘慶磘磬罄謦硘櫦芎匔卭邛宆穷穹茕桏笻筇赹惸焪焭琼舼蛩蛬煢睘"
+    "跫銎瞏窮儝憌橩璚藑瓊竆藭瓗熍丘丠邱坵恘秋秌蚯媝萩楸蓲鹙篍緧蝵穐趥"
+    "鳅蟗鞦鞧鰌鰍鶖蠤龝叴囚扏犰玌汓肍求虬泅虯俅觓訄訅酋釓唒浗紌莍逎逑"
+    "釚梂殏毬球赇崷巯渞湭皳盚遒煪絿蛷裘巰觩賕璆蝤銶醔鮂鼽鯄鰽搝糗釻蘒"
+    "区曲伹佉匤岖诎阹驱坥屈岨岴抾浀祛胠袪區紶蛆躯筁粬蛐詘趋嶇憈駆敺誳"
+    "镼駈麹髷魼趨麯覰軀麴黢覻驅鰸鱋佢劬斪朐胊菃鸲淭渠絇翑葋軥蕖璖磲螶"
+    "鴝璩蟝瞿鼩蘧忂灈戵欋氍籧臞癯蠷衢躣蠼鑺鸜取竘娶詓竬蝺龋齲厺去刞呿"
+    "唟耝阒觑趣閴麮闃覷鼁迲衐峑弮恮悛圈圏棬駩鐉全权佺诠姾泉洤荃拳牷辁"
+    "啳埢婘惓痊硂铨湶犈筌絟葲搼瑔觠詮跧輇蜷銓権踡縓醛鳈鬈騡孉巏鰁權齤"
+    "蠸颧顴犬汱畎烇绻綣虇劝券牶勧韏勸犭椦楾闎缺蒛阙瘸却卻埆崅寉悫琷雀"
+    "硞确阕塙搉皵碏愨榷墧慤確碻趞燩闋礐闕灍礭鹊鵲夋囷峮逡宭帬裙羣群裠"
+    "呥肰衻袇蚦袡蚺然髥嘫髯燃繎冄冉姌苒染珃媣橪蒅穣儴勷瀼獽蘘禳瓤穰躟"
+    "鬤壌嚷壤攘爙纕让懹譲讓娆荛饶桡嬈蕘橈襓饒扰隢擾绕遶繞惹热熱人亻仁"
+    "壬忈朲忎秂芢鈓魜銋鵀忍荏栠栣荵秹棯稔刃刄认仞仭讱任屻岃扨纫妊杒牣"
+    "纴肕轫韧饪姙祍紉衽紝訒軔梕袵軠絍腍葚靭靱韌飪認餁綛躵扔仍辸礽陾芿"
+    "日驲囸釰鈤馹茸戎肜栄狨绒茙荣容毧烿媶嵘搑絨羢嫆嵤搈榵溶蓉榕榮熔瑢"
+    "穁縙蝾褣镕融螎駥髶嬫嶸爃鎔巆瀜曧蠑冗宂坈傇軵氄鴧穃厹禸柔媃揉渘葇"
+    "煣瑈糅蝚蹂輮鍒鞣瓇騥鰇鶔粈楺韖肉宍腬邚如侞帤茹桇袽铷渪筎蒘銣蕠蝡"
+    "儒鴑嚅嬬孺濡薷鴽曘燸襦蠕颥醹顬鱬汝肗乳辱鄏擩入洳嗕媷溽缛蓐褥縟扖"
+    "込杁鳰嶿挼堧撋壖阮朊软耎偄軟媆瑌碝緛輭瓀礝婑桵甤緌蕤蕊蕋橤繠蘂蘃"
+    "汭芮枘蚋锐瑞蜹睿銳鋭叡壡瞤闰润閏閠潤橍膶捼叒若偌弱鄀渃焫楉蒻箬篛"
+    "爇鰙鰯鶸嵶仨挱挲撒洒訯靸潵灑躠卅泧飒脎萨鈒摋馺颯薩櫒虄隡毢愢揌塞"
+    "毸腮噻鳃顋鰓嗮赛僿賽簺嘥三弎叁毵毿犙鬖仐伞傘糁糂馓糝糣糤繖鏒鏾霰"
+    "饊俕帴悷散閐壭毶厁橵桒桑嗓搡磉褬颡鎟顙丧喪槡掻慅搔溞骚缫繅臊鳋騒"
+    "騷鰠鱢扫掃嫂埽瘙氉矂髞螦閪色洓栜涩啬铯雭歮琗嗇瑟歰銫澁懎擌濇瘷穑"
+    "澀璱瀒穡繬轖鏼譅飋渋濏穯森椮槮襂僧鬙杀沙纱乷刹剎砂唦殺猀粆紗莎桬"
+    "毮铩痧硰煞蔱裟榝樧魦鲨鎩鯊鯋傻儍倽唼啑啥帹萐厦喢廈歃翜箑翣閯霎繌"
+    "筛酾篩簁簛釃繺晒閷曬山彡邖删刪杉芟姍姗苫衫钐埏挻柵狦珊舢痁脠軕笘"
+    "跚剼搧嘇幓煽潸澘檆縿膻鯅羴羶闪陕陝閃晱煔睒熌覢讪汕疝剡扇訕赸掞釤"
+    "傓善銏骟僐鄯墠墡潬缮嬗擅樿歚膳磰謆赡繕蟮蟺譱贍鐥饍騸鳝灗鱓鱔圸杣"
+    "閊敾伤殇商觞傷墒慯滳漡蔏殤熵螪觴謪鬺垧扄晌赏賞贘鑜丄上尙尚恦绱緔"
+    "鞝仩裳弰捎烧莦梢焼稍旓筲艄蛸輎燒颵髾鮹勺芍苕柖玿竰韶少劭卲邵绍哨"
+    "娋袑紹睄綤潲蕱奢猞赊畬畲輋賒賖檨舌佘虵蛇蛥舍捨厍设社厙射涉涻渉設"
+    "赦弽慑摂摄滠慴摵蔎歙蠂韘騇懾攝灄麝欇舎申屾扟伸身侁呻妽籶绅诜姺柛"
+    "氠珅穼籸娠峷甡眒砷莘敒深紳兟棽葠裑訷蓡詵甧蔘燊薓駪鲹曑鵢鯵鰺什甚"
+    "神邥弞审矤哂矧宷谂谉婶渖訠審諗頣魫曋頥瞫嬸瀋覾讅肾侺昚胂涁眘渗祳"
+    "脤腎愼慎椹瘆罧蜃蜄滲鋠瘮堔榊鰰升生阩呏声斘昇泩狌苼栍殅牲珄陞陹笙"
+    "湦焺甥鉎聲鼪鵿绳憴繩譝省眚偗渻圣胜晠剰盛剩勝貹嵊琞聖墭榺蕂賸竔曻"
+    "橳尸失师呞虱诗邿鸤屍施浉狮師絁釶湤湿葹鈟溮溼獅蒒蓍詩鉇鉈瑡鳲蝨鳾"
+    "褷鲺濕鍦鯴鰤鶳襹十饣石辻乭时实実旹飠姼峕炻祏蚀食埘時莳寔湜遈塒溡"
+    "蒔鉐實榯蝕鲥鼫鼭鰣史矢乨豕使始驶兘宩屎笶鉂駛士氏礻丗世仕市示似卋"
+    "式忕亊叓戺事侍势呩柹视试饰冟室恀恃拭是昰枾柿眂贳适栻烒眎眡舐轼逝"
+    "铈視豉釈媞崼弑徥揓谥貰释勢嗜弒睗筮觢試軾鈰鉃飾舓誓適鉽奭銴餙餝噬"
+    "嬕澨諟諡遾螫謚簭襫釋佦竍识拾匙嵵榁煶篒鮖籂識鰘収收手守垨首艏寿受"
+    "狩兽售授涭绶痩壽夀瘦綬獸鏉扌獣书殳尗抒纾叔杸枢陎姝倏倐書殊紓掓梳"
+    "淑焂菽軗鄃疎疏舒摅毹綀输瑹跾踈樞蔬輸橾鮛儵攄鵨秫婌孰赎塾熟璹贖鼡"
+    "属暑暏黍署蜀鼠潻薥薯曙癙藷襡襩屬钃朮术戍束沭述侸凁咰怷树竖荗恕捒"
+    "庶庻絉蒁術隃尌裋数竪腧鉥墅漱潄數澍豎樹濖錰鏣鶐虪瀭糬蠴鱪鱰刷唰耍"
+    "誜衰摔甩帅帥蟀卛闩拴閂栓涮腨双霜雙孀骦孇騻欆礵鷞鹴艭驦鸘爽塽慡漺"
+    "樉縔灀鏯谁脽誰水帨涗涚祱稅税裞睡瞓氵氺閖吮顺舜順蕣橓瞚瞬鬊说哾說"
+    "説妁烁朔铄欶硕矟搠蒴槊獡碩箾鎙爍鑠厶纟丝司糹私咝泀思虒鸶媤斯絲缌"
+    "蛳楒禗鉰飔凘厮榹禠罳蜤锶嘶噝廝撕澌磃緦蕬鋖燍螄蟖蟴颸騦鐁鷥鼶籭死"
+    "巳亖四寺汜佀兕姒泤祀価孠杫泗饲驷娰柶牭洍涘肂飤笥耜釲竢覗嗣肆貄鈶"
+    "鈻飼禩駟蕼儩瀃俬恖銯忪松枀娀柗倯凇崧庺梥淞菘嵩硹蜙憽濍檧鍶鬆怂悚"
+    "耸竦傱愯楤嵷慫聳駷讼宋诵送颂訟頌誦餸枩鎹捜鄋嗖廀廋搜溲獀蒐蓃馊摉"
+    "飕摗锼艘螋醙鎪餿颼颾騪叜叟傁嗾瞍擞薮擻藪櫢籔膄瘶嗽苏甦酥稣窣穌蘇"
+    "蘓櫯囌俗玊夙泝肃洬涑珟素莤速宿梀殐粛骕傃粟谡嗉塐塑嫊愫溯溸肅遡鹔"
+    "僳愬榡膆蔌觫趚遬憟樎樕潥碿鋉餗潚縤橚璛簌藗謖蹜驌鱐鷫诉訴鯂狻痠酸"
+    "匴祘笇筭蒜算夊攵芕虽倠哸浽荽荾眭葰滖睢綏熣濉鞖雖绥隋随遀隨瓍瀡膸"
+    "髄髓亗岁砕祟谇埣嵗遂歲歳煫睟碎隧嬘澻穂誶賥檖燧璲禭檅穗穟繀襚邃旞"
+    "繐繸譢鐆鐩韢孙狲荪孫飧搎猻蓀飱槂蕵薞损笋隼筍損榫箰簨鎨鶽唆娑莏傞"
+    "桫梭睃嗍羧蓑摍缩趖簑簔縮髿鮻所乺唢索琐惢锁嗩暛溑瑣褨璅鎈鎍鎖鎻鏁"
+    "逤溹蜶琑嗦他它她牠祂趿铊塌榙溻褟嚃闧蹹塔溚墖獭鳎獺鰨亣拓挞狧闼崉"
+    "涾搨跶遝遢榻毾禢撻澾誻踏橽錔濌蹋鞜鮙闒鞳嚺闥譶躢侤咜囼孡胎冭台旲"
+    "邰坮抬苔枱炱炲菭跆鲐箈臺颱駘儓鮐嬯擡薹檯籉太夳忲汰态肽钛泰舦酞鈦"
+    "溙態燤粏坍抩贪怹痑舑貪摊滩瘫擹攤灘癱坛昙倓谈郯婒惔覃榃痰锬谭墰墵"
+    "憛潭談醈壇曇燂錟餤檀磹顃罈藫壜譚貚醰譠罎忐坦袒钽菼毯鉭嗿憳憻醓璮"
+    "襢叹炭埮探傝湠僋嘆碳舕歎賧汤坣铴湯嘡耥劏羰蝪薚镗蹚鏜鐋鞺鼞饧唐堂"
+    "傏啺棠鄌塘搪溏蓎隚榶漟煻瑭禟膅樘磄糃膛橖篖糖螗踼糛螳赯醣餳鎕餹闛"
+    "饄鶶伖帑倘偒淌傥躺镋鎲儻戃曭爣矘钂烫摥趟燙夲弢涛绦掏絛詜嫍幍慆搯"
+    "滔槄瑫韬飸縚縧濤謟轁鞱韜饕匋迯咷洮逃桃陶啕梼淘绹萄祹裪綯蜪鞀醄鞉"
+    "鋾錭駣檮饀騊鼗讨討套忑忒特貣蚮铽慝鋱螣蟘熥膯鼟疼痋幐腾誊漛滕邆縢"
+    "駦謄儯藤騰籐鰧籘驣霯虅剔梯锑踢擿鷈鷉苐厗荑绨偍啼崹惿提稊缇罤遆鹈"
+    "嗁瑅綈碮褆徲漽緹蕛蝭銻题趧蹄醍謕蹏鍗鳀鴺題鮷鵜騠鯷鶗鶙禵鷤体挮躰"
+    "骵鮧軆體戻迏剃朑洟倜悌涕逖悐惕掦逷惖揥替楴裼褅歒殢髰薙嚏鬀嚔瓋籊"
+    "趯屉屜笹嵜天兲婖添酟靔黇靝田屇沺恬畋畑盷胋畠甛甜菾湉塡填搷鈿阗緂"
+    "磌窴璳闐鷆鷏忝殄倎唺悿淟晪琠腆觍痶睓舔餂覥賟錪鍩靦掭睼舚碵鴫旫佻"
+    "庣恌挑祧聎芀条岧岹迢祒條笤萔蓚蓨趒龆樤蜩鋚鞗髫鲦鯈鎥齠鰷宨晀朓脁"
+    "窕誂斢窱嬥眺粜絩覜跳糶螩帖怗贴萜聑貼铁蛈僣銕鋨鴩鐡鐵驖呫飻餮厅庁"
+    "汀艼听町耓厛烃桯烴綎鞓聴聼廰聽廳邒廷亭庭莛停婷嵉渟筳葶蜓楟榳閮霆"
+    "聤蝏諪鼮圢甼侹娗挺涏梃烶珽脡艇颋誔頲囲炵通痌嗵蓪仝同佟彤峂庝哃峝"
+    "狪茼晍桐浵烔砼蚒眮秱铜童粡筩詷赨酮鉖僮勭鉵銅餇鲖潼獞曈朣橦氃燑犝"
+    "膧瞳鮦统捅桶筒統綂樋恸痛衕慟憅偷偸婾媮鋀鍮亠头投骰緰頭妵钭紏敨飳"
+    "黈蘣透綉凸宊禿秃怢突唋涋捸堗湥痜葖嶀鋵鵚鼵図图凃峹庩徒悇捈荼途屠"
+    "梌菟揬稌圕塗嵞瘏筡腯蒤鈯圖圗廜潳跿酴馟鍎駼鵌鶟鷋鷵土圡吐钍釷兎迌"
+    "兔堍鵵汢涂莵湍猯煓貒团団抟剸團慱摶漙槫篿檲鏄糰鷒鷻疃彖湪褖推蓷藬"
+    "弚颓隤尵頹頺頽魋穨蘈蹪俀腿僓蹆骽侻退娧煺蛻蜕褪駾吞呑涒啍朜焞噋暾"
+    "黗屯坉忳芚饨豘豚軘飩鲀魨霕臀臋氽畽旽乇仛讬托扡汑饦杔侂咃拕拖沰挩"
+    "捝莌袥託涶脫脱飥魠驝驮佗陀陁坨岮沱沲狏迱砣砤袉鸵紽堶跎酡碢馱槖駄"
+    "駞橐鮀鴕鼧騨鼍驒鼉彵妥庹媠椭楕嫷橢鵎鬌鰖柝毤唾萚跅毻箨蘀籜驼駝穵"
+    "劸挖洼娲畖窊媧嗗蛙搲溛漥窪鼃攨娃瓦佤邷咓袜聉嗢腽膃襪韈韤屲瓲哇歪"
+    "喎竵崴外夞顡弯剜婠帵塆湾蜿潫豌彎壪灣丸刓汍纨芄完岏抏玩紈捖顽烷琓"
+    "頑翫宛倇唍挽盌埦婉惋晚梚绾脘菀萖晩晼椀琬皖畹睕碗綩綰輓踠鋄鋔万卍"
+    "卐妧忨捥脕貦萬腕輐澫薍錽蟃贃鎫贎邜杤笂尣尪尫汪尩亡亾兦王仼彺莣蚟"
+    "罒网往徃罔徍惘菵暀棢蛧辋網蝄誷輞瀇魍妄忘迋旺盳望朢枉焹危威烓偎萎"
+    "逶隇隈喴媙愄揋揻渨葨葳微椳楲溦煨詴蜲蝛覣薇燰鳂巍鰃鰄囗韦圩围帏沩"
+    "违闱峗峞洈韋桅涠唯帷惟硙维喡圍媁嵬幃湋溈琟違潍維蓶鄬潙潿磑醀濰鍏"
+    "闈鮠癓覹犩霺欈厃伟伪尾纬芛苇委炜玮洧娓屗浘荱诿偉偽崣梶痏硊骩嵔徫"
+    "愇猥葦蒍骪骫暐椲煒瑋痿腲艉韪僞撱磈鲔寪緯蔿諉踓韑頠薳儰濻鍡鮪壝瀢"
+    "韙颹韡蘤斖卫为未位味苿為畏胃叞軎尉菋谓喂媦渭爲煟碨蔚蜼慰熭犚緭衛"
+    "懀璏罻衞謂餧鮇螱褽餵魏藯轊鏏霨鳚蘶饖讆躗讏躛捤煀猬墛縅蝟嶶昷塭温"
+    "榅殟溫瑥辒瘟蕰豱輼轀鳁鞰鰛鰮匁文彣纹芠炆玟闻紋蚉蚊珳阌琝雯瘒聞馼"
+    "魰鳼鴍螡閺閿蟁闅鼤闦刎吻忟抆呡肳紊桽脗稳穏穩问妏汶莬問渂揾搵顐璺"
+    "呚鈫鎾翁嗡滃鹟螉鎓鶲勜奣塕嵡蓊暡瞈聬瓮蕹甕罋齆挝倭涡莴唩涹渦猧萵"
+    "窝窩蜗撾蝸踒我婐捰仴沃肟卧枂臥偓捾涴媉幄握渥焥硪楃腛斡瞃擭濣瓁臒"
+    "雘龌齷乌圬弙汙汚污邬呜巫杇屋洿诬钨烏剭窏鄔嗚歍誣箼螐鴮鎢鰞无毋吳"
+    "吴吾呉芜郚唔娪洖浯茣莁梧珸祦無铻鹀禑蜈誈蕪璑蟱鯃鵐譕鼯鷡五午仵妩"
+    "庑忤怃旿武玝侮俉倵捂啎娬牾珷摀碔鹉熓瑦舞嫵廡憮潕儛橆甒鵡躌兀勿戊"
+    "阢伆屼扤坞岉杌芴迕忢物矹卼敄误悞悟悮粅逜晤焐婺嵍痦隖靰骛塢奦嵨溩"
+    "雺雾寤熃誤鹜遻鋈窹霚鼿霧齀蘁騖鶩乄务伍務錻夕兮吸忚扱汐覀希扸卥昔"
+    "析穸肸肹俙徆怸恓郗饻唏奚屖悕氥浠牺狶莃唽悉惜捿晞桸欷淅烯焁焈琋硒"
+    "菥赥釸傒惁晰晳焟焬犀睎稀粞翕舾鄎厀嵠徯溪皙蒠锡僖榽煕熄熈熙緆蜥豨"
+    "餏嘻噏嬆嬉嶲潝瘜磎膝凞憙樨橀熹熺熻窸縘羲螅螇錫燨瞦蟋谿豀豯貕糦繥"
+    "雟鵗觹譆醯鏭隵巇曦爔犧酅觽鼷蠵鸂觿鑴习郋席習袭觋媳椺蒵蓆嶍漝覡趘"
+    "槢薂隰檄謵鎴霫鳛飁騱騽襲鰼驨枲洗玺徙铣喜葈葸鈢鉨鉩屣漇蓰憘暿歖禧"
+    "諰壐縰謑蟢蹝璽囍鱚矖躧匸卌戏屃系饩呬忥怬矽细係咥恄盻郤欯绤細釳阋"
+    "喺椞翖舃舄趇隙慀滊禊綌赩隟墍熂犔稧潟澙蕮覤戱黖戲磶虩餼鬩繫嚱闟霼"
+    "屭衋西息渓橲犠礂鯑虲疨虾谺傄閕煆煵颬瞎蝦鰕匣侠狎俠峡柙炠狭陜峽烚"
+    "狹珨祫硖翈舺陿硤遐敮暇瑕筪舝碬辖磍縀蕸縖赮魻轄鍜霞鎋黠騢鶷閜丅下"
+    "乤吓疜夏睱嚇懗罅鎼夓鏬圷梺溊仚屳先奾纤佡忺氙杴祆秈苮枮籼珗莶掀訮"
+    "铦跹酰锨僊嘕銛鲜暹韯嬐憸薟鍁褼韱鮮蹮馦廯攕纎鶱襳躚纖鱻伭闲妶弦贤"
+    "咸唌挦涎胘娴娹婱絃舷蚿衔啣痫蛝閑閒鹇嫌衘甉銜嫺嫻憪撏澖稴誸賢燅諴"
+    "輱醎癇癎瞯藖礥鹹麙贒鷳鷴鷼冼狝显险崄毨烍猃蚬険赻筅尟尠搟禒跣銑箲"
+    "險嶮獫獮藓鍌燹顕幰攇櫶蘚譣玁韅顯灦伣县咞岘苋现线臽限姭宪県陥哯垷"
+    "娊娨峴涀莧陷晛現硍馅睍絤缐羡献粯羨腺蜆僩僴綫誢撊線鋧憲橌縣錎餡壏"
+    "豏麲瀗臔獻糮鼸仙僲繊鑦乡芗相香郷厢啌鄉鄊廂湘缃葙鄕稥薌箱緗膷襄忀"
+    "骧麘欀瓖镶鑲驤瓨佭详庠栙祥絴翔詳跭享亯响饷晑飨想銄餉鲞曏蠁鮝鯗響"
+    "饗饟鱶向姠巷蚃项珦象塂缿萫衖項像勨嶑銗橡襐嚮蟓闀鐌鱌楿鱜灱灲呺枭"
+    "侾哓枵骁哮宯宵庨消绡虓逍鸮婋梟焇猇萧痚痟硝硣窙翛萷销揱綃嘋嘐歊潇"
+    "箫踃嘵憢獢銷霄彇膮蕭魈鴞穘簘藃蟂蟏鴵嚣瀟簫蟰髇櫹嚻囂髐蠨驍毊虈洨"
+    "笅郩崤淆訤殽筊誵小晓暁筱筿皛曉篠謏皢孝肖効咲俲效校涍笑啸傚敩詨嘨"
+    "誟嘯歗熽鞩斅斆恷滧些揳猲楔歇蝎蠍劦协旪邪協胁垥奊峫恊拹挟挾脅脇衺"
+    "偕斜谐翓嗋愶携瑎綊熁膎勰撷擕緳缬蝢鞋頡諧燲擷鞵襭攜纈讗龤写冩寫藛"
+    "伳灺泄泻祄绁缷卸洩炧卨娎屑屓偞偰徢械烲焎禼紲亵媟屟渫絏絬谢僁塮榍"
+    "榭褉噧屧暬緤嶰廨懈澥獬糏薢薤邂韰燮褻謝駴瀉鞢瀣爕繲蟹蠏齘齛齥齂躞"
+    "脋夑心邤妡忻芯辛昕杺欣炘盺俽惞訢鈊锌新歆廞鋅嬜薪馨鑫馫枔襑鐔伈阠"
+    "伩囟孞信軐脪衅訫焮煡馸顖舋釁忄噺星垶骍惺猩煋瑆腥蛵觪箵篂鮏曐觲鍟"
+    "騂皨鯹刑行邢形陉侀郉型洐荥钘陘娙硎铏鈃滎鉶銒鋞睲醒擤兴杏姓幸性荇"
+    "倖莕婞悻涬緈興嬹臖哘裄謃凶兄兇匈讻忷汹哅恟洶胷胸訩詾賯雄熊焽诇焸"
+    "詗夐敻休俢修咻庥烋烌羞脩脙鸺臹貅馐樇銝髤髹鎀鵂鏅饈鱃飍苬朽滫綇糔"
+    "秀岫峀珛绣袖琇锈嗅溴璓褎褏銹螑繍繡鏥鏽齅鮴吁戌旴疞盱欨胥须晇訏顼"
+    "虗虚谞媭幁揟湑虛裇須楈窢頊嘘墟需魆噓嬃歔縃蕦蝑諝譃繻魖驉鑐鬚俆徐"
+    "蒣许呴姁诩冔栩珝偦許暊詡稰鄦糈醑盨旭伵序汿芧侐卹怴沀叙恤昫洫垿欰"
+    "殈烅珬勖敍敘勗烼绪续酗喣壻婿朂溆絮訹慉煦蓄賉槒漵潊盢瞁緒聟銊獝稸"
+    "緖魣藇瞲藚續鱮聓続蓿吅轩昍宣弲軒梋谖喧塇媗愃愋揎萱萲暄煊瑄蓒睻儇"
+    "禤箮縇翧蝖鋗懁蕿諠諼鍹駽矎翾藼蘐蠉譞玄玹痃悬旋琁蜁嫙漩暶璇檈璿懸"
+    "咺选晅烜選顈癣癬怰泫昡炫绚眩袨铉琄眴衒渲絢楥楦鉉碹蔙镟鞙颴縼繏鏇"
+    "讂贙鰚削疶蒆靴薛辥辪鞾穴斈乴学岤峃茓泶袕鸴踅壆學嶨澩燢觷雤鷽雪鳕"
+    "鱈血吷坹狘桖谑趐謔瀥膤樰艝轌坃勋埙焄勛塤熏窨蔒勲勳薫駨壎獯薰曛燻"
+    "臐矄蘍壦纁醺廵寻旬巡驯杊畃询峋恂洵浔紃荀荨栒桪毥珣偱尋循揗槆潃詢"
+    "馴鄩鲟噚潯攳樳燖璕蟳鱏鱘灥卂讯伨汛迅侚巺徇狥迿逊殉訊訙奞巽殾稄遜"
+    "愻賐噀潠蕈鵕爋顨鑂训訓嚑丫圧压吖庘押枒垭鸦桠鸭埡孲椏鴉錏鴨壓鵶鐚"
+    "牙伢厑岈芽厓玡琊笌蚜堐崕崖涯猚瑘睚衙漄齖厊庌哑唖啞痖雅瘂蕥劜圠轧"
+    "亚襾讶亜犽迓亞軋娅挜砑俹氩婭掗訝铔揠氬猰聐圔稏窫齾乛呀恹剦烟珚胭"
+    "偣啱崦淊淹焉焑菸阉湮猒腌煙硽鄢嫣漹醃閹嬮懨篶懕臙黫讠延严妍芫言岩"
+    "昖沿炎郔姸娫狿研莚娮盐琂硏閆阎嵒嵓湺筵綖蜒塩揅楌詽碞蔅颜厳虤閻檐"
+    "顏顔嚴壛巌簷櫩黬壧孍巗巖礹鹽麣夵抁沇乵兖奄俨兗匽弇衍偃厣掩眼萒郾"
+    "酓嵃愝扊揜棪渰渷琰遃隒椼罨裺演褗嶖戭蝘魇噞躽縯檿験黡厴甗鰋鶠黤齞"
+    "龑儼黭顩鼴巘巚曮魘鼹齴黶厌闫妟觃牪咽姲彥彦砚唁宴晏烻艳覎验偐焔谚"
+    "隁喭堰敥焰焱硯葕雁傿椻溎滟鳫厭墕暥酽嬊谳餍鴈燄燕諺赝鬳曕鴳酀騐嚥"
+    "嬿艶贋曣爓醶騴鷃灔贗觾讌醼饜驗鷰艷灎釅驠灧讞豓豔灩訁熖樮軅欕央咉"
+    "姎抰泱殃胦眏秧鸯鉠雵鞅鴦扬羊阦阳旸杨炀飏佯劷氜疡钖垟徉昜洋羏烊珜"
+    "眻陽崵崸揚蛘敭暘楊煬禓瘍諹輰鍚鴹颺鐊鰑霷鸉仰佒坱岟养柍炴氧痒紻傟"
+    "楧軮慃氱蝆養駚懩攁癢怏恙样羕詇様漾樣瀁奍羪礢幺夭吆妖枖殀祅訞喓葽"
+    "楆腰鴁邀爻尧尭肴垚姚峣轺倄烑珧窑傜堯揺谣軺嗂媱徭愮搖摇猺遙遥暚榣"
+    "瑤瑶銚飖餆嶢嶤窯窰餚繇謠謡鎐鳐颻蘨邎顤鰩仸宎岆抭杳狕苭咬柼眑窅窈"
+    "舀偠婹崾溔蓔榚鴢鼼闄騕齩鷕穾药要钥袎窔筄葯詏熎覞靿獟鹞薬曜燿艞藥"
+    "矅耀纅鷂讑鑰倻掖椰暍噎潱蠮耶捓揶铘釾鋣鎁擨也吔冶埜野嘢漜壄业叶曳"
+    "页曵邺夜抴亱枼頁晔枽烨啘液谒堨殗腋葉鄓墷楪業馌僷曄曅歋燁擛皣瞱鄴"
+    "靥嶪嶫澲謁餣嚈擫曗瞸鍱擪爗礏鎑饁鵺鐷靨驜鸈爷亪爺一乊弌伊衣医吚壱"
+    "依祎咿洢悘猗郼铱壹揖欹蛜禕嫛漪稦銥嬄噫夁瑿鹥繄檹毉醫黟譩鷖黳乁仪"
+    "匜圯夷迆冝宐沂诒侇怡沶狋衪迤饴咦姨峓恞拸柂珆瓵贻迻宧巸弬扅栘桋眙"
+    "胰袘訑貤痍移耛萓凒羠蛦詑詒貽遗媐暆椸誃跠頉颐飴疑儀熪箷遺嶬彛彜螔"
+    "頤寲嶷簃顊彝彞謻鏔觺讉鸃乙已以钇佁攺矣肔苡苢庡舣蚁釔倚扆笖逘酏偯"
+    "崺旑椅鉯鳦裿旖踦輢敼螘檥礒艤蟻顗轙齮乂义亿弋刈忆艺肊议亦伇屹异芅"
+    "伿佚劮呓坄役抑杙耴苅译邑佾呭呹峄怈怿易枍欥泆炈秇绎诣驿俋奕帟帠弈"
+    "枻洂浂玴疫羿衵轶唈垼悒挹捙栧栺欭浥浳益袣谊陭勚埶埸悥掜殹異硛羛翊"
+    "翌訲訳豙豛逸釴隿幆敡晹棭殔湙焲蛡詍跇軼鈠骮亄兿意溢獈痬睪竩缢義肄"
+    "裔裛詣勩嫕廙榏潩瘗膉蓺蜴靾駅億撎槸毅熠熤熼瘞誼镒鹝鹢黓劓圛墿嬑嬟"
+    "嶧憶懌曀殪澺燚瘱瞖穓縊艗薏螠褹寱斁曎檍歝燡燱翳翼臆賹鮨癔藙藝贀鎰"
+    "镱繶繹豷霬鯣鶂鶃瀷蘙譯議醳醷饐囈鐿鷁鷊懿襼驛鷧虉鷾讛齸辷匇衤宜畩"
+    "萟椬鶍籎囙因阥阴侌垔姻洇茵荫音骃栶殷氤陰凐秵裀铟陻隂喑堙婣愔筃絪"
+    "歅溵禋蔭慇摿瘖銦緸鞇諲霒駰噾闉霠韾冘乑吟犾苂斦烎垠泿圁峾狺珢荶訔"
+    "訚婬寅崟崯淫訡银鈝龂滛碒鄞夤蔩銀噖殥璌誾嚚檭蟫霪齗鷣乚廴尹引吲饮"
+    "蚓赺隐淾鈏飲隠靷飮朄輑磤趛檃瘾隱嶾濥濦螾蘟櫽癮讔印茚洕胤垽堷湚猌"
+    "廕蒑酳慭癊憖憗鮣懚檼粌应応英偀桜莺啨婴媖渶绬朠煐瑛嫈碤锳嘤撄甇緓"
+    "缨罂蝧賏樱璎罃褮鍈霙鴬鹦嬰應膺韺甖鹰鶑鶧嚶孆孾攖罌蘡譍櫻瓔礯譻鶯"
+    "鑍纓蠳鷪鷹鸎鸚盁迎茔盈荧莹営萤营萦蛍溁溋萾僌塋楹滢蓥潆熒瑩蝿嬴營"
+    "縈螢濙濚濴藀覮謍赢瀅鎣攍瀛瀠瀯櫿瀴贏籝籯矨郢浧梬颍颕颖摬影潁璄瘿"
+    "穎頴巊廮癭映暎硬媵膡噟鞕鐛鱦珱愥蝇縄攚蠅灐灜軈哟唷喲佣拥痈邕庸傭"
+    "嗈鄘雍墉嫞慵滽槦噰壅擁澭郺镛臃癕雝鏞鳙廱灉饔鱅鷛癰喁揘牅颙顒鰫永"
+    "甬咏泳俑勇勈栐埇悀柡涌恿傛惥愑湧硧詠塎嵱彮愹蛹慂踊禜鲬踴鯒用苚醟"
+    "怺砽优忧攸呦怮泑幽逌悠麀滺憂優鄾嚘瀀櫌纋耰尢尤由沋犹邮油肬怣斿疣"
+    "峳浟秞莜莸郵铀偤蚰訧逰游猶遊鱿楢猷鈾鲉輏駀蕕蝣魷輶鮋櫾有丣卣苃酉"
+    "羑庮栯羐莠梄聈脜铕湵禉蜏銪槱牖黝懮又右幼佑侑狖糿哊囿姷宥峟柚牰祐"
+    "诱迶唀蚴亴貁釉酭誘鼬友孧蒏牗扜纡迂迃穻陓紆虶唹淤盓毺瘀箊亐于邘伃"
+    "余妤扵杅欤玗玙於盂臾衧鱼乻俞兪禺竽舁茰娛娯娱桙狳谀酑馀渔萸隅雩魚"
+    "堣堬崳嵎嵛愉揄楰渝湡畭硢腴萮逾骬愚旕楡榆歈牏瑜艅虞觎漁睮窬舆褕歶"
+    "羭蕍蝓諛雓餘嬩澞覦踰歟璵螸輿鍝謣髃鮽旟籅騟蘛鰅鷠鸆与予伛宇屿羽雨"
+    "俁俣禹语圄峿祤偊匬圉庾敔鄅斞萭傴寙楀瑀瘐與語窳鋙頨龉噳嶼懙貐斔麌"
+    "蘌齬肀玉驭圫聿芋芌妪忬饫育郁昱狱秗茟俼峪彧浴砡钰预喐域堉悆惐欲淢"
+    "淯谕逳阈喅喩喻媀寓庽御棛棜棫焴琙矞硲裕遇飫馭鹆愈滪煜稢罭艈蒮蓣誉"
+    "鈺預嫗嶎戫毓獄瘉緎蜟蜮輍銉噊慾潏稶蓹薁豫遹鋊鳿澦燏燠蕷諭錥閾鴥鴪"
+    "儥礇禦魊鹬癒礖礜穥篽繘醧鵒櫲饇譽轝鐭霱欎驈鬻籞鱊鷸鸒欝龥軉鬰鬱灪"
+    "籲爩挧荢澚鯲囦鸢剈冤悁眢鸳寃渁渆渊渕惌淵葾棩蒬蜎裷鹓箢鳶蜵駌鴛嬽"
+    "鵷灁鼘鼝元円贠邧员园沅杬垣爰貟原員圆笎蚖袁厡圎援湲猨缘茒鼋園圓塬"
+    "媴嫄源溒猿獂蒝榞榬辕緣縁蝝蝯魭橼羱薗螈謜轅黿鎱櫞邍騵鶢鶰厵远盶逺"
+    "遠鋺夗肙妴苑怨院垸衏傆媛掾瑗禐愿裫褑褤噮願酛鈨曰曱约約箹矱彟彠月"
+    "戉刖妜岄抈礿岳玥恱悅悦蚎蚏軏钺阅捳跀跃粤越鈅粵鉞閱閲嬳樾篗嶽龠籆"
+    "瀹蘥黦爚禴躍籥鸑籰鸙晕缊蒀暈氲煴蒕氳奫蝹縕赟頵馧贇云勻匀囩妘沄纭"
+    "芸昀畇眃秐郧涢紜耘耺鄖雲愪溳筠筼蒷榲熉澐蕓鋆橒篔縜饂允阭夽抎狁陨"
+    "荺殒喗鈗隕殞褞馻磒賱霣齳孕运枟郓恽鄆酝傊惲愠運慍腪韫韵熅熨緷緼蕴"
+    "薀醖醞餫藴韗韞蘊韻抣繧帀匝沞迊咂拶紥紮鉔魳臜臢杂砸偺喒韴雑嶻磼襍"
+    "雜囋囐雥咋災灾甾哉栽烖菑渽睵賳宰崽再在扗侢洅载傤載酨儎縡兂糌簪簮"
+    "鐕鐟咱昝沯桚寁揝噆撍儧攅攒儹攢趱礸趲暂暫賛赞錾鄼濽蹔瓉贊鏨瓒酇灒"
+    "讃瓚禶襸讚饡匨牂羘赃賍臧蔵賘贓髒贜驵駔奘弉脏塟葬銺臓臟傮遭糟蹧醩"
+    "凿鑿早枣蚤棗澡璪薻繰藻灶皁皂唕唣造梍喿慥艁噪簉燥竃譟趮躁竈栆则択"
+    "沢择泎泽责迮則荝唶啧帻笮舴責溭矠嘖嫧幘箦樍諎赜擇澤皟瞔簀礋襗謮賾"
+    "蠌齚齰鸅夨仄庂汄昃昗捑崱伬蔶贼戝賊鲗鯽蠈鰂鱡怎谮譖譛囎増鄫增憎缯"
+    "橧熷璔矰磳罾繒譄锃鋥甑赠贈鱛扎吒抯奓挓柤査哳偧喳揸渣楂劄摣皶樝觰"
+    "皻譇齄齇札甴闸蚻铡煠牐閘箚耫鍘譗厏拃苲眨砟搩鲊鲝踷鮓鮺乍灹诈咤柞"
+    "栅炸宱痄蚱溠詐搾榨霅醡捚斋斎摘榸齋宅檡窄鉙债砦債寨瘵夈粂沾毡旃栴"
+    "粘蛅飦惉詀趈詹閚谵噡嶦薝邅霑氈氊瞻鹯旜譫饘鳣驙魙鱣鸇讝斩飐展盏崭"
+    "斬椫琖搌盞嶃嶄榐颭嫸醆橏輾黵占佔战栈桟站偡绽菚棧湛戦綻嶘輚戰虥虦"
+    "覱轏譧蘸驏张張章傽鄣墇嫜彰慞漳獐粻蔁遧暲樟璋餦蟑騿鱆麞仉长長涨掌"
+    "漲礃丈仗扙帐杖胀账帳涱脹痮障嶂幛賬瘬瘴瞕粀幥鏱鐣佋钊妱巶招昭盄釗"
+    "啁鉊駋窼鍣皽爪找沼瑵召兆诏枛垗炤狣赵笊肁旐棹詔照罩肇肈趙曌燳鮡櫂"
+    "瞾羄爫罀蜇嗻嫬遮厇折歽矺砓籷虴哲埑粍袩啠悊晢晣辄喆蛰詟谪馲摺輒磔"
+    "輙銸辙蟄嚞謫謺鮿轍讁讋者乽啫禇锗赭褶襵这柘浙這淛樜潪鹧蟅鷓着著蔗"
+    "贞针侦浈珍珎胗貞帪栕桢眞真砧祯針偵桭酙寊葴遉嫃搸斟楨獉甄禎蒖蓁鉁"
+    "靕榛殝瑧碪禛潧箴樼澵臻薽錱轃鍼籈鱵诊抮枕弫昣轸屒畛疹眕袗紾聄裖診"
+    "軫絼缜稹駗縥鬒黰圳阵纼甽侲挋陣鸩振朕栚紖眹赈酖塦揕敶瑱誫賑镇震鴆"
+    "鎭鎮萙鋴争佂姃征怔爭诤埩峥挣炡狰烝眐钲崝崢掙猙睁聇铮媜揁筝徰蒸睜"
+    "踭鉦徴箏錚徵篜鬇鯖癥氶抍糽拯掟晸愸撜整正证郑帧政症幀証塣諍鄭鴊證"
+    "凧之支卮汁芝吱巵汥坧枝泜知织肢栀祗秓秖胑胝衼倁疷祬秪脂隻梔戠椥臸"
+    "搘禔稙綕榰蜘馶鳷鴲鵄織蘵鼅执侄妷直姪値值聀釞埴執淔职貭植殖犆禃絷"
+    "褁跖嗭瓡鉄墌摭馽嬂慹漐踯樴膱儨縶職蟙蹠軄躑夂止只劧旨阯址坁帋扺汦"
+    "沚纸芷怾抧祉咫恉指枳洔砋衹轵淽疻紙訨趾軹黹酯藢襧阤至芖志忮扻豸制"
+    "厔垁帙帜治炙质迣郅峙庢庤挃柣栉洷祑陟娡徏挚晊桎狾秩致袟贽轾乿偫徝"
+    "掷梽楖猘畤痔秲秷窒紩翐袠觗铚鸷傂崻彘智滞痣蛭軽骘寘廌搱滍稚筫置跱"
+    "輊锧雉墆滯潌疐製覟誌銍幟憄摯熫稺膣觯質踬鋕擳旘瀄緻駤鴙劕懥擲櫛穉"
+    "螲懫贄櫍瓆觶騭鯯礩豑騺驇躓鷙鑕豒凪俧徔謢中伀汷刣妐彸忠泈炂终柊盅"
+    "衳钟舯衷終鈡幒蔠锺銿螤螽鍾鼨蹱鐘籦肿种冢喠尰塚塜歱煄腫瘇種踵穜仲"
+    "众妕狆祌茽衶重蚛偅眾堹媑筗衆諥迚州舟诌侜周洲诪烐珘辀郮徟掫淍矪週"
+    "鸼喌粥赒輈銂賙輖霌盩謅鵃騆譸妯轴軸肘疛菷晭睭箒鯞纣伷呪咒宙绉冑咮"
+    "昼紂胄荮皱酎晝粙葤詋甃詶僽皺駎噣縐骤籀籕籒驟帚炿駲朱劯侏诛邾洙茱"
+    "株珠诸猪硃秼袾铢絑蛛誅跦槠潴蝫銖橥諸豬駯鮢鴸瀦櫫櫧鯺鼄蠩竹泏竺炢"
+    "笁茿烛窋逐笜舳瘃築燭蠋躅鱁孎灟曯欘爥蠾丶主宔拄罜陼渚煮煑詝嘱濐麈"
+    "瞩劚囑斸矚伫佇住助纻苎坾杼注贮迬驻壴柱殶炷祝疰眝砫祩竚莇紵紸羜蛀"
+    "嵀筑註貯跓軴铸筯鉒馵箸翥樦鋳駐篫霔麆鑄墸抓檛膼簻髽拽跩专叀専砖專"
+    "鄟塼嫥瑼甎磗膞颛磚諯蟤顓鱄转孨転竱轉灷啭堟蒃瑑腞僎赚撰篆馔篹襈賺"
+    "譔饌囀籑妆庄妝荘娤桩莊梉湷粧装裝樁糚壮壯状狀壵焋漴撞戇庒隹追骓锥"
+    "錐騅鵻沝坠桘笍娷惴甀缒畷硾膇墜赘縋諈醊錣餟礈贅譵轛鑆缀綴宒迍肫窀"
+    "谆諄衠准埻準綧訰稕凖卓拙炪倬捉桌棁涿棳穛穱蠿圴彴汋犳灼叕妰茁斫浊"
+    "丵浞烵诼酌啄啅娺梲斱晫椓琸硺窡罬撯擆斲槕禚諁諑鋜濁篧擢斀斵濯櫡謶"
+    "镯鐯鵫灂蠗鐲籗鷟籱劅窧乲孜茊兹咨姕姿茲栥玆紎赀资淄秶缁谘嗞孳嵫椔"
+    "湽滋粢葘辎鄑孶禌觜訾貲資趑锱稵緇鈭镃龇輜鼒澬諮趦輺錙髭鲻鍿鎡璾頿"
+    "頾鯔鶅齍鰦蓻仔吇姉姊杍矷秄胏呰秭籽耔虸笫梓釨啙紫滓訿榟字自芓茡倳"
+    "剚恣牸渍眥眦胔胾漬子崰橴宗倧综骔堫嵏嵕惾棕猣腙葼朡椶嵸稯綜緃熧緵"
+    "翪蝬踨踪磫鍐豵蹤騌鬃騣鬉鬷鯮鯼鑁总偬捴惣愡揔搃傯蓗摠総縂總鏓纵昮"
+    "疭倊猔碂粽糉瘲縦錝縱糭潈邹驺诹郰陬菆棷棸鄒箃緅諏鄹鲰鯫黀騶齱齺赱"
+    "走奏揍楱鯐租葅蒩卆足卒哫崒崪族傶箤踤踿镞鏃诅阻组俎爼珇祖組詛靻鎺"
+    "钻躜鑽繤缵纂纉籫纘攥鑚厜朘嗺樶蟕纗嶊嘴嶵噿璻栬絊酔最晬祽稡罪辠槜"
+    "酻蕞醉檇鋷錊檌枠穝尊墫壿嶟遵樽繜罇鐏鳟鱒鷷僔噂撙譐捘銌鶎昨秨莋捽"
+    "椊琢稓筰鈼左佐唨繓作坐阼岝岞怍侳祚胙唑座袏做葃葄飵糳咗蓙";
+
+// 按笔画数排列
+const char collate_stroke_order[] =
+    "一丨丶丿乀乁乙乚乛亅丁丂七丄丅丆丩丷乂乃乄乜九了二亠人亻儿入八冂"
+    "冖冫几凵刀刁刂力勹匕匚匸十卜卩厂厶又巜讠万丈三上下丌亐卄个丫丸义"
+    "久乆乇么乊乞也习亇亍于亏亡亼亽亾亿兀兦凡凢凣刃刄劜勺卂千卪卫叉口"
+    "囗土士夂夊夕大夨女子孑孒孓宀寸小尢尸屮山巛川工己已巳巾干乡幺广廴"
+    "廾弋弓彐彑彡彳忄扌才氵犭纟艹门阝飞饣马不与丏丐丑丒专中丮丯丰丹为"
+    "之乌尹乣乤乥书予云互亓五井亖亢亣什仁仂仃仄仅仆仇仈仉今介仌仍从仏"
+    "仐仑仒仓允兂元內公六兮兯冃冄内円冇冈冗冘凤凶刅分切刈劝办勻勼勽勾"
+    "勿匀匁匂化匹区卅卆升午卝卞卬厃厄厅历厷厸厹及友双反収圠圡壬夃天太"
+    "夫夬夭孔尐少尣尤尺屯乢屲巴巿帀币幻廿开弌弔引弖心忆戈戶户戸手扎支"
+    "攴攵文斗斤方无旡日曰月木朩欠止歹殳毋毌比毛氏气水火灬爪爫父爻丬爿"
+    "片牙牛牜犬王礻罓耂肀见计订讣认讥贝车辶闩韦风丗且丕世丘丙业丛东丝"
+    "丱主丼乍乎乏乐乧亗仔仕他仗付仙仚仛仜仝仞仟仠仡仢代令以仦仧仨仩仪"
+    "仫们仭兄充兰冉冊冋册写冚冬冭冮冯凥処凧凷凸凹出击刉刊刋刌刍功加务"
+    "劢匃匄包匆匇北匛匜匝匞卉半卌卟占卡卢卭卮卯厇厈厉厺去厼叏叐发古句"
+    "另叧叨叩只叫召叭叮可台叱史右叴叵叶号司叹叺叻叼叽叾囘囙囚四囜圢圣"
+    "圤圥圦圧壭处外夗夘央夯夰失夲夳头奴奵奶孕宁宂它宄对尒尓尔尕尻尼屳"
+    "屴屵屶屷左巧巨市布帄帅平幼庀庁庂広弁弍弗弘归必忇忉忊戉戊戋戹扐扑"
+    "扒打扔払扖扏斥旦旧曱未末本札朮术朰正歺母氐民氕氺氶氷永氹氻氾氿汀"
+    "汁汃汄汅汇汈汉灭犮犯犰玄玉玊玌玍瓜瓦甘生用甩田由甲申甴电疋疒癶白"
+    "皮皿目矛矢石示禸禾穴立纠罒肊艺衤讦讧讨让讪讫讬训议讯记讱轧辷邒邓"
+    "钅长闪阞队饤饥驭鸟龙丞丟丠両丢乑乒乓乔乨乩乪乫乬乭乮乯买争亘亙亚"
+    "交亥亦产仮仯仰仱仲仳仴仵件价仸仹仺任仼份仾仿伀企伂伃伄伅伆伇伈伉"
+    "伊伋伌伍伎伏伐休伒伓伔伕伖众优伙会伛伜伝伞伟传伡伢伣伤伥伦伧伨伩"
+    "伪伫伬佤兆兇先光兊全氽共兲关兴再冎军农冰冱冲决冴凨凩凪凫凼刎刏刐"
+    "刑划刓刔刕刖列刘则刚创劣劤劥劦劧动匈匟匠匡匢卋卍华协卐印危厊压厌"
+    "厍厽厾叒叿吀吁吂吃各吅吆吇合吉吊吋同名后吏吐向吒吓吔吕吖吗囝回囟"
+    "因囡团団在圩圪圫圬圭圮圯地圱圲圳圴圵圶圷圸圹场壮夅夙多夛夵夶夷夸"
+    "夹夺夻夼奷奸她奺奻奼好奾奿妀妁如妃妄妅妆妇妈孖字存孙宅宆宇守安寺"
+    "寻导尖尗尘尥尦尧尽屰屸屹屺屻屼屽屾屿岀岁岂岃州巟巩巪帆帇师年幵并"
+    "庄庅庆廵异弎式弐弙弚弛弜当彴彵忈忋忏忓忔忕忖忙忚忛戌戍戎戏成扗托"
+    "扙扚扛扜扝扞扠扡扢扣扤扥扦执扨扩扪扫扬扟攰收攷旨早旪旫旬旭旮旯曲"
+    "曳有朱朲朳朴朵朶朷朸朹机朻朼朽朾朿杀杁杂权次欢此死毎毕氒氖気氘氼"
+    "汆汊汋汌汍汎汏汐汑汒汓汔汕汗汘汙汚汛汜汝江池污汢汣汤汷灮灯灰灱灲"
+    "灳爷牝牞牟犱犲犳犴犵犷犸玎玏玐玑甪甶百癿礼穵竹米糸糹纡红纣纤纥约"
+    "级纨纩纪纫缶网羊羽老考而耒耳聿肉肋肌肍肎臣自至臼舌舛舟艮色艸艻艼"
+    "艽艾艿芀芁节虍虫血行衣襾西覀观讲讳讴讵讶讷许讹论讻讼讽设访诀贞负"
+    "贠赱轨辸边辺辻込辽邔邖邗邘邙邚邛邜邝钆钇闫闬闭问闯阠阡阢阣阤页饦"
+    "饧驮驯驰齐丣两严丽串乕乱乲亊亜亨亩亪伭伮伯估伱伲伳伴伵伶伷伸伹伺"
+    "伻似伽伾伿佀佁佂佃佄佅但佇佈佉佊佋位低住佐佑佒体佔何佖佗佘余佚佛"
+    "作佝佞佟你佡佢佣佥佦佧佨克兌免兎兏児兑兵冏冝况冶冷冸冹冺冻凬刜初"
+    "刞刟删刡刢刣判別刦刧刨利刪别刬刭助努劫劬劭劮劯劰励劲劳労匉匣匤匥"
+    "医卣卤卲即却卵厎厏厐厑县叓吘吙吚君吜吝吞吟吠吡吢吣吤吥否吧吨吩吪"
+    "含听吭吮启吰吱吲吳吴吵吶吷吸吹吺吻吼吽吾吿呀呁呂呃呄呅呆呇呈呉告"
+    "呋呌呍呎呏呐呑呒呓呔呕呖呗员呙呚呛呜囤囥囦囧囨囩囪囫囬园囮囯困囱"
+    "囲図围囵圻圼圽圾圿址坁坂坃坄坅坆均坈坉坊坋坌坍坎坏坐坑坒坓坔坕坖"
+    "块坘坙坚坛坜坝坞坟坠壯声壱売壳夆夋夽夾夿奀奁奂妉妊妋妌妎妏妐妑妒"
+    "妓妔妕妖妗妘妙妚妛妜妝妞妟妠妡妢妣妤妥妦妧妨妩妪妫孚孛孜孝孞宊宋"
+    "完宍宎宏宐宑宒寽対寿尨尩尪尫尬尾尿局屁层屃岄岅岆岇岈岉岊岋岌岎岏"
+    "岐岑岒岓岔岕岖岗岘岙岚岛岜岍巠巫巵帉帊帋希帍帎帏帐庇庈庉床庋庌庍"
+    "庎序庐庑庒库应廷弃弄弅弝弞弟张形彣彤彶彷彸役彺彻忌忍忎忐忑忒志忘"
+    "応忟忡忣忤忦忧忨忪快忬忭忮忯忰忱忲忳忴忶忷忸忹忺忻忼忾怀怃怄怅怆"
+    "我戒戓戺戻戼扭扮扯扰扱扲扳扴扵扶扷批扺扻扼扽找技抁抂抃抄抅抆抇抈"
+    "抉把抋抌抍抎抏抐抑抒抓抔投抖抗折抙抚抛抜抝択抟抠抡抢抣护报扸攸改"
+    "攺攻攼斈斘旰旱旲旳旴旵时旷旸更曵杄杅杆杇杈杉杊杋杌杍李杏材村杒杓"
+    "杔杕杖杗杘杙杚杛杜杝杞束杠条杢杣杤来杦杧杨杩极欤步歼每毐毜毝氙氚"
+    "求汖汞汥汦汧汨汩汪汫汭汮汯汰汱汲汳汴汵汶汸汹決汻汼汽汾汿沁沂沃沄"
+    "沅沆沇沈沉沋沌沍沎沏沐沑沒沔沕沖沘沙沚沛沜沞沟沠没沢沣沤沥沦沧沨"
+    "沩沪灴灵灶灷灸灹灺灻灼災灾灿炀牠牡牢牣牤状犹犺犻犼犽犾犿狁狂狃狄"
+    "狅狆狇狈玒玓玔玕玖玗玘玙玚玛瓧甫甬男甸甹町甼疓疔疕疖疗皀皁皂皃盀"
+    "盁盯矣矴矵矶礽禿秀私秂秃究穷竌竍糺系纶纬纭纮纯纰纱纲纳纴纵纷纸纹"
+    "纺纻纼纽纾罕耴肐肑肒肓肔肕肖肗肘肙肚肛肜肝肞肟肠臫良芃芄芅芆芇芈"
+    "芉芊芋芌芍芎芏芐芑芒芓芕芖芗虬見觃角言訁证诂诃评诅识诇诈诉诊诋诌"
+    "词诎诏诐译诒谷豆豕豸貝贡财赤走足身車轩轪轫辛辰辵巡达辿迀迁迂迃迄"
+    "迅迆过迈迉邑邞邟邠邡邢那邤邥邦邧邨邩邪邬酉釆里针钉钊钋钌闰闱闲闳"
+    "间闵闶闷阥阦阧阨阩阪阫阬阭阮阯阰阱防阳阴阵阶韧飏饨饩饪饫饬饭饮驱"
+    "驲驳驴鸠鸡麦龟並丧丳乖乳乴乵乶乷乸事些亝亞亟享京佌佩佪佫佬佭佮佯"
+    "佰佱佲佳佴併佶佷佸佹佺佻佼佽佾使侀侁侂侃侄侅來侇侈侉侊例侌侍侎侏"
+    "侐侑侒侓侔侕侖侗侘侙侚供侜依侞侟侠価侢侣侤侥侦侧侨侩侪侫侬侭兒兓"
+    "兔兕兖兩其具典冐冞冼冽冾冿净凭凮凯函刮刯到刱刲刳刴刵制刷券刹刺刻"
+    "刼刽刾刿剀剁剂剆劵劶劷劸効劺劻劼劽劾势勆匊匋匌匦匼卑卒卓協单卖卥"
+    "卦卧卶卷卸卹卺厒厓厔厕叀叁参叔叕取受变呝呞呟呠呡呢呣呤呥呦呧周呩"
+    "呪呫呬呭呮呯呱味呴呵呶呷呸呹呺呻呼命呾呿咀咁咂咃咄咅咆咇咈咉咊咋"
+    "和咍咎咏咐咑咒咓咔咕咖咗咘咙咚咛咜咝囶囷囸囹固囻囼国图坡坢坣坤坥"
+    "坦坧坨坩坪坫坬坭坮坯坰坱坲坳坴坵坶坷坸坹坺坻坼坽坾坿垀垁垂垃垄垅"
+    "垆垇垈垉垊备夌夜夝奃奄奅奆奇奈奉奋奌奍奔妬妭妮妯妰妱妲妳妴妵妶妷"
+    "妸妹妺妻妼妽妾妿姀姁姂姃姄姅姆姇姈姉姊始姌姍姎姏姐姑姒姓委姖姗孟"
+    "孠孡孢季孤孥学孧宓宔宕宖宗官宙定宛宜宝实実宠审尀尙尚尭屄居屆屇屈"
+    "屉届岝岞岟岠岡岢岣岤岥岦岧岨岩岪岫岬岭岮岯岰岱岲岳岴岵岶岷岸岹岺"
+    "岻岼岽岾岿峀峁峂峃峄峅巶帑帒帓帔帕帖帗帘帙帚帛帜幷幸庘底庖店庙庚"
+    "府庝庞废延廸廹弆弡弢弣弤弥弦弧弨弩弪彔录彼彽彾彿往征徂徃径忝忞忠"
+    "忢忥忩念忽忿态怂怇怈怉怊怋怌怍怏怐怑怓怔怕怖怗怙怚怛怜怞怟怡怢怦"
+    "性怩怪怫怬怭怮怯怰怲怳怴怵怶怺怽怾怿戔戕或戗戽戾房所承抦抧抨抩抪"
+    "披抬抭抮抯抰抱抲抳抴抵抶抷抸抹抺抻押抽抾抿拀拁拂拃拄担拆拇拈拉拊"
+    "拋拌拍拎拐拑拒拓拔拕拖拗拘拙拚招拝拞拟拠拡拢拣拤拥拦拧拨择攽放斉"
+    "斦斧斨斩斺斻於旹旺旻旼旽旾旿昀昁昂昃昄昅昆昇昈昉昊昋昌昍明昏昐昑"
+    "昒易昔昕昖昗昘昙曶朊朋朌服杪杫杬杭杮杯杰東杲杳杴杵杶杷杸杹杺杻杼"
+    "杽松板枀枂枃构枅枆枇枈枉枊枋枌枍枎枏析枑枒枓枔枕枖林枘枙枚枛果枝"
+    "枞枟枠枡枢枣枤枥枦枧枨枩枪枫枬枭柹欣欥欦欧武歧歨歩歽歾歿殀殁殴毑"
+    "毞毟氓氛氜氝汬沀沊沓沝沫沬沭沮沰沱沲河沴沵沶沷沸油沺治沼沽沾沿泀"
+    "況泂泃泄泅泆泇泈泊泋泌泍泎泏泐泑泒泓泔法泖泗泘泙泛泜泝泞泟泠泡波"
+    "泣泤泥泦泧注泩泪泫泬泭泮泯泱泲泳泷泸泹泺泻泼泽泾洰炇炁炂炃炄炅炆"
+    "炈炉炊炋炌炍炎炏炐炑炒炓炔炕炖炗炘炙炚炛炜炝炞爬爭爸牀版牥牦牧牨"
+    "物牪牫牬狀狉狋狌狍狎狏狐狑狒狓狔狕狖狗狘狙狚狛狜狝狞玜玝玞玟玠玡"
+    "玢玣玤玥玦玧玨玩玪玫玬玭玮环现玱瓝瓨瓩甙画甽甾甿畀畁畂畃畄畅疌疘"
+    "疙疚疛疜疝疞疟疠疡癷的皯盂盰盱盲盳直盵矤知矷矸矹矺矻矼矽矾矿砀码"
+    "社礿祀祁祂祃秄秅秆秇秈秉秊穸穹空穻竎竏竺竻籴籵籶糼糽糾糿线绀绁绂"
+    "练组绅细织终绉绊绋绌绍绎经绐缷罔罖罗罙羋羌者耓耵肃肏股肢肣肤肥肦"
+    "肧肨肩肪肫肬肭肮肯肰肱育肳肴肵肶肷肸肹肺肻肼肽肾肿胀胁臤臥臽臾舍"
+    "舎舏舠艰芘芙芚芛芜芝芞芟芠芡芢芣芤芥芦芧芨芩芪芫芬芭芮芯芰花芲芳"
+    "芴芵芶芷芸芹芺芼芽芾苀苁苂苃苄苅苆苇苈苉苊苋苌苍苎苏茾芿虎虏虭虮"
+    "虯虰虱虲补表规觅诓诔试诖诗诘诙诚诛诜话诞诟诠诡询诣诤该详诧诨诩豖"
+    "责贤败账货质贩贪贫贬购贮贯軋转轭轮软轰迊迋迌迍迎迏运近迒迓返迕迖"
+    "迗还这迚进远违连迟迬邭邮邯邰邱邲邳邴邵邶邷邸邹邺邻采金釒钍钎钏钐"
+    "钑钒钓钔钕钖钗長镸門闸闹阜阷阸阹阺阻阼阽阾阿陀陁陂陃附际陆陇陈陉"
+    "隶隹雨靑青非靣顶顷饯饰饱饲饳饴驵驶驷驸驹驺驻驼驽驾驿骀鱼鸢鸣鸤黾"
+    "鼡齿临举乗乹乺乻乼亭亮亯亰亱亲侮侯侰侱侲侳侴侵侶侷侸侹侺侻侼侽侾"
+    "便俀俁係促俄俅俆俇俈俉俊俋俌俍俎俏俐俑俒俓俔俕俖俗俘俙俚俛俜保俞"
+    "俟俠信俢俣俤俥俦俧俨俩俪俫俬俭兗兘兙兪兹养冑冒冟冠凁凂凃凾剃剄剅"
+    "則剈剉削剋剌前剎剏剐剑勀勁勂勃勄勅勇勈勉勊勋匍匧匨匩匽南単卻卼卽"
+    "厖厗厘厙厚厛叙叚叛叜叝呰呲咞咟咠咡咢咣咤咥咦咧咨咩咪咫咬咭咮咯咰"
+    "咱咲咳咴咵咶咷咸咹咺咻咼咽咾咿哀品哂哃哄哅哆哇哈哉哊哋哌响哎哏哐"
+    "哑哒哓哔哕哖哗哘哙哚哛哜哝哞哟囿圀型垌垍垎垏垐垑垒垓垔垕垖垗垘垙"
+    "垚垛垜垝垞垟垠垡垢垣垤垥垦垧垨垩垪垫垬垭垮垯垰垱垲垳垴垵城壴壵夈"
+    "変复奎奏奐契奒奓奕奖姕妍姘姙姚姛姜姝姞姟姠姡姢姣姤姥姦姧姨姩姪姫"
+    "姭姮姯姰姱姲姳姴姵姶姷姸姹姺姻姼姽姾姿娀威娂娃娅娆娇娈娍孨孩孪客"
+    "宣室宥宦宨宩宪宫封専将尛尜尝尮尯屋屌屍屎屏峆峇峈峉峊峋峌峍峎峏峐"
+    "峑峒峓峔峕峖峗峘峙峚峛峜峝峞峟峠峡峢峣峤峥峦峧峸巬巭巷巸巹巺巻帝"
+    "帞帟帠帡帢帣帤帥带帧幽庛庠庡庢庣庤庥度庰建廻廼弇弈弫弬弭弮弯彖彥"
+    "彦待徆徇很徉徊律後徍徔怎怒怘思怠怣怤急怨怱怷怸怹总怼恀恂恃恄恅恆"
+    "恇恈恉恊恌恍恎恑恒恓恔恗恘恛恜恞恟恠恡恢恤恦恨恪恫恬恮恰恱恲恸恹"
+    "恺恻恼恽战扁扂扃拏拜拪拫括拭拮拯拰拱拴拵拶拷拸拹拺拻拼拽拾挀持挂"
+    "挃挄挅挆指按挊挋挌挍挎挏挑挒挓挔挕挖挗挘挜挝挞挟挠挡挢挣挤挥挦挧"
+    "攱政敀敁敂敃敄故斪斫施斾斿旀既昚昛昜昝昞星映昡昢昣昤春昦昧昨昩昪"
+    "昫昬昭昮是昰昱昲昳昴昵昶昷昸昹昺昻昼昽显昿曷朎朏朐朑枮枯枰枱枲枳"
+    "枴枵架枷枸枹枺枻枼枾枿柀柁柂柃柄柅柆柇柈柉柊柋柌柍柎柏某柑柒染柔"
+    "柕柖柗柘柙柚柛柜柝柞柟柠柢柣柤查柦柧柨柩柪柫柬柭柮柯柰柱柲柳柵柶"
+    "柷柸柺査柼柽柾柿栀栁栂栃栄栅栆标栈栉栊栋栌栍栎栏栐树桒欨欩欪歪歫"
+    "殂殃殄殅殆殇段殶毒毖毗毘毠毡氞氟氠氡氢沗沯泉泴泶泚泿洀洁洂洃洄洅"
+    "洆洇洈洉洊洋洌洎洏洐洑洒洓洔洕洗洘洙洚洛洝洞洟洠洡洢洣洤津洦洧洨"
+    "洩洪洫洬洭洮洱洲洳洴洵洶洷洸洹洺活洼洽派洿浀流浂浃浄浅浇浈浉浊测"
+    "浌浍济浏浐浑浒浓浔浕炟炠炡炢炣炤炥炦炧炨炩炪炫炬炭炮炯炰炱炲炳炴"
+    "炵炶炷炸点為炻炼炽炾炿烀烁烂烃爮爯爰爼牁牉牊牭牮牯牰牱牲牳牴牵狊"
+    "狟狠狡狢狣狤狥狦狧狨狩狪狫独狭狮狯狰狱狲玅玲玳玴玵玶玷玸玹玻玽玾"
+    "玿珀珁珂珃珄珅珆珇珈珉珊珋珌珍珎珏珐珑瓪瓫瓬瓭瓮瓯瓰瓱瓲甚甠甭甮"
+    "畆畇畈畉畊畋界畍畎畏畐畑畒畓疢疣疤疥疦疧疨疩疪疫疬疭疮疯疺癸癹発"
+    "皅皆皇皈盃盄盅盆盇盈盶盷相盹盺盻盼盽盾盿眀省眂眃眄眅眆眇眈眉眊看"
+    "県眍矜矦矧矨泵砂砃砄砅砆砇砈砉砊砋砌砍砎砏砐砑砒砓研砕砖砗砘砙砚"
+    "砛砜祄祅祆祇祈祉祊祋祌祍祎视禹禺秋秌种秎秏秐科秒秓秔秕秖秗穼穽穾"
+    "穿窀突窂窃竐竑竒竓竔竕竖竗竼竽竾竿笀笁笂笃娄籷籸籹籺类籼籽籾籿粀"
+    "粁粂紀紁紂紃約紅紆紇紈紉绑绒结绔绕绖绗绘给绚绛络绝绞统缸罘罚羍美"
+    "羏羑羾羿耇耍耎耏耐耑耔耶耷胂胃胄胅胆胇胈胉胊胋背胍胎胏胐胑胒胓胕"
+    "胖胗胘胙胚胛胜胝胞胟胠胡胢胣胤胥胦胧胨胩胪胫脉致臿舡舢舣舤芔苐苑"
+    "苒苓苔苕苖苗苘苙苚苛苜苝苞苟苠苡苢苣苤若苦苧苨苩苪苫苬苭苮苯苰英"
+    "苲苳苴苵苶苷苸苹苺苻苼苽苾苿茀茁茂范茄茅茆茇茉茊茋茌茍茎茏茐茑茓"
+    "茔茕茺虐虳虴虵虶虷虸虹虺虻虼虽虾虿蚀蚁蚂蚃衁衂衍衎衦衧衩衪衫衬要"
+    "覌觇览觉觓觔訂訃訄訅訆訇計诪诫诬语诮误诰诱诲诳说诵诶貞貟負贰贱贲"
+    "贳贴贵贶贷贸费贺贻赲赳赴赵趴軌軍轱轲轳轴轵轶轷轸轹轺轻迠迡迢迣迤"
+    "迥迦迧迨迩迪迫迭迮迯述迱迲迳邼邽邾邿郀郁郂郃郄郅郆郇郈郉郊郋郍郎"
+    "郏郐郑郓郕郱酊酋重釓釔钘钙钚钛钜钝钞钟钠钡钢钣钤钥钦钧钨钩钪钫钬"
+    "钭钮钯閁閂闺闻闼闽闾闿阀阁阂陊陋陌降陎陏限陑陒陓陔陕面革韋韨韭音"
+    "頁顸项顺须風飐飑飒飛食飠饵饶饷饸饹饺饻饼首香骁骂骃骄骅骆骇骈骉鳬"
+    "鸥鸦鸧鸨鸩丵乘乽亳修俯俰俱俲俳俴俵俶俷俸俹俺俻俼俽俾俿倀倁倂倃倄"
+    "倅倆倇倈倉倊個倌倍倎倏倐們倒倓倔倕倖倗倘候倚倛倜倝倞借倠倡倢倣値"
+    "倥倦倧倨倩倪倫倬倭倮倯倰倱倲倳倴倵倶倷倸倹债倻值倽倾倿偖党兛兺兼"
+    "冓冔冡冢冣冤冥冦冧凄凅准凇凈凉凊凋凌凍凎剒剓剔剕剖剗剘剙剚剛剜剝"
+    "剞剟剠剡剢剣剤剥剦剧勌勍勎勏勐勑匎匪匫卿厜厝厞原虒叞叟哠員哢哣哤"
+    "哥哦哧哨哩哪哫哬哭哮哯哰哱哲哳哴哵哶哷哸哹哺哻哼哽哾哿唀唁唂唃唄"
+    "唅唆唇唈唉唊唋唍唎唏唐唑唒唓唔唕唖唗唘唙唚唛唜唝唞唟唠唡唢唣唤唥"
+    "唦唧圁圂圃圄圅圆垶垷垸垹垺垻垼垽垾垿埀埁埂埃埄埅埆埇埈埉埊埋埌埍"
+    "埏埐埑埒埓埔埕埖埗埘埙埚埛堲壶夎夏夞奊套奘奙奚姬娉娊娋娌娎娏娐娑"
+    "娒娓娔娕娖娗娘娙娚娛娜娝娞娟娠娡娢娣娤娥娦娧娨娩娪娭娮娯娰娱娲娳"
+    "娴孫孬孭宧宬宭宮宯宰宱宲害宴宵家宷宸容宺宻宼宽宾尃射尅屐屑屒屓屔"
+    "展屖屗屘峨峩峪峫峬峭峮峯峰峱峲峳峴峵島峷峹峺峻峼峽峾峿崀崁崂崃崄"
+    "崅差巼帨帩帪師帬席帮帯帰帱座庨庩庪庫庬庭庮庯廽弉弰弱弲弳彧彨徎徏"
+    "徐徑徒従徕恁恋恏恐恕恖恙恚恝恣恥恧恩恭息恳恴恵恶恷恾悀悁悂悃悄悅"
+    "悇悈悋悌悍悎悏悑悒悓悔悕悖悗悙悚悛悜悝悞悟悢悦悧悩悭悮悯戙扄扅扆"
+    "扇拲拳拿挈挐挙挚挛挨挩挪挫挬挭挮振挰挱挳挴挵挶挷挸挹挺挼挽挾挿捀"
+    "捁捂捃捄捅捆捇捈捉捊捋捌捍捎捏捐捑捒捓捔捕捖捗捘捙捚捛捜捝捞损捠"
+    "捡换捣捤揤敆敇效敉敊敋敌斊斋料斚旁旂旃旄旅旆旊晀晁時晃晄晅晆晇晈"
+    "晉晊晋晌晍晎晏晐晑晒晓晔晕晖晟晠書曺曻朒朓朔朕朗枽柡柴栒栓栔栕栖"
+    "栗栘栙栚栛栜栝栞栟栠校栢栣栤栥栦栧栨栩株栫栬栭栮栯栰栱栲栳栴栵栶"
+    "样核根栺栻格栽栾栿桀桁桂桃桄桅框桇案桉桊桋桌桍桎桏桐桑桓桔桕桖桗"
+    "桘桙桚桛桜桝桞桟桠桡桢档桤桥桦桧桨桩桪欫欬欭欮欯欰欱欴歬歭殈殉殊"
+    "残殷毙毢毣毤毥毦毧毨毩毪氣氤氥氦氧氨氩泰洜洯浆洍洖浖浗浘浙浚浛浜"
+    "浝浞浟浠浡浢浣浤浥浦浧浨浩浪浫浬浭浮浯浰浱浲浳浴浵浶海浸浹浺浻浼"
+    "浽浾浿涀涁涂涃涄涅涆涇消涉涊涋涌涍涏涐涑涒涓涔涕涖涗涘涚涛涜涝涞"
+    "涟涠涡涢涣涤涥润涧涨涩烄烅烆烇烈烉烊烋烌烍烎烏烐烑烒烓烔烕烖烗烘"
+    "烙烚烛烜烝烞烟烠烡烢烣烤烥烦烧烨烩烪烫烬热烮爱爹牂牶牷牸特牺狳狴"
+    "狵狶狷狸狹狺狻狼狽狾猀猁猂猃玆玺玼珒珓珔珕珖珗珘珙珚珛珜珝珞珟珠"
+    "珡珢珣珤珥珦珧珨珩珪珫珬班珮珯珰珱珲琉珹瓞瓟瓳瓴瓵甡畔畕畖畗畘留"
+    "畚畛畜畝畞畟疍疰疱疲疳疴疶疷疸疹疻疼疽疾疿痀痁痂痃痄病痆症痈痉畠"
+    "皊皋皌皍皰皱盉益盋盌盍盎盏盐监眎眏眐眑眒眓眔眕眖眗眘眙眚眛眜眝眞"
+    "真眠眡眢眣眤眧眨眩眪眫眬眿矝矩砝砞砟砠砡砢砣砤砥砧砨砩砪砫砬砭砮"
+    "砯砰砱砲砳破砵砶砷砸砹砺砻砼砽砾砿础硁祏祐祑祒祓祔祕祖祗祘祙祚祛"
+    "祜祝神祟祠祢秘秙秚秛秜秝秞租秠秡秢秣秤秥秦秧秨秩秪秫秬秭秮积称窄"
+    "窅窆窇窈窉窊窋窌窍窎竘站竚竛竜竝竞笅笆笇笈笉笊笋笌笍笎笏笐笑笒笓"
+    "笔笕笄粃粄粅粆粇粈粉粊粋粌粍粎粏粐粑紊紋紌納紎紏紐紑紒紓純紕紖紗"
+    "紘紙級紛紜紝紞紟素紡索紣紤紥紦紧绠绡绢绣绤绥绦继绨缹缺缼罛罜罝罞"
+    "罟罠罡罢羐羒羓羔羖羗羘羙翀翁翂翃翄翅翆耄耆耊耕耖耗耘耙耸耹耺耻耼"
+    "耽耾耿聀聁聂肁肂胭胮胯胰胱胲胳胴胵胶胷胸胹胺胻胼能胿脀脁脂脃脄脅"
+    "脆脇脈脊脋脌脍脎脏脐脑脒脓臬臭舀舁舐舥舦舧舨舩航舫般舭舮舯舰舱艳"
+    "芻茈茖茗茘茙茚茛茜茞茟茠茡茢茤茥茦茧茨茩茪茫茬茭茮茯茰茱茲茳茴茵"
+    "茶茷茸茹茼茽茿荀荁荂荃荄荅荇荈草荊荋荌荍荎荏荐荑荒荔荕荖荗荘荚荛"
+    "荜荝荞荟荠荡荢荣荤荥荦荧荨荩荪荬荭荮药荓虑虓虔蚄蚅蚆蚇蚉蚊蚋蚌蚍"
+    "蚎蚏蚐蚑蚒蚓蚔蚕蚖蚗蚘蚙蚚蚛蚜蚝蚞蚟蚠蚡蚢蚣蚤蚥蚦蚧蚨蚩蚪蚬衃衄"
+    "衏衭衮衯衰衱衲衳衴衵衶衷衸衹衺衻衼衽衾衿袀袁袂袃袄袅袆袇覍覎觊訉"
+    "訊訋訌訍討訏訐訑訒訓訔訕訖託記訙訚请诸诹诺读诼诽课诿谀谁谂调谄谅"
+    "谆谇谈谉谊谸豇豈豗豹豺豻財貢貣貤贼贽贾贿赀赁赂赃资赅赆赶起赸趵趶"
+    "趷趸躬軎軏軐軑軒軓軔軕轼载轾轿辀辁辂较辱迴迵迶迷迸迹迺迻迼追迾迿"
+    "退送适逃逄逅逆逇逈选逊邕郖郗郘郙郚郛郜郝郞郟郠郡郢郣郤郥郦郧酌配"
+    "酎酏酐酑酒釕釖釗釘釙釚釛釜針釞釟釠釡釢钰钱钲钳钴钵钶钷钸钹钺钻钼"
+    "钽钾钿铀铁铂铃铄铅铆铇铈铉铊铋铌铍铎閃閄閅阃阄阅阆陖陗陘陙陛陜陝"
+    "陞陟陠陡院陣除陥陦陧陨险陚隺隻隼隽难顼顽顾顿颀颁颂颃预飢飣飤饽饾"
+    "饿馀馁馂馬骊骋验骍骎骏骨高髟鬥鬯鬲鬼鱽鸪鸫鸬鸭鸮鸯鸰鸱鸲鸳鸴鸵鸶"
+    "龀乾乿亀偀偁偂偃偄偅偆假偈偉偊偋偌偍偎偏偐偑偒偓偔偕偗偘偙做偛停"
+    "偝偞偟偠偡偢偣偤健偦偧偩偪偫偬偭偮偯偰偱偲偳側偵偶偷偸偹偺偻偼偽"
+    "偾偿兜兝兞兽冕冨减凐凑凰剨剪剫剬剭剮副剰剱剶勒勓勔動勖勘務勚匏匐"
+    "匓匘匙匬匭匮匾匿區卙卨卾厠厡厢厣厩參叄唌唨唩唪唫唬唭售唯唰唱唲唳"
+    "唴唵唶唷唸唹唺唻唼唽唾唿啀啁啂啃啄啅商啇啈啉啊啋啌啍啎問啐啑啒啓"
+    "啔啕啖啗啘啚啛啜啝啞啠啡啢啣啤啥啦啧啨啩啪啬啭啮啯啰啱啲啳啴啵啶"
+    "啷啸啹啫営圇圈圉圊國圏埜埝埞域埠埡埢埣埤埥埦埧埨埩埫埬埭埮埯埰埱"
+    "埲埳埴埵埶執埸培基埻埼埽埾埿堀堁堂堃堄堅堆堇堈堉堊堋堌堍堎堏堐堑"
+    "堒堓堔堕埪堵壷壸够夠奛奜奝奞奟奢娫娽娬娵娶娷娸娹娺娻娼娾娿婀婁婂"
+    "婃婄婅婆婇婈婉婊婋婌婍婎婏婐婑婒婓婔婕婖婗婘婙婚婛婜婝婞婟婠婡婢"
+    "婣婤婥婦婧婨婩婪婫婬婭婮婯婰婱婲婳婴婵婶媎孮孯孰孲宿寀寁寂寃寄寅"
+    "密寇寈寉將專尉屙屚屛屜屝屠崆崇崈崉崊崋崌崍崎崏崐崑崒崓崔崕崖崗崘"
+    "崙崚崛崜崝崞崟崠崡崢崣崤崥崦崧崨崩崪崫崬崭崮崯崰巢巣帲帳帴帵帶帷"
+    "常帹帺帻帼帾庱庲庳庴庵庶康庸庹庺庻庼庾弴張弶強弸弹彗彩彫彬徖得徘"
+    "徙徛徜徝從徟徠御徢徣徤恿悆悉悊悐悘悠悡患悤悥您悪悫悬悰悱悴悵悷悸"
+    "悺悻悼悽悾悿惀惂惃情惆惇惈惊惋惍惏惐惓惔惕惗惘惙惚惛惜惝惞惟惤惦"
+    "惧惨惬惭惮惯戚戛戜戝扈挲挻捥捦捧捨捩捪捫捬捭据捯捰捱捲捳捴捵捶捷"
+    "捸捹捺捻捼捽捾捿掀掁掂掃掄掅掆掇授掉掊掋掍掎掏掐掑排掓掕掖掗掘掙"
+    "掚掛掜掝掞掟掠採探掤接掦控推掩措掫掬掭掮掯掳掴掵掶掷掸掹掺掻掼掽"
+    "掲啟敍敎敏敐救敒敓敔敕敖敗敘教敚敛敝斍斎斏斛斜斬断旇旈旉旋旌旍旎"
+    "族旣勗晗晘晙晚晛晜晝晞晡晢晣晤晥晦晧晨晩曽曹曼朖朘朙朚望桫桬桭桮"
+    "桯桰桱桲桳桴桵桶桷桸桹桺桻桼桽桾桿梀梁梂梃梄梅梆梇梈梉梊梋梌梍梎"
+    "梏梐梑梒梓梔梕梖梗梘梙梚梛梜條梞梟梠梡梢梣梤梥梦梧梨梩梪梫梬梭梮"
+    "梯械梱梲梳梵梶梷梸梹梺梻梼梽梾梿检棁棂楖欲欳欵欶欷欸殌殍殎殏殐殑"
+    "殒殓殸殹殺殻毫毬毭毮氪氫涎涙涪涫涬涭涮涯涰涱液涳涴涵涶涷涸涹涺涻"
+    "涼涽涾涿淀淁淂淃淄淅淆淇淈淉淊淋淌淍淎淏淐淑淒淓淔淕淖淗淘淙淚淛"
+    "淜淝淞淟淠淡淢淣淤淥淦淧淨淩淪淫淬淭淮淯淰深淲淳淴淵淶混淸淹淺添"
+    "淽淿渀渁渂渄清渆渇済渉渊渋渌渍渎渏渐渑渒渓渔渕渖渗渚湴烯烰烱烲烳"
+    "烴烵烶烷烸烹烺烼烽烾烿焀焁焂焃焄焅焆焇焈焉焊焋焌焍焎焏焐焑焒焓焕"
+    "焖焗焘焔爽牻牼牽牾牿犁狿猄猅猇猈猉猊猍猎猏猐猑猓猔猕猖猗猘猙猚猛"
+    "猜猝猞猟猠猡猪率玈珳珴珵珶珸珺珻珼珽現珿琀琁琂球琄琅理琇琈琊琋琌"
+    "琍琎琏琐琑琒琓瓠瓶瓷瓸甛甜產産畡畢畣畤略畦畧畩異疵痊痋痌痍痎痏痐"
+    "痑痒痓痔痕痖皉皎皏皐皑皲盒盓盔盕盖盗盘盛眥眦眭眮眯眰眱眲眳眴眵眶"
+    "眷眸眹眺眻眼眽眾睁着矪矫砦硂硃硄硅硆硇硈硉硊硋硌硍硎硏硐硑硒硓硔"
+    "硕硖硗硘硙硚硛祡祣祤祥祧票祩祪祫祬祭祮祯視离秱秲秳秴秵秶秷秸秹秺"
+    "移秼秽秾稆窏窐窑窒窓窔窕窚竡笖笗笘笙笚笛笜笝笞笟笠笡笢笣笤笥符笧"
+    "笨笩笪笫第笭笮笯笰笱笲笳笴笵笶笷笸笹笺笻笼笽笾畨粒粓粔粕粖粗粘粙"
+    "粚粛粜粝粣紨紩紬紭紮累細紱紲紳紴紵紶紷紸紹紺紻紼紽紾紿絀絁終絃組"
+    "絅絆絇絈絉絊絋経绩绪绫绬续绮绯绰绱绲绳维绵绶绷绸绹绺绻综绽绾绿缀"
+    "缁缻缽罣羕羚羛羜羝羞羟翇翈翉翊翋翌翍翎翏翐翑習耈耉耚耛耜耝耞耟聃"
+    "聄聅聆聇聈聉聊聋职聍胬脕脖脗脘脙脚脛脜脝脞脟脡脢脣脤脥脦脧脨脩脪"
+    "脫脬脭脮脯脰脱脲脳脴脵脶脷脸舂舑舲舳舴舵舶舷舸船舺舻艴荙荫茝茣荰"
+    "荱荲荳荴荵荶荷荸荹荺荻荼荽荾荿莀莁莂莃莄莅莆莇莈莉莊莋莌莍莎莏莐"
+    "莑莒莓莔莕莖莗莘莙莛莜莝莞莟莠莡莢莣莤莥莦莧莨莩莪莫莬莮莯莰莱莲"
+    "莳莴莵莶获莸莹莺莼莽莭彪處虖虗虘虙虚蚫蚭蚮蚯蚰蚱蚲蚳蚴蚵蚶蚷蚸蚹"
+    "蚺蚻蚼蚽蚾蚿蛀蛁蛂蛃蛄蛅蛆蛇蛈蛉蛊蛋蛌蛍蛎蛏衅衐衑衒術衔袈袉袊袋"
+    "袌袍袎袏袐袑袒袓袔袕袖袗袘袙袚袛袜袝袞袟袠袡袢袣袤袥袦袧袨袩袪被"
+    "袬袭袮袰袯覂規覐覑覒覓覔觋觕觖觗觘觙訛訜訝訞訟訠訡訢訣訤訥訦訧訨"
+    "訩訪訫訬設訮訯訰許訲訳谋谌谍谎谏谐谑谒谓谔谕谖谗谘谙谚谛谜谝谞谹"
+    "谺谻豉豘豙豚豛豜豝豼豽貥貦貧貨販貪貫責貭貮赇赈赉赊赥赦赧赹赺赻赼"
+    "赽赾赿趹趺趻趽趾趿跀跁跂跃跄躭躮躯軖軗軘軙軚軛軜軝軞軟軠軡転軣辄"
+    "辅辆逋逌逍逎透逐逑递逓途逕逖逗逘這通逛逜逝逞速造逡逢連逤逥逦逧邫"
+    "郔部郩郪郫郬郭郮郯郰郲郳郴郷郸都酓酔酕酖酗酘酙酚酛酜酝酞釈野釣釤"
+    "釥釦釧釨釩釪釫釬釭釮釯釰釱釲釳釴釵釶釷釸釹釺釻釼铏铐铑铒铓铔铕铖"
+    "铗铘铙铚铛铜铝铞铟铠铡铢铣铤铥铦铧铨铩铪铫铬铭铮铯铰铱铲铳铴铵银"
+    "铷镹镺閆閇閈閉閊阇阈阉阊阋阌阍阎阏阐陪陫陬陭陮陯陰陱陳陴陵陶陷陸"
+    "陹険陼隿雀雩雪雫靪竟章頂頃頄颅领颇颈飡飥飦馃馄馅馆馗骐骑骒骓骔骕"
+    "骖髙魚鱾鳥鸷鸸鸹鸺鸻鸼鸽鸾鸿鹵鹿麥麸麻黒龁龚龛亁亴亵偨傀傁傂傃傄"
+    "傅傆傇傈傉傊傋傌傍傎傏傐傑傒傓傔傕傖傗傘備傚傛傜傝傞傟傠傡傢傣傤"
+    "傥傦傧储傩兟兠最凒凓凔凕凖凱凲凿剩割剳剴創勛勜勝勞匑匒博厤厥厦厧"
+    "厨叅啙啺啻啼啽啾啿喀喁喂喃善喅喆喇喈喉喊喋喌喎喏喐喑喒喓喔喕喖喗"
+    "喘喙喚喛喜喝喞喟喠喡喢喣喤喥喦喧喨喩喪喫喬喭單喯喰喱喲喳喴喵喷喸"
+    "喹喺喻喼喽喾噅嗞圌圍圎圐堖堗堘堙堚堛堜堝堞堟堠堡堢堣堤堥堦堧堨堩"
+    "堪堫堬堭堮堯堰報堳場堶堷堸堹堺堻堼堾堿塀塁塂塄塅塆塇塈壹壺壻夡奠"
+    "奡奣奤奥婷婸婹婺婻婼婽婾婿媀媁媂媃媄媅媆媇媈媉媊媋媌媍媏媑媒媓媔"
+    "媕媖媗媘媙媚媛媜媝媞媟媠媡媢媣媤媥媦媧媨媩媪媫媬媭媮媯嫏孱孳寊寋"
+    "富寍寎寏寐寑寒寓寔寕寪尊尋尌尞尰就属屟屡崱崲崳崴崵崶崷崸崹崺崻崼"
+    "崽崾崿嵀嵁嵂嵃嵄嵅嵆嵇嵈嵉嵋嵌嵍嵎嵏嵐嵑嵒嵓嵔嵕嵖嵗嵘嵙嵚嵛嵜嵝"
+    "嵫巯巽帽帿幀幁幂幃幄幅幆幇幉幈幾庽庿廀廁廂廃廊廄弑强弻弼弽弾彘彭"
+    "徚徥徦徧徨復循徫悲悳悶悹惁惄惉惌惎惑惒惖惠惡惢惣惥惩惪惫惰惱惲惴"
+    "惵惶惸惺惻惼惽惾惿愀愃愄愅愇愉愊愋愌愎愐愑愒愓愔愕愖愘愜愝愞愠愡"
+    "愢愣愤愥愦慨戞戟扉扊掌掔掣掰掱掾掿揀揁揂揃揄揆揇揈揉揊揋揌揍揎描"
+    "提揑插揓揔揕揖揗揘揙揚換揜揝揞揟揠握揢揣揥揦揨揩揪揬揭揮揯揰揲揳"
+    "援揵揶揷揸揹揺揻揼揽揾揿搀搁搂搃搄搅摒摡攲敜敞敟敠敡敢散敤敥敦敧"
+    "敨敩敪斌斐斑斝斞斮斯斱旐旑晪晫晬晭普景晰晱晲晳晴晵晶晷晹智晻晼晽"
+    "晾晿暀暁暂暃暑曾替朁朂朜朝朞期梴棃棄棅棆棇棈棉棊棋棌棍棎棏棐棑棒"
+    "棓棔棕棖棗棘棙棚棛棜棝棞棟棠棡棢棣棤棥棦棧棨棩棪棫棬棭森棯棰棱棲"
+    "棳棴棵棶棷棸棹棺棻棼棽棾棿椀椁椂椃椄椅椆椇椈椉椊椋椌植椎椏椐椑椒"
+    "椓椔椕椖椗椘椙椚椛検椝椞椟椠椡椢椣椤椥椦椧椨椩椪椫椬椭椮楮楰欹欺"
+    "欻欼欽款欿歮歯殔殕殖殗殘殙殚殼殽殾毯毰毱毲毳毴毵毶氬氭氮氯氰淼淾"
+    "渃渘渙減渜渝渞渟渠渡渢渣渤渥渦渧渨温渪渫測渭渮港渰渱渲渳渴渵渶渷"
+    "游渹渺渻渼渽渾渿湀湁湂湃湄湅湆湇湈湉湊湋湌湍湎湏湐湑湒湓湔湕湖湗"
+    "湘湙湚湛湜湝湞湟湠湡湢湣湤湥湦湧湨湩湪湫湭湮湯湰湱湲湳湵湶湷湸湹"
+    "湺湻湼湽湾湿満溁溂溃溄溅溆溇溈溉溊溋溌滋滞烻焙焚焛焜焝焞焟焠無焢"
+    "焣焤焥焦焧焨焩焪焫焬焭焮焯焰焱焲焳焴焵然焷焸焹焺焻焼焽焾焿煀煮爲"
+    "牋牌牍牚犀犂犃犄犅犆犇犈犉犊犋猆猋猌猒猫猢猣猤猥猦猧猨猩猬猭猯猰"
+    "猱猲猳猴猵猶猸猹珷琔琕琖琗琘琙琚琛琜琝琟琠琡琢琣琤琥琦琨琩琪琫琬"
+    "琭琮琯琰琱琲琳琴琵琶琷琸琹琺琻琼瓹瓺瓻瓼甤甥甦甯番畫畬畭畮畯畲畳"
+    "畴畱疎疏痗痘痙痚痛痜痝痞痟痠痡痢痣痤痥痦痧痨痩痪痫登發皒皓皔皕皖"
+    "皳皴盙盚盜睂睃睄睅睆睇睈睉睊睋睌睍睎睏睐睑矞矟矬短硜硝硞硟硠硡硢"
+    "硣硤硥硦硧硨硩硪硫硬硭确硯硰硱硲硳硴硵硶硷祦祰祱祲祳祴祵祶祷祸禄"
+    "禼秿稀稁稂稃稄稅稇稈稉稊程稌稍税窖窗窘窙窛窜窝竢竣竤童竦竧笿筀筁"
+    "筂筃筄筅筆筇筈等筊筋筌筍筎筏筐筑筒筓答筕策筗筘筙筚筛筜筝筬粞粟粠"
+    "粡粢粤粥粦粧粨粩粪粫粬粭紪紫絍絎絏結絑絒絓絔絕絖絗絘絙絚絜絝絞絟"
+    "絠絡絢絣絤絥給絧絨絩絪絫絬絭絮絯絰統絲絳絴絵絶絷絾缂缃缄缅缆缇缈"
+    "缉缊缋缌缍缎缏缐缑缒缓缔缕编缗缘缾缿罀罤罥罦羠羡羢翓翔翕翖翗翘翙"
+    "翚耋耠聎聏聐聑聒聓联聠胔胾脔脠脹脺脻脼脽脾脿腀腁腂腃腄腅腆腇腈腉"
+    "腊腋腌腍腎腏腑腒腓腔腕腖腗腘腙腚腴臦臮臯臰臵臶臷臸臹舃舄舒舜舼舽"
+    "舾舿艵茒茻荆莚莾莿菀菁菂菃菄菅菆菇菈菉菊菋菌菍菎菏菐菑菒菓菔菕菖"
+    "菗菘菚菛菜菝菞菟菠菡菢菣菤菥菦菧菨菩菪菫菬菭菮華菰菱菲菳菴菵菶菷"
+    "菸菹菺菻菼菽菾菿萀萁萂萃萄萅萆萇萈萉萊萋萌萍萎萏萐萑萒萓萔萕萖萗"
+    "萘萙萚萛萜萝萞萟萠萡萢萣萤萦萧著萸虛虝蚈蛐蛑蛒蛓蛔蛕蛗蛘蛙蛚蛛蛜"
+    "蛝蛞蛟蛠蛡蛢蛣蛤蛥蛦蛧蛨蛩蛪蛫蛬蛭蛮蛯蛰蛱蛲蛳蛴衆衇衈衉衕衖街袱"
+    "袲袳袴袵袶袷袸袹袺袻袼袽袾袿裀裁裂裃裄装裆裇裈裉裗褁覃覄覙覕覗覘"
+    "覚觌觍觚觛觝觞訴訵訶訷訸訹診註証訽詀詁詂詃詄詅詆詇詈詉詊詋詌詍詎"
+    "詏詐詑詒詓詔評詖詗詘詙詚詛詜詝詞詟詠谟谠谡谢谣谤谥谦谧豞豟豠象豾"
+    "豿貀貁貂貃貯貰貱貳貴貵貶買貸貹貺費貼貽貾貿賀賁赋赌赍赎赏赐赑赒赓"
+    "赔赕趀趁趂趃趄超趆趇趈趉越趋跅跆跇跈跉跊跋跌跍跎跏跑跒跓跔跕跖跗"
+    "跘跙跚跛跜距跞践躰軤軥軦軧軨軩軪軫軬軮軯軰軱軲軳軴軵軶軷軸軹軺軻"
+    "軼軽辇辈辉辊辋辌辍辎辜辝逨逩逪逫逬逭逮逯逰週進逳逴逵逶逷逸逹逺逻"
+    "郵郹郻郼郾郿鄀鄁鄂鄃鄄鄅鄆鄇鄈鄉鄊鄬酟酠酡酢酣酤酥釉释量釽釾釿鈀"
+    "鈁鈂鈃鈄鈅鈆鈇鈈鈉鈊鈋鈌鈍鈎鈏鈐鈑鈒鈓鈔鈕鈖鈗鈘鈙鈚鈛鈜鈝鈞鈟鈠"
+    "鈡鈢鈣鈤鈥鈦鈧鈨鈩鈪鈫鈬铸铹铺铻铼铽链铿销锁锂锃锄锅锆锇锈锉锊锋"
+    "锌锍锎锏锐锑锒锓锔锕镻開閌閍閎閏閐閑閒間閔閕閖閗阑阒阓阔阕陲陻陽"
+    "陾陿隀隁隂隃隄隅隆隇隈隉隊隋隌隍階隐雁雂雃雄雅集雇雈雬雭雮雯雰雱"
+    "雲雳靓靔靟靫靬靭靮靯靰靱韌韩項順頇須颉颊颋颌颍颎颏颩颪飓飧飨飩飪"
+    "飫飭飯飰飲馇馈馊馋馭馮骗骘骙骚骛骩髠鱿鲀鲁鲂鲃鳦鹀鹁鹂鹃鹄鹅鹆鹇"
+    "鹈黃黄黍黑黹鼋龂亂亃亄亶亷傪傫催傭傮傯傰傱傲傳傴債傶傷傸傹傺傻傼"
+    "傽傾傿僀僁僂僃僄僅僆僇僈僉僊僋僌働兡兾兿凗剷剸剹剺剻剼剽剾剿募勠"
+    "勡勢勣勤勥勦勧匯厀厁厪厫厯叠喍喿嗀嗁嗂嗃嗄嗅嗆嗇嗈嗉嗊嗋嗌嗍嗎嗏"
+    "嗐嗑嗒嗓嗔嗕嗖嗗嗘嗙嗚嗛嗜嗝嗟嗠嗡嗢嗣嗤嗥嗦嗧嗨嗩嗪嗫嗬嗭嗮嗯嗰"
+    "嗱嗲嗳嗴嗵圑園圓圔圕堽塃塉塊塋塌塍塎塏塐塑塒塓塔塕塖塗塘塙塚塛塜"
+    "塝塞塟塠塡塢塣塤塥塦塧塨塩塪填塬塭塮塯塰塱壼奦奧奨媐媰媱媲媳媴媵"
+    "媶媷媸媹媺媻媼媽媾媿嫀嫁嫂嫃嫄嫅嫆嫇嫈嫉嫊嫋嫌嫍嫎嫐嫑嫒嫓嫔孴孶"
+    "寖寗寘寙寚寛寜寝尟尠尲尳尴嵊嵞嵟嵠嵡嵢嵣嵤嵥嵦嵧嵨嵩嵪嵬嵭嵮嵯嵰"
+    "嵱嵲嵳嵴嵵嵶巰幊幋幌幍幎幏幹廅廆廇廈廉廋廌弒弿彀彁彂彙彚彮徬徭微"
+    "徯徰想惷惹愁愂愆愈愍意愗愙愚愛感愧愩愪愫愭愮愯愰愱愲愴愵愶愷愹愺"
+    "愼愽愾慀慃慄慅慆慉慊慌慍慎慏慑戦戠戡戢戣戤戥揧揫揱搆搇搈搉搊搋搌"
+    "損搎搏搐搑搒搓搔搕搖搗搘搙搚搛搜搝搞搟搠搡搢搣搤搥搦搧搨搩搪搬搭"
+    "搮搯搰搲搳搵搶搷搸搹携搼搽搾摀摁摂摃摄摅摆摇摈摉摊揅搱敭敫敬敮敯"
+    "数斒斟新旒旓旔旕旤晸暄暅暆暇暈暉暊暋暌暍暎暏暐暒暓暔暕暖暗暘暙會"
+    "朠朡椯椰椱椲椳椴椵椶椷椸椹椺椻椼椽椾椿楀楁楂楃楄楅楆楇楈楉楊楋楌"
+    "楍楎楏楐楑楒楓楔楕楗楘楙楚楛楜楝楞楟楠楡楢楣楤楥楦楧楨楩楪楫楬業"
+    "楯楱楲楳楴極楶楷楸楹楺楻楼楽楾楿榀榁概榃榄榅榆榇榈榉榋榌榔榘歀歁"
+    "歂歃歄歅歆歇歈歱歲歳殛殜殿毀毁毂毓毷毸毹毺毻毼毽氱湬溍溎溏源溑溒"
+    "溓溔溕準溗溘溙溚溛溜溝溞溟溠溡溢溣溤溥溦溧溨溩溪溫溬溭溮溯溰溱溲"
+    "溳溴溵溶溷溸溹溺溻溼溽溾溿滀滁滂滃滄滅滆滇滈滉滊滍滏滐滑滒滓滔滖"
+    "滗滘滙滛滜滝滟滠满滢滣滤滥滦滧滨滩滪漓滚煁煂煃煄煅煆煇煈煉煊煋煌"
+    "煍煎煏煐煑煒煓煔煖煗煘煙煚煜煝煞煟煠煡煢煣煤煥煦照煨煩煪煫煬煭煯"
+    "煰煱煲煳煴煵煶煷煸煺爺牃牎牏牐牑牒犌犍犎犏犐犑献猷獁猺猻猼猽猾猿"
+    "獀獂獅獆獇獈獉獊琧琞琽琾琿瑀瑁瑂瑃瑄瑅瑆瑇瑈瑉瑊瑋瑌瑍瑎瑏瑐瑑瑒"
+    "瑓瑔瑕瑖瑗瑘瑙瑚瑛瑜瑝瑞瑟瑯瓡瓽瓾瓿甁甝甞畵當畷畸畹畺痬痭痮痯痰"
+    "痱痲痳痴痵痶痷痸痹痺痻痼痽痾痿瘀瘁瘂瘃瘄瘅瘆瘏瘐皗皘皙皵盝盞盟睒"
+    "睓睔睕睖睗睘睙睚睛睜睝睞睟睠睢督睤睥睦睧睨睩睪睫睬睭睡睹矠矮硸硹"
+    "硺硻硼硽硿碀碁碂碃碄碅碆碇碈碉碊碋碌碍碎碏碐碑碒碓碔碕碖碗碘碙碚"
+    "碛碜碰祹祺祻祼祽祾祿禀禁禂禃禅禆禽萬稏稐稑稒稓稔稕稖稗稘稙稚稛稜"
+    "稝稞稟稠稡稢稣稤稥窞窟窠窡窢窣窤窥窦窧竨竩竪竫筞筟筠筡筢筣筤筥筦"
+    "筧筨筩筪筫筭筮筯筰筱筲筳筴筶筷筸筹筺筻筼筽签筿简節粮粯粰粱粲粳粴"
+    "粵糀絛絸絹絺絻絼絽絿綀綁綂綃綄綅綆綇綈綉綊綋綌綍綎綏綐綑綒經綔綕"
+    "綗綘継続綛缙缚缛缜缝缞缟缠缡缢缣缤罧罨罩罪罫罬罭置署羣群羥羦羧羨"
+    "義羪翛翜翝耡耢聕聖聗聘肄肅肆幐腛腜腝腞腟腠腡腢腣腤腥腦腧腨腩腪腫"
+    "腬腭腮腯腰腱腲腳腵腶腷腸腹腺腻腼腽腾舅舝艀艁艂艃艄艅艆艇艈艉莻菙"
+    "营萨萩萪萫萭萮萯萰萱萲萳萴萵萶萷萹萺萻萼落萾萿葀葁葂葃葄葅葆葇葈"
+    "葉葊葋葌葍葎葏葐葑葒葓葔葕葖葘葙葚葛葜葝葞葟葠葡葢董葤葥葦葧葨葩"
+    "葪葫葬葭葮葯葰葱葲葳葴葵葶葷葸葹葺葻葼葽葾葿蒀蒁蒂蒃蒄蒅蒆蒇蒈蒉"
+    "蒋蒌蒍蒎蒏蓅蓈蓱蔇虜虞號蛖蛵蛶蛷蛸蛹蛺蛻蛼蛽蛾蛿蜀蜁蜂蜃蜄蜅蜆蜇"
+    "蜈蜉蜊蜋蜌蜍蜎蜏蜐蜓蜔蜕蜖蜗蝆蝍衘衙裊裋裌裍裎裏裐裑裒裓裔裕裖裘"
+    "裙裚裛補裝裞裟裠裡裣裤裥覅覛覜觎觜觟觠觡觢解觤觥触觧訾訿詡詢詣詤"
+    "詥試詧詨詩詪詫詬詭詮詯詰話該詳詴詵詶詷詸詹詺詻詼詽詾詿誀誁誂誃誄"
+    "誅誆誇誈誉誊誠谨谩谪谫谬谼豊豋豢豣豤豥豦貄貅貆貇貈貉貊貲賂賃賄賅"
+    "賆資賈賉賊賋賌賍賎赖赗赨赩赪趌趍趎趏趐趑趒趓趔跐趼跟跠跡跢跣跤跥"
+    "跦跧跨跩跪跫跬跭跮路跰跱跲跳跴跶跷跸跹跺跻躱躲軭軾軿輀輁輂較輄輅"
+    "輆輇輈載輊輋輌辏辐辑辒输辔辞辟辠農逼逽逾逿遀遁遂遃遄遅遆遇遈遉遊"
+    "運遌遍過遏遐遑遒道達違遖遗郌鄋鄌鄍鄎鄏鄐鄑鄒鄓鄔鄕鄖鄗酦酧酨酩酪"
+    "酫酬酭酮酯酰酱鈮鈯鈰鈱鈲鈳鈴鈵鈶鈷鈸鈹鈺鈻鈼鈽鈾鈿鉀鉁鉂鉃鉄鉅鉆"
+    "鉇鉈鉉鉊鉋鉌鉍鉎鉏鉐鉑鉒鉓鉔鉕鉖鉗鉘鉙鉚鉛鉜鉝鉞鉟鉠鉡鉢鉣鉤鉥鉦"
+    "鉧鉨鉩鉪鉫鉬鉭鉮鉯鉰鉱鉲鉳鉴銏锖锗锘错锚锛锜锝锞锟锠锡锢锣锤锥锦"
+    "锧锨锩锪锫锬锭键锯锰锱閘閙閚閛閜閝閞閟閠阖阗阘阙随隑隒隓隔隕隖隗"
+    "隘雉雊雋雍雎雏雴雵零雷雸雹雺電雼雽雾靕靖靲靳靴靵靶靷靸靹韪韫韮韴"
+    "韵頉頊頋頌頍頎頏預頑頒頓颐频颒颓颔颕颖颫颬飔飬飮飱飳飴飵飶飷飹飻"
+    "飼飽飾飿馉馌馍馎馏馐馚馯馰馱馲馳馴馵骜骝骞骟骪骫骬骭骮髡髢鬽魛魜"
+    "魝魞鲄鲅鲆鲇鲈鲉鲊鲋鲌鲍鲎鲏鲐鳧鳨鳩鳪鳫鳭鳮鳯鳰鹉鹊鹋鹌鹍鹎鹏鹐"
+    "鹑鹒鹓鹔麀麁麂黽鼌鼎鼓鼔鼠龃龄龅龆僎像僐僑僒僓僔僕僖僗僘僙僚僛僜"
+    "僝僞僟僠僡僢僣僤僥僦僧僨僩僪僫僬僭僮僯僰僱僳僴僷僲兢冩凘凳凴劀劁"
+    "劂劃劄勨勩勪勫勬勭匰匱匲厬厭厮厰叆嗶嗷嗸嗹嗺嗻嗼嗽嗾嗿嘀嘁嘂嘃嘄"
+    "嘅嘆嘇嘈嘉嘊嘋嘌嘍嘎嘏嘐嘑嘒嘓嘔嘕嘖嘗嘘嘙嘚嘛嘜嘝嘞嘡嘢嘣嘤嘥嘦"
+    "嘧噑嘟嘨圖圗團圙塲塳塴塵塶塷塸塹塺塻塼塽塾塿墁墂境墄墅墆墇墈墉墊"
+    "墋墌墍墎墏墐墑墒墓墔墕墖増墘墙墚墛墭壽壾夐夢夣夤夥奩奪奫奬嫕嫖嫗"
+    "嫘嫙嫚嫛嫜嫝嫞嫟嫠嫡嫢嫣嫤嫥嫦嫧嫨嫩嫪嫫嫬嫭嫮嫯嫰嫱嫲嫳孵孷寞察"
+    "寠寡寢寣寤寥實寧寨對尡屢屣嵷嵸嵹嵺嵻嵼嵽嵾嵿嶀嶁嶂嶃嶄嶅嶆嶇嶈嶉"
+    "嶊嶋嶌嶍嶎幑幒幓幔幕幖幗幘幙幛幣廍廎廏廐廑廒廓廔廕廖廗廘廙廜弊彃"
+    "彄彅彆彯彰徱徳徴徶愨愬愳愸愻愿慁慂慇慈態慐慒慓慔慖慘慚慛慞慟慠慡"
+    "慢慣慥慩慪慬慯慱慲慳慴慵慷慺慻慽憀憁憆憈戧戨戩截戫戬搫搴搻搿摋摌"
+    "摍摎摏摐摑摓摔摕摗摘摙摚摛摜摝摞摟摠摢摣摤摥摦摧摪摫摬摭摱摲摳摴"
+    "摵摶摷摸摺摻摼摽摾摿撁撂撄撇摖撦敱敲敳斠斡斲旖旗暚暛暜暝暞暟暠暡"
+    "暢暣暤暥暦暧暨朄朅朢榊榍榎榏榐榑榒榓榕榖榗榙榚榛榜榝榞榟榠榡榢榣"
+    "榤榥榦榧榨榩榪榫榬榭榮榯榰榱榲榳榴榵榶榷榸榹榺榻榼榽榾榿槀槁槂槃"
+    "槄槅槆槇槈槉槊構槌槍槎槏槐槑槒槓槔槕槖槗様槙槚槛槜槝槞槟槠槡樮樃"
+    "歉歊歋歌歍歰歴殝殞殟殠殡毃毄毾氲氳滎滌滫滬滭滮滯滰滱滲滳滴滵滶滷"
+    "滸滹滺滻滼滽滾滿漁漂漃漄漅漆漇漈漉漊漌漍漎漏漑漒演漕漖漗漘漙漚漛"
+    "漜漝漞漟漠漡漢漣漤漥漧漨漩漪漫漬漭漮漯漰漱漲漳漴漵漶漷漸漹漺漻漼"
+    "漾潀潂潃潄潅潆潇潈潉潊潋潌潍潎潳煕煛煹煻煼煽煾煿熀熁熂熃熄熅熆熇"
+    "熈熉熊熋熌熍熎熏熐熑熒熓熔熕熖熗熘熙蒸爳爾牄牓牔犒犓犔犕犖犗獓獃"
+    "獄獌獍獏獐獑獒獔獕瑠瑡瑢瑣瑤瑥瑦瑧瑨瑪瑫瑭瑮瑰瑱瑲瑳瑴瑵瑶瑷瑸甀"
+    "甂甃甄甅甆甧畻畼畽疐疑瘇瘈瘉瘊瘋瘌瘍瘎瘑瘒瘓瘔瘕瘖瘗瘘瘧皶皷皸皹"
+    "盠盡盢監睮睯睰睱睲睳睴睵睶睷睸睺睻睼睽睾睿瞀瞁瞂瞃瞄瞅瞆硾碝碞碟"
+    "碠碡碢碣碤碥碦碧碨碩碪碫碬碭碮碯碱碲碳碴碵碶碷碸碹磁禇禈禉禊禋禌"
+    "禍禎福禐禑禒禓禔禕禖禗禘禙稦稧稨稩稪稫稬稭種稯稰稱稲稳穊稵窨窩窪"
+    "窫窬窭竬竭端竰竮筵箁箂箃箄箅箆箇箈箉箊箋箌箍箎箏箐箑箒箓箔箕箖算"
+    "箘箙箚箛箜箝箞箟箠管箢箣箤箥箦箧箨箩箪箫箸粶粷粸粹粺粻粼粽精粿糁"
+    "綖緐綜綝綞綟綠綡綢綣綤綥綦綧綨綩綪綫綬維綮綯綰綱網綳綴綵綶綷綸綹"
+    "綺綻綼綽綾綿緀緁緂緃緄緅緆緇緈緉緊緋緌緍緎総緑緒緔緕缥缦缧缨缩缪"
+    "缫罁罂罯罰罱罳罴羫翞翟翠翡翢翣翤翥耣耤耥聙聚聛聜聝聞聟聡聢聣肇肈"
+    "腐腿膀膁膂膃膄膅膆膇膈膉膊膋膌膍膎膏膑臧臺與舓舔舕舞艊艋艌艍蒐蒑"
+    "蒒蒓蒔蒕蒖蒗蒘蒙蒚蒛蒜蒝蒞蒟蒠蒡蒢蒣蒤蒥蒦蒧蒨蒩蒪蒫蒬蒭蒮蒯蒰蒱"
+    "蒲蒳蒴蒵蒶蒷蒹蒺蒻蒼蒽蒾蒿蓀蓁蓂蓃蓄蓆蓇蓉蓊蓋蓌蓍蓎蓏蓐蓑蓒蓓蓔"
+    "蓕蓖蓗蓘蓙蓚蓛蓜蓝蓟蓡蓢蓣蓤蓦蓥虠虡蜑蜒蜫蜘蜙蜚蜛蜜蜝蜞蜟蜠蜡蜢"
+    "蜣蜤蜥蜦蜧蜨蜩蜪蜬蜭蜮蜯蜰蜱蜲蜳蜴蜵蜶蜷蜸蜹蜺蜻蜼蜽蜾蜿蝀蝁蝂蝃"
+    "蝄蝅蝇蝈蝉蝊蝋蝕蝫裢裧裨裩裪裫裬裭裮裯裰裱裲裳裴裵裶裷裸裹裺裻裼"
+    "製裾裿褀褂褃褄褚覝覞覟覠覡觏觨觩觪觫誋誌認誎誏誐誑誒誓誔誖誗誘誙"
+    "誚誛誜誝語誟誡誢誣誤誥誦誧誨誩說誫説読誮谭谮谯谰谱谲谽豧豨豩豪貋"
+    "貌貍賏賐賑賒賓賔賕賖賗賘赘赙赚赛赫趕趖趗趘趙趚跼跽跾跿踀踁踂踃踄"
+    "踅踆踇踈踉踊踋踌踍踎躳躴躵輍輎輏輐輑輒輓輔輕辕辖辗辡辢辣遘遙遚遛"
+    "遜遝遞遟遠遡遢遣遤遥郒鄘鄙鄚鄛鄜鄝鄞鄟鄠鄡鄢鄣鄤鄥酲酳酴酵酶酷酸"
+    "酹酺酻酼酽酾酿鈭鉵鉶鉷鉸鉹鉺鉻鉽鉾鉿銀銁銂銃銄銅銆銇銈銉銊銋銌銍"
+    "銎銐銑銒銓銔銕銖銗銘銙銚銛銜銝銞銟銠銡銢銣銤銥銦銧銨銩銪銫銬銭銮"
+    "銯銰銱鋮鉼锲锳锴锵锶锷锸锹锺锻锼锽锾锿镀镁镂镃镄镅閡関閣閤閥閦閧"
+    "閨閩閪阚隙隚際障隝隞隟隠隡雌雐雑雒雿需霁靗靘静靤靺靻靼靽靾靿鞀鞁"
+    "鞂鞃鞄鞅鞆韍韎韬韶韷頙頔頕頖頗領頚颗颭颮颯颰颱飖飕飗飸餀餁餂餃餄"
+    "餅餆餇餉餌餎餏馑馒馛馜馝馶馷馸馹馺馻馼馽馾馿駀駁駂駃駄駅駆駇骠骡"
+    "骢骯骰骱髚髣髤髥髦髧髨髩髪鬦鬾鬿魀魁魂魟魠魡魢鲑鲒鲓鲔鲕鲖鲗鲘鲙"
+    "鲚鲛鲜鲝鲞鲟鳱鳲鳳鳴鳵鳶鹕鹖鹗鹙鹚鹛鹜麧麼麽鼻齊龇龈僵僶僸價僺僻"
+    "僼僽僾僿儀儁儂儃億儅儆儇儈儉儊儋儌儍儎儏儰凙凚凛凜劅劆劇劈劉劊劋"
+    "劌劍劎劏勮勯勰勱勲匔匳厱厲叇噓嘠嘩嘪嘫嘬嘭嘮嘯嘰嘱嘲嘳嘴嘵嘶嘷嘸"
+    "嘹嘺嘻嘼嘽嘾嘿噀噁噂噃噄噆噇噈噉噊噋噌噍噎噏噐噒噔噖噗噘噙噚噛噜"
+    "噝噴圚墀墜墝增墟墠墡墢墣墤墥墦墧墩墪墫墬墮墯墰墱墲墳墴墵墶墷墸墹"
+    "壿夀夦奭嫴嫵嫶嫷嫸嫹嫺嫻嫼嫽嫾嫿嬀嬁嬂嬃嬄嬅嬆嬇嬈嬉嬊嬋嬌嬍嬎嬏"
+    "審寫寬寭寮導尵層履屦屧嶏嶐嶑嶒嶓嶔嶕嶖嶗嶘嶙嶚嶛嶜嶝嶞嶟嶠嶡嶢嶣"
+    "嶤嶥巤幚幜幝幞幟幠幡幢幤幥幩廚廛廝廞廟廠廡廢廣廤彇彈彉影徲徵德徸"
+    "徹徺慕慗慙慜慝慤慦慧慫慮慰慶慸慹慼慾慿憂憃憄憅憇慭憉憋憍憎憏憐憒"
+    "憓憔憕憘憚憛憜憞憟憡憢憣憤憦憧憪憫憬憭憮憯憰憱憳戭戮戯摨摩摮摯摰"
+    "摹撀撃撅撆撈撊撋撌撍撎撏撐撑撒撓撔撕撖撗撘撙撚撛撜撝撞撟撠撡撢撣"
+    "撤撥撧撨撩撪撫撬播撮撯撰撱撲撳撴撵撶撷撸撹撺擆敵敶敷數敹敺敻斳暩"
+    "暪暫暬暭暮暯暰暱暲暳暴暵暶暷暼膤槩槢槣槤槥槦槧槨槪槫槬槭槮槯槰槱"
+    "槲槳槴槵槶槷槸槹槺槻槼槽槾槿樀樁樂樄樅樆樇樈樉樊樋樌樍樎樏樐樑樒"
+    "樓樔樕樖樗樘標樚樛樜樝樞樟樠模樢樣樤樥樦樧権横樫樬樭樯樰樱橥歎歏"
+    "歐歑歒歓歵歶殢殣殤殥殦毅毆毿氀氁氂滕漀漐漦漿潁漋漽潏潐潑潒潓潔潕"
+    "潖潗潘潙潚潛潜潝潟潠潡潢潣潤潥潦潧潨潩潪潫潬潭潮潯潰潱潲潴潵潶潷"
+    "潸潹潺潻潼潽潾潿澁澂澄澅澆澇澈澉澊澋澌澍澎澏澐澑澒澓澔澕澖澗澘澚"
+    "澛澜澝濐濆熦熚熛熜熝熞熟熠熡熢熣熤熥熧熨熩熪熫熬熭熮熯熰熱熲熳熴"
+    "熵黙噕爴牅牕牖牗犘犙犚犛獎獋獖獗獘獙獚獛獜獝獞獟獠獡獢獤瑩瑬瑹瑺"
+    "瑻瑼瑽瑾璀璁璂璃璄璅璆璇璈璉璊璋璌璎璓甇甈甉畾畿瘟瘙瘚瘛瘜瘝瘞瘠"
+    "瘡瘢瘣瘤瘥瘦瘨瘩瘪瘫皚皛皜皝皞皺盤瞇瞈瞉瞊瞋瞌瞍瞎瞏瞐瞑瞒瞓確碻"
+    "碼碽碾碿磀磂磃磄磅磆磇磈磉磊磋磌磍磎磏磐磑磒磓磔磕磗磘磙磤禚禛禜"
+    "禝禞禟禠禡禢禣稴稶稷稸稹稺稻稼稽稾稿穀穁穂穃窮窯窰窱窲窳窴箬箭箮"
+    "箯箰箱箲箳箴箵箶箷箹箺箻箼箽箾箿篁篂篃範篅篆篇篈篊篋篌篍篎篏篐篑"
+    "篒篓糂糃糄糅糆糇糈糉糊糋糌糍糎緓緖緗緘緙線緛緜緝緞緟締緡緢緣緤緥"
+    "緦緧編緩緪緫緬緭緮緯緰緱緲緳練緵緶緷緸緹緺緻緼緽緾緿縀縁縂縃縄縅"
+    "縆縇缬缭缮缯罵罶罷罸羬羭羮羯羰翦翧翨翩翪翫翬翭耦耧聤聥聦聧聨聩聪"
+    "聫膒膓膔膕膖膗膘膙膚膛膜膝膞膟膠膡膢膣臱舖舗艎艏艐艑艒艓艔蒊蓠蓧"
+    "蓨蓩蓪蓫蓬蓭蓮蓯蓰蓲蓳蓴蓵蓶蓷蓸蓹蓺蓻蓼蓽蓾蓿蔀蔁蔂蔃蔄蔅蔆蔈蔉"
+    "蔊蔋蔌蔍蔎蔏蔐蔑蔒蔓蔔蔕蔖蔗蔘蔙蔚蔛蔜蔝蔞蔟蔠蔡蔢蔣蔤蔥蔦蔧蔨蔩"
+    "蔪蔫蔬蔭蔮蔯蔰蔱蔲蔳蔴蔵蔶蔷蔸蔹蔺蔻蔼蔽蕏虢蝌蝎蝏蝐蝑蝒蝓蝔蝖蝗"
+    "蝘蝙蝚蝛蝜蝝蝞蝟蝠蝡蝢蝣蝤蝥蝦蝧蝨蝩蝪蝬蝭蝮蝯蝰蝱蝲蝳蝴蝵蝶蝷蝸"
+    "蝺蝻蝼蝽蝾蝿螀蟡螂衚衛衜衝裦褅褆複褈褉褊褋褌褍褎褏褐褑褒褓褔褕褖"
+    "褗褘褙褛褜褝覢覣覤覥覩觐觑觬觭觮觯觰誕誯誰誱課誳誴誵誶誷誸誹誺誻"
+    "誼誽誾調諀諁諂諃諄諅諆談諈諉諊請諌諍諎諏諐諑諒諓諔諕論諗諘諙諚諩"
+    "諛諸谳谴谵谾豌豍豎豬貎貏賙賚賛賜賝賞賟賠賡賢賣賤賥賦賧賨賩質賫賬"
+    "賭赜赭趛趜趝趞趟趠趡趢趣趤踏踐踑踒踓踔踕踖踗踘踙踚踛踜踝踞踟踠踡"
+    "踢踣踤踥踦踧踨踩踪踬踭踮踯踺踫踷躶躷躸躹躺躻躼輖輗輘輙輚輛輜輝輞"
+    "輟輠輡輢輣輤輥輦輧輨輩輪輫輬辘辤辳遦遧遨適遪遫遬遭遮遯遰遱遳遷郶"
+    "鄦鄧鄩鄪鄫鄭鄮鄯鄰鄱鄲醀醁醂醃醄醅醆醇醈醉醊醋醌銲銳銴銵銶銷銸銹"
+    "銺銻銼銽銾銿鋀鋁鋂鋃鋄鋅鋆鋇鋈鋉鋊鋌鋍鋎鋏鋐鋑鋒鋓鋔鋕鋖鋗鋘鋙鋚"
+    "鋛鋜鋝鋞鋟鋠鋡鋢鋣鋤鋥鋦鋧鋨鋩鋪鋫鋬鋭鋯鋰鋱鋲鋳鋴鋵鋶镆镇镈镉镊"
+    "镋镌镍镎镏镐镑镒镓镔镕镼閫閬閭閮閯閰閱閲閳閴隢隣隤隥雓霂霃霄霅霆"
+    "震霈霉霊靚靠靥鞇鞈鞉鞊鞋鞌鞍鞎鞏鞐鞑鞒韏韐韑韯頛頜頝頞頟頠頡頢頣"
+    "頦頧頨頩頪頫頬题颙颚颛颜额颲颳飘飺餈養餋餍餑餒餓餔餕餖餗餘餙馓馔"
+    "駈駉駊駋駌駍駎駏駐駑駒駓駔駕駖駗駘駙駚駛駜駝駞駟駠骣骲骳骴骵骶骷"
+    "髛髫髬髮髯髰髱髲髳髴鬧魃魄魅魆魣魤魥魦魧魨魩魪魫魬魭魮魯魰魱魲魳"
+    "魴魵魶魷魸魹鲠鲡鲢鲣鲤鲥鲦鲧鲨鲩鲪鲫鲬鳷鳸鳹鳺鳻鳼鳽鳾鳿鴀鴁鴂鴃"
+    "鴄鴅鴆鴇鴈鴉鴋鴌鴍鴎鹘鹝鹞鹟鹠鹡鹢鹣鹤鹶麃麄麨麩麪麫麹麾黎墨黓鼏"
+    "鼐鼑齑齒龉龊亸儐儑儒儓儔儕儖儗儘儙儚儛儜儝儞儫兣冀冪凝凞劐劑劒劓"
+    "劔勳匴叡噞噟噠噡噢噣噤噥噦噧器噩噪噫噬噭噮噯噰噱噲噳噵噶噷噸噹噺"
+    "噻噼圛圜墺墻墼墽墾墿壀壁壂壃壄壅壆壇壈壉壊壋壌夁奮奯嬐嬑嬒嬓嬔嬕"
+    "嬖嬗嬘嬙嬚嬛嬜嬝嬞嬟嬠嬡嬢嬴嬨學孹寯寰嶦嶧嶨嶩嶪嶫嶬嶭嶮嶯嶰嶱嶲"
+    "嶳嶴嶵嶶幦幧幨幯廥廦廧廨廩廪彊彋彛彜徻徼憊憌憑憖憗憙憝憠憥憨憩憲"
+    "憴憶憷憸憹憺憽憾憿懀懁懄懅懆懈懊懌懍懎懏懐懒懓懔憻戱戰撉撻撼撽撾"
+    "撿擀擁擂擃擄擅擇擈擉擋擌操擏擐擑擒擓擔擕擖擗擙據擛擜擝擞擳攳整敼"
+    "敽敾敿斓斢斴旘旙暸暹暺暻暽暾暿曀曁曂曃曄曅曆曇曈曉曊曋曌曍曏朆朣"
+    "朤朥樨橴樲樳樴樵樶樷樸樹樺樻樼樽樾樿橀橁橂橃橄橅橆橇橈橉橊橋橌橍"
+    "橎橏橐橑橒橓橔橕橖橗橘橙橚橛橜橝橞機橠橡橢橣橤橦橧橨橩橪橫橬橭橮"
+    "橯橰橱橲橳橵橶橷橸橹橺橻橼歔歕歖歗歘歙歚歷殧殨殩殪殫毇毈氃氄氅氆"
+    "氇潞澃澙澞澟澠澡澢澣澤澥澦澧澨澪澫澬澭澮澯澰澱澲澳澴澵澶澷澸澹澺"
+    "澻澼澽澾澿激濁濂濃濄濅濇濈濉濊濋濍濎濏濑濒濓濖瀄熶熷熸熹熺熻熼熽"
+    "熾熿燀燁燂燃燄燅燆燇燈燉燊燋燌燍燎燏燐燑燒燓燔燕燖燗燘燙燚燛燜燝"
+    "燞犜犝犞犟獣獥獦獧獨獩獪獫獬獭瑿璍璏璑璒璔璕璖璘璙璚璛璜璝璞璟璠"
+    "璡璣璤璢瓢甊甋甌甍甎疀疁疂瘬瘭瘮瘯瘰瘱瘲瘳瘴瘵瘶瘷瘸瘹瘺瘻瘼瘽瘾"
+    "瘿癊皟皠皡皻盥盦盧瞔瞕瞖瞗瞘瞙瞚瞛瞜瞝瞞瞟瞠瞡瞢瞣瞥磖磜磚磛磝磞"
+    "磟磠磡磢磣磥磦磧磨磩磪磫磬磭磮禤禥禦禩穄穅穆穇穈穋穌積穎穏穐穑穒"
+    "穓窵窶窷窸窹窺窻窼窽竱築篔篕篖篗篘篙篚篛篜篝篞篟篠篡篢篣篤篥篦篧"
+    "篨篩篪篫篬篭篮篯簑篹糏糐糑糒糓糔糕糖糗糘縈縉縊縋縌縍縎縏縐縑縒縓"
+    "縔縕縖縗縘縙縚縛縜縝縞縟縠縡縢縣縤縥縦縧縨缰缱缲缳缴罃罹罺罻罼羱"
+    "羲翮翯翰翱耨耩耪聬聭聮膐膦膧膨膩膪膫膬膭膮膯膰膱膲膳膴膵膶膷膹臲"
+    "臻興舆舉舘艕艖艗艘艙蓞蔾蔿蕀蕁蕂蕃蕄蕅蕆蕇蕈蕉蕊蕋蕌蕍蕎蕐蕑蕒蕓"
+    "蕔蕕蕖蕘蕙蕚蕛蕜蕝蕞蕟蕠蕡蕢蕣蕤蕥蕦蕧蕨蕩蕪蕫蕬蕭蕮蕯蕰蕱蕲蕳蕴"
+    "蕵薌虣虤虥虦蝹螁螃螄螅螆螇螈螉螊螋螌融螎螏螐螑螒螓螔螕螖螗螘螙螚"
+    "螛螜螝螞螟螠螡螢螣螤螥螦螧螨螩衞衟衠衡褞褟褠褡褢褣褤褥褦褧褨褩褪"
+    "褫褬褭褮褯褰褱褲褴覦覧覨親觱諜諝諞諟諠諡諢諣諤諥諦諧諨諪諫諬諭諮"
+    "諯諰諱諲諳諴諵諶諷諹諺諻諼諽諾諿謀謁謂謃謔豫豭豮貐貑貒貓賮賯賰賱"
+    "賲賳賴賵赝赞赟赠赬赮趥趦趧踰踱踲踳踴踵踶踸踹踻踼踽踾踿蹀蹁蹂蹃蹄"
+    "蹅躽躾輭輮輯輰輱輲輳輴輵輶輷輸輹輺輻輼辙辚辥辦辧辨辩辪遲遴遵遶選"
+    "遹遺遻遼邆郺鄳鄴鄵鄶鄷醍醎醏醐醑醒醓醔醕醖醗鋋鋷鋸鋹鋺鋻鋼鋽鋾鋿"
+    "錀錁錂錃錄錅錆錇錈錉錊錋錌錍錎錏錐錑錒錓錔錕錖錗錘錙錚錛錜錝錞錟"
+    "錠錡錢錣錤錥錦錧錩錪錫錬錭錮錯錰錱録錳錴錵錶錷錸錹錺錻錼錽錾錿鍀"
+    "鍁鍂鍃鍄鍅鍆鍈鍺镖镗镘镙镚镛镜镝镞镟镠閵閶閸閹閺閻閼閽閾閿闁闂闍"
+    "阛隦隧隨隩險隫隷雔雕霋霌霍霎霏霐霑霒霓霔霕霖霗靛靜靦鞓鞔鞕鞖鞗鞘"
+    "鞙韒韰韸頤頥頭頮頯頰頱頲頳頴頵頶頷頸頹頺頻頼頽颞颟颠颡颴颵飙飚餐"
+    "餝餚餛餜餞餟餠餡餢餣餤餦餧館餩餴馞馟馠駡駢駣駤駥駦駧駨駩駪駫駬駭"
+    "駮駯駰駱駲骸骹骺骻骼骿髭髵髶髷髸髹髺髻鬇鬨鬳魇魺魻魼魽魾魿鮀鮁鮂"
+    "鮃鮄鮅鮇鮈鮉鮊鮋鮌鮍鮎鮏鮐鮑鮒鮓鮔鮕鮖鮗鮘鮣鲭鲮鲯鲰鲱鲲鲳鲴鲵鲶"
+    "鲷鲸鲹鲺鲻鴊鴏鴐鴑鴒鴓鴔鴕鴖鴗鴘鴙鴚鴛鴝鴞鴟鴠鴡鴢鴣鴤鴥鴦鴧鴨鴩"
+    "鴪鴫鴬鹥鹦鹧鹨鹷鹾麅麆麇麈麬麭麮麺黅黆黔黕黖黗默黺鼒鼼鼽齓龍龜償"
+    "儠儡儢儣儤儥儦儧儨儩優儬儲凟劕勴勵勶匵厳噽噾噿嚀嚁嚂嚃嚄嚅嚆嚇嚈"
+    "嚉嚊嚋嚌嚍嚎嚏嚐嚑嚒嚓壍壎壏壐壑壒壓壔壕壖壗嬣嬤嬥嬦嬧嬩嬪嬫嬬嬭"
+    "嬮嬯嬰嬱嬲嬳嬵嬶嬷孺孻寱寲尶尷屨嶷嶸嶹嶺嶼嶽嶾嶿嶻幪幫幬彌徽徾憵"
+    "憼懂懃懇應懋懑懗懙懚懛懜懝懞懠懡懢懤懥懦懧懨戲戴擊擎擘擟擠擡擢擣"
+    "擤擦擨擩擫擬擭擮擯擰擱斀斁斂斃斣斵斶旚曎曐曑曒曓曔曕曖曗曚曙橽橾"
+    "橿檀檁檂檃檄檅檆檇檈檉檊檋檌檍檎檏檐檑檒檓檔檕檖檗檘檙檚檛檜檝檞"
+    "檟檠檡檢檣檤檥檦檧檨檩檪櫛歛歜歝殬殭殮毚氈氉氊澩濌澀濔濕濗濘濙濚"
+    "濛濜濝濞濟濠濡濢濣濤濥濦濧濨濩濪濫濬濭濮濯濰濱濲濴濵濶濸營燠燡燢"
+    "燣燤燥燦燧燨燩燪燫燬燭燮燯燰燱燲燳燴燵燶燷爵牆犠獮獯獰獱獲獳獴璐"
+    "璗璥璦璨璩璪璫璬璭璮璯環璱璲璳璴甏甐甑甒疃疄癀癁療癃癄癅癆癇癈癉"
+    "癋癌癍癎皢皣皤皥皼盨盩盪瞤瞦瞧瞨瞩瞪瞫瞬瞭瞮瞯瞰瞱瞲瞳瞴瞵瞶瞷矯"
+    "矰磯磰磱磲磳磴磵磶磷磸磹磺磻磼磽磾磿礀礁礂礃礄礅禧禨禪禫穉穔穕穖"
+    "穗穘穙穚穛穜穝穞窾窿竀竁竂竲竳竴簕篰篱篲篳篴篵篶篷篸篺篻篼篽篾篿"
+    "簀簁簂簃簄簅簆簇簈簉簊簋簌簍簎簏簐簒簓簔簖簗簘糙糚糛糜糝糞糟糠糡"
+    "糢糨縩縪縫縬縭縮縯縰縱縲縳縴縵縶縷縸縹縺縻縼總績縿繀繁繂繃繄繅繆"
+    "繇繉繊繌繍繈罄罅罆罽罾罿羁翲翳翴翵翶翼耫耬聯聰聱聲聳聴膥膸膺膻膼"
+    "膽膾膿臀臁臂臃臄臅臆臇臈臉臊臌臨臩艚艛艜艝艱蕗蕶蕷蕸蕹蕺蕻蕼蕽蕾"
+    "蕿薀薁薂薃薄薅薆薇薈薉薊薋薍薎薏薐薑薒薓薔薕薖薗薘薙薚薛薜薝薞薟"
+    "薠薡薢薣薤薥薦薧薨薪薫薬薮薭薯虧虨螪螫螬螭螮螯螰螱螲螳螴螵螶螷螸"
+    "螹螺螻螼螽螾螿蟀蟁蟂蟃蟄蟅蟆蟇蟈蟉蟊蟋蟌蟍蟎蟏蟐蟑蟒蟞褳褵褶褷褸"
+    "褹褺褻褼褽褾褿襀襁襂襃襄襅襔襒覫覬覭覮覯觲觳謄謅謆謇謈謉謊謋謌謍"
+    "謎謏謐謑謒謓謕謖謗謘謙謚講謜謝謞謟謠謡謢谿豀豁豏豯豰豱豲豳貔貕貖"
+    "賶賷賸賹賺賻購賽赡赢赯趨蹆蹇蹈蹉蹊蹋蹌蹍蹎蹏蹐蹑蹒蹓輽輾輿轀轁轂"
+    "轃轄轅辫遽遾避邀邁邂邃還邅邉鄸鄹醘醙醚醛醜醝醞醟醠醡醢醣醤錨鍇鍉"
+    "鍊鍋鍌鍍鍎鍏鍐鍑鍒鍓鍔鍕鍖鍗鍘鍙鍚鍛鍜鍝鍞鍟鍠鍡鍢鍣鍤鍥鍦鍧鍨鍩"
+    "鍪鍫鍬鍭鍮鍯鍰鍱鍲鍳鍴鍵鍶鍷鍸鍹鍻鍼鍽鍾鍿鎀鎁鎂鎃鎄鎅鎆鎇鎡鎯镡"
+    "镢镣镤镥镦镧镨镩镪镫闀閷闃闄闅闆闇闈闉闊闋闌闎闏隬隭隮隯隰隱隲隸"
+    "雖霘霙霚霛霜霝霞霟霠霡鞚鞛鞜鞝鞞鞟鞠鞡韓韔韕韱顀顁顂顃顄顅顆顇顈"
+    "顉顊颶颷餥餪餫餬餭餯餰餱餲餳餵餷饂饆馘馡馢馣駴駵駶駷駸駹駺駻駼駽"
+    "駾駿騀騁騂騃駳骤骽骾髼髽髾髿鬀鬁鬂鬴魈魉鮆鮙鮚鮛鮜鮝鮞鮟鮠鮡鮢鮤"
+    "鮥鮦鮧鮨鮩鮪鮫鮬鮭鮮鮯鮰鮱鮲鮳鮴鮺鯎鲼鲽鲿鳀鳁鳂鳃鳄鳅鳆鳇鳈鳉鳊"
+    "鳋鲾鴜鴭鴮鴯鴰鴱鴲鴳鴴鴵鴶鴷鴸鴹鴺鴻鴼鴽鴾鴿鵀鵁鵂鵃鵄鵅鵆鵇鵈鵉"
+    "鵧鹩鹪鹫鹬麉麊麋麯麰黇黈黉黏黚黛黜黝點黻黿鼢鼣鼤鼾鼿齋齔齢龋龌龠"
+    "儭儮儯儱冁叢嚔嚕嚖嚗嚘嚙嚚嚛嚜嚝嚞嚟嚠嚡嚢嚣嚤嚮壘壙夑夓奰嬸嬺嬻"
+    "嬼屩屪巀巁巂幭幮廫彍彝彞懕懖懘懟懣懩懪懫懭懮懰懱懳懴戳擧擪擥擲擴"
+    "擵擶擷擸擹擺擻擼擽擾擿攁攂攃攄攅攆贁斔斷旛曘曛曜朦檫檬檭檮檯檰檱"
+    "檲檳檴檵檶檷檸檹檺檻檼檽檾檿櫀櫁櫂櫃櫄櫅櫆櫇櫈櫉櫊櫡櫭歞歟歸殯毉"
+    "氋濷濹濺濻濼濽濾濿瀀瀁瀂瀃瀅瀆瀇瀈瀉瀊瀋瀌瀍瀎瀏瀐瀑瀒瀓瀔瀦燸燹"
+    "燺燻燼燽燾燿爀爁爃獵獶獷璧璵璶璸璹璻璼璾璿瓀瓁瓂甓甔甕疅癏癐癑癒"
+    "癓癔癕癖癗癘癙癚癛癜癝癞癤皦皧皨皽盫盬瞸瞹瞺瞻瞼瞽瞾瞿矀矁矂礆礇"
+    "礈礉礊礋礌礍礎礏礐礑礒礓礔礕礖禬禭禮禯穟穠穡穢穣竄竅竵簙簚簛簜簝"
+    "簞簟簠簡簢簣簤簥簦簧簨簩簪簫簭簮簯簰簱簲糣糤糥糦糧繎繏繐繑繒繓織"
+    "繕繖繗繘繙繚繛繜繝繞繟繠繡繢繣繤繥繧繱罇罈罉羀羂羳羴羵翷翸翹翺翻"
+    "耭耮聵聶職臍臎臏臐臑臒臓舊舙艞艟艠薩薰薱薲薳薴薵薶薷薸薹薺薻薼薽"
+    "薾薿藀藁藂藃藄藅藆藇藈藉藊藋藌藍藎藏藐藒藓虩蟗蟓蟔蟖蟘蟙蟚蟛蟜蟝"
+    "蟟蟠蟢蟣蟤蟥蟦蟧蟨蟩蟪蟫蟬蟭蟮蟯蟰蟱蟲蟳蟴蟵蠎襆襇襈襉襊襋襌襍襎"
+    "襏襐襑襓襕覆覰覱覲観觴鵤謣謤謥謦謧謨謩謪謫謬謭謮謯謰謱謲謳謴謵謶"
+    "謷謸謹謺謻謼謽謾譇豂豐豴豵貗貘貙賾賿贀贂贃贄贅趩蹔蹕蹖蹗蹘蹙蹚蹛"
+    "蹜蹝蹞蹟蹠蹡蹢蹣蹤蹥蹦蹧蹮躀蹩躿軀軁轆轇轈轉轊轋轌辬邇邈鄨鄺鄻鄼"
+    "鄽鄾醥醦醧醨醩醪醫醬釐鎈鎉鎊鎋鎌鎍鎎鎏鎐鎑鎒鎓鎔鎕鎖鎗鎘鎙鎚鎛鎜"
+    "鎝鎞鎟鎠鎢鎣鎤鎥鎦鎧鎨鎪鎫鎬鎭鎮鎰鎱鎲鎳鎴鎵鎶鎷鎸鎹鎺鎻鎼鎽鎾鎿"
+    "镬镭镮镯镰镱闐闑闒闓闔闕闖闗闘隳雗雘雙雚雛雜雝雞雟雠離霢霣霤霥靝"
+    "鞢鞣鞤鞥鞦鞧鞨鞩鞪鞫鞬鞭鞮鞯鞰韖韗韘韙韚韹韺頿頾顋題額顎顏顐顑顒"
+    "顓顔顕颢颣颸颹颺餮餶餸餹餺餻餼餽餾餿饀饁馤馥騄騅騆騇騈騉騊騋騌騍"
+    "騎騏騐騑騒験髀髁髜鬃鬄鬅鬆鬈鬩鬵鬶魊魋魌魍魎魏鮵鮶鮷鮸鮹鮻鮼鮽鮾"
+    "鮿鯀鯁鯂鯃鯄鯆鯇鯈鯉鯊鯋鯌鯍鯏鯐鯑鯒鯓鯽鳌鳍鳎鳏鳐鳑鳒鵊鵋鵌鵍鵎"
+    "鵏鵐鵑鵒鵓鵔鵕鵖鵗鵘鵙鵚鵛鵜鵝鵞鵟鵠鵢鵣鵥鹭鹮鹯鹰麌麍麎麏麐麱麲"
+    "麿黊黋黟黠黡鼀鼁鼂鼕鼖鼥鼦鼧鼨鼩鼪鼫鼬齌齕龎儳儴儵劖勷勸匶厴壡嚥"
+    "嚦嚧嚨嚩嚪嚫嚬嚭嚯嚰壚壛壜壝壞壟壠壢夒嬽嬹嬾嬿孼寳寴寵屫巃巄巅幰"
+    "廬廭龐彟徿懬懯懲懵懶懷懻攀攇攈攉攊攋攌攍攎攏攐攒斄旜旝旞曝曞曟曠"
+    "曡曢櫋櫌櫍櫎櫏櫐櫑櫒櫓櫔櫕櫖櫗櫘櫙櫚櫜櫝櫞櫟櫠櫢櫣櫤櫥櫦櫫櫧歠殰"
+    "殱氌濳瀕瀖瀗瀘瀙瀚瀛瀜瀝瀞瀟瀠瀡瀢瀣瀤瀥瀧瀨瀩瀫瀬瀭瀮爂爄爅爆爇"
+    "爈爉爊爌爍爎爕牘犡犢犣犤犥犦獸獹獺璷璽瓃瓄瓅瓆瓇瓈瓉瓊瓋瓣甖疆疇"
+    "癟癠癡癣皩矃矄矅矆矇矈矉矊矱礗礘礙礚礛礜礝礞礟礠礡禰禱穤穥穦穧穨"
+    "穩穪穫竆簬簳簴簵簶簷簸簹簺簻簼簽簾簿籀籁籂糩糪糫糬糭繋繦繨繩繪繫"
+    "繬繭繮繯繰繲繳繴繵繶繷繸繹繺缵罊罋羃羄羅羆羶羷羸羹翽翾聸臋臔臕臗"
+    "臘舋舚艡艢艣艤艥艶藑藕藖藗藘藙藚藛藜藝藞藟藠藡藢藣藤藥藦藧藨藩藪"
+    "藫藬藭藯藰藱藲藳藴藵藷藸蠁蟕蟶蟷蟸蟹蟺蟻蟼蟽蟾蟿蠀蠂蠃蠄蠅蠆蠇蠈"
+    "蠉蠊蠋蠌蠍蠏蠞襖襗襘襙襚襛襜襝襞襟襠襡襢覇覈覴覵覶覷覸觵觶謿譀譁"
+    "譂譃譄譆譈證譊譋譌譎譏譐譑譒譓譔譕譖譗識譙譚譛譜谶豃豷豶貚贆贇贈"
+    "贉贊贋贌趪趫趬趭蹨蹪蹫蹬蹭蹯蹰蹱蹲蹳蹴蹵蹶蹷蹸蹹蹺蹻蹼蹽蹾蹿躇軂"
+    "軃軄軅轍轎轏轐轑轒轓轔辭辴邊邋邌鄿酀酂醭醮醯醰醱鎩鏀鏁鏂鏃鏄鏅鏆"
+    "鏇鏈鏉鏊鏋鏌鏍鏎鏏鏐鏑鏒鏓鏔鏕鏖鏗鏘鏙鏚鏛鏜鏝鏞鏟鏠鏡鏢鏣鏤鏥鏦"
+    "鏧鏨鏩鏪鏫鏬鏭鏮鏯鏰鏱鏲鏹镲镽闙闚闛關闝隴雡難霦霧霨霩霪霫霬霭靡"
+    "鞱鞲鞳鞴鞵鞶鞷韜韝韞韟韲韻韼顖顗願顙顚顛顜顝類颤颻颼颽颾颿飀饃饄"
+    "饅饇饈饉馦馧騔騕騖騗騘騙騚騛騜騝騞騟騠騡騢騣騤騥騦騧騨骥髂髃髅鬉"
+    "鬊鬋鬌鬍鬎鬏鬷鯅鯔鯕鯖鯗鯘鯙鯚鯛鯜鯝鯞鯟鯠鯡鯢鯣鯤鯥鯦鯧鯨鯩鯪鯫"
+    "鯬鯭鯮鯯鯰鯱鯲鯳鯴鯵鯺鳓鳔鳕鳖鳗鳘鳙鳚鳛鵡鵦鵨鵩鵪鵫鵬鵭鵮鵯鵰鵱"
+    "鵲鵳鵴鵵鵶鵷鵸鵹鵺鵻鵼鵽鵾鵿鶀鶁鶂鶃鶄鶅鶆鶇鶈鶉鶊鶋鶌鶍鶎鶏鶑鹱"
+    "鹲鹸麑麒麓麔麕麖麗麳麴黀黢黣黼鼃鼄鼗鼭齀齁齍齖齗齘龏儶匷嚱嚲嚳嚴"
+    "嚵嚶嚷嚸嚹嚼壣壤壥孀孁孂孃孄孅孆孽孾寶巆巇巈巉巊巌幱廮廯廰忀忁懸"
+    "懹懺攓攔攕攖攗攘攙攚斅斆旟曣曤曥曦曧曨朧櫨櫩櫪櫬櫮櫯櫰櫱櫲櫳櫴櫵"
+    "櫶櫹瀪瀯瀰瀱瀲瀳瀴瀵瀶瀷瀸瀹瀺瀻瀼瀽瀾瀿灀灁灂爋爏爐爑爒爓爔爖爗"
+    "爘犧犨獻獼獽璺瓌瓍瓎瓏瓐瓑瓒疈疉癢癥癦皪皫皾盭矋矌矍矎矏矲礢礣礤"
+    "礥礦礧礨礩礪礫礬禲穬穭穮穯竇競竷籃籄籅籆籇籈籉籊籋籌籍籎籏籕糮糯"
+    "糰繻繼繽繾繿纀纁纂纃罌羺翿耀耯聹聺聻聼臖臙臚臛臜艦艧艨艩蘤藮藶藹"
+    "藺藻藼藽藾藿蘀蘁蘂蘃蘄蘅蘆蘇蘈蘉蘊蘋蘌蘍蘎蘏蘐蘑蘓蘔蘢蘒蘛蘰蠐蠑"
+    "蠒蠓蠔蠕蠖蠗蠘蠙襣襤襥襦襧襨覹覺覻觷觸觹譍譝譞譟譠譡譢譣譤譥警譧"
+    "譨譩譪譫譬譭譮譯議譱譲豑贍贎贏趮躁躂躃躄躅躆躈躉軆轕轖轗轘轙轚辮"
+    "邍酁酃醲醳醴醵醶醷醸釋鏳鏵鏶鏷鏸鏺鏻鏼鏽鏾鏿鐀鐁鐂鐃鐄鐅鐆鐇鐈鐉"
+    "鐊鐋鐌鐍鐎鐏鐐鐑鐒鐓鐔鐕鐖鐗鐘鐙鐚鐛鐜鐝鐞鐟鐠鐡鐢鐣鐤鐥鐦鐧鐨鐯"
+    "鐼镳镴闞闟闠闡隵霮霯霰霱霳霴鞸鞹鞺鞻韛韠韽韾響顟顠顡顢顣颥飁飂飃"
+    "飄饊饋饌饍饎饐饑饒饓饙馨騩騪騫騬騭騮騯騰騱騲騳騴騵騶騷騸骦骧髄髆"
+    "髇髈髉髊髋髌鬐鬑鬒鬓鬪鬸魐鯻鯶鯷鯸鯹鯼鯾鯿鰀鰁鰂鰃鰄鰅鰆鰇鰈鰉鰊"
+    "鰋鰌鰍鰎鰏鰐鰑鰒鰓鰔鰕鰖鰗鰘鰙鰚鰛鰠鱀鳜鳝鳞鳟鶐鶒鶓鶔鶕鶖鶗鶘鶙"
+    "鶚鶛鶜鶝鶞鶟鶠鶡鶢鶣鶤鶥鶦鶧鶨鶩鶪鶫鶿鹹麘麙麚麛麵黁黤黥黦黧黨黩"
+    "黪鼍鼮鼯鼰齙齚齛齝齞齟齠齡齣龑儷儸儹儺兤劗劘卛嚺嚻嚽嚾嚿囀囁囂囃"
+    "囄囍壦夔孇孈孉寷屬巋巍巏巐廱忂懼懽懾攑攛攜攝斕曩朇櫸櫺櫻櫼櫽櫾櫿"
+    "欀欁欂欃欄欅欌殲灃灄灅灆灇灈灉灊灋灌灍灏灐爙爚爛爝獾瓓瓔瓖甗癧癨"
+    "癩癪癫皬矐矑矒矓礭礮礯礰礱礲礳礴竃竈竉籖籐籑籒籓籔糲纄纅纆纇纈纉"
+    "纊纋續纍纎纏纐罍羻羼耰臝艪藔蘕蘖蘗蘘蘙蘚蘜蘝蘞蘟蘠蘡蘣蘥蘦蘧蘨蘩"
+    "蘪蘫蘭蘮蘯蠚蠛蠜蠝蠟蠠蠡蠢蠣蠤蠩蠫衊襩襪襫襬襭襮覼覽觺譅譳譴譵譶"
+    "護譸譹譺譻譼譽贐贑贒贓贔赣趯趰躊躋躌躍躎躏軇轛轜轝轞轟辯邎酄酅酆"
+    "醹醺醻鏴鐩鐪鐫鐬鐭鐮鐰鐱鐲鐳鐴鐵鐶鐷鐸鐹鐺鐻鐽鐾鐿鑀鑁闢闣闤闥闦"
+    "雤露霵霶霷霸霹霺霻靧鞼鞽鞾鞿韡韢顤顥顦顧顨颦飅飆飇飈飉飊飜饏饖饗"
+    "饘馩騹騺騻騼騽騾騿驀驁驂驃驄驅驆驇髍髎髏鬔鬕鬖鬗鬘鬹鬺魑魒魓魔鰜"
+    "鰝鰞鰟鰡鰢鰣鰤鰥鰦鰧鰨鰩鰪鰫鰬鰭鰮鰯鰰鳠鳡鳢鳣鶬鶭鶮鶯鶰鶱鶲鶳鶴"
+    "鶵鶶鶷鶸鶹鶺鶻鶼鶽鶾鷀鷁鷂鷃鷄鷅鷆鷇鷈鷉鷊鷌鷍鷎鷏鹺鹻麜麝黫黬黭"
+    "黮黯鼅鼘鼙鼚鼛鼱齎齜齤齥齦齧齨齩龒龝龡亹儻儼囅囆囇囈囉囊囋囎圝奱"
+    "孊孋孌孿巎巑巒巓巔巕巗廲彎彲懿戂戵攞攟攠攡攢攤攦攧櫷欆欇欈欉權欋"
+    "欍欎歡氍灑灒灔灕灖灗灘爜爞爟爠犩獿玀瓕瓗瓘瓙瓤疊癬癭癮皭礵禳禴穰"
+    "穱竊竸籗籘籙籚籛籜籝籟籠籡糱糴纑纒罎罏羇耱耲聽聾臞臟艫蘬蘲蘳蘴蘵"
+    "蘶蘷蠥蠦蠧蠨蠪蠬襯襰襱襲覾覿觻觼譾譿讀讁讂讃讄讅讆豄贕贖贗贘躐躑"
+    "躒躓躔躕躖躗躚轠轡轢酇酈鑂鑃鑄鑅鑆鑇鑈鑉鑊鑋鑌鑍鑎鑏鑐鑑鑒鑓鑔鑧"
+    "镵镶镾闧霼霽霾霿靀韀韁韂韃韣顩顪顫飋饔饕饚饛驈驉驊驋驌驍驎驏驐驑"
+    "驒驓驔驕髐髒髝鬝鬙鬚鬛鬜鬫鬻魕魖鰱鰲鰳鰴鰵鰶鰷鰸鰹鰺鰻鰼鰽鰾鰿鱁"
+    "鱂鱃鱄鱅鱆鱇鱈鷠鱉鳤鷋鷐鷑鷒鷓鷔鷕鷖鷗鷘鷙鷚鷛鷜鷝鷞鷟鷩鷵鹳鹴麞"
+    "麶黐黰黱鼲鼳鼴鼵齂齪齫齬龓龔龕龢儽劙劚囌囏囐壧壨奲孍巖巘巚彏戀戁"
+    "戃戄攣攥攨攩攪攫斖曪曫曬欏欐欑欒毊灓灙灚灛灜爡爢玁玂玃瓚癯癰矔礶"
+    "礷禵籞籢籣籤籥籦籧籨糵纓纔纕纖臢艬蘱蘸蘹蘺蘻蘼蘽蘾蘿虀虁蠴蠭蠮蠯"
+    "蠰蠱蠲蠳襳襴襶覉觽觾讇讈讉變讋讌讍讎讏讐豅贙贚趱躘躙躛躜轣轤邏邐"
+    "醼鑕鑖鑗鑘鑙鑚鑛鑜鑝鑞鑟鑠鑡鑢鑣鑤鑥鑦靁靨韄韅頀顬顭顮顯颧饜馪驖"
+    "驗驘驙驚驛驜髑髓體髞鬞鬟鬠鱊鱋鱌鱍鱎鱏鱐鱑鱒鱓鱔鱕鱖鱗鱘鱙鱚鱛鱪"
+    "鷡鷢鷣鷤鷥鷦鷧鷨鷪鷫鷬鷭鷮鷯鷰鷱鷲鷳鷴鷶鷷鷸鷻鷼麟黂黲黳黴鼆鼇鼜"
+    "鼶鼷鼸鼹齃齄齏齭齮齯齰齱儾囑囒囓壩孎孏屭巙攬攭曭曮欓欔欕灝灞灟灠"
+    "灡爣瓛瓥癱癲矕矗矖礸禶禷穳穲籪纗罐羈羉艭艷虃虅蠵蠶蠷蠸蠹蠺衋衢襵"
+    "襷讑讒讓讔讕讖贛躝躞躟躠軈醽醾醿釀釂鑨鑩鑪鑫鑬雥雦靂靃靄靅靆靇靈"
+    "韆韇韈韤韥顰饝驝驞驟髕鬡鬢鬬鬭魗魘魙鱜鱝鱞鱟鱠鱡鱢鱣鱤鱥鱦鱧鱩鱫"
+    "鱰鷺鷹鷽鷾鷿鸀鸁鸂鸃鸄鸅鸆鸇鸈鸉鸊鹼鹽麠鼞齅齆齲齳齴齵齶齷囔囕壪"
+    "廳戅戆攮斸曯欖欗欘欙欚欛欝灢灣爤爥爦犪矘矙矡礹籩籫籬籭籮糶纘纙纚"
+    "纛臠臡虂虆虇虈虉蠻襸襹襺襻襼覊觀觿讗讘讙豒貛贜躡躢躣躤躥釁鑭鑮鑯"
+    "鑰鑱鑲鑳靉顱顲饞饟馕髖鬣鱨鱬鱭鱮鱯鸋鸌鸍鸎鸏鸐鸑鸒麡黌黵鼈鼉鼝鼟"
+    "齇齸齹齺齻龣圞彠欜氎灎灤灦癳矚籯籰糳虄虪蠼讚讛趲躦躧釃釄鑴鑵鑶鑷"
+    "鑸鑹鑺靊韉驠驡驢驣驥髗鱱鱲鱳鱴鱵鱶鸓鸔黶鼊龤龥灥灧灨犫糷纜纝虊蠽"
+    "蠾蠿襽讜讝讞豓貜躩躪軉轥釅鑻鑼鑽鑾靋靌靍靎顳顴飌飍飝饠饡馫驤驦驧"
+    "鬤鬮鬰鱷鱸鸕鸖鸗黷齈囖戇欞欟爧癴虌豔躨鑿钀钁钂雧驨驩鸘鸙鸚麢黸鼺"
+    "齼齽龞爨纞虋讟钃钄靏驪鬱鱹鸛鸜麷厵癵籱韊饢驫鱺鸝鸞灩麣灪籲龖爩鱻"
+    "麤龗齾齉靐龘";
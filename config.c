@@ -0,0 +1,42 @@
+#include "config.h"
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+// 去掉首尾空白，返回新的起始位置
+static char *trim(char *text) {
+    while (isspace((unsigned char)*text)) {
+        text++;
+    }
+    size_t len = strlen(text);
+    while (len > 0 && isspace((unsigned char)text[len - 1])) {
+        text[--len] = '\0';
+    }
+    return text;
+}
+
+// 从配置文件读取一项设置（每行 key = value，#开头为注释），找到返回1
+int config_get(const char *key, char *value, size_t size) {
+    FILE *file = fopen(CONFIG_FILENAME, "r");
+    if (file == NULL) {
+        return 0;
+    }
+
+    char line[512];
+    int found = 0;
+    while (!found && fgets(line, sizeof(line), file) != NULL) {
+        char *text = trim(line);
+        char *eq = strchr(text, '=');
+        if (*text == '#' || eq == NULL) {
+            continue;
+        }
+        *eq = '\0';
+        if (strcmp(trim(text), key) == 0) {
+            snprintf(value, size, "%s", trim(eq + 1));
+            found = 1;
+        }
+    }
+
+    fclose(file);
+    return found;
+}
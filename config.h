@@ -0,0 +1,11 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include <stddef.h>
+
+#define CONFIG_FILENAME "students.conf"
+
+// 函数声明
+int config_get(const char *key, char *value, size_t size);
+
+#endif
@@ -0,0 +1,410 @@
+#define _POSIX_C_SOURCE 200809L
+#include "student.h"
+#include "blockfile.h"
+#include "config.h"
+#include "changefeed.h"
+#include "filesync.h"
+#include "fileio.h"
+#include <unistd.h>
+
+#define FILE_MAGIC "STDB"
+#define FILE_VERSION 3           // 3: 文件头后附科目设置；2: 固定三科
+#define FILE_VERSION_BLOCKS 4    // 4: 科目设置后为压缩块，文件头后附块索引位置
+#define LEGACY_ID_LEN 20
+#define LEGACY_NAME_LEN 50
+
+// 数据文件头
+typedef struct {
+    char magic[4];              // "STDB"
+    uint16_t version;           // 格式版本
+    uint16_t header_size;       // 文件头长度
+    uint32_t count;             // 学生数量
+    uint32_t generation;        // 代数：每次保存加1，用于发现其他进程的保存（旧版本写入0）
+} FileHeader;
+
+// 旧版数据文件中的学生记录（学生数量之后直接存放结构体）
+typedef struct {
+    char id[LEGACY_ID_LEN];
+    char name[LEGACY_NAME_LEN];
+    int age;
+    float math_score;
+    float english_score;
+    float chinese_score;
+    float average_score;
+} LegacyStudent;
+
+// 写入带长度前缀的字符串
+static void write_string(FILE *file, const char *text) {
+    uint16_t len = (uint16_t)strlen(text);
+    fwrite(&len, sizeof(len), 1, file);
+    fwrite(text, 1, len, file);
+}
+
+// 写入科目设置：科目数，随后每科为 名称、别名、权重
+static void write_schema(FILE *file, const Schema *schema) {
+    uint8_t count = (uint8_t)schema->count;
+    fwrite(&count, sizeof(count), 1, file);
+    for (int k = 0; k < schema->count; k++) {
+        write_string(file, schema->subjects[k].name);
+        write_string(file, schema->subjects[k].alias);
+        fwrite(&schema->subjects[k].weight, sizeof(uint16_t), 1, file);
+    }
+}
+
+// 读取带长度前缀的字符串，长度须小于limit
+static int read_string(FILE *file, char *buffer, size_t limit) {
+    uint16_t len;
+    if (fread(&len, sizeof(len), 1, file) != 1 || len >= limit) {
+        return 0;
+    }
+    if (fread(buffer, 1, len, file) != len) {
+        return 0;
+    }
+    buffer[len] = '\0';
+    return 1;
+}
+
+// 读取科目设置，成功返回1
+static int read_schema(FILE *file, Schema *schema) {
+    uint8_t count;
+    memset(schema, 0, sizeof(*schema));
+    if (fread(&count, sizeof(count), 1, file) != 1 || count == 0 || count > MAX_SUBJECTS) {
+        return 0;
+    }
+    for (int k = 0; k < count; k++) {
+        char name[SUBJECT_NAME_LEN], alias[SUBJECT_NAME_LEN];
+        uint16_t weight;
+        if (!read_string(file, name, sizeof(name)) || !read_string(file, alias, sizeof(alias))
+            || fread(&weight, sizeof(weight), 1, file) != 1 || !schema_add(schema, name, alias, weight)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// 配置文件中 compress = yes 时保存为压缩格式
+int compression_enabled(void) {
+    char value[16];
+    return config_get("compress", value, sizeof(value)) && (strcmp(value, "yes") == 0 || strcmp(value, "1") == 0);
+}
+
+// 按配置的格式写入数据文件
+int write_data_file(const Snapshot *snapshot, const char *filename) {
+    return write_data_file_as(snapshot, filename, compression_enabled());
+}
+
+// 写入一条普通格式的记录：学号、姓名、年龄、各科定点成绩
+static void write_record(FILE *file, const char *id, const char *name, uint8_t age,
+                         const uint16_t *scores, int subjects) {
+    write_string(file, id);
+    write_string(file, name);
+    fwrite(&age, sizeof(age), 1, file);
+    fwrite(scores, sizeof(uint16_t), subjects, file);
+}
+
+// 替换filename时写入的代数：原文件的代数加1，原文件不存在或无法读取时为1
+static uint32_t next_generation(const char *filename) {
+    uint32_t generation = 0;
+    data_file_generation(filename, &generation);
+    return generation + 1;
+}
+
+// 关闭临时文件（随之同步到磁盘），再改名替换目标文件；失败时删除临时文件
+static int commit_file(FILE *file, const char *temp, const char *filename) {
+    int failed = fflush(file) != 0 || ferror(file);
+    if (fclose(file) != 0 || failed || rename(temp, filename) != 0) {
+        remove(temp);
+        return FILE_WRITE_ERROR;
+    }
+    return FILE_OK;
+}
+
+// 把快照写入数据文件（不输出提示信息），compressed为1时写为压缩块格式。
+// 快照不随之后的修改变化，写入期间可以继续修改数据。
+// 先写入临时文件并同步到磁盘，再改名替换原文件，中途出错或崩溃时原文件保持完整
+int write_data_file_as(const Snapshot *snapshot, const char *filename, int compressed) {
+    char temp[512];
+    snprintf(temp, sizeof(temp), "%s.tmp", filename);
+    uint32_t generation = next_generation(filename);
+    FILE *file = fileio_open(temp, "w");
+    if (file == NULL) {
+        return FILE_WRITE_ERROR;
+    }
+
+    FileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FILE_MAGIC, 4);
+    header.version = compressed ? FILE_VERSION_BLOCKS : FILE_VERSION;
+    header.header_size = sizeof(header) + (compressed ? sizeof(uint64_t) : 0);
+    header.count = (uint32_t)snapshot->count;
+    header.generation = generation;
+    fwrite(&header, sizeof(header), 1, file);
+
+    if (compressed) {
+        // 块索引写在最后，写完后回填其位置
+        uint64_t index_offset = 0;
+        fwrite(&index_offset, sizeof(index_offset), 1, file);
+        write_schema(file, &snapshot->schema);
+        if (!write_blocks(snapshot, file, &index_offset) || fseeko(file, sizeof(header), SEEK_SET) != 0) {
+            fclose(file);
+            remove(temp);
+            return FILE_WRITE_ERROR;
+        }
+        fwrite(&index_offset, sizeof(index_offset), 1, file);
+    } else {
+        write_schema(file, &snapshot->schema);
+    }
+
+    for (int i = 0; !compressed && i < snapshot->count; i++) {
+        uint16_t scores[MAX_SUBJECTS];
+        for (int k = 0; k < snapshot->schema.count; k++) {
+            scores[k] = score_at(snapshot, k, i);
+        }
+        write_record(file, student_id_at(snapshot, i), student_name_at(snapshot, i), hot_at(snapshot, i)->age,
+                     scores, snapshot->schema.count);
+    }
+    return commit_file(file, temp, filename);
+}
+
+// 开始以逐条追加的方式写普通格式的数据文件，记录数须事先确定；写入临时文件，commit_data_file时替换原文件
+int create_data_file(DataFile *data, const char *filename, const Schema *schema, uint32_t count) {
+    memset(data, 0, sizeof(*data));
+    snprintf(data->temp, sizeof(data->temp), "%s.tmp", filename);
+    uint32_t generation = next_generation(filename);
+    data->file = fileio_open(data->temp, "w");
+    if (data->file == NULL) {
+        return FILE_WRITE_ERROR;
+    }
+    data->version = FILE_VERSION;
+    data->count = count;
+    data->schema = *schema;
+
+    FileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FILE_MAGIC, 4);
+    header.version = FILE_VERSION;
+    header.header_size = sizeof(header);
+    header.count = count;
+    header.generation = generation;
+    fwrite(&header, sizeof(header), 1, data->file);
+    write_schema(data->file, schema);
+    return FILE_OK;
+}
+
+// 追加一条记录，成绩为定点数，对应数据文件科目设置的各列
+void write_data_record(DataFile *data, const char *id, const char *name, uint8_t age, const uint16_t *scores) {
+    write_record(data->file, id, name, age, scores, data->schema.count);
+}
+
+// 完成写入：同步到磁盘后替换原文件；失败时删除临时文件
+int commit_data_file(DataFile *data, const char *filename) {
+    int status = commit_file(data->file, data->temp, filename);
+    data->file = NULL;
+    return status;
+}
+
+// 放弃写入，删除临时文件
+void abort_data_file(DataFile *data) {
+    if (data->file != NULL) {
+        fclose(data->file);
+        data->file = NULL;
+        remove(data->temp);
+    }
+}
+
+// 打开数据文件并读出文件头和科目设置，支持旧版格式；成功返回FILE_OK
+int open_data_file(DataFile *data, const char *filename) {
+    memset(data, 0, sizeof(*data));
+    data->file = fileio_open(filename, "r");
+    if (data->file == NULL) {
+        return FILE_NOT_FOUND;
+    }
+
+    FileHeader header;
+    int ok;
+    if (fread(&header, sizeof(header), 1, data->file) == 1 && memcmp(header.magic, FILE_MAGIC, 4) == 0) {
+        data->version = header.version;
+        data->compressed = header.version == FILE_VERSION_BLOCKS;
+        data->count = header.count;
+        data->generation = header.generation;
+        ok = header.version >= 2 && header.version <= FILE_VERSION_BLOCKS && header.header_size >= sizeof(header)
+             && header.count <= INT32_MAX
+             && (!data->compressed || fread(&data->index_offset, sizeof(data->index_offset), 1, data->file) == 1)
+             && fseek(data->file, header.header_size, SEEK_SET) == 0;
+        if (ok && header.version == 2) {
+            schema_init_default(&data->schema);
+        } else if (ok) {
+            ok = read_schema(data->file, &data->schema);
+        }
+    } else {
+        // 旧版格式：学生数量之后直接是结构体数组，固定为数学、英语、语文三科
+        int count;
+        rewind(data->file);
+        ok = fread(&count, sizeof(int), 1, data->file) == 1 && count >= 0;
+        data->count = ok ? (uint32_t)count : 0;
+        schema_init_default(&data->schema);
+    }
+
+    if (!ok) {
+        close_data_file(data);
+        return FILE_READ_ERROR;
+    }
+    return FILE_OK;
+}
+
+// 顺序读取下一条记录（不适用于压缩格式），成绩为定点数，对应文件科目设置的各列；成功返回1
+int read_data_record(DataFile *data, char *id, char *name, uint8_t *age, uint16_t *scores) {
+    if (data->version == 0) {
+        LegacyStudent legacy;
+        if (fread(&legacy, sizeof(legacy), 1, data->file) != 1) {
+            return 0;
+        }
+        legacy.id[LEGACY_ID_LEN - 1] = '\0';
+        legacy.name[LEGACY_NAME_LEN - 1] = '\0';
+        snprintf(id, MAX_ID_LEN, "%s", legacy.id);
+        snprintf(name, STRHEAP_SEGMENT_SIZE, "%s", legacy.name);
+        *age = (uint8_t)legacy.age;
+        scores[0] = score_to_fixed(legacy.math_score);
+        scores[1] = score_to_fixed(legacy.english_score);
+        scores[2] = score_to_fixed(legacy.chinese_score);
+        return 1;
+    }
+
+    int subjects = data->schema.count;
+    if (!read_string(data->file, id, MAX_ID_LEN) || !read_string(data->file, name, STRHEAP_SEGMENT_SIZE)
+        || fread(age, sizeof(*age), 1, data->file) != 1
+        || fread(scores, sizeof(uint16_t), subjects, data->file) != (size_t)subjects) {
+        return 0;
+    }
+    for (int k = 0; k < subjects; k++) {
+        if (scores[k] > 100 * SCORE_SCALE) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// 关闭数据文件
+void close_data_file(DataFile *data) {
+    if (data->file != NULL) {
+        fclose(data->file);
+        data->file = NULL;
+    }
+}
+
+// 顺序读取全部记录并追加到系统中
+static int read_records(StudentSystem *system, DataFile *data) {
+    char id[MAX_ID_LEN];
+    char name[STRHEAP_SEGMENT_SIZE];
+    uint16_t scores[MAX_SUBJECTS];
+    uint8_t age;
+
+    for (uint32_t i = 0; i < data->count; i++) {
+        if (!read_data_record(data, id, name, &age, scores)) {
+            return FILE_READ_ERROR;
+        }
+        Student s = {id, name, age, {0}, 0};
+        for (int k = 0; k < data->schema.count; k++) {
+            s.scores[k] = fixed_to_score(scores[k]);
+        }
+        if (!append_student(system, &s)) {
+            return FILE_TOO_LARGE;
+        }
+    }
+    return FILE_OK;
+}
+
+// 读取数据文件（不输出提示信息），支持旧版格式
+int read_data_file(StudentSystem *system, const char *filename) {
+    DataFile data;
+    int status = open_data_file(&data, filename);
+    if (status == FILE_NOT_FOUND) {
+        remember_data_file(system, NULL, 0);
+    }
+    if (status != FILE_OK) {
+        return status;
+    }
+
+    // 以文件中的科目为准，追加配置文件中新增的科目。
+    // 逐条追加不记入变更流，之后的第一条变更之前记下加载
+    Schema merged = data.schema;
+    schema_merge_config(&merged);
+    struct ChangeFeed *changes = system->changes;
+    system->changes = NULL;
+    clear_students(system);
+    if (!apply_schema(system, &merged) || !reserve_students(system, (int)data.count)) {
+        status = FILE_TOO_LARGE;
+    } else if (data.compressed) {
+        status = read_blocks(system, data.file, data.index_offset, data.count, data.schema.count);
+    } else {
+        status = read_records(system, &data);
+    }
+    close_data_file(&data);
+    system->changes = changes;
+    changes_loaded(system);
+
+    if (status != FILE_OK) {
+        clear_students(system);
+    } else {
+        mark_saved(system);
+        // 追加了配置文件中的新科目时，需要保存才能写回文件
+        if (system->schema.count != data.schema.count) {
+            system->layout_changed = 1;
+        }
+        // 记下文件的内容和代数，保存时据此发现并合并其他进程的保存
+        Snapshot loaded;
+        take_snapshot(system, &loaded);
+        remember_data_file(system, &loaded, data.generation);
+    }
+    return status;
+}
+
+// 只读出数据文件的代数；文件不存在时为0并返回FILE_NOT_FOUND
+int data_file_generation(const char *filename, uint32_t *generation) {
+    DataFile data;
+    int status = open_data_file(&data, filename);
+    *generation = status == FILE_OK ? data.generation : 0;
+    close_data_file(&data);
+    return status;
+}
+
+// 在数据文件中按学号查找一名学生，不加载整个文件：压缩格式只解码可能包含该学号的块，其他格式顺序扫描。
+// 找到时填写schema和out（姓名复制到name中）并返回FILE_OK，未找到返回FILE_NOT_FOUND
+int lookup_data_file(const char *filename, const char *id, Schema *schema, Student *out,
+                     char *name, size_t name_size) {
+    DataFile data;
+    int status = open_data_file(&data, filename);
+    if (status != FILE_OK) {
+        return FILE_READ_ERROR;
+    }
+    *schema = data.schema;
+
+    status = FILE_NOT_FOUND;
+    if (data.compressed) {
+        status = lookup_blocks(data.file, data.index_offset, schema->count, id, out, name, name_size);
+    } else {
+        char record_id[MAX_ID_LEN];
+        char record_name[STRHEAP_SEGMENT_SIZE];
+        uint16_t scores[MAX_SUBJECTS];
+        uint8_t age;
+        for (uint32_t i = 0; status == FILE_NOT_FOUND && i < data.count; i++) {
+            if (!read_data_record(&data, record_id, record_name, &age, scores)) {
+                status = FILE_READ_ERROR;
+            } else if (strcmp(record_id, id) == 0) {
+                snprintf(name, name_size, "%s", record_name);
+                out->id = id;
+                out->name = name;
+                out->age = age;
+                for (int k = 0; k < schema->count; k++) {
+                    out->scores[k] = fixed_to_score(scores[k]);
+                }
+                status = FILE_OK;
+            }
+        }
+    }
+    close_data_file(&data);
+    if (status == FILE_OK) {
+        calculate_average(schema, out);
+    }
+    return status;
+}
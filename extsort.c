@@ -0,0 +1,453 @@
+#define _POSIX_C_SOURCE 200809L
+#include "extsort.h"
+#include "config.h"
+#include "collate.h"
+#include <unistd.h>
+
+// 外部排序：数据超出内存时分两步完成
+//   1. 生成顺串：流式读入学生，内存中的学生达到限额时排好序写入临时文件（一个顺串）；
+//   2. 归并：用败者树每趟归并至多EXTSORT_MAX_FANIN个顺串，顺串多时分多趟，最后一趟直接输出。
+// 顺串按输入顺序编号，键相同时编号小的先输出，因此排序是稳定的。
+// 顺串文件中的记录：学号长度（1字节）、学号、姓名长度（2字节）、姓名、年龄、各科定点成绩、平均分。
+// 姓名须短于MAX_NAME_LEN字节（与输入时的限制相同），更长的姓名使排序失败，不截断
+
+// 一个顺串文件：创建后立即删除目录项，只通过描述符访问，关闭后由系统回收
+typedef struct {
+    int fd;
+    FILE *file;                     // 正在写入或读取时打开
+    char *buffer;                   // 打开期间的读写缓冲区
+} Run;
+
+// 顺串的读取状态
+typedef struct {
+    Run *run;
+    SortRecord record;              // 当前记录
+    char *name;                     // 当前记录的姓名（按姓名排序时其后紧接姓名的排序键）
+    size_t name_capacity;
+    int has;                        // 是否还有记录
+} RunReader;
+
+// 一趟归并：tree[0]为胜者，tree[1..count-1]为各内部结点上的败者
+typedef struct {
+    const SortSpec *spec;
+    RunReader *readers;
+    int *tree;
+    int count;
+} Merge;
+
+// 把记录写到顺串文件的输出
+typedef struct {
+    Run *run;
+    int subjects;
+} RunSink;
+
+// 以大缓冲区打开顺串文件
+static int attach_run(Run *run, const char *mode) {
+    int fd = dup(run->fd);
+    run->buffer = malloc(EXTSORT_BUFFER);
+    run->file = fd != -1 && run->buffer != NULL ? fdopen(fd, mode) : NULL;
+    if (run->file == NULL) {
+        if (fd != -1) {
+            close(fd);
+        }
+        free(run->buffer);
+        run->buffer = NULL;
+        return 0;
+    }
+    setvbuf(run->file, run->buffer, _IOFBF, EXTSORT_BUFFER);
+    return 1;
+}
+
+// 关闭打开的顺串文件，释放缓冲区（文件本身保留）
+static int detach_run(Run *run) {
+    int ok = 1;
+    if (run->file != NULL) {
+        ok = fflush(run->file) == 0 && !ferror(run->file);
+        ok = fclose(run->file) == 0 && ok;
+    }
+    free(run->buffer);
+    run->file = NULL;
+    run->buffer = NULL;
+    return ok;
+}
+
+// 在临时目录中创建一个空的顺串文件并打开以写入
+static int open_run(Run *run) {
+    char path[512];
+    const char *dir = getenv("TMPDIR");
+    snprintf(path, sizeof(path), "%s/students-sort-XXXXXX", dir != NULL && *dir ? dir : "/tmp");
+    memset(run, 0, sizeof(*run));
+    run->fd = mkstemp(path);
+    if (run->fd == -1) {
+        return 0;
+    }
+    unlink(path);
+    return attach_run(run, "wb");
+}
+
+// 写完顺串，回到开头准备读取（读取时再分配缓冲区，空闲的顺串不占内存）
+static int finish_run(Run *run) {
+    return detach_run(run) && lseek(run->fd, 0, SEEK_SET) == 0;
+}
+
+// 关闭并回收顺串文件
+static void close_run(Run *run) {
+    detach_run(run);
+    if (run->fd >= 0) {
+        close(run->fd);
+    }
+    run->fd = -1;
+}
+
+// 向顺串写入一条记录，姓名过长时返回0
+static int write_run_record(Run *run, const SortRecord *record, int subjects) {
+    size_t name_size = strlen(record->name);
+    if (name_size >= MAX_NAME_LEN) {
+        return 0;
+    }
+    uint8_t id_len = (uint8_t)strlen(record->id);
+    uint16_t name_len = (uint16_t)name_size;
+    fwrite(&id_len, sizeof(id_len), 1, run->file);
+    fwrite(record->id, 1, id_len, run->file);
+    fwrite(&name_len, sizeof(name_len), 1, run->file);
+    fwrite(record->name, 1, name_len, run->file);
+    fwrite(&record->age, sizeof(record->age), 1, run->file);
+    fwrite(record->scores, sizeof(uint16_t), subjects, run->file);
+    fwrite(&record->average, sizeof(record->average), 1, run->file);
+    return !ferror(run->file);
+}
+
+// 读取顺串的下一条记录，keys为1时计算姓名的排序键：成功返回1，读完返回0，出错返回-1
+static int read_run_record(RunReader *reader, int subjects, int keys) {
+    FILE *file = reader->run->file;
+    SortRecord *record = &reader->record;
+    uint8_t id_len;
+    uint16_t name_len;
+    if (fread(&id_len, sizeof(id_len), 1, file) != 1) {
+        return feof(file) ? 0 : -1;
+    }
+    if (id_len >= MAX_ID_LEN || fread(record->id, 1, id_len, file) != id_len
+        || fread(&name_len, sizeof(name_len), 1, file) != 1 || name_len >= MAX_NAME_LEN) {
+        return -1;
+    }
+    record->id[id_len] = '\0';
+    size_t needed = name_len + 1u + (keys ? COLLATE_KEY_LEN(name_len) : 0);
+    if (needed > reader->name_capacity) {
+        char *name = realloc(reader->name, needed);
+        if (name == NULL) {
+            return -1;
+        }
+        reader->name = name;
+        reader->name_capacity = needed;
+    }
+    if (fread(reader->name, 1, name_len, file) != name_len
+        || fread(&record->age, sizeof(record->age), 1, file) != 1
+        || fread(record->scores, sizeof(uint16_t), subjects, file) != (size_t)subjects
+        || fread(&record->average, sizeof(record->average), 1, file) != 1) {
+        return -1;
+    }
+    reader->name[name_len] = '\0';
+    record->name = reader->name;
+    record->name_key = NULL;
+    if (keys) {
+        char *key = reader->name + name_len + 1;
+        collate_key(record->name, key, COLLATE_KEY_LEN(name_len));
+        record->name_key = key;
+    }
+    return 1;
+}
+
+static int run_sink_write(void *context, const SortRecord *record) {
+    RunSink *sink = context;
+    return write_run_record(sink->run, record, sink->subjects);
+}
+
+// 稳定的归并排序（按记录指针排序）
+static void merge_sort(const SortSpec *spec, SortRecord **items, SortRecord **temp, size_t count) {
+    if (count < 2) {
+        return;
+    }
+    size_t half = count / 2;
+    merge_sort(spec, items, temp, half);
+    merge_sort(spec, items + half, temp, count - half);
+    if (sort_compare(spec, items[half - 1], items[half]) <= 0) {
+        return;
+    }
+    memcpy(temp, items, half * sizeof(SortRecord *));
+    size_t i = 0, j = half, k = 0;
+    while (i < half && j < count) {
+        items[k++] = sort_compare(spec, items[j], temp[i]) < 0 ? items[j++] : temp[i++];
+    }
+    while (i < half) {
+        items[k++] = temp[i++];
+    }
+}
+
+// 顺串a的当前记录是否应先于顺串b输出；count为虚拟的最小结点，读完的顺串排在最后
+static int run_before(const Merge *m, int a, int b) {
+    if (a == m->count || b == m->count) {
+        return a == m->count;
+    }
+    if (!m->readers[a].has || !m->readers[b].has) {
+        return m->readers[a].has;
+    }
+    int r = sort_compare(m->spec, &m->readers[a].record, &m->readers[b].record);
+    return r < 0 || (r == 0 && a < b);
+}
+
+// 顺串s的记录变化后，自下而上与各结点上的败者比较，胜者继续向上
+static void adjust(Merge *m, int s) {
+    for (int t = (s + m->count) / 2; t > 0; t /= 2) {
+        if (run_before(m, m->tree[t], s)) {
+            int winner = m->tree[t];
+            m->tree[t] = s;
+            s = winner;
+        }
+    }
+    m->tree[0] = s;
+}
+
+// 归并count个顺串，按顺序逐条交给write
+static int merge_runs(Run *runs, int count, int subjects, const SortSpec *spec,
+                      int (*write)(void *, const SortRecord *), void *context) {
+    Merge m = {spec, calloc(count, sizeof(RunReader)), malloc((count + 1) * sizeof(int)), count};
+    int status = m.readers != NULL && m.tree != NULL ? FILE_OK : FILE_TOO_LARGE;
+
+    for (int i = 0; status == FILE_OK && i < count; i++) {
+        m.readers[i].run = &runs[i];
+        if (!attach_run(&runs[i], "rb")) {
+            status = FILE_READ_ERROR;
+            break;
+        }
+        int r = read_run_record(&m.readers[i], subjects, sort_uses_name(spec));
+        m.readers[i].has = r == 1;
+        status = r < 0 ? FILE_READ_ERROR : FILE_OK;
+    }
+    if (status == FILE_OK) {
+        for (int t = 0; t < count; t++) {
+            m.tree[t] = count;
+        }
+        for (int s = count - 1; s >= 0; s--) {
+            adjust(&m, s);
+        }
+    }
+
+    while (status == FILE_OK && m.readers[m.tree[0]].has) {
+        RunReader *winner = &m.readers[m.tree[0]];
+        if (!write(context, &winner->record)) {
+            status = FILE_WRITE_ERROR;
+            break;
+        }
+        int r = read_run_record(winner, subjects, sort_uses_name(spec));
+        winner->has = r == 1;
+        if (r < 0) {
+            status = FILE_READ_ERROR;
+        }
+        adjust(&m, m.tree[0]);
+    }
+
+    for (int i = 0; m.readers != NULL && i < count; i++) {
+        free(m.readers[i].name);
+        detach_run(&runs[i]);
+    }
+    free(m.readers);
+    free(m.tree);
+    return status;
+}
+
+// 把内存中的学生排好序写成一个顺串
+static int spill_run(const SortSpec *spec, SortRecord **order, SortRecord **temp, size_t count, int subjects,
+                     Run **runs, int *run_count, int *run_capacity) {
+    if (*run_count == *run_capacity) {
+        int capacity = *run_capacity > 0 ? *run_capacity * 2 : 16;
+        Run *grown = realloc(*runs, capacity * sizeof(Run));
+        if (grown == NULL) {
+            return FILE_TOO_LARGE;
+        }
+        *runs = grown;
+        *run_capacity = capacity;
+    }
+    Run *run = &(*runs)[*run_count];
+    if (!open_run(run)) {
+        return FILE_WRITE_ERROR;
+    }
+    (*run_count)++;
+
+    merge_sort(spec, order, temp, count);
+    for (size_t i = 0; i < count; i++) {
+        if (!write_run_record(run, order[i], subjects)) {
+            return FILE_WRITE_ERROR;
+        }
+    }
+    return finish_run(run) ? FILE_OK : FILE_WRITE_ERROR;
+}
+
+// 把姓名的排序键存入字符串堆，scratch为按需扩大的缓冲区；失败返回 STRHEAP_NONE
+static uint32_t add_name_key(StringHeap *names, const char *name, char **scratch, size_t *capacity) {
+    size_t size = COLLATE_KEY_LEN(strlen(name));
+    if (size > *capacity) {
+        char *buffer = realloc(*scratch, size);
+        if (buffer == NULL) {
+            return STRHEAP_NONE;
+        }
+        *scratch = buffer;
+        *capacity = size;
+    }
+    collate_key(name, *scratch, size);
+    return strheap_add(names, *scratch);
+}
+
+// 对流中的全部学生按spec排序，结果按顺序交给sink；内存中的学生不超过memory字节
+int external_sort(StudentStream *stream, const SortSpec *spec, size_t memory, const SortSink *sink,
+                  SortReport *report) {
+    int subjects = stream->schema.count;
+    memset(report, 0, sizeof(*report));
+    if (!sink->begin(sink->context, &stream->schema, stream->data.count)) {
+        return FILE_WRITE_ERROR;
+    }
+
+    // 每名学生占一条记录、两个指针（排序用）和姓名；按平均16字节的姓名估算一个顺串的学生数
+    size_t per_row = sizeof(SortRecord) + 2 * sizeof(SortRecord *) + 16;
+    size_t limit = memory / per_row > 0 ? memory / per_row : 1;
+    size_t capacity = stream->data.count < limit ? (stream->data.count > 0 ? stream->data.count : 1) : limit;
+    SortRecord *records = malloc(capacity * sizeof(SortRecord));
+    SortRecord **order = malloc(capacity * sizeof(SortRecord *));
+    SortRecord **temp = malloc(capacity * sizeof(SortRecord *));
+    StringHeap names;
+    int names_ok = strheap_init(&names);
+    int status = records != NULL && order != NULL && temp != NULL && names_ok ? FILE_OK : FILE_TOO_LARGE;
+
+    int keys = sort_uses_name(spec);
+    char *scratch = NULL;
+    size_t scratch_size = 0;
+
+    Run *runs = NULL;
+    int run_count = 0, run_capacity = 0;
+    size_t count = 0;
+    const StreamChunk *chunk;
+    while (status == FILE_OK && (chunk = stream_next_chunk(stream)) != NULL) {
+        const DecodedBlock *rows = &chunk->rows;
+        for (uint32_t i = 0; status == FILE_OK && i < rows->rows; i++) {
+            if (count == capacity || names.bytes > memory / 4) {
+                for (size_t j = 0; j < count; j++) {
+                    order[j] = &records[j];
+                }
+                status = spill_run(spec, order, temp, count, subjects, &runs, &run_count, &run_capacity);
+                strheap_free(&names);
+                if (status == FILE_OK && !strheap_init(&names)) {
+                    status = FILE_TOO_LARGE;
+                }
+                count = 0;
+                if (status != FILE_OK) {
+                    break;
+                }
+            }
+
+            // 在读入时检查姓名长度，无论是否需要写顺串，结果都一样
+            if (strlen(rows->names[i]) >= MAX_NAME_LEN) {
+                snprintf(report->error, sizeof(report->error), "学号 %s 的姓名超过 %d 字节", rows->ids[i],
+                         MAX_NAME_LEN - 1);
+                status = FILE_TOO_LARGE;
+                break;
+            }
+            SortRecord *record = &records[count];
+            uint32_t name = strheap_add(&names, rows->names[i]);
+            uint32_t key = keys && name != STRHEAP_NONE ? add_name_key(&names, rows->names[i], &scratch, &scratch_size)
+                                                        : name;
+            if (name == STRHEAP_NONE || key == STRHEAP_NONE) {
+                status = FILE_TOO_LARGE;
+                break;
+            }
+            memcpy(record->id, rows->ids[i], MAX_ID_LEN);
+            record->name = strheap_get(&names, name);
+            record->name_key = keys ? strheap_get(&names, key) : NULL;
+            record->age = rows->ages[i];
+            record->average = chunk->averages[i];
+            for (int k = 0; k < subjects; k++) {
+                record->scores[k] = rows->scores[(size_t)k * rows->rows + i];
+            }
+            count++;
+            report->count++;
+        }
+    }
+    if (status == FILE_OK) {
+        status = stream->status;
+    }
+
+    for (size_t j = 0; j < count; j++) {
+        order[j] = &records[j];
+    }
+    if (status == FILE_OK && run_count == 0) {
+        // 全部学生都在内存中，排序后直接输出
+        merge_sort(spec, order, temp, count);
+        for (size_t j = 0; status == FILE_OK && j < count; j++) {
+            if (!sink->write(sink->context, order[j])) {
+                status = FILE_WRITE_ERROR;
+            }
+        }
+    } else if (status == FILE_OK && count > 0) {
+        status = spill_run(spec, order, temp, count, subjects, &runs, &run_count, &run_capacity);
+    }
+    free(records);
+    free(order);
+    free(temp);
+    strheap_free(&names);
+    free(scratch);
+    report->runs = run_count;
+
+    // 顺串多于每趟可归并的数量时，先分组归并为较少的顺串（各组保持输入顺序，排序仍然稳定）
+    int fanin = memory / EXTSORT_BUFFER < EXTSORT_MAX_FANIN ? (int)(memory / EXTSORT_BUFFER) : EXTSORT_MAX_FANIN;
+    fanin = fanin < 2 ? 2 : fanin;
+    while (status == FILE_OK && run_count > fanin) {
+        int merged_count = (run_count + fanin - 1) / fanin;
+        Run *merged = calloc(merged_count, sizeof(Run));
+        if (merged == NULL) {
+            status = FILE_TOO_LARGE;
+            break;
+        }
+        for (int g = 0; g < merged_count; g++) {
+            merged[g].fd = -1;
+        }
+        for (int g = 0; g < merged_count; g++) {
+            int first = g * fanin;
+            int n = run_count - first < fanin ? run_count - first : fanin;
+            RunSink out = {&merged[g], subjects};
+            if (status == FILE_OK && !open_run(&merged[g])) {
+                status = FILE_WRITE_ERROR;
+            }
+            if (status == FILE_OK) {
+                status = merge_runs(&runs[first], n, subjects, spec, run_sink_write, &out);
+            }
+            if (status == FILE_OK && !finish_run(&merged[g])) {
+                status = FILE_WRITE_ERROR;
+            }
+            for (int i = first; i < first + n; i++) {
+                close_run(&runs[i]);
+            }
+        }
+        free(runs);
+        runs = merged;
+        run_count = merged_count;
+        report->passes++;
+    }
+    if (status == FILE_OK && run_count > 0) {
+        status = merge_runs(runs, run_count, subjects, spec, sink->write, sink->context);
+        report->passes++;
+    }
+
+    for (int i = 0; i < run_count; i++) {
+        close_run(&runs[i]);
+    }
+    free(runs);
+    return status;
+}
+
+// 排序可用的内存（字节），取自配置项 sort_memory（MB）
+size_t sort_memory(void) {
+    char value[32];
+    int megabytes = EXTSORT_MEMORY_MB;
+    if (config_get("sort_memory", value, sizeof(value)) && atoi(value) > 0) {
+        megabytes = atoi(value);
+    }
+    return (size_t)megabytes << 20;
+}
@@ -0,0 +1,32 @@
+#ifndef EXTSORT_H
+#define EXTSORT_H
+
+#include "student.h"
+#include "sortkey.h"
+#include "stream.h"
+
+#define EXTSORT_MEMORY_MB 64        // 默认排序内存（MB），可由配置项 sort_memory 修改
+#define EXTSORT_BUFFER (1 << 20)    // 每个顺串文件的读写缓冲区
+#define EXTSORT_MAX_FANIN 64        // 每趟最多归并的顺串数
+
+// 排序结果的去向：先以科目设置和学生数调用begin，再按顺序逐条调用write（返回0表示失败）
+typedef struct {
+    int (*begin)(void *context, const Schema *schema, uint32_t count);
+    int (*write)(void *context, const SortRecord *record);
+    void *context;
+} SortSink;
+
+// 一次外部排序的情况
+typedef struct {
+    uint32_t count;                 // 学生数
+    int runs;                       // 初始顺串数（0表示在内存中完成）
+    int passes;                     // 归并趟数
+    char error[MAX_ID_LEN + 64];    // 因数据不符合要求而失败时的原因
+} SortReport;
+
+// 函数声明
+int external_sort(StudentStream *stream, const SortSpec *spec, size_t memory, const SortSink *sink,
+                  SortReport *report);
+size_t sort_memory(void);
+
+#endif
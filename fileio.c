@@ -0,0 +1,535 @@
+#define _GNU_SOURCE                 // fopencookie
+#include "fileio.h"
+#include "config.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+
+// io_uring 的提交队列和完成队列（映射到内核共享的内存），以及注册的缓冲区
+typedef struct {
+    int fd;
+    unsigned *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    unsigned queued;                // 已放入提交队列、尚未提交给内核的请求数
+    int fixed;                      // 缓冲区已注册，使用 READ_FIXED / WRITE_FIXED
+    char *buffers[FILEIO_DEPTH];    // 每个槽位一块，按页对齐
+} Ring;
+
+static Ring ring;
+static int ring_state;              // 1 可用，-1 不可用
+static int ring_busy;               // 有文件正在使用（原子读写）
+static pthread_once_t ring_once = PTHREAD_ONCE_INIT;
+
+// 打开的文件；ring为0时用 pread/pwrite，只用到 fd、size 和 position
+typedef struct {
+    int fd;
+    int writing;
+    int ring;                       // 使用 io_uring（独占 ring）
+    int failed;                     // 写入出错，之后的写入和关闭都返回失败
+    off_t size;                     // 读：打开时的文件大小
+    off_t position;                 // pread/pwrite 的当前位置；io_uring 读时没有已提交的块时的位置
+    off_t offsets[FILEIO_DEPTH];    // 各槽位读写的文件偏移
+    int expected[FILEIO_DEPTH];     // 各槽位提交的字节数
+    int lengths[FILEIO_DEPTH];      // 读：已读到的字节数，-1为在途；写：在途的字节数，0为空闲
+    int first;                      // 读：正在消费的槽位，之后的 count 个槽位依次为文件中后面的块
+    int count;
+    int window;                     // 读：同时在途的块数，顺序读取时逐步增加到 FILEIO_DEPTH
+    off_t next;                     // 读：下一块的偏移；写：正在填充的槽位的偏移
+    size_t used;                    // 读：当前槽位已消费的字节；写：当前槽位已填入的字节
+    int slot;                       // 写：正在填充的槽位
+} FileCookie;
+
+static void ring_unmap(char *sq, size_t sq_size, char *cq, size_t cq_size, void *sqes, size_t sqes_size) {
+    if (sq != MAP_FAILED) {
+        munmap(sq, sq_size);
+    }
+    if (cq != MAP_FAILED && cq != sq) {
+        munmap(cq, cq_size);
+    }
+    if (sqes != MAP_FAILED) {
+        munmap(sqes, sqes_size);
+    }
+}
+
+// 建立 io_uring 并注册缓冲区（只进行一次）；注册失败时仍可使用，只是每次由内核临时映射缓冲区
+static void ring_init(void) {
+    char value[16];
+    ring_state = -1;
+    if (config_get("io_uring", value, sizeof(value)) && (strcmp(value, "no") == 0 || strcmp(value, "0") == 0)) {
+        return;
+    }
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = (int)syscall(__NR_io_uring_setup, FILEIO_DEPTH * 2, &params);
+    if (fd < 0) {
+        return;
+    }
+
+    size_t sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    size_t cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    size_t sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    int single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single && cq_size > sq_size) {
+        sq_size = cq_size;
+    }
+    char *sq = mmap(NULL, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, IORING_OFF_SQ_RING);
+    char *cq = single ? sq : mmap(NULL, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, IORING_OFF_CQ_RING);
+    void *sqes = mmap(NULL, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, IORING_OFF_SQES);
+    int ok = sq != MAP_FAILED && cq != MAP_FAILED && sqes != MAP_FAILED;
+    for (int i = 0; ok && i < FILEIO_DEPTH; i++) {
+        void *buffer;
+        ok = posix_memalign(&buffer, 4096, FILEIO_CHUNK) == 0;
+        ring.buffers[i] = ok ? buffer : NULL;
+    }
+    if (!ok) {
+        for (int i = 0; i < FILEIO_DEPTH; i++) {
+            free(ring.buffers[i]);
+            ring.buffers[i] = NULL;
+        }
+        ring_unmap(sq, sq_size, cq, cq_size, sqes, sqes_size);
+        close(fd);
+        return;
+    }
+
+    ring.fd = fd;
+    ring.sq_tail = (unsigned *)(sq + params.sq_off.tail);
+    ring.sq_mask = (unsigned *)(sq + params.sq_off.ring_mask);
+    ring.sq_array = (unsigned *)(sq + params.sq_off.array);
+    ring.sqes = sqes;
+    ring.cq_head = (unsigned *)(cq + params.cq_off.head);
+    ring.cq_tail = (unsigned *)(cq + params.cq_off.tail);
+    ring.cq_mask = (unsigned *)(cq + params.cq_off.ring_mask);
+    ring.cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+
+    struct iovec iov[FILEIO_DEPTH];
+    for (int i = 0; i < FILEIO_DEPTH; i++) {
+        iov[i].iov_base = ring.buffers[i];
+        iov[i].iov_len = FILEIO_CHUNK;
+    }
+    ring.fixed = syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, iov, FILEIO_DEPTH) == 0;
+    ring_state = 1;
+}
+
+// 放入一个读或写请求（槽位slot的缓冲区），之后由 ring_submit 或 ring_wait 提交
+static void ring_push(int writing, int fd, int slot, off_t offset, unsigned length) {
+    unsigned tail = *ring.sq_tail;
+    unsigned index = tail & *ring.sq_mask;
+    struct io_uring_sqe *sqe = &ring.sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    if (ring.fixed) {
+        sqe->opcode = writing ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+        sqe->buf_index = (uint16_t)slot;
+    } else {
+        sqe->opcode = writing ? IORING_OP_WRITE : IORING_OP_READ;
+    }
+    sqe->fd = fd;
+    sqe->off = (uint64_t)offset;
+    sqe->addr = (uint64_t)(uintptr_t)ring.buffers[slot];
+    sqe->len = length;
+    sqe->user_data = (uint64_t)slot;
+    ring.sq_array[index] = index;
+    __atomic_store_n(ring.sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ring.queued++;
+}
+
+// 提交已放入的请求，waiting为1时再等待至少一个完成
+static int ring_enter(int waiting) {
+    for (;;) {
+        int submitted = (int)syscall(__NR_io_uring_enter, ring.fd, ring.queued, waiting ? 1 : 0,
+                                     waiting ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+        if (submitted >= 0) {
+            ring.queued -= (unsigned)submitted < ring.queued ? (unsigned)submitted : ring.queued;
+            return 1;
+        }
+        if (errno != EINTR) {
+            return 0;
+        }
+    }
+}
+
+static void ring_submit(void) {
+    if (ring.queued > 0) {
+        ring_enter(0);
+    }
+}
+
+// 取一个完成的请求：槽位和结果（字节数或负的错误码）；成功返回1
+static int ring_wait(int *slot, int *result) {
+    for (;;) {
+        unsigned head = *ring.cq_head;
+        if (head != __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE)) {
+            const struct io_uring_cqe *cqe = &ring.cqes[head & *ring.cq_mask];
+            *slot = (int)cqe->user_data;
+            *result = cqe->res;
+            __atomic_store_n(ring.cq_head, head + 1, __ATOMIC_RELEASE);
+            return 1;
+        }
+        if (!ring_enter(1)) {
+            return 0;
+        }
+    }
+}
+
+// 同步读写一段，直到完成、读到文件末尾或出错；返回处理的字节数，出错返回-1
+static ssize_t pread_all(int fd, char *buffer, size_t length, off_t offset) {
+    size_t done = 0;
+    while (done < length) {
+        ssize_t n = pread(fd, buffer + done, length - done, offset + (off_t)done);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            return -1;
+        }
+        if (n == 0) {
+            break;
+        }
+        done += (size_t)n;
+    }
+    return (ssize_t)done;
+}
+
+static ssize_t pwrite_all(int fd, const char *buffer, size_t length, off_t offset) {
+    size_t done = 0;
+    while (done < length) {
+        ssize_t n = pwrite(fd, buffer + done, length - done, offset + (off_t)done);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return -1;
+        }
+        done += (size_t)n;
+    }
+    return (ssize_t)done;
+}
+
+// 处理一个完成的请求。出错或只完成了一部分时，其余部分同步读写（读到的文件比打开时短也照常结束）
+static int complete_one(FileCookie *c) {
+    int slot, result;
+    if (!ring_wait(&slot, &result)) {
+        return 0;
+    }
+    int done = result > 0 ? result : 0;
+    if (done < c->expected[slot]) {
+        ssize_t rest = c->writing
+                           ? pwrite_all(c->fd, ring.buffers[slot] + done, c->expected[slot] - done, c->offsets[slot] + done)
+                           : pread_all(c->fd, ring.buffers[slot] + done, c->expected[slot] - done, c->offsets[slot] + done);
+        if (rest < 0) {
+            c->failed = 1;
+            rest = 0;
+        }
+        done += (int)rest;
+    }
+    c->lengths[slot] = c->writing ? 0 : done;
+    return 1;
+}
+
+// ---- 读取 ----
+
+// 当前位置
+static off_t read_position(const FileCookie *c) {
+    return c->count > 0 ? c->offsets[c->first] + (off_t)c->used : c->position;
+}
+
+// 按窗口提交后面的块
+static void read_ahead(FileCookie *c) {
+    while (c->count < c->window && c->next < c->size) {
+        int slot = (c->first + c->count) % FILEIO_DEPTH;
+        off_t left = c->size - c->next;
+        c->offsets[slot] = c->next;
+        c->expected[slot] = left < FILEIO_CHUNK ? (int)left : FILEIO_CHUNK;
+        c->lengths[slot] = -1;
+        ring_push(0, c->fd, slot, c->next, (unsigned)c->expected[slot]);
+        c->next += c->expected[slot];
+        c->count++;
+    }
+    ring_submit();
+}
+
+// 丢弃已提交的块（等在途的读完，缓冲区才能再用）
+static int read_drain(FileCookie *c) {
+    int ok = 1;
+    for (; c->count > 0; c->count--) {
+        int slot = c->first;
+        while (ok && c->lengths[slot] == -1) {
+            ok = complete_one(c);
+        }
+        c->first = (c->first + 1) % FILEIO_DEPTH;
+    }
+    return ok;
+}
+
+static ssize_t ring_read(FileCookie *c, char *buffer, size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        if (c->count == 0) {
+            read_ahead(c);
+            if (c->count == 0) {
+                break;                      // 文件末尾
+            }
+        }
+        int slot = c->first;
+        while (c->lengths[slot] == -1) {
+            if (!complete_one(c)) {
+                return -1;
+            }
+        }
+        if (c->used >= (size_t)c->lengths[slot]) {
+            // 这一块已读完才换下一块：stdio 定位时会退回到当前块内，保留它免得重读
+            int shorter = c->lengths[slot] < c->expected[slot];
+            off_t end = c->offsets[slot] + c->lengths[slot];
+            c->first = (c->first + 1) % FILEIO_DEPTH;
+            c->count--;
+            c->used = 0;
+            if (shorter) {
+                // 文件在打开后变短了：后面的块都作废，到此结束
+                if (!read_drain(c)) {
+                    return -1;
+                }
+                c->position = c->next = c->size = end;
+                break;
+            }
+            if (c->window < FILEIO_DEPTH) {
+                c->window++;
+            }
+            if (c->count == 0) {
+                c->position = c->next;
+            }
+            read_ahead(c);
+            continue;
+        }
+        size_t n = (size_t)c->lengths[slot] - c->used;
+        if (n > size - done) {
+            n = size - done;
+        }
+        memcpy(buffer + done, ring.buffers[slot] + c->used, n);
+        c->used += n;
+        done += n;
+    }
+    return (ssize_t)done;
+}
+
+// 定位：目标在已提交的块中时跳过之前的块，否则丢弃全部，从目标所在的对齐块重新开始预读
+static int ring_read_seek(FileCookie *c, off_t target) {
+    for (int i = 0; i < c->count; i++) {
+        int slot = (c->first + i) % FILEIO_DEPTH;
+        if (target >= c->offsets[slot] && target < c->offsets[slot] + c->expected[slot]) {
+            for (; i > 0; i--) {
+                int skipped = c->first;
+                while (c->lengths[skipped] == -1) {
+                    if (!complete_one(c)) {
+                        return -1;
+                    }
+                }
+                c->first = (c->first + 1) % FILEIO_DEPTH;
+                c->count--;
+            }
+            c->used = (size_t)(target - c->offsets[slot]);
+            read_ahead(c);
+            return 0;
+        }
+    }
+    if (!read_drain(c)) {
+        return -1;
+    }
+    c->first = 0;
+    c->window = 1;
+    c->used = 0;
+    c->position = target;
+    if (target < c->size) {
+        c->next = target - target % FILEIO_CHUNK;
+        read_ahead(c);
+        c->used = (size_t)(target - c->offsets[c->first]);
+    } else {
+        c->next = c->size;
+    }
+    return 0;
+}
+
+// ---- 写入 ----
+
+// 提交正在填充的槽位，换到下一个槽位
+static void write_flush(FileCookie *c) {
+    if (c->used == 0) {
+        return;
+    }
+    int slot = c->slot;
+    c->offsets[slot] = c->next;
+    c->expected[slot] = (int)c->used;
+    c->lengths[slot] = (int)c->used;
+    ring_push(1, c->fd, slot, c->next, (unsigned)c->used);
+    ring_submit();
+    c->next += (off_t)c->used;
+    c->used = 0;
+    c->slot = (slot + 1) % FILEIO_DEPTH;
+}
+
+// 等待全部在途的写入完成
+static int write_drain(FileCookie *c) {
+    for (int slot = 0; slot < FILEIO_DEPTH; slot++) {
+        while (c->lengths[slot] != 0) {
+            if (!complete_one(c)) {
+                c->failed = 1;
+                return 0;
+            }
+        }
+    }
+    return !c->failed;
+}
+
+static ssize_t ring_write(FileCookie *c, const char *buffer, size_t size) {
+    size_t done = 0;
+    while (done < size && !c->failed) {
+        // 槽位上一次的写入还在进行时等它完成
+        while (c->used == 0 && c->lengths[c->slot] != 0) {
+            if (!complete_one(c)) {
+                c->failed = 1;
+                return -1;
+            }
+        }
+        size_t n = FILEIO_CHUNK - c->used;
+        if (n > size - done) {
+            n = size - done;
+        }
+        memcpy(ring.buffers[c->slot] + c->used, buffer + done, n);
+        c->used += n;
+        done += n;
+        if (c->used == FILEIO_CHUNK) {
+            write_flush(c);
+        }
+    }
+    return c->failed ? -1 : (ssize_t)size;
+}
+
+// ---- stdio 接口 ----
+
+static ssize_t cookie_read(void *cookie, char *buffer, size_t size) {
+    FileCookie *c = cookie;
+    if (c->ring) {
+        return ring_read(c, buffer, size);
+    }
+    ssize_t n = pread_all(c->fd, buffer, size, c->position);
+    if (n > 0) {
+        c->position += n;
+    }
+    return n;
+}
+
+static ssize_t cookie_write(void *cookie, const char *buffer, size_t size) {
+    FileCookie *c = cookie;
+    if (c->ring) {
+        return ring_write(c, buffer, size);
+    }
+    if (pwrite_all(c->fd, buffer, size, c->position) < 0) {
+        c->failed = 1;
+        return -1;
+    }
+    c->position += (off_t)size;
+    return (ssize_t)size;
+}
+
+static int cookie_seek(void *cookie, off64_t *offset, int whence) {
+    FileCookie *c = cookie;
+    off_t current = !c->ring ? c->position : c->writing ? c->next + (off_t)c->used : read_position(c);
+    off_t target;
+    if (whence == SEEK_SET) {
+        target = (off_t)*offset;
+    } else if (whence == SEEK_CUR) {
+        target = current + (off_t)*offset;
+    } else if (!c->writing) {
+        target = c->size + (off_t)*offset;
+    } else {
+        return -1;
+    }
+    if (target < 0) {
+        return -1;
+    }
+    if (target != current) {
+        if (!c->ring) {
+            c->position = target;
+        } else if (c->writing) {
+            // 回填（如压缩格式文件头中的索引位置）：先写出已填充的部分
+            write_flush(c);
+            if (!write_drain(c)) {
+                return -1;
+            }
+            c->next = target;
+        } else if (ring_read_seek(c, target) != 0) {
+            return -1;
+        }
+    }
+    *offset = target;
+    return 0;
+}
+
+static int cookie_close(void *cookie) {
+    FileCookie *c = cookie;
+    int failed = c->failed;
+    if (c->ring) {
+        if (c->writing) {
+            write_flush(c);
+            failed = !write_drain(c);
+        } else {
+            read_drain(c);
+        }
+        __atomic_store_n(&ring_busy, 0, __ATOMIC_RELEASE);
+    }
+    if (c->writing && fsync(c->fd) != 0) {
+        failed = 1;
+    }
+    if (close(c->fd) != 0) {
+        failed = 1;
+    }
+    free(c);
+    return failed ? -1 : 0;
+}
+
+// 打开文件："r" 读，"w" 创建或清空后写。失败返回NULL（errno 同 open）
+FILE *fileio_open(const char *filename, const char *mode) {
+    int writing = mode[0] == 'w';
+    int fd = writing ? open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644) : open(filename, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    FileCookie *c = calloc(1, sizeof(FileCookie));
+    struct stat st;
+    if (c == NULL || (!writing && fstat(fd, &st) != 0)) {
+        free(c);
+        close(fd);
+        return NULL;
+    }
+    c->fd = fd;
+    c->writing = writing;
+    c->window = 1;
+    if (!writing) {
+        c->size = st.st_size;
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    pthread_once(&ring_once, ring_init);
+    c->ring = ring_state == 1 && !__atomic_exchange_n(&ring_busy, 1, __ATOMIC_ACQUIRE);
+    cookie_io_functions_t functions = {cookie_read, cookie_write, cookie_seek, cookie_close};
+    FILE *file = fopencookie(c, writing ? "w" : "r", functions);
+    if (file == NULL) {
+        cookie_close(c);
+    }
+    return file;
+}
+
+// 当前使用的读写方式
+const char *fileio_backend(void) {
+    pthread_once(&ring_once, ring_init);
+    return ring_state == 1 ? "io_uring" : "pread/pwrite";
+}
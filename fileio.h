@@ -0,0 +1,21 @@
+#ifndef FILEIO_H
+#define FILEIO_H
+
+#include <stdio.h>
+
+#define FILEIO_CHUNK (256 * 1024)   // 每次读写的块大小，顺序读写时文件偏移按此对齐
+#define FILEIO_DEPTH 8              // 同时在途的块数
+
+// 数据文件的读写通道：返回的 FILE* 可照常 fread/fwrite/fseeko，底层按块读写。
+// 可用时经 io_uring 进行（直接使用系统调用，不依赖 liburing）：
+// 读取时按顺序预读后面的若干块，解析当前块的同时后面的块已在读取；
+// 写入时写满一块即提交，填充下一块的同时前面的块在写入。
+// 各块的缓冲区在首次使用时分配并注册到内核，之后的加载和保存反复使用。
+// 内核不支持、配置 io_uring = no，或另一个线程正在使用时，改用 pread/pwrite 逐次读写。
+// 以写方式打开的文件在 fclose 时同步到磁盘，fclose 失败即写入失败（不能对其使用 fileno）
+
+// 函数声明
+FILE *fileio_open(const char *filename, const char *mode);
+const char *fileio_backend(void);
+
+#endif
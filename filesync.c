@@ -0,0 +1,342 @@
+#define _POSIX_C_SOURCE 200809L
+#include "filesync.h"
+#include "changefeed.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// 在<filename>.lock上加写锁，其他进程正在保存时等待；返回锁文件的描述符，失败返回-1。
+// 锁文件只在这里打开，关闭描述符即释放锁。记录锁属于进程，同一进程内的保存由调用者串行进行
+int lock_data_file(const char *filename) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s.lock", filename);
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+    struct flock lock = {.l_type = F_WRLCK, .l_whence = SEEK_SET};
+    while (fcntl(fd, F_SETLKW, &lock) != 0) {
+        if (errno != EINTR) {
+            close(fd);
+            return -1;
+        }
+    }
+    return fd;
+}
+
+void unlock_data_file(int fd) {
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+// 记下数据文件的内容和代数，替换之前记下的。接管snapshot，NULL表示文件不存在。
+// 内存不足时不记内容，合并时与文件不存在一样按没有学生比较
+void remember_data_file(StudentSystem *system, Snapshot *snapshot, uint32_t generation) {
+    if (system->file_base != NULL) {
+        release_snapshot(system->file_base);
+    }
+    if (snapshot != NULL && system->file_base == NULL) {
+        system->file_base = malloc(sizeof(Snapshot));
+    }
+    if (snapshot != NULL && system->file_base != NULL) {
+        *system->file_base = *snapshot;
+    } else {
+        if (snapshot != NULL) {
+            release_snapshot(snapshot);
+        }
+        free(system->file_base);
+        system->file_base = NULL;
+    }
+    system->file_generation = generation;
+}
+
+// 按学号查找记录的散列表（开放寻址），只在合并期间使用
+typedef struct {
+    const Snapshot *snapshot;
+    int *slots;                     // 记录下标，-1为空
+    uint32_t mask;
+} IdIndex;
+
+// FNV-1a 32位哈希
+static uint32_t hash_id(const char *id) {
+    uint32_t h = 2166136261u;
+    for (const unsigned char *p = (const unsigned char *)id; *p; p++) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static int index_build(IdIndex *index, const Snapshot *snapshot) {
+    uint32_t size = 16;
+    while (size < (uint32_t)snapshot->count * 2) {
+        size <<= 1;
+    }
+    index->snapshot = snapshot;
+    index->mask = size - 1;
+    index->slots = malloc(size * sizeof(int));
+    if (index->slots == NULL) {
+        return 0;
+    }
+    memset(index->slots, 0xff, size * sizeof(int));
+    for (int i = 0; i < snapshot->count; i++) {
+        uint32_t h = hash_id(student_id_at(snapshot, i)) & index->mask;
+        while (index->slots[h] != -1) {
+            h = (h + 1) & index->mask;
+        }
+        index->slots[h] = i;
+    }
+    return 1;
+}
+
+// 返回学号所在的下标，没有时返回-1
+static int index_find(const IdIndex *index, const char *id) {
+    for (uint32_t h = hash_id(id) & index->mask; index->slots[h] != -1; h = (h + 1) & index->mask) {
+        if (strcmp(student_id_at(index->snapshot, index->slots[h]), id) == 0) {
+            return index->slots[h];
+        }
+    }
+    return -1;
+}
+
+// 两处的同一学号（下标-1表示没有这名学生）是否相同：比较姓名、年龄和各科成绩，科目设置须相同
+static int same_student(const Snapshot *a, int i, const Snapshot *b, int j) {
+    if (i < 0 || j < 0) {
+        return i == j;
+    }
+    if (hot_at(a, i)->age != hot_at(b, j)->age || strcmp(student_name_at(a, i), student_name_at(b, j)) != 0) {
+        return 0;
+    }
+    for (int k = 0; k < a->schema.count; k++) {
+        if (score_at(a, k, i) != score_at(b, k, j)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void add_conflict(MergeReport *report, const char *id) {
+    if (report->conflicts < MERGE_REPORT_IDS) {
+        snprintf(report->conflict_ids[report->conflicts], MAX_ID_LEN, "%s", id);
+    }
+    report->conflicts++;
+}
+
+static int compare_desc(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x < y) - (x > y);
+}
+
+// 三方合并：base为记下的文件内容，ours为当前数据，theirs为文件中现在的数据。
+// 只有本进程改动的学生保持当前的值；只有对方改动的学生按文件中的值写入当前数据；
+// 双方都改动且结果不同为冲突：keep_ours为0时不修改当前数据，否则与只有本进程改动时一样保持当前的值。
+// 科目设置不同时无法按学生比较，keep_ours为1时整体以当前数据为准
+static int merge_students(StudentSystem *system, const Snapshot *base, const Snapshot *theirs, int keep_ours,
+                          MergeReport *report) {
+    if (!schema_same_subjects(&system->schema, &theirs->schema)
+        || (base->count > 0 && !schema_same_subjects(&base->schema, &theirs->schema))) {
+        report->schema_conflict = 1;
+        report->kept_ours = keep_ours;
+        return keep_ours ? FILE_OK : FILE_CONFLICT;
+    }
+
+    Snapshot ours;
+    take_snapshot(system, &ours);
+    IdIndex base_index = {0}, ours_index = {0}, theirs_index = {0};
+    char *handled = calloc((size_t)theirs->count + 1, 1);      // 文件中已由本进程的改动决定结果的学生
+    int *upserts = malloc(((size_t)theirs->count + 1) * sizeof(int));
+    int *targets = malloc(((size_t)theirs->count + 1) * sizeof(int));
+    int *removals = malloc(((size_t)ours.count + 1) * sizeof(int));
+    int upsert_count = 0, removal_count = 0;
+    int status = FILE_OK;
+    if (handled == NULL || upserts == NULL || targets == NULL || removals == NULL || !index_build(&base_index, base)
+        || !index_build(&ours_index, &ours) || !index_build(&theirs_index, theirs)) {
+        status = FILE_TOO_LARGE;
+        goto done;
+    }
+
+    // 本进程添加或修改的学生
+    for (int i = 0; i < ours.count; i++) {
+        const char *id = student_id_at(&ours, i);
+        int b = index_find(&base_index, id);
+        if (same_student(&ours, i, base, b)) {
+            continue;
+        }
+        int t = index_find(&theirs_index, id);
+        if (t >= 0) {
+            handled[t] = 1;
+        }
+        if (!same_student(theirs, t, base, b) && !same_student(theirs, t, &ours, i)) {
+            add_conflict(report, id);
+        }
+    }
+    // 本进程删除的学生
+    for (int b = 0; b < base->count; b++) {
+        const char *id = student_id_at(base, b);
+        int t = index_find(&theirs_index, id);
+        if (t >= 0 && index_find(&ours_index, id) == -1) {
+            handled[t] = 1;
+            if (!same_student(theirs, t, base, b)) {
+                add_conflict(report, id);
+            }
+        }
+    }
+    if (report->conflicts > 0 && !keep_ours) {
+        status = FILE_CONFLICT;
+        goto done;
+    }
+    report->kept_ours = report->conflicts > 0;
+
+    // 对方添加或修改、本进程没有改动的学生
+    for (int t = 0; t < theirs->count; t++) {
+        const char *id = student_id_at(theirs, t);
+        if (!handled[t] && !same_student(theirs, t, base, index_find(&base_index, id))) {
+            upserts[upsert_count] = t;
+            targets[upsert_count++] = index_find(&ours_index, id);
+        }
+    }
+    // 对方删除、本进程没有改动的学生（本进程也删除了的不再处理）
+    for (int b = 0; b < base->count; b++) {
+        const char *id = student_id_at(base, b);
+        int o = index_find(&ours_index, id);
+        if (o >= 0 && index_find(&theirs_index, id) == -1 && same_student(&ours, o, base, b)) {
+            removals[removal_count++] = o;
+        }
+    }
+    release_snapshot(&ours);
+
+    // 对方的修改已由对方记入变更流，写入当前数据时不再记录
+    struct ChangeFeed *changes = system->changes;
+    system->changes = NULL;
+    for (int n = 0; n < upsert_count && status == FILE_OK; n++) {
+        Student s;
+        snapshot_get_student(theirs, upserts[n], &s);
+        if (targets[n] >= 0 ? !set_student(system, targets[n], &s) : !append_student(system, &s)) {
+            status = FILE_TOO_LARGE;
+        }
+    }
+    // 从后往前删除，前面的下标不受影响
+    qsort(removals, removal_count, sizeof(int), compare_desc);
+    for (int n = 0; n < removal_count && status == FILE_OK; n++) {
+        remove_student(system, removals[n]);
+    }
+    system->changes = changes;
+    report->theirs = upsert_count + removal_count;
+
+done:
+    if (ours.hot != NULL) {
+        release_snapshot(&ours);
+    }
+    free(base_index.slots);
+    free(ours_index.slots);
+    free(theirs_index.slots);
+    free(handled);
+    free(upserts);
+    free(targets);
+    free(removals);
+    return status;
+}
+
+// 在锁内调用：数据文件在记下之后被其他进程保存过时，把对方的修改合并到当前数据，并改记为文件现在的内容。
+// 文件不存在或文件头无法读取时没有可合并的内容，直接返回FILE_OK；冲突时返回FILE_CONFLICT，当前数据不变
+int merge_data_file(StudentSystem *system, const char *filename, int keep_ours, MergeReport *report) {
+    memset(report, 0, sizeof(*report));
+    uint32_t generation;
+    if (data_file_generation(filename, &generation) != FILE_OK || generation == system->file_generation) {
+        return FILE_OK;
+    }
+
+    StudentSystem theirs;
+    init_system(&theirs);
+    int status = read_data_file(&theirs, filename);
+    if (status == FILE_OK && theirs.file_base == NULL) {
+        status = FILE_TOO_LARGE;
+    }
+    if (status == FILE_OK) {
+        Snapshot empty;
+        memset(&empty, 0, sizeof(empty));
+        status = merge_students(system, system->file_base != NULL ? system->file_base : &empty,
+                                theirs.file_base, keep_ours, report);
+    }
+    if (status == FILE_OK) {
+        Snapshot loaded;
+        take_snapshot(&theirs, &loaded);
+        remember_data_file(system, &loaded, theirs.file_generation);
+        report->merged = 1;
+    }
+    free_system(&theirs);
+    return status;
+}
+
+// 加锁保存当前数据：先合并其他进程在此期间的保存，再写入并记下写入的内容和代数。
+// 冲突且keep_ours为0时不写入，返回FILE_CONFLICT，report中有冲突的学号
+int save_data_file(StudentSystem *system, const char *filename, int compressed, int keep_ours,
+                   MergeReport *report) {
+    int fd = lock_data_file(filename);
+    if (fd < 0) {
+        memset(report, 0, sizeof(*report));
+        return FILE_WRITE_ERROR;
+    }
+    int status = merge_data_file(system, filename, keep_ours, report);
+    if (status == FILE_OK) {
+        Snapshot snapshot;
+        take_snapshot(system, &snapshot);
+        status = write_data_file_as(&snapshot, filename, compressed);
+        if (status == FILE_OK) {
+            uint32_t generation;
+            data_file_generation(filename, &generation);
+            mark_saved(system);
+            changes_saved(system, snapshot.change_seq);
+            remember_data_file(system, &snapshot, generation);
+            compact_strings(system);
+        } else {
+            release_snapshot(&snapshot);
+        }
+    }
+    unlock_data_file(fd);
+    return status;
+}
+
+// 加锁写入快照，但只在数据文件的代数仍为expected（或文件不存在）时写入，否则返回FILE_CHANGED。
+// 供不能在保存时修改当前数据的场合（后台保存线程）使用，成功时generation为写入的代数
+int save_snapshot_if_unchanged(const Snapshot *snapshot, const char *filename, uint32_t expected,
+                               uint32_t *generation) {
+    int fd = lock_data_file(filename);
+    if (fd < 0) {
+        return FILE_WRITE_ERROR;
+    }
+    uint32_t current;
+    int status = data_file_generation(filename, &current);
+    if (status == FILE_OK && current != expected) {
+        status = FILE_CHANGED;
+    } else {
+        status = write_data_file(snapshot, filename);
+        if (status == FILE_OK) {
+            data_file_generation(filename, generation);
+        }
+    }
+    unlock_data_file(fd);
+    return status;
+}
+
+// 输出合并的结果：合并了其他进程的保存或发生冲突时提示
+void print_merge_report(FILE *out, const MergeReport *report) {
+    if (report->schema_conflict) {
+        fprintf(out, report->kept_ours ? "数据文件已被其他进程保存过，且科目设置不同，已以本次的数据覆盖！\n"
+                                       : "数据文件已被其他进程保存过，且科目设置不同，无法合并！\n");
+        return;
+    }
+    if (report->merged) {
+        fprintf(out, "数据文件已被其他进程保存过，已合并对方修改的 %d 名学生。\n", report->theirs);
+    }
+    if (report->conflicts > 0) {
+        fprintf(out, report->kept_ours ? "其中 %d 名学生双方都修改过，已以本次的修改为准："
+                                       : "数据文件已被其他进程保存过，%d 名学生双方都修改过：",
+                report->conflicts);
+        for (int i = 0; i < report->conflicts && i < MERGE_REPORT_IDS; i++) {
+            fprintf(out, i > 0 ? "、%s" : "%s", report->conflict_ids[i]);
+        }
+        fprintf(out, report->conflicts > MERGE_REPORT_IDS ? " 等\n" : "\n");
+    }
+}
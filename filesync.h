@@ -0,0 +1,38 @@
+#ifndef FILESYNC_H
+#define FILESYNC_H
+
+#include "student.h"
+
+#define MERGE_REPORT_IDS 8          // 最多报告的冲突学号数
+
+// 多个进程同时使用同一个数据文件（如并发执行的命令行、交互模式和服务）：
+// 保存时在数据文件旁的锁文件（<数据文件>.lock）上加写锁，同一时刻只有一个进程在检查和替换数据文件；
+// 读取不加锁，保存先写临时文件再改名替换，读到的总是完整的某一次保存。
+// 文件头记有代数，每次保存加1。加载和保存后记下当时文件的代数和内容（快照，与当前数据共享未修改的块）。
+// 保存时文件的代数与记下的不同，说明其他进程在此期间保存过：重新读取数据文件，
+// 按学号三方比较记下的内容、当前数据和文件中的数据，把对方修改的学生合并到当前数据后再保存；
+// 双方都修改了同一名学生（添加、修改或删除）且结果不同为冲突：默认不保存并报告冲突的学号，
+// keep_ours为1时这些学生以本进程的修改为准（常驻的服务以及交互模式中用户确认后）
+
+// 合并结果
+typedef struct {
+    int merged;                     // 合并了其他进程的保存
+    int theirs;                     // 从文件合并进来的学生数（添加、修改或删除）
+    int conflicts;                  // 冲突的学生数
+    int kept_ours;                  // 冲突的学生已以本进程的修改为准
+    int schema_conflict;            // 科目设置不同，无法按学生合并
+    char conflict_ids[MERGE_REPORT_IDS][MAX_ID_LEN];
+} MergeReport;
+
+// 函数声明
+int lock_data_file(const char *filename);
+void unlock_data_file(int fd);
+void remember_data_file(StudentSystem *system, Snapshot *snapshot, uint32_t generation);
+int merge_data_file(StudentSystem *system, const char *filename, int keep_ours, MergeReport *report);
+int save_data_file(StudentSystem *system, const char *filename, int compressed, int keep_ours,
+                   MergeReport *report);
+int save_snapshot_if_unchanged(const Snapshot *snapshot, const char *filename, uint32_t expected,
+                               uint32_t *generation);
+void print_merge_report(FILE *out, const MergeReport *report);
+
+#endif
@@ -0,0 +1,674 @@
+#define _POSIX_C_SOURCE 200809L
+#include "history.h"
+#include <unistd.h>
+
+#define HISTORY_MAGIC "STHI"
+#define HISTORY_VERSION 2
+
+// 历史文件头，其后依次追加各学期。
+// 版本2中每个学期为一帧：字节数、校验和（FNV-1a）、序列化的学期；版本1没有帧头，只能读取，下次结转时整体改写为版本2
+typedef struct {
+    char magic[4];              // "STHI"
+    uint16_t version;
+    uint16_t reserved;
+} HistoryHeader;
+
+// 帧头
+typedef struct {
+    uint32_t length;
+    uint32_t checksum;
+} FrameHeader;
+
+// 排序用：学号与其在学生表中的下标
+typedef struct {
+    const char *id;
+    uint32_t index;
+} IdEntry;
+
+// 初始化成绩历史
+void history_init(History *history) {
+    memset(history, 0, sizeof(*history));
+}
+
+// 释放一个学期的编码数据
+static void term_free(Term *term) {
+    free(term->offsets);
+    for (int c = 0; c <= term->schema.count; c++) {
+        buffer_free(&term->columns[c]);
+    }
+}
+
+// 释放成绩历史
+void history_free(History *history) {
+    for (int t = 0; t < history->count; t++) {
+        term_free(&history->terms[t]);
+    }
+    free(history->terms);
+    history_init(history);
+}
+
+// 追加一个学期（接管term中的内存），成功返回1
+static int history_push(History *history, const Term *term) {
+    if (history->count == history->capacity) {
+        int capacity = history->capacity ? history->capacity * 2 : 8;
+        Term *terms = realloc(history->terms, (size_t)capacity * sizeof(Term));
+        if (terms == NULL) {
+            return 0;
+        }
+        history->terms = terms;
+        history->capacity = capacity;
+    }
+    history->terms[history->count++] = *term;
+    return 1;
+}
+
+// 按名称查找学期，找不到返回-1
+int history_find_term(const History *history, const char *name) {
+    for (int t = 0; t < history->count; t++) {
+        if (strcmp(history->terms[t].name, name) == 0) {
+            return t;
+        }
+    }
+    return -1;
+}
+
+// 读取一个学号：共享前缀长度、后缀长度、后缀；id中为同块上一个学号
+static int read_id(const uint8_t **pos, const uint8_t *end, char *id) {
+    uint64_t shared, len;
+    if (!get_varint(pos, end, &shared) || !get_varint(pos, end, &len)
+        || shared > strlen(id) || shared + len >= MAX_ID_LEN || len > (uint64_t)(end - *pos)) {
+        return 0;
+    }
+    memcpy(id + shared, *pos, len);
+    id[shared + len] = '\0';
+    *pos += len;
+    return 1;
+}
+
+// 写入一个学号（与同块上一个学号做前缀压缩）
+static int put_id(ByteBuffer *buffer, const char *previous, const char *id) {
+    size_t shared = 0;
+    while (previous[shared] != '\0' && previous[shared] == id[shared]) {
+        shared++;
+    }
+    size_t len = strlen(id) - shared;
+    return buffer_put_varint(buffer, shared) && buffer_put_varint(buffer, len)
+           && buffer_append(buffer, id + shared, len);
+}
+
+// 求本学期各科在上一学期中的列号（按科目名对应），没有的为-1
+static void map_subjects(const Schema *schema, const Schema *previous, int *map) {
+    for (int k = 0; k < schema->count; k++) {
+        map[k] = previous != NULL ? schema_find(previous, schema->subjects[k].name) : -1;
+    }
+}
+
+static int compare_ids(const void *a, const void *b) {
+    return strcmp(((const IdEntry *)a)->id, ((const IdEntry *)b)->id);
+}
+
+// 把当前成绩编码为一个新学期
+static int encode_term(const History *history, const StudentSystem *system, Term *term) {
+    uint32_t rows = (uint32_t)system->count;
+    int subjects = system->schema.count;
+    TermTable previous = {0};
+    int map[MAX_SUBJECTS];
+    int ok = 0;
+
+    term->schema = system->schema;
+    term->keyframe = history->count % HISTORY_KEYFRAME == 0;
+    if (!term->keyframe && !history_read_term(history, history->count - 1, &previous)) {
+        return 0;
+    }
+    map_subjects(&system->schema, term->keyframe ? NULL : &history->terms[history->count - 1].schema, map);
+
+    IdEntry *order = malloc((rows > 0 ? rows : 1) * sizeof(IdEntry));
+    term->blocks = (rows + HISTORY_BLOCK_ROWS - 1) / HISTORY_BLOCK_ROWS;
+    term->offsets = malloc(((size_t)term->blocks * (subjects + 1) + 1) * sizeof(uint32_t));
+    if (order == NULL || term->offsets == NULL) {
+        goto done;
+    }
+    for (uint32_t i = 0; i < rows; i++) {
+        order[i].id = student_id_at(system, i);
+        order[i].index = i;
+    }
+    qsort(order, rows, sizeof(IdEntry), compare_ids);
+
+    // 与上一学期（同样按学号升序）归并，找到同一学生的上期成绩
+    const char *last = "";
+    uint32_t p = 0;
+    for (uint32_t i = 0; i < rows; i++) {
+        if (i % HISTORY_BLOCK_ROWS == 0) {
+            uint32_t block = i / HISTORY_BLOCK_ROWS;
+            for (int c = 0; c <= subjects; c++) {
+                term->offsets[c * term->blocks + block] = (uint32_t)term->columns[c].size;
+            }
+            last = "";
+        }
+        const char *id = order[i].id;
+        if (!put_id(&term->columns[0], last, id)) {
+            goto done;
+        }
+        last = id;
+
+        while (p < previous.rows && strcmp(previous.ids[p], id) < 0) {
+            p++;
+        }
+        int matched = p < previous.rows && strcmp(previous.ids[p], id) == 0;
+        for (int k = 0; k < subjects; k++) {
+            int base = matched && map[k] != -1 ? previous.scores[map[k]][p] : 0;
+            int delta = score_at(system, k, order[i].index) - base;
+            if (!buffer_put_varint(&term->columns[k + 1], zigzag_encode(delta))) {
+                goto done;
+            }
+        }
+    }
+    for (int c = 0; c <= subjects; c++) {
+        buffer_shrink(&term->columns[c]);
+    }
+    term->rows = rows;
+    ok = 1;
+
+done:
+    free(order);
+    term_table_free(&previous);
+    return ok;
+}
+
+// 写入带长度前缀的字符串
+static int put_string(ByteBuffer *buffer, const char *text) {
+    uint16_t len = (uint16_t)strlen(text);
+    return buffer_append(buffer, &len, sizeof(len)) && buffer_append(buffer, text, len);
+}
+
+// 把学期序列化：名称、关键学期标志、科目设置、行数、块数，随后每列为 字节数、块偏移、数据
+static int serialize_term(const Term *term, ByteBuffer *out) {
+    uint8_t keyframe = (uint8_t)term->keyframe;
+    uint8_t subjects = (uint8_t)term->schema.count;
+    if (!put_string(out, term->name) || !buffer_append(out, &keyframe, 1) || !buffer_append(out, &subjects, 1)) {
+        return 0;
+    }
+    for (int k = 0; k < subjects; k++) {
+        const Subject *subject = &term->schema.subjects[k];
+        if (!put_string(out, subject->name) || !put_string(out, subject->alias)
+            || !buffer_append(out, &subject->weight, sizeof(uint16_t))) {
+            return 0;
+        }
+    }
+    if (!buffer_append(out, &term->rows, sizeof(uint32_t)) || !buffer_append(out, &term->blocks, sizeof(uint32_t))) {
+        return 0;
+    }
+    for (int c = 0; c <= subjects; c++) {
+        uint32_t size = (uint32_t)term->columns[c].size;
+        if (!buffer_append(out, &size, sizeof(size))
+            || !buffer_append(out, &term->offsets[c * term->blocks], term->blocks * sizeof(uint32_t))
+            || !buffer_append(out, term->columns[c].data, size)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// 帧的校验和：FNV-1a 32位
+static uint32_t frame_checksum(const uint8_t *data, size_t size) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        h ^= data[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// 写入一帧（帧头和序列化的学期），成功返回1
+static int put_frame(FILE *file, const ByteBuffer *record) {
+    FrameHeader frame = {(uint32_t)record->size, frame_checksum(record->data, record->size)};
+    return fwrite(&frame, sizeof(frame), 1, file) == 1 && fwrite(record->data, 1, record->size, file) == record->size;
+}
+
+// 写完后落盘再关闭，成功返回1
+static int close_synced(FILE *file, int ok) {
+    ok = ok && fflush(file) == 0 && fsync(fileno(file)) == 0;
+    return fclose(file) == 0 && ok;
+}
+
+// 把一帧追加到历史文件末尾（没有文件时先写文件头）并落盘，成功返回1。
+// 加载时已截去不完整的末尾，新的一帧紧接在最后一个完整的学期之后
+static int append_frame(const ByteBuffer *record, const char *filename) {
+    FILE *file = fopen(filename, "ab");
+    if (file == NULL) {
+        return 0;
+    }
+    int ok = fseek(file, 0, SEEK_END) == 0;
+    if (ok && ftell(file) == 0) {
+        HistoryHeader header = {HISTORY_MAGIC, HISTORY_VERSION, 0};
+        ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    }
+    return close_synced(file, ok && put_frame(file, record));
+}
+
+// 把已有的各学期和新的一帧写成版本2的新文件，替换旧版本的历史文件，成功返回1
+static int rewrite_history(const History *history, const ByteBuffer *record, const char *filename) {
+    char temp[256];
+    snprintf(temp, sizeof(temp), "%s.tmp", filename);
+    FILE *file = fopen(temp, "wb");
+    if (file == NULL) {
+        return 0;
+    }
+    HistoryHeader header = {HISTORY_MAGIC, HISTORY_VERSION, 0};
+    int ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    for (int t = 0; ok && t < history->count; t++) {
+        ByteBuffer old = {0};
+        ok = serialize_term(&history->terms[t], &old) && put_frame(file, &old);
+        buffer_free(&old);
+    }
+    ok = close_synced(file, ok && put_frame(file, record));
+    if (!ok || rename(temp, filename) != 0) {
+        remove(temp);
+        return 0;
+    }
+    return 1;
+}
+
+// 把当前成绩结转为名为name的学期，追加到历史和历史文件（写入后落盘）
+int history_close_term(History *history, const StudentSystem *system, const char *name, const char *filename) {
+    Term term;
+    ByteBuffer record = {0};
+    memset(&term, 0, sizeof(term));
+    snprintf(term.name, sizeof(term.name), "%s", name);
+
+    if (!encode_term(history, system, &term)) {
+        term_free(&term);
+        return FILE_TOO_LARGE;
+    }
+    if (!serialize_term(&term, &record)) {
+        term_free(&term);
+        buffer_free(&record);
+        return FILE_TOO_LARGE;
+    }
+
+    int written = history->version == 1 ? rewrite_history(history, &record, filename)
+                                        : append_frame(&record, filename);
+    int status = written ? FILE_OK : FILE_WRITE_ERROR;
+    buffer_free(&record);
+    if (written) {
+        history->version = HISTORY_VERSION;
+    }
+
+    if (status == FILE_OK && !history_push(history, &term)) {
+        status = FILE_TOO_LARGE;
+    }
+    if (status != FILE_OK) {
+        term_free(&term);
+    }
+    return status;
+}
+
+// 读取带长度前缀的字符串，长度须小于limit
+static int read_string(FILE *file, char *buffer, size_t limit) {
+    uint16_t len;
+    if (fread(&len, sizeof(len), 1, file) != 1 || len >= limit) {
+        return 0;
+    }
+    if (fread(buffer, 1, len, file) != len) {
+        return 0;
+    }
+    buffer[len] = '\0';
+    return 1;
+}
+
+// 读取一个学期，成功返回1；到达文件末尾返回0且*eof为1
+static int read_term(FILE *file, Term *term, int *eof) {
+    uint8_t keyframe, subjects;
+    uint16_t len;
+
+    memset(term, 0, sizeof(*term));
+    *eof = 0;
+    if (fread(&len, sizeof(len), 1, file) != 1) {
+        *eof = feof(file);
+        return 0;
+    }
+    if (len >= TERM_NAME_LEN || fread(term->name, 1, len, file) != len
+        || fread(&keyframe, 1, 1, file) != 1 || fread(&subjects, 1, 1, file) != 1
+        || subjects == 0 || subjects > MAX_SUBJECTS) {
+        return 0;
+    }
+    term->name[len] = '\0';
+    term->keyframe = keyframe;
+    for (int k = 0; k < subjects; k++) {
+        char name[SUBJECT_NAME_LEN], alias[SUBJECT_NAME_LEN];
+        uint16_t weight;
+        if (!read_string(file, name, sizeof(name)) || !read_string(file, alias, sizeof(alias))
+            || fread(&weight, sizeof(weight), 1, file) != 1 || !schema_add(&term->schema, name, alias, weight)) {
+            return 0;
+        }
+    }
+    if (fread(&term->rows, sizeof(uint32_t), 1, file) != 1 || fread(&term->blocks, sizeof(uint32_t), 1, file) != 1
+        || term->blocks != (term->rows + HISTORY_BLOCK_ROWS - 1) / HISTORY_BLOCK_ROWS) {
+        return 0;
+    }
+    term->offsets = malloc(((size_t)term->blocks * (subjects + 1) + 1) * sizeof(uint32_t));
+    if (term->offsets == NULL) {
+        return 0;
+    }
+    for (int c = 0; c <= subjects; c++) {
+        uint32_t size;
+        uint32_t *offsets = &term->offsets[c * term->blocks];
+        ByteBuffer *column = &term->columns[c];
+        if (fread(&size, sizeof(size), 1, file) != 1
+            || fread(offsets, sizeof(uint32_t), term->blocks, file) != term->blocks
+            || !buffer_reserve(column, size + 1) || fread(column->data, 1, size, file) != size) {
+            return 0;
+        }
+        column->size = size;
+        for (uint32_t b = 0; b < term->blocks; b++) {
+            if (offsets[b] > size || (b > 0 && offsets[b] < offsets[b - 1])) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+// 读取一帧：校验和正确且恰好是一个完整的学期时返回1，*end为帧之后的位置；
+// 到达文件末尾返回0且*eof为1
+static int read_frame(FILE *file, long size, Term *term, long *end, int *eof) {
+    FrameHeader frame;
+    memset(term, 0, sizeof(*term));
+    *eof = 0;
+    long start = ftell(file);
+    if (start == size) {
+        *eof = 1;
+        return 0;
+    }
+    if (fread(&frame, sizeof(frame), 1, file) != 1 || frame.length > (uint64_t)(size - start) - sizeof(frame)) {
+        return 0;
+    }
+    *end = start + (long)sizeof(frame) + (long)frame.length;
+    uint8_t *data = malloc(frame.length > 0 ? frame.length : 1);
+    if (data == NULL) {
+        return 0;
+    }
+    int ok = fread(data, 1, frame.length, file) == frame.length
+             && frame_checksum(data, frame.length) == frame.checksum;
+    // 帧内的学期按与文件相同的方式解析，须恰好用完整帧
+    FILE *memory = ok ? fmemopen(data, frame.length, "rb") : NULL;
+    if (memory != NULL) {
+        int at_end;
+        ok = read_term(memory, term, &at_end) && ftell(memory) == (long)frame.length;
+        fclose(memory);
+    } else {
+        ok = 0;
+    }
+    free(data);
+    return ok;
+}
+
+// 加载历史文件。
+// 结转时中断会在末尾留下不完整的学期：它之前的学期都完整，把文件截到最后一个完整的学期处（history->truncated为截去的字节数）；
+// 其余位置的损坏不做截断，返回读取错误
+int history_load(History *history, const char *filename) {
+    history_free(history);
+    FILE *file = fopen(filename, "rb");
+    if (file == NULL) {
+        return FILE_NOT_FOUND;
+    }
+
+    HistoryHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, HISTORY_MAGIC, 4) != 0
+        || header.version < 1 || header.version > HISTORY_VERSION) {
+        fclose(file);
+        return FILE_READ_ERROR;
+    }
+    history->version = header.version;
+    long size = 0;
+    long valid = (long)sizeof(header);
+    if (fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) < 0 || fseek(file, valid, SEEK_SET) != 0) {
+        fclose(file);
+        return FILE_READ_ERROR;
+    }
+
+    int status = FILE_OK;
+    for (;;) {
+        Term term;
+        int eof, ok;
+        long end = 0;
+        if (header.version == 1) {
+            ok = read_term(file, &term, &eof);
+            end = ftell(file);
+        } else {
+            ok = read_frame(file, size, &term, &end, &eof);
+        }
+        if (!ok) {
+            term_free(&term);
+            if (eof) {
+                break;
+            }
+            // 版本1读到文件末尾才失败、版本2最后一帧不完整或校验不符，都是中断的结转；否则是损坏
+            if (header.version == 1 ? feof(file) : end <= valid || end >= size) {
+                history->truncated = size - valid;
+            } else {
+                status = FILE_READ_ERROR;
+            }
+            break;
+        }
+        if (!history_push(history, &term)) {
+            term_free(&term);
+            status = FILE_TOO_LARGE;
+            break;
+        }
+        valid = end;
+    }
+    fclose(file);
+    if (status == FILE_OK && history->truncated > 0 && truncate(filename, valid) != 0) {
+        status = FILE_WRITE_ERROR;
+    }
+    if (status != FILE_OK) {
+        history_free(history);
+    }
+    return status;
+}
+
+// 释放解码后的学期
+void term_table_free(TermTable *table) {
+    free(table->ids);
+    for (int k = 0; k < table->subject_count; k++) {
+        free(table->scores[k]);
+    }
+    memset(table, 0, sizeof(*table));
+}
+
+// 以上一学期为基准解码一个学期；previous为NULL表示关键学期
+static int decode_term(const Term *term, const Term *previous_term, const TermTable *previous, TermTable *out) {
+    int subjects = term->schema.count;
+    int map[MAX_SUBJECTS];
+    const uint8_t *pos[MAX_SUBJECTS + 1];
+    const uint8_t *end[MAX_SUBJECTS + 1];
+
+    memset(out, 0, sizeof(*out));
+    out->rows = term->rows;
+    out->subject_count = subjects;
+    out->ids = malloc((term->rows > 0 ? term->rows : 1) * sizeof(*out->ids));
+    if (out->ids == NULL) {
+        return 0;
+    }
+    for (int k = 0; k < subjects; k++) {
+        out->scores[k] = malloc((term->rows > 0 ? term->rows : 1) * sizeof(uint16_t));
+        if (out->scores[k] == NULL) {
+            term_table_free(out);
+            return 0;
+        }
+    }
+    for (int c = 0; c <= subjects; c++) {
+        pos[c] = term->columns[c].data;
+        end[c] = pos[c] + term->columns[c].size;
+    }
+    map_subjects(&term->schema, previous_term != NULL ? &previous_term->schema : NULL, map);
+
+    char id[MAX_ID_LEN] = "";
+    uint32_t p = 0;
+    for (uint32_t i = 0; i < term->rows; i++) {
+        if (i % HISTORY_BLOCK_ROWS == 0) {
+            id[0] = '\0';
+        }
+        if (!read_id(&pos[0], end[0], id)) {
+            term_table_free(out);
+            return 0;
+        }
+        memcpy(out->ids[i], id, MAX_ID_LEN);
+
+        while (previous != NULL && p < previous->rows && strcmp(previous->ids[p], id) < 0) {
+            p++;
+        }
+        int matched = previous != NULL && p < previous->rows && strcmp(previous->ids[p], id) == 0;
+        for (int k = 0; k < subjects; k++) {
+            uint64_t delta;
+            if (!get_varint(&pos[k + 1], end[k + 1], &delta)) {
+                term_table_free(out);
+                return 0;
+            }
+            int64_t value = zigzag_decode(delta) + (matched && map[k] != -1 ? previous->scores[map[k]][p] : 0);
+            if (value < 0 || value > 100 * SCORE_SCALE) {
+                term_table_free(out);
+                return 0;
+            }
+            out->scores[k][i] = (uint16_t)value;
+        }
+    }
+    return 1;
+}
+
+// 找到不晚于term的最近关键学期
+static int keyframe_before(const History *history, int term) {
+    while (term > 0 && !history->terms[term].keyframe) {
+        term--;
+    }
+    return term;
+}
+
+// 解码第term个学期的全部成绩（按学号升序）：从最近的关键学期起逐期累加差值
+int history_read_term(const History *history, int term, TermTable *table) {
+    TermTable current = {0};
+    int first = keyframe_before(history, term);
+
+    for (int t = first; t <= term; t++) {
+        TermTable next;
+        const Term *previous_term = t > first ? &history->terms[t - 1] : NULL;
+        int ok = decode_term(&history->terms[t], previous_term, t > first ? &current : NULL, &next);
+        term_table_free(&current);
+        if (!ok) {
+            return 0;
+        }
+        current = next;
+    }
+    *table = current;
+    return 1;
+}
+
+// 在学期中定位学号：按块首学号二分查找所在块，再在块内顺序解码；找到返回1
+static int locate_id(const Term *term, const char *target, uint32_t *block, uint32_t *slot) {
+    const uint8_t *data = term->columns[0].data;
+    const uint8_t *end = data + term->columns[0].size;
+    uint32_t low = 0, high = term->blocks;
+    char id[MAX_ID_LEN];
+
+    // 找到最后一个块首学号不大于target的块
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        const uint8_t *pos = data + term->offsets[mid];
+        id[0] = '\0';
+        if (!read_id(&pos, end, id)) {
+            return 0;
+        }
+        if (strcmp(id, target) <= 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low == 0) {
+        return 0;
+    }
+
+    *block = low - 1;
+    const uint8_t *pos = data + term->offsets[*block];
+    uint32_t rows = term->rows - *block * HISTORY_BLOCK_ROWS;
+    if (rows > HISTORY_BLOCK_ROWS) {
+        rows = HISTORY_BLOCK_ROWS;
+    }
+    id[0] = '\0';
+    for (uint32_t r = 0; r < rows; r++) {
+        if (!read_id(&pos, end, id)) {
+            return 0;
+        }
+        int order = strcmp(id, target);
+        if (order == 0) {
+            *slot = r;
+            return 1;
+        }
+        if (order > 0) {
+            break;
+        }
+    }
+    return 0;
+}
+
+// 读取学期中某块第slot行各科的差值
+static int read_deltas(const Term *term, uint32_t block, uint32_t slot, int64_t *deltas) {
+    for (int k = 0; k < term->schema.count; k++) {
+        const ByteBuffer *column = &term->columns[k + 1];
+        const uint8_t *pos = column->data + term->offsets[(k + 1) * term->blocks + block];
+        const uint8_t *end = column->data + column->size;
+        uint64_t value = 0;
+        for (uint32_t r = 0; r <= slot; r++) {
+            if (!get_varint(&pos, end, &value)) {
+                return 0;
+            }
+        }
+        deltas[k] = zigzag_decode(value);
+    }
+    return 1;
+}
+
+// 查询一名学生在各学期的成绩：scores[t]按第t个学期的科目顺序，present[t]表示该学期是否有此学生。
+// 每个学期只解码学号所在的块。成功返回1
+int history_student(const History *history, const char *id, uint16_t (*scores)[MAX_SUBJECTS], uint8_t *present) {
+    for (int t = 0; t < history->count; t++) {
+        const Term *term = &history->terms[t];
+        uint32_t block, slot;
+        int64_t deltas[MAX_SUBJECTS];
+
+        present[t] = 0;
+        if (!locate_id(term, id, &block, &slot)) {
+            continue;
+        }
+        if (!read_deltas(term, block, slot, deltas)) {
+            return 0;
+        }
+
+        int map[MAX_SUBJECTS];
+        int chained = !term->keyframe && t > 0 && present[t - 1];
+        map_subjects(&term->schema, chained ? &history->terms[t - 1].schema : NULL, map);
+        for (int k = 0; k < term->schema.count; k++) {
+            int64_t value = deltas[k] + (map[k] != -1 ? scores[t - 1][map[k]] : 0);
+            if (value < 0 || value > 100 * SCORE_SCALE) {
+                return 0;
+            }
+            scores[t][k] = (uint16_t)value;
+        }
+        present[t] = 1;
+    }
+    return 1;
+}
+
+// 统计成绩历史占用的内存（字节）
+size_t history_memory(const History *history) {
+    size_t total = (size_t)history->capacity * sizeof(Term);
+    for (int t = 0; t < history->count; t++) {
+        const Term *term = &history->terms[t];
+        total += (size_t)term->blocks * (term->schema.count + 1) * sizeof(uint32_t);
+        for (int c = 0; c <= term->schema.count; c++) {
+            total += term->columns[c].capacity;
+        }
+    }
+    return total;
+}
@@ -0,0 +1,53 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include "student.h"
+#include "codec.h"
+
+#define HISTORY_FILENAME "students.hist"
+#define TERM_NAME_LEN 32
+#define HISTORY_BLOCK_ROWS 128      // 每块行数，块首学号完整存放，可按块随机访问
+#define HISTORY_KEYFRAME 8          // 每隔几个学期存一次绝对成绩，限制解码链长度
+
+// 一个已结转的学期：按学号排序后分列编码
+// 第0列为学号（块内前缀压缩），其余每科一列，存放与该生上一学期同科成绩之差（zigzag变长整数）；
+// 关键学期或上一学期没有该生时，差值相对于0
+typedef struct {
+    char name[TERM_NAME_LEN];       // 学期名，如"2024春"
+    Schema schema;                  // 结转时的科目设置
+    int keyframe;                   // 是否为关键学期
+    uint32_t rows;                  // 学生数
+    uint32_t blocks;                // 块数
+    uint32_t *offsets;              // 各列每块的起始字节：offsets[列 * blocks + 块]
+    ByteBuffer columns[MAX_SUBJECTS + 1];
+} Term;
+
+// 成绩历史
+typedef struct {
+    Term *terms;
+    int count;
+    int capacity;
+    int version;                    // 历史文件的格式版本（加载时没有文件为0）
+    long truncated;                 // 加载时截去的不完整末尾（字节），上次结转中断时留下
+} History;
+
+// 解码后的一个学期（按学号升序）
+typedef struct {
+    uint32_t rows;
+    char (*ids)[MAX_ID_LEN];
+    uint16_t *scores[MAX_SUBJECTS]; // 与所属学期的科目设置一致
+    int subject_count;
+} TermTable;
+
+// 函数声明
+void history_init(History *history);
+void history_free(History *history);
+int history_load(History *history, const char *filename);
+int history_close_term(History *history, const StudentSystem *system, const char *name, const char *filename);
+int history_find_term(const History *history, const char *name);
+int history_read_term(const History *history, int term, TermTable *table);
+void term_table_free(TermTable *table);
+int history_student(const History *history, const char *id, uint16_t (*scores)[MAX_SUBJECTS], uint8_t *present);
+size_t history_memory(const History *history);
+
+#endif
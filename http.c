@@ -0,0 +1,297 @@
+#define _POSIX_C_SOURCE 200809L
+#include "http.h"
+#include "config.h"
+#include "json.h"
+#include "query.h"
+#include "sortkey.h"
+#include <ctype.h>
+#include <strings.h>
+
+// 配置的HTTP端口，未设置或不正确时返回0（不启用）
+int http_port(void) {
+    char value[16];
+    if (!config_get("http_port", value, sizeof(value))) {
+        return 0;
+    }
+    int port = atoi(value);
+    return port > 0 && port < 65536 ? port : 0;
+}
+
+// 一行请求头（不含\r\n）是否为指定字段，是则返回值的起点
+static const char *header_value(const char *line, size_t length, const char *name) {
+    size_t n = strlen(name);
+    if (length <= n || strncasecmp(line, name, n) != 0 || line[n] != ':') {
+        return NULL;
+    }
+    const char *value = line + n + 1;
+    while (*value == ' ' || *value == '\t') {
+        value++;
+    }
+    return value;
+}
+
+// 检查完整的请求头（每行以\r\n结尾）：是否在响应后关闭连接，是否带有请求体（不支持）
+static void scan_headers(const char *head, size_t length, int *last, int *has_body) {
+    const char *end = head + length;
+    const char *line_end = memchr(head, '\r', length);
+    // HTTP/1.0 默认不保持连接
+    *last = line_end != NULL && line_end - head >= 8 && strncmp(line_end - 8, "HTTP/1.0", 8) == 0;
+    *has_body = 0;
+    for (const char *line = line_end + 2; line_end != NULL && line < end; line = line_end + 2) {
+        line_end = memchr(line, '\r', (size_t)(end - line));
+        size_t len = line_end != NULL ? (size_t)(line_end - line) : (size_t)(end - line);
+        const char *value;
+        if ((value = header_value(line, len, "Connection")) != NULL) {
+            if (strncasecmp(value, "close", 5) == 0) {
+                *last = 1;
+            } else if (strncasecmp(value, "keep-alive", 10) == 0) {
+                *last = 0;
+            }
+        } else if ((value = header_value(line, len, "Content-Length")) != NULL) {
+            *has_body |= atol(value) != 0;
+        } else if (header_value(line, len, "Transfer-Encoding") != NULL) {
+            *has_body = 1;
+        }
+    }
+}
+
+// 输入开头一个完整请求的长度（含结尾的空行），不完整返回0；
+// last置为该请求是否要求响应后关闭连接。带请求体时返回HTTP_INVALID，请求头过长时返回HTTP_TOO_LARGE
+size_t http_request_length(const uint8_t *data, size_t size, int *last) {
+    size_t limit = size < HTTP_MAX_REQUEST ? size : HTTP_MAX_REQUEST;
+    for (size_t i = 3; i < limit; i++) {
+        if (data[i] == '\n' && data[i - 1] == '\r' && data[i - 2] == '\n' && data[i - 3] == '\r') {
+            int has_body;
+            scan_headers((const char *)data, i + 1, last, &has_body);
+            return has_body ? HTTP_INVALID : i + 1;
+        }
+    }
+    return size < HTTP_MAX_REQUEST ? 0 : HTTP_TOO_LARGE;
+}
+
+// 写入状态行和响应头，Content-Length先留空位，返回空位的位置
+static size_t begin_response(Message *response, const char *status, int last) {
+    json_put_raw(response, "HTTP/1.1 ");
+    json_put_raw(response, status);
+    json_put_raw(response, "\r\nContent-Type: application/json; charset=utf-8\r\n");
+    if (last) {
+        json_put_raw(response, "Connection: close\r\n");
+    }
+    json_put_raw(response, "Content-Length:");
+    size_t field = response->bytes.size;
+    json_put_raw(response, "           \r\n\r\n");
+    return field;
+}
+
+// 响应体写完后填入Content-Length（数字右对齐，前面的空格是允许的空白）
+static void end_response(Message *response, size_t field) {
+    if (response->failed) {
+        return;
+    }
+    size_t width = 11;
+    size_t length = response->bytes.size - field - width - 4;
+    char *p = (char *)response->bytes.data + field + width;
+    do {
+        *--p = (char)('0' + length % 10);
+        length /= 10;
+    } while (length > 0);
+}
+
+static void respond_error(Message *response, const char *status, const char *message, int last) {
+    size_t field = begin_response(response, status, last);
+    json_put_raw(response, "{\"error\":");
+    json_put_string(response, message);
+    message_put_u8(response, '}');
+    end_response(response, field);
+}
+
+// 无法处理的请求（http_request_length返回HTTP_INVALID或HTTP_TOO_LARGE）：应答错误后关闭连接，
+// 之后的字节无法可靠地划分成请求
+void http_reject(size_t reason, Message *response) {
+    if (reason == HTTP_TOO_LARGE) {
+        respond_error(response, "413 Payload Too Large", "请求头过长", 1);
+    } else {
+        respond_error(response, "400 Bad Request", "不支持带请求体的请求", 1);
+    }
+}
+
+// 解码URL中的一段（%XX和+），放不下时返回0
+static int url_decode(const char *text, size_t length, char *out, size_t size) {
+    size_t n = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (n + 1 >= size) {
+            return 0;
+        }
+        char c = text[i];
+        if (c == '+') {
+            c = ' ';
+        } else if (c == '%' && i + 2 < length && isxdigit((unsigned char)text[i + 1])
+                   && isxdigit((unsigned char)text[i + 2])) {
+            char hex[3] = {text[i + 1], text[i + 2], '\0'};
+            c = (char)strtol(hex, NULL, 16);
+            i += 2;
+        }
+        out[n++] = c;
+    }
+    out[n] = '\0';
+    return 1;
+}
+
+// 取查询字符串中的参数，没有该参数或放不下时返回0
+static int query_param(const char *query, const char *name, char *value, size_t size) {
+    size_t n = strlen(name);
+    for (const char *p = query; p != NULL && *p != '\0';) {
+        const char *end = strchr(p, '&');
+        size_t len = end != NULL ? (size_t)(end - p) : strlen(p);
+        if (len > n && strncmp(p, name, n) == 0 && p[n] == '=') {
+            return url_decode(p + n + 1, len - n - 1, value, size);
+        }
+        p = end != NULL ? end + 1 : NULL;
+    }
+    return 0;
+}
+
+static void respond_student(StudentSystem *system, const char *id, int last, Message *response) {
+    int index = find_student_by_id(system, id);
+    if (index == -1) {
+        respond_error(response, "404 Not Found", "学生不存在", last);
+        return;
+    }
+    size_t field = begin_response(response, "200 OK", last);
+    json_put_student(response, system, index);
+    end_response(response, field);
+}
+
+static void respond_search(StudentSystem *system, const char *query, int last, Message *response) {
+    char text[HTTP_MAX_REQUEST];
+    if (!query_param(query, "q", text, sizeof(text))) {
+        respond_error(response, "400 Bad Request", "缺少查询条件 q", last);
+        return;
+    }
+    Query compiled;
+    Selection selection;
+    if (!query_compile(&compiled, &system->schema, text)) {
+        respond_error(response, "400 Bad Request", compiled.error, last);
+        return;
+    }
+    if (!query_execute(&compiled, system, &selection)) {
+        respond_error(response, "500 Internal Server Error", "内存不足", last);
+        return;
+    }
+    size_t field = begin_response(response, "200 OK", last);
+    json_put_raw(response, "{\"count\":");
+    json_put_int(response, selection_count(&selection));
+    json_put_raw(response, ",\"students\":[");
+    int first = 1;
+    for (int i = 0; i < selection.count; i++) {
+        if (selection_test(&selection, i)) {
+            if (!first) {
+                message_put_u8(response, ',');
+            }
+            json_put_student(response, system, i);
+            first = 0;
+        }
+    }
+    json_put_raw(response, "]}");
+    end_response(response, field);
+    selection_free(&selection);
+}
+
+static void respond_top(StudentSystem *system, const char *query, int last, Message *response) {
+    char value[HTTP_MAX_REQUEST];
+    int n = HTTP_TOP_DEFAULT;
+    if (query_param(query, "n", value, sizeof(value))) {
+        n = atoi(value);
+        if (n < 1 || n > HTTP_TOP_MAX) {
+            respond_error(response, "400 Bad Request", "n 应在 1 到 1000 之间", last);
+            return;
+        }
+    }
+    SortSpec spec;
+    if (!query_param(query, "by", value, sizeof(value))) {
+        snprintf(value, sizeof(value), "%s", HTTP_TOP_ORDER);
+    }
+    if (!sort_spec_parse(&spec, &system->schema, value)) {
+        respond_error(response, "400 Bad Request", spec.error, last);
+        return;
+    }
+    // 只选出前n名，不排序整个名单
+    uint32_t order[HTTP_TOP_MAX];
+    n = sort_top(system, &spec, order, n);
+    size_t field = begin_response(response, "200 OK", last);
+    json_put_raw(response, "{\"count\":");
+    json_put_int(response, n);
+    json_put_raw(response, ",\"students\":[");
+    for (int i = 0; i < n; i++) {
+        if (i > 0) {
+            message_put_u8(response, ',');
+        }
+        json_put_student(response, system, (int)order[i]);
+    }
+    json_put_raw(response, "]}");
+    end_response(response, field);
+}
+
+// 处理一个完整的请求（http_request_length划出的），把完整的HTTP响应写入response
+void http_respond(RosterVersion *version, Replica *replica, const char *request, size_t length,
+                  Message *response) {
+    int last, has_body;
+    scan_headers(request, length, &last, &has_body);
+
+    // 请求行：方法 目标 版本
+    char target[HTTP_MAX_REQUEST];
+    const char *line_end = memchr(request, '\r', length);
+    const char *space = memchr(request, ' ', length);
+    const char *target_end = space != NULL && line_end != NULL
+                             ? memchr(space + 1, ' ', (size_t)(line_end - space - 1)) : NULL;
+    if (target_end == NULL) {
+        respond_error(response, "400 Bad Request", "请求行格式不正确", last);
+        return;
+    }
+    if (space - request != 3 || strncmp(request, "GET", 3) != 0) {
+        respond_error(response, "405 Method Not Allowed", "只支持GET", last);
+        return;
+    }
+    size_t target_length = (size_t)(target_end - space - 1);
+    memcpy(target, space + 1, target_length);
+    target[target_length] = '\0';
+    char *query = strchr(target, '?');
+    if (query != NULL) {
+        *query++ = '\0';
+    }
+
+    StudentSystem *system = &version->system;
+    if (strncmp(target, "/students/", 10) == 0) {
+        char id[MAX_ID_LEN];
+        if (!url_decode(target + 10, strlen(target + 10), id, sizeof(id))) {
+            respond_error(response, "404 Not Found", "学生不存在", last);
+        } else {
+            respond_student(system, id, last, response);
+        }
+    } else if (strcmp(target, "/search") == 0) {
+        respond_search(system, query, last, response);
+    } else if (strcmp(target, "/top") == 0) {
+        respond_top(system, query, last, response);
+    } else if (strcmp(target, "/replication") == 0) {
+        if (replica == NULL) {
+            respond_error(response, "404 Not Found", "不是只读副本", last);
+            return;
+        }
+        ReplicaStatus status;
+        replica_status(replica, &status);
+        size_t field = begin_response(response, "200 OK", last);
+        json_put_replica(response, &status);
+        end_response(response, field);
+    } else if (strcmp(target, "/stats") == 0) {
+        const Statistics *stats = version_statistics(version);
+        if (stats == NULL) {
+            respond_error(response, "500 Internal Server Error", "内存不足", last);
+            return;
+        }
+        size_t field = begin_response(response, "200 OK", last);
+        json_put_statistics(response, &system->schema, stats);
+        end_response(response, field);
+    } else {
+        respond_error(response, "404 Not Found", "没有这个接口", last);
+    }
+}
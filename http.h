@@ -0,0 +1,29 @@
+#ifndef HTTP_H
+#define HTTP_H
+
+#include "shared.h"
+#include "protocol.h"
+
+#define HTTP_MAX_REQUEST 8192       // 请求头的最大长度
+#define HTTP_INVALID ((size_t)-1)   // http_request_length：请求格式不正确（带请求体），应答400
+#define HTTP_TOO_LARGE ((size_t)-2) // http_request_length：请求头过长，应答413
+#define HTTP_TOP_DEFAULT 10         // /top 默认返回的学生数
+#define HTTP_TOP_MAX 1000
+#define HTTP_TOP_ORDER "average desc, id asc" // /top 默认的排序规则
+
+// 服务模式的HTTP/JSON接口，只监听本机（127.0.0.1），端口由配置项 http_port 设置，未设置时不启用。
+// 只支持不带请求体的GET：
+//   /students/{学号}      一名学生
+//   /search?q=条件         符合条件的学生（条件语法同 search 命令，需URL编码）
+//   /stats                统计结果
+//   /top?n=10&by=排序规则  排在最前的n名学生（排序规则同 sort 命令，默认按平均分从高到低）
+//   /replication          复制状态（只读副本，见 replica.h）
+
+// 函数声明
+int http_port(void);
+size_t http_request_length(const uint8_t *data, size_t size, int *last);
+void http_reject(size_t reason, Message *response);
+void http_respond(RosterVersion *version, Replica *replica, const char *request, size_t length,
+                  Message *response);
+
+#endif
@@ -0,0 +1,743 @@
+#define _POSIX_C_SOURCE 200809L
+#include "import.h"
+#include "fileio.h"
+#include "parallel.h"
+#include "changefeed.h"
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+// 表头中各列的含义：科目列为科目下标（>=0）
+#define COLUMN_ID (-1)
+#define COLUMN_NAME (-2)
+#define COLUMN_AGE (-3)
+#define COLUMN_SKIP (-4)            // 平均分，导入时按科目设置重新计算
+#define MAX_COLUMNS (MAX_SUBJECTS + 4)
+
+// 一条有效记录，学号和姓名指向批中的文本
+typedef struct {
+    const char *id;
+    const char *name;
+    int age;
+} ImportRow;
+
+// 一批：读入的文本和解析出的有效记录，缓冲区随批重复使用
+typedef struct {
+    char *text;                     // IMPORT_BATCH 字节，另加结尾的'\0'
+    size_t length;
+    ImportRow *rows;
+    uint16_t *scores;               // 每条记录 schema.count 个定点成绩
+    int count;                      // 有效记录数
+    int capacity;
+    int records;                    // 记录数（含无效记录）
+    int invalid;
+    int invalid_at[IMPORT_REPORT_ROWS]; // 无效记录在批中的序号（从0开始）
+    const char *invalid_reasons[IMPORT_REPORT_ROWS];
+} Batch;
+
+// 输入结束的标记：读取线程放入各解析线程的输入队列，解析线程原样转给插入
+static Batch end_of_input;
+
+// 单生产者单消费者的无锁环形队列：head 只由消费者修改，tail 只由生产者修改，分开放在不同的缓存行
+typedef struct {
+    Batch **slots;
+    unsigned mask;
+    char pad0[64];
+    unsigned head;
+    char pad1[64];
+    unsigned tail;
+    char pad2[64];
+} Ring;
+
+typedef struct Import Import;
+
+// 解析线程
+typedef struct {
+    Import *import;
+    pthread_t thread;
+    Ring input;                     // 读取线程 -> 本线程
+    Ring output;                    // 本线程 -> 插入
+    ImportStage stage;
+} Worker;
+
+struct Import {
+    FILE *file;
+    const Schema *schema;
+    int columns[MAX_COLUMNS];
+    int column_count;
+    Worker *workers;
+    int worker_count;
+    Batch *batches;                 // 全部的批，数目固定
+    int batch_count;
+    Ring free_batches;              // 插入 -> 读取线程：处理完的批
+    char *carry;                    // 读取线程：上一批末尾不完整的记录
+    int stop;                       // 插入出错，读取线程提前结束（原子读写）
+    int status;                     // 读取结果 FILE_*
+    char error[128];
+    ImportStage read_stage;
+    pthread_t reader;
+};
+
+// 当前时间（秒，单调时钟）
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int ring_init(Ring *ring, unsigned capacity) {
+    unsigned size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    memset(ring, 0, sizeof(*ring));
+    ring->slots = malloc(size * sizeof(Batch *));
+    ring->mask = size - 1;
+    return ring->slots != NULL;
+}
+
+static int ring_try_push(Ring *ring, Batch *batch) {
+    unsigned tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    if (tail - __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) > ring->mask) {
+        return 0;
+    }
+    ring->slots[tail & ring->mask] = batch;
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+static Batch *ring_try_pop(Ring *ring) {
+    unsigned head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    if (head == __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE)) {
+        return NULL;
+    }
+    Batch *batch = ring->slots[head & ring->mask];
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    return batch;
+}
+
+// 队列暂时满或空时等待：先让出处理器，仍未就绪再短暂休眠
+static void backoff(unsigned *tries) {
+    if (++*tries < 16) {
+        sched_yield();
+    } else {
+        struct timespec pause = {0, 20000};
+        nanosleep(&pause, NULL);
+    }
+}
+
+// 放入队列，满时等待，等待的时间计入waited
+static void ring_push(Ring *ring, Batch *batch, double *waited) {
+    if (ring_try_push(ring, batch)) {
+        return;
+    }
+    double start = now_seconds();
+    unsigned tries = 0;
+    while (!ring_try_push(ring, batch)) {
+        backoff(&tries);
+    }
+    *waited += now_seconds() - start;
+}
+
+// 从队列取出，空时等待，等待的时间计入waited
+static Batch *ring_pop(Ring *ring, double *waited) {
+    Batch *batch = ring_try_pop(ring);
+    if (batch != NULL) {
+        return batch;
+    }
+    double start = now_seconds();
+    unsigned tries = 0;
+    while ((batch = ring_try_pop(ring)) == NULL) {
+        backoff(&tries);
+    }
+    *waited += now_seconds() - start;
+    return batch;
+}
+
+// 拆分一条记录：各字段就地去掉引号并以'\0'结尾，最多保存max个；返回下一条记录的开始。
+// 字段数记入count（超过max时也照常计数）
+static char *split_record(char *p, char **fields, int max, int *count) {
+    int n = 0;
+    for (;;) {
+        char *field = p;
+        char *out = p;
+        if (*p == '"') {
+            p++;
+            while (*p != '\0') {
+                if (*p == '"' && p[1] == '"') {
+                    *out++ = '"';
+                    p += 2;
+                } else if (*p == '"') {
+                    p++;
+                    break;
+                } else {
+                    *out++ = *p++;
+                }
+            }
+        }
+        while (*p != '\0' && *p != ',' && *p != '\n' && *p != '\r') {
+            *out++ = *p++;
+        }
+        char delimiter = *p;
+        *out = '\0';
+        if (n < max) {
+            fields[n] = field;
+        }
+        n++;
+        if (delimiter == ',') {
+            p++;
+            continue;
+        }
+        if (delimiter == '\r' && p[1] == '\n') {
+            p += 2;
+        } else if (delimiter != '\0') {
+            p++;
+        }
+        *count = n;
+        return p;
+    }
+}
+
+// 读出表头，确定各列的含义；出错时原因写入error
+static int read_header(Import *import, const Schema *schema, char *error, size_t size) {
+    char *line = NULL;
+    size_t capacity = 0;
+    if (getline(&line, &capacity, import->file) <= 0) {
+        free(line);
+        snprintf(error, size, "文件为空");
+        return 0;
+    }
+    char *text = strncmp(line, "\xEF\xBB\xBF", 3) == 0 ? line + 3 : line;  // 跳过UTF-8 BOM
+    char *fields[MAX_COLUMNS];
+    int count;
+    split_record(text, fields, MAX_COLUMNS, &count);
+    int ok = count <= MAX_COLUMNS;
+    if (!ok) {
+        snprintf(error, size, "表头的列数过多");
+    }
+
+    int seen[MAX_SUBJECTS] = {0};
+    int id = 0, name = 0, age = 0;
+    for (int c = 0; ok && c < count; c++) {
+        const char *field = fields[c];
+        int column, *flag;
+        if (strcmp(field, "id") == 0 || strcmp(field, "学号") == 0) {
+            column = COLUMN_ID;
+            flag = &id;
+        } else if (strcmp(field, "name") == 0 || strcmp(field, "姓名") == 0) {
+            column = COLUMN_NAME;
+            flag = &name;
+        } else if (strcmp(field, "age") == 0 || strcmp(field, "年龄") == 0) {
+            column = COLUMN_AGE;
+            flag = &age;
+        } else if (strcmp(field, "average") == 0 || strcmp(field, "平均分") == 0) {
+            import->columns[c] = COLUMN_SKIP;
+            continue;
+        } else if ((column = schema_find(schema, field)) >= 0) {
+            flag = &seen[column];
+        } else {
+            snprintf(error, size, "表头中的“%.40s”不是学号、姓名、年龄或科目", field);
+            ok = 0;
+            break;
+        }
+        if (*flag) {
+            snprintf(error, size, "表头中的“%.40s”重复", field);
+            ok = 0;
+        }
+        *flag = 1;
+        import->columns[c] = column;
+    }
+    if (ok && (!id || !name || !age)) {
+        snprintf(error, size, "表头缺少学号、姓名或年龄");
+        ok = 0;
+    }
+    for (int k = 0; ok && k < schema->count; k++) {
+        if (!seen[k]) {
+            snprintf(error, size, "表头缺少科目“%s”", subject_label(schema, k));
+            ok = 0;
+        }
+    }
+    import->column_count = count;
+    free(line);
+    return ok;
+}
+
+// 最后一条完整记录之后的位置（引号内的换行不是记录的结尾），没有完整的记录时返回0
+static size_t record_boundary(const char *text, size_t length) {
+    if (memchr(text, '"', length) == NULL) {
+        for (size_t i = length; i > 0; i--) {
+            if (text[i - 1] == '\n') {
+                return i;
+            }
+        }
+        return 0;
+    }
+    size_t cut = 0;
+    int quoted = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (text[i] == '"') {
+            quoted = !quoted;
+        } else if (text[i] == '\n' && !quoted) {
+            cut = i + 1;
+        }
+    }
+    return cut;
+}
+
+// 读取线程：取空闲的批读入文件，依次轮流交给各解析线程，最后给每个解析线程一个结束标记
+static void *reader_main(void *arg) {
+    Import *import = arg;
+    ImportStage *stage = &import->read_stage;
+    double start = now_seconds();
+    size_t carried = 0;
+    unsigned long sequence = 0;
+    while (!__atomic_load_n(&import->stop, __ATOMIC_RELAXED)) {
+        Batch *batch = ring_pop(&import->free_batches, &stage->blocked);
+        memcpy(batch->text, import->carry, carried);
+        size_t wanted = IMPORT_BATCH - carried;
+        size_t n = fread(batch->text + carried, 1, wanted, import->file);
+        if (n < wanted && ferror(import->file)) {
+            import->status = FILE_READ_ERROR;
+            snprintf(import->error, sizeof(import->error), "读取文件出错");
+            break;
+        }
+        size_t length = carried + n;
+        int at_end = n < wanted;
+        if (length == 0) {
+            break;
+        }
+        size_t cut = at_end ? length : record_boundary(batch->text, length);
+        if (cut == 0) {
+            import->status = FILE_READ_ERROR;
+            snprintf(import->error, sizeof(import->error), "有记录超过 %d KB", IMPORT_BATCH / 1024);
+            break;
+        }
+        carried = length - cut;
+        memcpy(import->carry, batch->text + cut, carried);
+        batch->length = cut;
+        batch->text[cut] = '\0';
+        stage->batches++;
+        stage->bytes += cut;
+        ring_push(&import->workers[sequence % import->worker_count].input, batch, &stage->blocked);
+        sequence++;
+        if (at_end) {
+            break;
+        }
+    }
+    for (int i = 0; i < import->worker_count; i++) {
+        ring_push(&import->workers[(sequence + i) % import->worker_count].input, &end_of_input, &stage->blocked);
+    }
+    stage->busy = now_seconds() - start - stage->starved - stage->blocked;
+    return NULL;
+}
+
+// 校验一条记录的各字段，有效时填入row和scores并返回NULL，否则返回原因
+static const char *parse_row(const Import *import, char **fields, int count, ImportRow *row, uint16_t *scores) {
+    if (count != import->column_count) {
+        return "字段数与表头不一致";
+    }
+    for (int c = 0; c < count; c++) {
+        char *field = fields[c];
+        char *end;
+        switch (import->columns[c]) {
+        case COLUMN_ID:
+            if (!is_valid_id(field)) {
+                return "学号格式不正确";
+            }
+            row->id = field;
+            break;
+        case COLUMN_NAME:
+            if (field[0] == '\0' || strlen(field) >= MAX_NAME_LEN) {
+                return "姓名为空或过长";
+            }
+            row->name = field;
+            break;
+        case COLUMN_AGE: {
+            long age = strtol(field, &end, 10);
+            if (end == field || *end != '\0' || age < 1 || age > 150) {
+                return "年龄不正确";
+            }
+            row->age = (int)age;
+            break;
+        }
+        case COLUMN_SKIP:
+            break;
+        default: {
+            float score = strtof(field, &end);
+            if (end == field || *end != '\0' || !is_valid_score(score)) {
+                return "成绩不正确";
+            }
+            scores[import->columns[c]] = score_to_fixed(score);
+            break;
+        }
+        }
+    }
+    return NULL;
+}
+
+// 有效记录的空间不足时扩充
+static int grow_batch(Batch *batch, int subjects) {
+    int capacity = batch->capacity > 0 ? batch->capacity * 2 : 1024;
+    ImportRow *rows = realloc(batch->rows, capacity * sizeof(ImportRow));
+    if (rows == NULL) {
+        return 0;
+    }
+    batch->rows = rows;
+    uint16_t *scores = realloc(batch->scores, (size_t)capacity * subjects * sizeof(uint16_t));
+    if (scores == NULL) {
+        return 0;
+    }
+    batch->scores = scores;
+    batch->capacity = capacity;
+    return 1;
+}
+
+// 解析一批中的全部记录（空行跳过）
+static void parse_batch(const Import *import, Batch *batch) {
+    int subjects = import->schema->count;
+    batch->count = batch->records = batch->invalid = 0;
+    char *p = batch->text;
+    char *end = batch->text + batch->length;
+    while (p < end) {
+        char *fields[MAX_COLUMNS];
+        int count;
+        char *next = split_record(p, fields, MAX_COLUMNS, &count);
+        p = next;
+        if (count == 1 && fields[0][0] == '\0') {
+            continue;
+        }
+        const char *reason;
+        if (batch->count == batch->capacity && !grow_batch(batch, subjects)) {
+            reason = "内存不足";
+        } else {
+            reason = parse_row(import, fields, count, &batch->rows[batch->count],
+                               &batch->scores[(size_t)batch->count * subjects]);
+        }
+        if (reason == NULL) {
+            batch->count++;
+        } else {
+            if (batch->invalid < IMPORT_REPORT_ROWS) {
+                batch->invalid_at[batch->invalid] = batch->records;
+                batch->invalid_reasons[batch->invalid] = reason;
+            }
+            batch->invalid++;
+        }
+        batch->records++;
+    }
+}
+
+// 解析线程：依次解析输入队列中的批，放入输出队列；转交结束标记后退出
+static void *worker_main(void *arg) {
+    Worker *worker = arg;
+    ImportStage *stage = &worker->stage;
+    double start = now_seconds();
+    for (;;) {
+        Batch *batch = ring_pop(&worker->input, &stage->starved);
+        if (batch != &end_of_input) {
+            parse_batch(worker->import, batch);
+            stage->batches++;
+            stage->records += (unsigned long)batch->records;
+            stage->bytes += batch->length;
+        }
+        ring_push(&worker->output, batch, &stage->blocked);
+        if (batch == &end_of_input) {
+            break;
+        }
+    }
+    stage->busy = now_seconds() - start - stage->starved - stage->blocked;
+    return NULL;
+}
+
+// 学号散列表（开放寻址），保存已有学生的下标，插入时用来排除已存在的学号
+typedef struct {
+    int *slots;                     // 学生下标，-1为空
+    uint32_t mask;
+} IdSet;
+
+// FNV-1a 32位哈希
+static uint32_t hash_id(const char *id) {
+    uint32_t h = 2166136261u;
+    for (const unsigned char *p = (const unsigned char *)id; *p; p++) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void id_set_put(IdSet *set, const StudentSystem *system, int index) {
+    uint32_t h = hash_id(student_id_at(system, index)) & set->mask;
+    while (set->slots[h] != -1) {
+        h = (h + 1) & set->mask;
+    }
+    set->slots[h] = index;
+}
+
+static int id_set_find(const IdSet *set, const StudentSystem *system, const char *id) {
+    for (uint32_t h = hash_id(id) & set->mask; set->slots[h] != -1; h = (h + 1) & set->mask) {
+        if (strcmp(student_id_at(system, set->slots[h]), id) == 0) {
+            return set->slots[h];
+        }
+    }
+    return -1;
+}
+
+// 保证能再容纳一名学生（装载率不超过一半），扩充时按全部学生重建
+static int id_set_reserve(IdSet *set, const StudentSystem *system) {
+    uint32_t wanted = (uint32_t)(system->count + 1) * 2;
+    if (set->slots != NULL && wanted <= set->mask + 1) {
+        return 1;
+    }
+    uint32_t size = 1024;
+    while (size < wanted * 2) {
+        size <<= 1;
+    }
+    int *slots = malloc(size * sizeof(int));
+    if (slots == NULL) {
+        return 0;
+    }
+    free(set->slots);
+    set->slots = slots;
+    set->mask = size - 1;
+    memset(slots, 0xff, size * sizeof(int));
+    for (int i = 0; i < system->count; i++) {
+        id_set_put(set, system, i);
+    }
+    return 1;
+}
+
+// 插入一批中的有效记录，已存在的学号跳过；内存不足返回0。
+// 插入时不逐条写变更流，插入后整批一次写入（每条变更各加锁写文件时，插入会被系统调用拖慢）
+static int insert_batch(StudentSystem *system, IdSet *ids, const Batch *batch, ImportReport *report) {
+    for (int i = 0; i < batch->invalid && i < IMPORT_REPORT_ROWS; i++) {
+        if (report->invalid + i < IMPORT_REPORT_ROWS) {
+            report->invalid_rows[report->invalid + i] = report->records + batch->invalid_at[i] + 1;
+            report->invalid_reasons[report->invalid + i] = batch->invalid_reasons[i];
+        }
+    }
+    report->invalid += batch->invalid;
+    report->records += batch->records;
+
+    int subjects = system->schema.count;
+    int first = system->count;
+    int ok = 1;
+    struct ChangeFeed *changes = system->changes;
+    system->changes = NULL;
+    for (int i = 0; ok && i < batch->count; i++) {
+        const ImportRow *row = &batch->rows[i];
+        if (id_set_find(ids, system, row->id) >= 0) {
+            report->duplicates++;
+            continue;
+        }
+        Student s;
+        s.id = row->id;
+        s.name = row->name;
+        s.age = row->age;
+        for (int k = 0; k < subjects; k++) {
+            s.scores[k] = fixed_to_score(batch->scores[(size_t)i * subjects + k]);
+        }
+        calculate_average(&system->schema, &s);
+        if (!id_set_reserve(ids, system) || !append_student(system, &s)) {
+            ok = 0;
+            break;
+        }
+        id_set_put(ids, system, system->count - 1);
+        report->inserted++;
+    }
+    system->changes = changes;
+    changes_insert_range(system, first, system->count - first);
+    return ok;
+}
+
+// 释放全部的批和队列
+static void free_import(Import *import) {
+    for (int i = 0; i < import->batch_count; i++) {
+        free(import->batches[i].text);
+        free(import->batches[i].rows);
+        free(import->batches[i].scores);
+    }
+    free(import->batches);
+    for (int i = 0; i < import->worker_count; i++) {
+        free(import->workers[i].input.slots);
+        free(import->workers[i].output.slots);
+    }
+    free(import->workers);
+    free(import->free_batches.slots);
+    free(import->carry);
+}
+
+// 分配队列和固定数目的批：每个解析线程两批（一批在解析，一批排队），读取和插入各一批
+static int setup_import(Import *import, int workers) {
+    import->workers = calloc((size_t)workers, sizeof(Worker));
+    import->batch_count = workers * 2 + 2;
+    import->batches = calloc((size_t)import->batch_count, sizeof(Batch));
+    import->carry = malloc(IMPORT_BATCH);
+    if (import->workers == NULL || import->batches == NULL || import->carry == NULL) {
+        import->batch_count = 0;
+        return 0;
+    }
+    import->worker_count = workers;
+    int ok = ring_init(&import->free_batches, (unsigned)import->batch_count);
+    for (int i = 0; i < workers; i++) {
+        import->workers[i].import = import;
+        import->workers[i].stage.threads = 1;
+        ok = ring_init(&import->workers[i].input, IMPORT_RING) && ok;
+        ok = ring_init(&import->workers[i].output, IMPORT_RING) && ok;
+    }
+    for (int i = 0; ok && i < import->batch_count; i++) {
+        import->batches[i].text = malloc(IMPORT_BATCH + 1);
+        ok = import->batches[i].text != NULL && ring_try_push(&import->free_batches, &import->batches[i]);
+    }
+    return ok;
+}
+
+// 从CSV文件导入学生（见 import.h），workers为解析线程数，0为按CPU核数；
+// 成功返回FILE_OK（无效记录和已存在的学号跳过，见report）；失败时原因写入report->error，
+// 已插入的学生全部撤销，数据恢复为导入前
+int import_csv(StudentSystem *system, const char *filename, int workers, ImportReport *report) {
+    memset(report, 0, sizeof(*report));
+    if (workers <= 0) {
+        workers = parallel_threads() > 2 ? parallel_threads() - 2 : 1;
+    }
+    if (workers > PARALLEL_MAX_THREADS) {
+        workers = PARALLEL_MAX_THREADS;
+    }
+
+    Import import;
+    memset(&import, 0, sizeof(import));
+    import.schema = &system->schema;
+    import.file = fileio_open(filename, "r");
+    if (import.file == NULL) {
+        snprintf(report->error, sizeof(report->error), "无法打开文件");
+        return FILE_NOT_FOUND;
+    }
+    if (!read_header(&import, &system->schema, report->error, sizeof(report->error))) {
+        fclose(import.file);
+        return FILE_READ_ERROR;
+    }
+    Snapshot before;
+    if (!take_snapshot(system, &before)) {
+        fclose(import.file);
+        snprintf(report->error, sizeof(report->error), "内存不足");
+        return FILE_TOO_LARGE;
+    }
+    if (!setup_import(&import, workers)) {
+        release_snapshot(&before);
+        free_import(&import);
+        fclose(import.file);
+        snprintf(report->error, sizeof(report->error), "内存不足");
+        return FILE_TOO_LARGE;
+    }
+
+    // 解析线程未能全部创建时只用已创建的；读取线程无法创建时放弃
+    double start = now_seconds();
+    int started = 0;
+    while (started < workers && pthread_create(&import.workers[started].thread, NULL, worker_main,
+                                               &import.workers[started]) == 0) {
+        started++;
+    }
+    import.worker_count = started;
+    int reading = started > 0 && pthread_create(&import.reader, NULL, reader_main, &import) == 0;
+    if (!reading) {
+        for (int i = 0; i < started; i++) {
+            ring_push(&import.workers[i].input, &end_of_input, &import.read_stage.blocked);
+            pthread_join(import.workers[i].thread, NULL);
+        }
+        import.worker_count = workers;
+        free_import(&import);
+        fclose(import.file);
+        release_snapshot(&before);
+        snprintf(report->error, sizeof(report->error), "无法创建线程");
+        return FILE_TOO_LARGE;
+    }
+
+    // 插入：按读取时的顺序轮流取各解析线程的输出，出错后不再插入，只把批交还读取线程直到结束
+    ImportStage *stage = &report->stages[IMPORT_INSERT];
+    IdSet ids = {NULL, 0};
+    int failed = !id_set_reserve(&ids, system);
+    for (unsigned long sequence = 0;; sequence++) {
+        Batch *batch = ring_pop(&import.workers[sequence % started].output, &stage->starved);
+        if (batch == &end_of_input) {
+            break;
+        }
+        if (!failed && !insert_batch(system, &ids, batch, report)) {
+            failed = 1;
+            __atomic_store_n(&import.stop, 1, __ATOMIC_RELAXED);
+        }
+        stage->batches++;
+        stage->records += (unsigned long)batch->records;
+        stage->bytes += batch->length;
+        ring_push(&import.free_batches, batch, &stage->blocked);
+    }
+    stage->threads = 1;
+    stage->busy = now_seconds() - start - stage->starved - stage->blocked;
+    free(ids.slots);
+
+    pthread_join(import.reader, NULL);
+    for (int i = 0; i < started; i++) {
+        pthread_join(import.workers[i].thread, NULL);
+        ImportStage *parse = &report->stages[IMPORT_PARSE];
+        const ImportStage *own = &import.workers[i].stage;
+        parse->threads++;
+        parse->batches += own->batches;
+        parse->records += own->records;
+        parse->bytes += own->bytes;
+        parse->busy += own->busy;
+        parse->starved += own->starved;
+        parse->blocked += own->blocked;
+    }
+    report->stages[IMPORT_READ] = import.read_stage;
+    report->stages[IMPORT_READ].threads = 1;
+    report->seconds = now_seconds() - start;
+
+    int status = failed ? FILE_TOO_LARGE : import.status;
+    if (failed) {
+        snprintf(report->error, sizeof(report->error), "内存不足");
+    } else if (status != FILE_OK) {
+        snprintf(report->error, sizeof(report->error), "%s", import.error);
+    }
+    if (status != FILE_OK && report->inserted > 0) {
+        report->rolled_back = restore_snapshot(system, &before);
+    }
+    release_snapshot(&before);
+    import.worker_count = workers;
+    free_import(&import);
+    fclose(import.file);
+    return status;
+}
+
+// 输出导入结果和各阶段的计数：处理时间占比最高的阶段即为瓶颈
+void print_import_report(FILE *out, const ImportReport *report) {
+    static const char *const names[IMPORT_STAGES] = {"读取", "解析校验", "插入"};
+    fprintf(out, "已导入 %d 名学生（共 %d 条记录，学号已存在 %d 条，格式不正确 %d 条），用时 %.2f 秒。\n",
+            report->inserted, report->records, report->duplicates, report->invalid, report->seconds);
+    for (int i = 0; i < report->invalid && i < IMPORT_REPORT_ROWS; i++) {
+        fprintf(out, "  第 %d 条记录：%s\n", report->invalid_rows[i], report->invalid_reasons[i]);
+    }
+    if (report->invalid > IMPORT_REPORT_ROWS) {
+        fprintf(out, "  ……\n");
+    }
+
+    fprintf(out, "各阶段（处理 / 等待上游 / 等待下游，占线程时间的比例）：\n");
+    int bottleneck = 0;
+    double highest = -1;
+    for (int s = 0; s < IMPORT_STAGES; s++) {
+        const ImportStage *stage = &report->stages[s];
+        double total = stage->busy + stage->starved + stage->blocked;
+        double share = total > 0 ? stage->busy / total : 0;
+        fprintf(out, "  %s：%d 个线程，%lu 批，%.1f MB，处理 %.0f%% / %.0f%% / %.0f%%", names[s], stage->threads,
+                stage->batches, stage->bytes / 1048576.0, share * 100,
+                total > 0 ? stage->starved / total * 100 : 0, total > 0 ? stage->blocked / total * 100 : 0);
+        if (stage->busy <= 0) {
+            fprintf(out, "\n");
+        } else if (s == IMPORT_READ) {
+            fprintf(out, "，每线程 %.1f MB/秒\n", stage->bytes / 1048576.0 / stage->busy);
+        } else {
+            fprintf(out, "，每线程 %.0f 条/秒\n", stage->records / stage->busy);
+        }
+        if (share > highest) {
+            highest = share;
+            bottleneck = s;
+        }
+    }
+    fprintf(out, "瓶颈：%s（处理时间占比最高）\n", names[bottleneck]);
+}
@@ -0,0 +1,53 @@
+#ifndef IMPORT_H
+#define IMPORT_H
+
+#include "student.h"
+
+#define IMPORT_BATCH (256 * 1024)   // 每批读入的字节数（只含完整的记录，单条记录不能超过此长度）
+#define IMPORT_RING 4               // 各环形队列的槽位数
+#define IMPORT_REPORT_ROWS 8        // 最多报告的无效记录数
+
+// 从CSV文件（与 export 的格式相同，第一行为表头）批量导入学生，分为三个阶段同时进行：
+// 读取线程按批读入文件，每批在最后一条完整记录处截断，余下部分留给下一批；
+// N 个解析线程拆分字段并校验学号、姓名、年龄和成绩，把有效记录转为定点成绩；
+// 插入在调用线程中进行，只有它修改数据（同时维护学号过滤器、排序视图和变更流）。
+// 各批依次轮流交给各解析线程，每个解析线程的输入和输出各是一个单生产者单消费者的无锁环形队列，
+// 插入按同样的顺序轮流取出，结果与顺序导入相同（文件中靠前的记录先插入）。
+// 批的缓冲区有固定的数目，插入处理完后交还读取线程重复使用：下游处理不过来时上游等待，内存占用与文件大小无关
+enum {
+    IMPORT_READ,
+    IMPORT_PARSE,
+    IMPORT_INSERT,
+    IMPORT_STAGES
+};
+
+// 一个阶段的计数（多个线程时为合计），时间以秒为单位
+typedef struct {
+    int threads;
+    unsigned long batches;
+    unsigned long records;          // 读取阶段不分记录，为0
+    unsigned long long bytes;
+    double busy;                    // 处理
+    double starved;                 // 等待上游（输入队列为空）
+    double blocked;                 // 等待下游（输出队列已满或没有空闲的批）
+} ImportStage;
+
+// 导入结果
+typedef struct {
+    int records;                    // 记录数（不含表头和空行）
+    int inserted;
+    int duplicates;                 // 学号已存在（或文件中重复）而跳过的记录
+    int invalid;                    // 格式不正确而跳过的记录
+    int invalid_rows[IMPORT_REPORT_ROWS]; // 无效记录的序号（从1开始，不含表头）
+    const char *invalid_reasons[IMPORT_REPORT_ROWS];
+    double seconds;
+    ImportStage stages[IMPORT_STAGES];
+    int rolled_back;                // 导入失败，已插入的学生已撤销（数据恢复为导入前）
+    char error[128];                // 导入失败的原因
+} ImportReport;
+
+// 函数声明
+int import_csv(StudentSystem *system, const char *filename, int workers, ImportReport *report);
+void print_import_report(FILE *out, const ImportReport *report);
+
+#endif
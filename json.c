@@ -0,0 +1,163 @@
+#include "json.h"
+
+void json_put_raw(Message *message, const char *text) {
+    message_put(message, text, strlen(text));
+}
+
+void json_put_string(Message *message, const char *text) {
+    static const char hex[] = "0123456789abcdef";
+    message_put_u8(message, '"');
+    const char *run = text;             // 尚未写出的、无需转义的一段
+    for (const char *p = text; *p != '\0'; p++) {
+        unsigned char c = (unsigned char)*p;
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        message_put(message, run, (size_t)(p - run));
+        char escape[6] = {'\\', (char)c, 0, 0, 0, 0};
+        size_t len = 2;
+        if (c == '\n') {
+            escape[1] = 'n';
+        } else if (c == '\t') {
+            escape[1] = 't';
+        } else if (c == '\r') {
+            escape[1] = 'r';
+        } else if (c < 0x20) {
+            memcpy(escape + 1, "u00", 3);
+            escape[4] = hex[c >> 4];
+            escape[5] = hex[c & 15];
+            len = 6;
+        }
+        message_put(message, escape, len);
+        run = p + 1;
+    }
+    message_put(message, run, strlen(run));
+    message_put_u8(message, '"');
+}
+
+void json_put_int(Message *message, long long value) {
+    char digits[24];
+    int pos = sizeof(digits);
+    unsigned long long v = value < 0 ? 0ull - (unsigned long long)value : (unsigned long long)value;
+    do {
+        digits[--pos] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v > 0);
+    if (value < 0) {
+        digits[--pos] = '-';
+    }
+    message_put(message, digits + pos, sizeof(digits) - pos);
+}
+
+// 定点成绩（百分之一分），如 8750 写为 87.5，9000 写为 90
+void json_put_fixed(Message *message, long long value) {
+    json_put_int(message, value / SCORE_SCALE);
+    int cents = (int)(value % SCORE_SCALE);
+    if (cents != 0) {
+        char fraction[3] = {'.', (char)('0' + cents / 10), (char)('0' + cents % 10)};
+        message_put(message, fraction, cents % 10 != 0 ? 3 : 2);
+    }
+}
+
+// 第index名学生：直接读取定点成绩，各科以CSV表头同样的短名为键
+void json_put_student(Message *message, const StudentSystem *system, int index) {
+    json_put_raw(message, "{\"id\":");
+    json_put_string(message, student_id_at(system, index));
+    json_put_raw(message, ",\"name\":");
+    json_put_string(message, student_name_at(system, index));
+    json_put_raw(message, ",\"age\":");
+    json_put_int(message, hot_at(system, index)->age);
+    json_put_raw(message, ",\"scores\":{");
+    for (int k = 0; k < system->schema.count; k++) {
+        if (k > 0) {
+            message_put_u8(message, ',');
+        }
+        json_put_string(message, subject_key(&system->schema, k));
+        message_put_u8(message, ':');
+        json_put_fixed(message, score_at(system, k, index));
+    }
+    json_put_raw(message, "},\"average\":");
+    json_put_fixed(message, hot_at(system, index)->average);
+    message_put_u8(message, '}');
+}
+
+// 学生信息视图（成绩为浮点数，来自定点数，换回定点数输出）
+void json_put_student_view(Message *message, const Schema *schema, const Student *s) {
+    json_put_raw(message, "{\"id\":");
+    json_put_string(message, s->id);
+    json_put_raw(message, ",\"name\":");
+    json_put_string(message, s->name);
+    json_put_raw(message, ",\"age\":");
+    json_put_int(message, s->age);
+    json_put_raw(message, ",\"scores\":{");
+    for (int k = 0; k < schema->count; k++) {
+        if (k > 0) {
+            message_put_u8(message, ',');
+        }
+        json_put_string(message, subject_key(schema, k));
+        message_put_u8(message, ':');
+        json_put_fixed(message, score_to_fixed(s->scores[k]));
+    }
+    json_put_raw(message, "},\"average\":");
+    json_put_fixed(message, score_to_fixed(s->average_score));
+    message_put_u8(message, '}');
+}
+
+// 四舍五入的平均值（定点）
+static long long mean(long long total, int count) {
+    return (total + count / 2) / count;
+}
+
+void json_put_statistics(Message *message, const Schema *schema, const Statistics *stats) {
+    json_put_raw(message, "{\"count\":");
+    json_put_int(message, stats->count);
+    if (stats->count == 0) {
+        message_put_u8(message, '}');
+        return;
+    }
+    json_put_raw(message, ",\"subjects\":{");
+    for (int k = 0; k < schema->count; k++) {
+        if (k > 0) {
+            message_put_u8(message, ',');
+        }
+        json_put_string(message, subject_key(schema, k));
+        json_put_raw(message, ":{\"average\":");
+        json_put_fixed(message, mean(stats->totals[k], stats->count));
+        json_put_raw(message, ",\"highest\":");
+        json_put_fixed(message, stats->highest[k]);
+        json_put_raw(message, ",\"lowest\":");
+        json_put_fixed(message, stats->lowest[k]);
+        message_put_u8(message, '}');
+    }
+    json_put_raw(message, "},\"average\":");
+    json_put_fixed(message, mean(stats->total_average, stats->count));
+    json_put_raw(message, ",\"best\":{\"id\":");
+    json_put_string(message, stats->max_id);
+    json_put_raw(message, ",\"name\":");
+    json_put_string(message, stats->max_name);
+    json_put_raw(message, ",\"average\":");
+    json_put_fixed(message, stats->max_average);
+    json_put_raw(message, "},\"worst\":{\"id\":");
+    json_put_string(message, stats->min_id);
+    json_put_raw(message, ",\"name\":");
+    json_put_string(message, stats->min_name);
+    json_put_raw(message, ",\"average\":");
+    json_put_fixed(message, stats->min_average);
+    json_put_raw(message, "}}");
+}
+
+// 复制状态：behind为落后的记录数
+void json_put_replica(Message *message, const ReplicaStatus *status) {
+    json_put_raw(message, "{\"applied\":");
+    json_put_int(message, (long long)status->applied);
+    json_put_raw(message, ",\"primary\":");
+    json_put_int(message, (long long)status->primary);
+    json_put_raw(message, ",\"behind\":");
+    json_put_int(message, status->primary > status->applied ? (long long)(status->primary - status->applied) : 0);
+    json_put_raw(message, ",\"lag_seconds\":");
+    json_put_int(message, status->lag_seconds);
+    json_put_raw(message, status->waiting ? ",\"waiting\":true" : ",\"waiting\":false");
+    json_put_raw(message, ",\"checked\":");
+    json_put_int(message, status->checked);
+    message_put_u8(message, '}');
+}
@@ -0,0 +1,20 @@
+#ifndef JSON_H
+#define JSON_H
+
+#include "student.h"
+#include "protocol.h"
+
+// 把JSON直接写入消息缓冲区：数字和定点成绩不经printf，逐位生成；
+// 字符串只转义引号、反斜杠和控制字符，其余UTF-8字节原样写出
+
+// 函数声明
+void json_put_raw(Message *message, const char *text);
+void json_put_string(Message *message, const char *text);
+void json_put_int(Message *message, long long value);
+void json_put_fixed(Message *message, long long value);
+void json_put_student(Message *message, const StudentSystem *system, int index);
+void json_put_student_view(Message *message, const Schema *schema, const Student *s);
+void json_put_statistics(Message *message, const Schema *schema, const Statistics *stats);
+void json_put_replica(Message *message, const ReplicaStatus *status);
+
+#endif
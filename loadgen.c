@@ -0,0 +1,377 @@
+#define _POSIX_C_SOURCE 200809L
+#include "loadgen.h"
+#include "client.h"
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+// 测试的每批请求数
+static const int batch_sizes[] = {1, 8, 32, 128};
+
+// HTTP测试的接口和流水线深度；/students/ 之后接随机学号
+static const struct {
+    const char *route;
+    int size;
+} http_cases[] = {
+    {"/students/", 1}, {"/students/", 8}, {"/students/", 32}, {"/stats", 1}, {"/top?n=10", 1},
+    {"/search?q=average+%3E%3D+99", 1},
+};
+
+typedef enum { MODE_PIPELINE, MODE_BATCH, MODE_HTTP } LoadMode;
+
+// 全部学号，各连接从中随机抽取
+typedef struct {
+    char (*ids)[MAX_ID_LEN];
+    int count;
+} IdPool;
+
+typedef struct {
+    const char *path;
+    int port;                       // HTTP端口
+    const char *route;              // HTTP请求的接口
+    const IdPool *pool;
+    LoadMode mode;
+    int size;                       // 每轮的请求数
+    int seconds;
+    uint64_t seed;
+    double *latencies;              // 每轮的耗时（秒）
+    size_t rounds;
+    size_t capacity;
+    unsigned long misses;           // 查不到的学号或失败的请求
+    int failed;
+    char error[MAX_NAME_LEN];
+} LoadWorker;
+
+// 当前时间（秒，单调时钟）
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift伪随机数
+static uint32_t next_random(uint64_t *seed) {
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return (uint32_t)(*seed >> 32);
+}
+
+static void collect_id(const Student *s, void *context) {
+    IdPool *pool = context;
+    if (pool->count < LOADGEN_MAX_IDS) {
+        snprintf(pool->ids[pool->count++], MAX_ID_LEN, "%s", s->id);
+    }
+}
+
+static void count_miss(int index, int status, const Student *s, void *context) {
+    (void)index;
+    (void)s;
+    if (status != PROTO_OK) {
+        (*(unsigned long *)context)++;
+    }
+}
+
+// 记下一轮的耗时，内存不足返回0
+static int record_latency(LoadWorker *w, double seconds) {
+    if (w->rounds == w->capacity) {
+        size_t capacity = w->capacity > 0 ? w->capacity * 2 : 4096;
+        double *latencies = realloc(w->latencies, capacity * sizeof(double));
+        if (latencies == NULL) {
+            snprintf(w->error, sizeof(w->error), "内存不足");
+            w->failed = 1;
+            return 0;
+        }
+        w->latencies = latencies;
+        w->capacity = capacity;
+    }
+    w->latencies[w->rounds++] = seconds;
+    return 1;
+}
+
+// 一轮：流水线方式连发size个查询再依次取回，或把size个查询放进一个批量请求
+static int run_round(LoadWorker *w, Client *client) {
+    const char *ids[PROTO_MAX_BATCH];
+    for (int i = 0; i < w->size; i++) {
+        ids[i] = w->pool->ids[next_random(&w->seed) % (uint32_t)w->pool->count];
+    }
+    if (w->mode == MODE_BATCH) {
+        return client_get_batch(client, ids, w->size, count_miss, &w->misses);
+    }
+
+    for (int i = 0; i < w->size; i++) {
+        client_queue_get(client, ids[i]);
+    }
+    int status = client_flush(client);
+    for (int i = 0; status == PROTO_OK && i < w->size; i++) {
+        Student s;
+        int result = client_receive_get(client, &s);
+        if (result == CLIENT_IO_ERROR) {
+            status = result;
+        } else if (result != PROTO_OK) {
+            w->misses++;
+        }
+    }
+    return status;
+}
+
+// HTTP连接及其接收缓冲区
+typedef struct {
+    int fd;
+    Message input;
+} HttpConnection;
+
+static int http_connect(HttpConnection *h, int port) {
+    message_init(&h->input);
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons((uint16_t)port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    h->fd = socket(AF_INET, SOCK_STREAM, 0);
+    return h->fd >= 0 && connect(h->fd, (struct sockaddr *)&address, sizeof(address)) == 0;
+}
+
+// 收下一个响应，返回状态码；连接中断或响应格式不正确返回-1
+static int http_receive(HttpConnection *h) {
+    for (;;) {
+        const char *data = (const char *)h->input.bytes.data;
+        size_t size = h->input.bytes.size;
+        for (size_t i = 3; i < size; i++) {
+            if (memcmp(data + i - 3, "\r\n\r\n", 4) != 0) {
+                continue;
+            }
+            const char *length = strstr(data, "Content-Length:");
+            if (size < 12 || length == NULL || length > data + i) {
+                return -1;
+            }
+            size_t total = i + 1 + (size_t)atol(length + 15);
+            if (size < total) {
+                break;              // 响应体还没收齐
+            }
+            int status = atoi(data + 9);
+            message_consume(&h->input, total);
+            return status;
+        }
+        uint8_t buffer[16384];
+        ssize_t n = recv(h->fd, buffer, sizeof(buffer) - 1, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return -1;
+        }
+        // 末尾补'\0'（不计入长度），以便在缓冲区上用strstr
+        message_put(&h->input, buffer, (size_t)n);
+        message_put_u8(&h->input, 0);
+        h->input.bytes.size--;
+        if (h->input.failed) {
+            return -1;
+        }
+    }
+}
+
+// 一轮HTTP请求：按流水线连发size个请求再依次取回响应，非200的响应计为失败
+static int run_http_round(LoadWorker *w, HttpConnection *h) {
+    char requests[PROTO_MAX_BATCH];
+    size_t used = 0;
+    for (int i = 0; i < w->size; i++) {
+        const char *id = strcmp(w->route, "/students/") == 0
+                         ? w->pool->ids[next_random(&w->seed) % (uint32_t)w->pool->count] : "";
+        used += snprintf(requests + used, sizeof(requests) - used, "GET %s%s HTTP/1.1\r\nHost: localhost\r\n\r\n",
+                         w->route, id);
+    }
+    for (size_t sent = 0; sent < used;) {
+        ssize_t n = send(h->fd, requests + sent, used - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return 0;
+        }
+        sent += (size_t)n;
+    }
+    for (int i = 0; i < w->size; i++) {
+        int status = http_receive(h);
+        if (status < 0) {
+            return 0;
+        }
+        w->misses += status != 200;
+    }
+    return 1;
+}
+
+// HTTP方式的压测线程
+static void http_main(LoadWorker *w) {
+    HttpConnection h;
+    if (!http_connect(&h, w->port)) {
+        snprintf(w->error, sizeof(w->error), "无法连接 127.0.0.1:%d（服务未配置 http_port？）", w->port);
+        w->failed = 1;
+    }
+    double end = now_seconds() + w->seconds;
+    while (!w->failed) {
+        double start = now_seconds();
+        if (start >= end) {
+            break;
+        }
+        if (!run_http_round(w, &h)) {
+            snprintf(w->error, sizeof(w->error), "与服务端的连接中断");
+            w->failed = 1;
+        } else {
+            record_latency(w, now_seconds() - start);
+        }
+    }
+    if (h.fd >= 0) {
+        close(h.fd);
+    }
+    message_free(&h.input);
+}
+
+static void *load_main(void *arg) {
+    LoadWorker *w = arg;
+    if (w->mode == MODE_HTTP) {
+        http_main(w);
+        return NULL;
+    }
+    Client client;
+    if (client_connect(&client, w->path) != PROTO_OK) {
+        snprintf(w->error, sizeof(w->error), "%s", client.error);
+        w->failed = 1;
+        client_close(&client);
+        return NULL;
+    }
+    double end = now_seconds() + w->seconds;
+    for (;;) {
+        double start = now_seconds();
+        if (start >= end) {
+            break;
+        }
+        if (run_round(w, &client) != PROTO_OK) {
+            snprintf(w->error, sizeof(w->error), "%s", client.error);
+            w->failed = 1;
+            break;
+        }
+        if (!record_latency(w, now_seconds() - start)) {
+            break;
+        }
+    }
+    client_close(&client);
+    return NULL;
+}
+
+static int compare_latency(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// 用connections个连接按setting的方式跑若干秒，打印吞吐量和每轮耗时的分位数
+static int run_case(const LoadWorker *setting, const char *label, int connections) {
+    LoadWorker workers[LOADGEN_MAX_CONNECTIONS];
+    pthread_t threads[LOADGEN_MAX_CONNECTIONS];
+    int started = 0;
+    int size = setting->size, seconds = setting->seconds;
+    for (int i = 0; i < connections; i++) {
+        workers[i] = *setting;
+        workers[i].seed = 0x9E3779B97F4A7C15ull * (uint64_t)(i + 1);
+        if (pthread_create(&threads[i], NULL, load_main, &workers[i]) != 0) {
+            break;
+        }
+        started++;
+    }
+
+    size_t rounds = 0;
+    unsigned long misses = 0;
+    const char *error = NULL;
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+        rounds += workers[i].rounds;
+        misses += workers[i].misses;
+        if (workers[i].failed && error == NULL) {
+            error = workers[i].error;
+        }
+    }
+    double *all = rounds > 0 ? malloc(rounds * sizeof(double)) : NULL;
+    size_t n = 0;
+    for (int i = 0; all != NULL && i < started; i++) {
+        memcpy(all + n, workers[i].latencies, workers[i].rounds * sizeof(double));
+        n += workers[i].rounds;
+    }
+
+    int ok = error == NULL && all != NULL;
+    if (ok) {
+        qsort(all, n, sizeof(double), compare_latency);
+        printf("%-8s %5d %12.0f %12.1f %12.1f", label, size,
+               (double)n * size / seconds, all[(n - 1) / 2] * 1e6, all[(n - 1) * 99 / 100] * 1e6);
+        if (misses > 0) {
+            printf("  （%lu 个请求失败）", misses);
+        }
+        printf("\n");
+    } else {
+        printf("错误：%s\n", error != NULL ? error : "内存不足");
+    }
+    free(all);
+    for (int i = 0; i < started; i++) {
+        free(workers[i].latencies);
+    }
+    return ok;
+}
+
+// 压测服务端：二进制协议下分别以流水线和批量方式、不同的每批请求数按学号查询；
+// port大于0时改为压测HTTP接口（保持连接，各接口逐个测试）。每项跑seconds秒，
+// 延迟按轮计（发出一批请求到收齐全部响应），单位微秒
+int run_load_generator(const char *path, int port, int connections, int seconds) {
+    if (connections < 1 || connections > LOADGEN_MAX_CONNECTIONS) {
+        connections = connections < 1 ? 1 : LOADGEN_MAX_CONNECTIONS;
+    }
+    if (seconds < 1) {
+        seconds = 1;
+    }
+
+    // 测试用的学号通过二进制协议取得
+    IdPool pool = {malloc(LOADGEN_MAX_IDS * sizeof(*pool.ids)), 0};
+    Client client;
+    int status = pool.ids != NULL ? client_connect(&client, path) : CLIENT_IO_ERROR;
+    if (status == PROTO_OK) {
+        status = client_search(&client, "age >= 0", collect_id, &pool);
+    }
+    if (status != PROTO_OK || pool.count == 0) {
+        printf("错误：%s\n", status != PROTO_OK ? (pool.ids != NULL ? client.error : "内存不足") : "服务端没有学生记录");
+        if (pool.ids != NULL) {
+            client_close(&client);
+        }
+        free(pool.ids);
+        return 0;
+    }
+    client_close(&client);
+
+    printf("%d 个连接，每项 %d 秒，从 %d 个学号中随机查询\n", connections, seconds, pool.count);
+    LoadWorker setting = {.path = path, .port = port, .pool = &pool, .seconds = seconds};
+    int ok = 1;
+    if (port > 0) {
+        printf("%-8s %5s %12s %12s %12s\n", "接口", "流水线", "请求/秒", "p50(us)", "p99(us)");
+        setting.mode = MODE_HTTP;
+        for (size_t i = 0; ok && i < sizeof(http_cases) / sizeof(http_cases[0]); i++) {
+            setting.route = http_cases[i].route;
+            setting.size = http_cases[i].size;
+            char label[64];
+            snprintf(label, sizeof(label), "%s", setting.route);
+            label[strcspn(label, "?")] = '\0';
+            ok = run_case(&setting, label, connections);
+        }
+    } else {
+        printf("%-8s %5s %12s %12s %12s\n", "方式", "每批", "查询/秒", "p50(us)", "p99(us)");
+        for (int mode = MODE_PIPELINE; ok && mode <= MODE_BATCH; mode++) {
+            setting.mode = (LoadMode)mode;
+            for (size_t i = 0; ok && i < sizeof(batch_sizes) / sizeof(batch_sizes[0]); i++) {
+                setting.size = batch_sizes[i];
+                ok = run_case(&setting, mode == MODE_BATCH ? "批量" : "流水线", connections);
+            }
+        }
+    }
+    free(pool.ids);
+    return ok;
+}
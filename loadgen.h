@@ -0,0 +1,10 @@
+#ifndef LOADGEN_H
+#define LOADGEN_H
+
+#define LOADGEN_MAX_CONNECTIONS 64
+#define LOADGEN_MAX_IDS 65536       // 随机抽取学号的范围（取服务端前这么多名学生）
+
+// 函数声明
+int run_load_generator(const char *path, int port, int connections, int seconds);
+
+#endif
@@ -1,18 +1,47 @@
 #include "student.h"
+#include "cli.h"
+#include "saver.h"
+#include "changefeed.h"
 
-int main() {
+int main(int argc, char *argv[]) {
     StudentSystem system;
+    Saver saver;
     int choice;
     
     // 初始化系统
     init_system(&system);
     
+    // --autosave 秒数：交互模式下的自动保存间隔（也可在配置文件中设置 autosave）
+    int interval = autosave_interval();
+    if (argc > 2 && strcmp(argv[1], "--autosave") == 0) {
+        interval = atoi(argv[2]);
+        argc -= 2;
+        argv += 2;
+    }
+    
+    // 带参数时以命令行模式运行
+    if (argc > 1) {
+        int status = run_command_line(&system, argc - 1, argv + 1);
+        free_system(&system);
+        return status;
+    }
+    
     // 程序启动时自动加载数据
     printf("欢迎使用学生管理系统！\n");
     load_from_file(&system);
+    if (!attach_change_feed(&system)) {
+        printf("提示：内存不足，变更流未启用。\n");
+    }
+    
+    // 保存在后台线程中进行，线程无法启动时直接保存
+    if (!saver_start(&saver, FILENAME, interval)) {
+        printf("提示：无法启动后台保存，将直接保存。\n");
+    }
     
     // 主循环
     while (1) {
+        saver_check(&saver, &system);
+        saver_autosave(&saver, &system);
         display_menu();
         
         if (scanf("%d", &choice) != 1) {
@@ -32,7 +61,7 @@ int main() {
                 modify_student(&system);
                 break;
             case 4:
-                display_all_students(&system);
+                display_all_students(&system, choose_view(&system));
                 break;
             case 5:
                 search_student(&system);
@@ -44,19 +73,28 @@ int main() {
                 calculate_statistics(&system);
                 break;
             case 8:
-                save_to_file(&system);
+                saver_save(&saver, &system);
+                printf("已开始后台保存，可以继续操作。\n");
                 break;
             case 9:
+                // 等待后台保存写完，以免读到旧文件
+                saver_finish(&saver, &system);
                 load_from_file(&system);
                 break;
             case 0:
-                printf("是否保存数据？(y/n): ");
-                char save_choice;
-                scanf(" %c", &save_choice);
-                if (save_choice == 'y' || save_choice == 'Y') {
-                    save_to_file(&system);
+                // 先等待后台保存完成；没有未保存的修改时直接退出
+                saver_finish(&saver, &system);
+                if (has_unsaved_changes(&system)) {
+                    printf("是否保存数据？(y/n): ");
+                    char save_choice;
+                    scanf(" %c", &save_choice);
+                    if (save_choice == 'y' || save_choice == 'Y') {
+                        save_to_file(&system);
+                    }
                 }
                 printf("感谢使用学生管理系统！再见！\n");
+                saver_stop(&saver);
+                free_system(&system);
                 return 0;
             default:
                 printf("无效选择，请重新输入！\n");
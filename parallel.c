@@ -0,0 +1,52 @@
+#define _POSIX_C_SOURCE 200809L
+#include "parallel.h"
+#include <pthread.h>
+#include <unistd.h>
+
+// 一组并行任务：各线程从next中领取下一个任务编号
+typedef struct {
+    void (*task)(void *context, int index);
+    void *context;
+    int count;
+    int next;
+} Work;
+
+static void *worker_main(void *arg) {
+    Work *work = arg;
+    for (;;) {
+        int index = __atomic_fetch_add(&work->next, 1, __ATOMIC_RELAXED);
+        if (index >= work->count) {
+            break;
+        }
+        work->task(work->context, index);
+    }
+    return NULL;
+}
+
+// 可用的工作线程数（CPU核数，最多 PARALLEL_MAX_THREADS）
+int parallel_threads(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus < 1) {
+        return 1;
+    }
+    return cpus > PARALLEL_MAX_THREADS ? PARALLEL_MAX_THREADS : (int)cpus;
+}
+
+// 并行执行task(context, 0..count-1)，全部完成后返回；线程无法创建时在当前线程中执行
+void parallel_for(int count, void (*task)(void *context, int index), void *context) {
+    Work work = {task, context, count, 0};
+    pthread_t threads[PARALLEL_MAX_THREADS];
+    int helpers = parallel_threads() - 1;
+    if (helpers > count - 1) {
+        helpers = count - 1;
+    }
+
+    int started = 0;
+    while (started < helpers && pthread_create(&threads[started], NULL, worker_main, &work) == 0) {
+        started++;
+    }
+    worker_main(&work);
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
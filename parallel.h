@@ -0,0 +1,10 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#define PARALLEL_MAX_THREADS 16
+
+// 函数声明
+int parallel_threads(void);
+void parallel_for(int count, void (*task)(void *context, int index), void *context);
+
+#endif
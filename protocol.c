@@ -0,0 +1,273 @@
+#include "protocol.h"
+#include "config.h"
+
+// 服务端套接字路径：配置项 socket，默认 PROTO_SOCKET
+void proto_socket_path(char *path, size_t size) {
+    if (!config_get("socket", path, size) || path[0] == '\0') {
+        snprintf(path, size, "%s", PROTO_SOCKET);
+    }
+}
+
+void message_init(Message *message) {
+    memset(message, 0, sizeof(*message));
+}
+
+void message_free(Message *message) {
+    buffer_free(&message->bytes);
+    message->failed = 0;
+}
+
+// 确保还能追加size字节；内存不足返回0
+int message_reserve(Message *message, size_t size) {
+    if (!message->failed && !buffer_reserve(&message->bytes, size)) {
+        message->failed = 1;
+    }
+    return !message->failed;
+}
+
+// 追加size字节
+void message_put(Message *message, const void *data, size_t size) {
+    if (message_reserve(message, size)) {
+        memcpy(message->bytes.data + message->bytes.size, data, size);
+        message->bytes.size += size;
+    }
+}
+
+void message_put_u8(Message *message, uint8_t value) {
+    message_put(message, &value, 1);
+}
+
+void message_put_u16(Message *message, uint16_t value) {
+    uint8_t bytes[2] = {value & 0xFF, value >> 8};
+    message_put(message, bytes, sizeof(bytes));
+}
+
+void message_put_u32(Message *message, uint32_t value) {
+    uint8_t bytes[4];
+    for (int i = 0; i < 4; i++) {
+        bytes[i] = (uint8_t)(value >> (8 * i));
+    }
+    message_put(message, bytes, sizeof(bytes));
+}
+
+void message_put_u64(Message *message, uint64_t value) {
+    message_put_u32(message, (uint32_t)value);
+    message_put_u32(message, (uint32_t)(value >> 32));
+}
+
+// 字符串超出长度字段的范围时截断
+void message_put_str8(Message *message, const char *text) {
+    size_t len = strlen(text);
+    len = len > UINT8_MAX ? UINT8_MAX : len;
+    message_put_u8(message, (uint8_t)len);
+    message_put(message, text, len);
+}
+
+void message_put_str16(Message *message, const char *text) {
+    size_t len = strlen(text);
+    len = len > UINT16_MAX ? UINT16_MAX : len;
+    message_put_u16(message, (uint16_t)len);
+    message_put(message, text, len);
+}
+
+// 去掉开头的size字节
+void message_consume(Message *message, size_t size) {
+    memmove(message->bytes.data, message->bytes.data + size, message->bytes.size - size);
+    message->bytes.size -= size;
+}
+
+// 开始一帧：先留出长度字段，返回帧的起始位置
+size_t proto_begin_frame(Message *message) {
+    size_t start = message->bytes.size;
+    message_put_u32(message, 0);
+    return start;
+}
+
+// 结束一帧：填入帧体长度
+void proto_end_frame(Message *message, size_t start) {
+    if (message->failed) {
+        return;
+    }
+    uint32_t length = (uint32_t)(message->bytes.size - start - PROTO_FRAME_HEADER);
+    for (int i = 0; i < 4; i++) {
+        message->bytes.data[start + i] = (uint8_t)(length >> (8 * i));
+    }
+}
+
+// 由帧头取得帧体长度
+uint32_t proto_frame_length(const uint8_t *header) {
+    return (uint32_t)header[0] | (uint32_t)header[1] << 8 | (uint32_t)header[2] << 16 | (uint32_t)header[3] << 24;
+}
+
+void reader_init(Reader *reader, const uint8_t *data, size_t length) {
+    reader->data = data;
+    reader->length = length;
+    reader->pos = 0;
+    reader->failed = 0;
+}
+
+// 取出size字节的位置，越界返回NULL
+const uint8_t *reader_bytes(Reader *reader, size_t size) {
+    if (reader->failed || reader->length - reader->pos < size) {
+        reader->failed = 1;
+        return NULL;
+    }
+    const uint8_t *p = reader->data + reader->pos;
+    reader->pos += size;
+    return p;
+}
+
+uint8_t reader_u8(Reader *reader) {
+    const uint8_t *p = reader_bytes(reader, 1);
+    return p != NULL ? p[0] : 0;
+}
+
+uint16_t reader_u16(Reader *reader) {
+    const uint8_t *p = reader_bytes(reader, 2);
+    return p != NULL ? (uint16_t)(p[0] | p[1] << 8) : 0;
+}
+
+uint32_t reader_u32(Reader *reader) {
+    const uint8_t *p = reader_bytes(reader, 4);
+    return p != NULL ? proto_frame_length(p) : 0;
+}
+
+uint64_t reader_u64(Reader *reader) {
+    uint64_t low = reader_u32(reader);
+    return low | (uint64_t)reader_u32(reader) << 32;
+}
+
+// 读出len字节的字符串存入text（以'\0'结尾），放不下时失败
+static int reader_text(Reader *reader, size_t len, char *text, size_t size) {
+    const uint8_t *p = reader_bytes(reader, len);
+    if (p == NULL || len >= size) {
+        reader->failed = 1;
+        return 0;
+    }
+    memcpy(text, p, len);
+    text[len] = '\0';
+    return 1;
+}
+
+int reader_str8(Reader *reader, char *text, size_t size) {
+    return reader_text(reader, reader_u8(reader), text, size);
+}
+
+int reader_str16(Reader *reader, char *text, size_t size) {
+    return reader_text(reader, reader_u16(reader), text, size);
+}
+
+// 写入一名学生的记录（成绩转为定点数）
+void proto_put_student(Message *message, int subjects, const Student *s) {
+    message_put_str8(message, s->id);
+    message_put_str16(message, s->name);
+    message_put_u8(message, (uint8_t)s->age);
+    message_put_u8(message, (uint8_t)subjects);
+    for (int k = 0; k < subjects; k++) {
+        message_put_u16(message, score_to_fixed(s->scores[k]));
+    }
+    message_put_u16(message, score_to_fixed(s->average_score));
+}
+
+// 读出一名学生的记录，学号和姓名存入id（MAX_ID_LEN字节）和name；成功返回1
+int proto_get_student(Reader *reader, Student *s, char *id, char *name, size_t name_size) {
+    reader_str8(reader, id, MAX_ID_LEN);
+    reader_str16(reader, name, name_size);
+    s->id = id;
+    s->name = name;
+    s->age = reader_u8(reader);
+    int subjects = reader_u8(reader);
+    if (subjects > MAX_SUBJECTS) {
+        reader->failed = 1;
+        return 0;
+    }
+    memset(s->scores, 0, sizeof(s->scores));
+    for (int k = 0; k < subjects; k++) {
+        s->scores[k] = fixed_to_score(reader_u16(reader));
+    }
+    s->average_score = fixed_to_score(reader_u16(reader));
+    return !reader->failed;
+}
+
+void proto_put_schema(Message *message, const Schema *schema) {
+    message_put_u8(message, (uint8_t)schema->count);
+    for (int k = 0; k < schema->count; k++) {
+        message_put_str8(message, schema->subjects[k].name);
+        message_put_str8(message, schema->subjects[k].alias);
+        message_put_u16(message, schema->subjects[k].weight);
+    }
+}
+
+int proto_get_schema(Reader *reader, Schema *schema) {
+    char name[SUBJECT_NAME_LEN], alias[SUBJECT_NAME_LEN];
+    int count = reader_u8(reader);
+    memset(schema, 0, sizeof(*schema));
+    for (int k = 0; k < count && !reader->failed; k++) {
+        reader_str8(reader, name, sizeof(name));
+        reader_str8(reader, alias, sizeof(alias));
+        int weight = reader_u16(reader);
+        if (!reader->failed && !schema_add(schema, name, alias, weight)) {
+            reader->failed = 1;
+        }
+    }
+    return !reader->failed;
+}
+
+// 统计结果：科目数(u8) 学生数(u32)，各科 总分(u64) 最高(u16) 最低(u16)，平均分之和(u64)，
+// 最高平均分(u16) 学号(str8) 姓名(str16)，最低平均分(u16) 学号(str8) 姓名(str16)
+void proto_put_statistics(Message *message, int subjects, const Statistics *stats) {
+    message_put_u8(message, (uint8_t)subjects);
+    message_put_u32(message, (uint32_t)stats->count);
+    for (int k = 0; k < subjects; k++) {
+        message_put_u64(message, (uint64_t)stats->totals[k]);
+        message_put_u16(message, stats->highest[k]);
+        message_put_u16(message, stats->lowest[k]);
+    }
+    message_put_u64(message, (uint64_t)stats->total_average);
+    message_put_u16(message, stats->max_average);
+    message_put_str8(message, stats->max_id);
+    message_put_str16(message, stats->max_name);
+    message_put_u16(message, stats->min_average);
+    message_put_str8(message, stats->min_id);
+    message_put_str16(message, stats->min_name);
+}
+
+int proto_get_statistics(Reader *reader, int subjects, Statistics *stats) {
+    memset(stats, 0, sizeof(*stats));
+    if (reader_u8(reader) != subjects) {
+        reader->failed = 1;
+        return 0;
+    }
+    stats->count = (int)reader_u32(reader);
+    for (int k = 0; k < subjects; k++) {
+        stats->totals[k] = (long long)reader_u64(reader);
+        stats->highest[k] = reader_u16(reader);
+        stats->lowest[k] = reader_u16(reader);
+    }
+    stats->total_average = (long long)reader_u64(reader);
+    stats->max_average = reader_u16(reader);
+    reader_str8(reader, stats->max_id, sizeof(stats->max_id));
+    reader_str16(reader, stats->max_name, sizeof(stats->max_name));
+    stats->min_average = reader_u16(reader);
+    reader_str8(reader, stats->min_id, sizeof(stats->min_id));
+    reader_str16(reader, stats->min_name, sizeof(stats->min_name));
+    return !reader->failed;
+}
+
+// 复制状态：已应用序号(u64) 主服务序号(u64) 延迟秒数(u32) 等待重新加载(u8) 最近检查时间(u64)
+void proto_put_replica(Message *message, const ReplicaStatus *status) {
+    message_put_u64(message, status->applied);
+    message_put_u64(message, status->primary);
+    message_put_u32(message, (uint32_t)status->lag_seconds);
+    message_put_u8(message, (uint8_t)status->waiting);
+    message_put_u64(message, (uint64_t)status->checked);
+}
+
+int proto_get_replica(Reader *reader, ReplicaStatus *status) {
+    status->applied = reader_u64(reader);
+    status->primary = reader_u64(reader);
+    status->lag_seconds = reader_u32(reader);
+    status->waiting = reader_u8(reader);
+    status->checked = (int64_t)reader_u64(reader);
+    return !reader->failed;
+}
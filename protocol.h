@@ -0,0 +1,92 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include "student.h"
+#include "codec.h"
+#include "replica.h"
+
+// 服务端与客户端之间的二进制协议。每个帧为 4字节长度 + 帧体，整数均为小端序。
+// 请求帧体：操作码（1字节）+ 参数；响应帧体：状态（1字节）+ 结果。
+// 客户端可以连续发送多个请求而不等待响应（流水线），服务端按请求的顺序返回响应。
+// 字符串为 长度（1或2字节）+ 内容，不含结尾的'\0'。
+// 学生记录：学号(str8) 姓名(str16) 年龄(u8) 科目数(u8) 各科定点成绩(u16...) 平均分(u16)
+
+#define PROTO_MAX_REQUEST 65536     // 请求帧体的最大长度
+#define PROTO_MAX_RESPONSE (1u << 30) // 响应帧体的最大长度
+#define PROTO_FRAME_HEADER 4
+#define PROTO_MAX_BATCH 4096        // 一个批量请求中最多的请求数
+#define PROTO_SOCKET "students.sock" // 默认套接字路径，可由配置项 socket 修改
+
+// 操作码
+enum {
+    PROTO_SCHEMA = 1,               // 取科目设置 → 科目数(u8)，每科 名称(str8) 别名(str8) 权重(u16)
+    PROTO_GET,                      // 学号(str8) → 学生记录
+    PROTO_SEARCH,                   // 查询条件(str16) → 学生数(u32) + 学生记录...
+    PROTO_STATS,                    // → 统计结果（见 proto_put_statistics，没有学生时学生数为0）
+    PROTO_ADD,                      // 学生记录 → 无
+    PROTO_MODIFY,                   // 学生记录（按学号找到原记录）→ 无
+    PROTO_DELETE,                   // 学号(str8) → 无
+    PROTO_SAVE,                     // 保存到数据文件 → 无
+    PROTO_BATCH,                    // 请求数(u16) + 若干请求帧（只能是查询类操作）→ 请求数(u16) + 对应的响应帧
+    PROTO_REPLICA                   // 取复制状态（见 proto_put_replica），不是只读副本时为 PROTO_NOT_FOUND
+};
+
+// 响应状态；PROTO_INVALID 和 PROTO_ERROR 的结果为错误信息(str16)
+enum {
+    PROTO_OK = 0,
+    PROTO_NOT_FOUND,
+    PROTO_EXISTS,
+    PROTO_INVALID,
+    PROTO_ERROR
+};
+
+// 待发送或已收到的消息；内存不足时置failed，之后的写入被忽略
+typedef struct {
+    ByteBuffer bytes;
+    int failed;
+} Message;
+
+// 顺序读取一段字节；越界时置failed，之后读到的都是0
+typedef struct {
+    const uint8_t *data;
+    size_t length;
+    size_t pos;
+    int failed;
+} Reader;
+
+// 函数声明
+void proto_socket_path(char *path, size_t size);
+void message_init(Message *message);
+void message_free(Message *message);
+int message_reserve(Message *message, size_t size);
+void message_put(Message *message, const void *data, size_t size);
+void message_put_u8(Message *message, uint8_t value);
+void message_put_u16(Message *message, uint16_t value);
+void message_put_u32(Message *message, uint32_t value);
+void message_put_u64(Message *message, uint64_t value);
+void message_put_str8(Message *message, const char *text);
+void message_put_str16(Message *message, const char *text);
+void message_consume(Message *message, size_t size);
+size_t proto_begin_frame(Message *message);
+void proto_end_frame(Message *message, size_t start);
+uint32_t proto_frame_length(const uint8_t *header);
+
+void reader_init(Reader *reader, const uint8_t *data, size_t length);
+uint8_t reader_u8(Reader *reader);
+uint16_t reader_u16(Reader *reader);
+uint32_t reader_u32(Reader *reader);
+uint64_t reader_u64(Reader *reader);
+const uint8_t *reader_bytes(Reader *reader, size_t size);
+int reader_str8(Reader *reader, char *text, size_t size);
+int reader_str16(Reader *reader, char *text, size_t size);
+
+void proto_put_student(Message *message, int subjects, const Student *s);
+int proto_get_student(Reader *reader, Student *s, char *id, char *name, size_t name_size);
+void proto_put_schema(Message *message, const Schema *schema);
+int proto_get_schema(Reader *reader, Schema *schema);
+void proto_put_statistics(Message *message, int subjects, const Statistics *stats);
+int proto_get_statistics(Reader *reader, int subjects, Statistics *stats);
+void proto_put_replica(Message *message, const ReplicaStatus *status);
+int proto_get_replica(Reader *reader, ReplicaStatus *status);
+
+#endif
@@ -0,0 +1,654 @@
+#include "query.h"
+#include "views.h"
+#include <ctype.h>
+#include <math.h>
+
+// 词法单元类型
+typedef enum {
+    TOK_END,
+    TOK_WORD,                   // 字段名、关键字或未加引号的值
+    TOK_NUMBER,
+    TOK_STRING,
+    TOK_OP,                     // 比较运算符
+    TOK_AND,
+    TOK_OR,
+    TOK_NOT,
+    TOK_LPAREN,
+    TOK_RPAREN,
+    TOK_ERROR
+} TokenType;
+
+// 解析器状态
+typedef struct {
+    const char *pos;
+    TokenType type;
+    char text[MAX_NAME_LEN];
+    int cmp;
+    Query *query;
+    const Schema *schema;
+} Parser;
+
+// 固定字段名表（支持英文和中文）；科目字段按科目设置中的名称和别名查找
+static const struct {
+    const char *name;
+    QueryField field;
+} field_names[] = {
+    {"id", FIELD_ID}, {"学号", FIELD_ID},
+    {"name", FIELD_NAME}, {"姓名", FIELD_NAME},
+    {"age", FIELD_AGE}, {"年龄", FIELD_AGE},
+    {"average", FIELD_AVERAGE}, {"avg", FIELD_AVERAGE}, {"平均分", FIELD_AVERAGE}
+};
+
+// 按名称查找字段（固定字段或科目），找不到返回-1
+int query_field(const Schema *schema, const char *name) {
+    for (size_t i = 0; i < sizeof(field_names) / sizeof(field_names[0]); i++) {
+        if (strcmp(name, field_names[i].name) == 0) {
+            return field_names[i].field;
+        }
+    }
+    int subject = schema_find(schema, name);
+    return subject != -1 ? FIELD_SUBJECT + subject : -1;
+}
+
+// 读取下一个词法单元
+static void next_token(Parser *p) {
+    while (isspace((unsigned char)*p->pos)) {
+        p->pos++;
+    }
+
+    const char *s = p->pos;
+    p->text[0] = '\0';
+
+    if (*s == '\0') {
+        p->type = TOK_END;
+        return;
+    }
+
+    if (*s == '(' || *s == ')') {
+        p->type = *s == '(' ? TOK_LPAREN : TOK_RPAREN;
+        p->pos++;
+        return;
+    }
+
+    if (s[0] == '&' && s[1] == '&') {
+        p->type = TOK_AND;
+        p->pos += 2;
+        return;
+    }
+    if (s[0] == '|' && s[1] == '|') {
+        p->type = TOK_OR;
+        p->pos += 2;
+        return;
+    }
+
+    // 比较运算符
+    if (strchr("<>=!^", *s)) {
+        int len = s[1] == '=' ? 2 : 1;
+        p->type = TOK_OP;
+        if (s[0] == '<') {
+            p->cmp = len == 2 ? CMP_LE : CMP_LT;
+        } else if (s[0] == '>') {
+            p->cmp = len == 2 ? CMP_GE : CMP_GT;
+        } else if (s[0] == '=') {
+            p->cmp = CMP_EQ;
+        } else if (s[0] == '!' && len == 2) {
+            p->cmp = CMP_NE;
+        } else if (s[0] == '!') {
+            p->type = TOK_NOT;
+        } else if (len == 2) {
+            p->cmp = CMP_PREFIX;
+        } else {
+            p->type = TOK_ERROR;
+        }
+        p->pos += len;
+        return;
+    }
+
+    // 带引号的字符串
+    if (*s == '"') {
+        const char *end = strchr(s + 1, '"');
+        if (end == NULL || end - s - 1 >= MAX_NAME_LEN) {
+            p->type = TOK_ERROR;
+            return;
+        }
+        memcpy(p->text, s + 1, end - s - 1);
+        p->text[end - s - 1] = '\0';
+        p->type = TOK_STRING;
+        p->pos = end + 1;
+        return;
+    }
+
+    // 单词或数字：直到空白、括号或运算符为止
+    int len = 0;
+    while (s[len] && !isspace((unsigned char)s[len]) && !strchr("()<>=!^&|\"", s[len])) {
+        len++;
+    }
+    if (len == 0 || len >= MAX_NAME_LEN) {
+        p->type = TOK_ERROR;
+        return;
+    }
+    memcpy(p->text, s, len);
+    p->text[len] = '\0';
+    p->pos += len;
+
+    // 只有有限的数值算作数字："nan"、"inf" 和溢出的 1e999 等当作单词，不能与成绩、年龄比较
+    char *end;
+    double value = strtod(p->text, &end);
+    if (*end == '\0' && isfinite(value)) {
+        p->type = TOK_NUMBER;
+    } else if (strcmp(p->text, "and") == 0 || strcmp(p->text, "AND") == 0) {
+        p->type = TOK_AND;
+    } else if (strcmp(p->text, "or") == 0 || strcmp(p->text, "OR") == 0) {
+        p->type = TOK_OR;
+    } else if (strcmp(p->text, "not") == 0 || strcmp(p->text, "NOT") == 0) {
+        p->type = TOK_NOT;
+    } else {
+        p->type = TOK_WORD;
+    }
+}
+
+// 追加一条指令
+static int emit(Parser *p, Instruction ins) {
+    Query *q = p->query;
+    if (q->length >= QUERY_MAX_CODE) {
+        snprintf(q->error, sizeof(q->error), "表达式过长");
+        return 0;
+    }
+    q->code[q->length++] = ins;
+    return 1;
+}
+
+static int parse_or(Parser *p, int *point_id);
+
+// 把数值常量换算为整数，使比较可直接在定点列上进行：
+// x < v 等价于 x < ceil(v)，x <= v 等价于 x <= floor(v)；非整数的 == 永不成立
+static int32_t integer_literal(double scaled, int cmp) {
+    double rounded = floor(scaled + 0.5);
+    if (fabs(scaled - rounded) < 1e-6) {
+        scaled = rounded;
+    }
+    if (scaled > INT32_MAX / 2) {
+        scaled = INT32_MAX / 2;
+    } else if (scaled < INT32_MIN / 2) {
+        scaled = INT32_MIN / 2;
+    }
+    switch (cmp) {
+        case CMP_LT:
+        case CMP_GE:
+            return (int32_t)ceil(scaled);
+        case CMP_LE:
+        case CMP_GT:
+            return (int32_t)floor(scaled);
+        default:
+            return scaled == floor(scaled) ? (int32_t)scaled : -1;
+    }
+}
+
+// 解析比较项或括号表达式
+static int parse_primary(Parser *p, int *point_id) {
+    Query *q = p->query;
+    *point_id = -1;
+
+    if (p->type == TOK_LPAREN) {
+        next_token(p);
+        if (!parse_or(p, point_id)) {
+            return 0;
+        }
+        if (p->type != TOK_RPAREN) {
+            snprintf(q->error, sizeof(q->error), "缺少右括号");
+            return 0;
+        }
+        next_token(p);
+        return 1;
+    }
+
+    if (p->type != TOK_WORD) {
+        snprintf(q->error, sizeof(q->error), "此处应为字段名");
+        return 0;
+    }
+
+    int field = query_field(p->schema, p->text);
+    if (field == -1) {
+        snprintf(q->error, sizeof(q->error), "未知字段: %s", p->text);
+        return 0;
+    }
+
+    next_token(p);
+    if (p->type != TOK_OP) {
+        snprintf(q->error, sizeof(q->error), "此处应为比较运算符");
+        return 0;
+    }
+    Instruction ins = {OP_CMP, (unsigned char)field, (unsigned char)p->cmp, 0, 0};
+
+    next_token(p);
+    if (field == FIELD_ID || field == FIELD_NAME) {
+        if (p->type != TOK_STRING && p->type != TOK_WORD && p->type != TOK_NUMBER) {
+            snprintf(q->error, sizeof(q->error), "此处应为字符串");
+            return 0;
+        }
+        if (q->string_count >= QUERY_MAX_STRINGS) {
+            snprintf(q->error, sizeof(q->error), "字符串常量过多");
+            return 0;
+        }
+        ins.str = (unsigned char)q->string_count;
+        strcpy(q->strings[q->string_count++], p->text);
+        // 姓名按排序方式比较大小（如 name < "王"），预先算出常量的排序键
+        if (field == FIELD_NAME && ins.cmp <= CMP_GE) {
+            collate_key(p->text, q->keys[ins.str], sizeof(q->keys[ins.str]));
+        }
+        if (field == FIELD_ID && ins.cmp == CMP_EQ) {
+            *point_id = ins.str;
+        }
+    } else {
+        if (p->type == TOK_WORD) {
+            snprintf(q->error, sizeof(q->error), "此处应为数字: %s", p->text);
+            return 0;
+        }
+        if (p->type != TOK_NUMBER) {
+            snprintf(q->error, sizeof(q->error), "此处应为数字");
+            return 0;
+        }
+        if (ins.cmp == CMP_PREFIX) {
+            snprintf(q->error, sizeof(q->error), "^= 只能用于学号和姓名");
+            return 0;
+        }
+        ins.value = integer_literal(strtod(p->text, NULL) * (field == FIELD_AGE ? 1 : SCORE_SCALE), ins.cmp);
+    }
+
+    next_token(p);
+    return emit(p, ins);
+}
+
+// 解析 not 前缀
+static int parse_not(Parser *p, int *point_id) {
+    if (p->type == TOK_NOT) {
+        next_token(p);
+        if (!parse_not(p, point_id)) {
+            return 0;
+        }
+        *point_id = -1;
+        Instruction ins = {OP_NOT, 0, 0, 0, 0};
+        return emit(p, ins);
+    }
+    return parse_primary(p, point_id);
+}
+
+// 解析 and 链；任一合取项为学号等值时整体可走学号查找
+static int parse_and(Parser *p, int *point_id) {
+    if (!parse_not(p, point_id)) {
+        return 0;
+    }
+    while (p->type == TOK_AND) {
+        int right;
+        next_token(p);
+        if (!parse_not(p, &right)) {
+            return 0;
+        }
+        if (*point_id == -1) {
+            *point_id = right;
+        }
+        Instruction ins = {OP_AND, 0, 0, 0, 0};
+        if (!emit(p, ins)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// 解析 or 链
+static int parse_or(Parser *p, int *point_id) {
+    if (!parse_and(p, point_id)) {
+        return 0;
+    }
+    while (p->type == TOK_OR) {
+        int right;
+        next_token(p);
+        if (!parse_and(p, &right)) {
+            return 0;
+        }
+        *point_id = -1;
+        Instruction ins = {OP_OR, 0, 0, 0, 0};
+        if (!emit(p, ins)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// 编译查询表达式为后缀字节码，成功返回1
+int query_compile(Query *query, const Schema *schema, const char *text) {
+    Parser p;
+    memset(query, 0, sizeof(*query));
+    query->point_id = -1;
+    p.pos = text;
+    p.query = query;
+    p.schema = schema;
+
+    next_token(&p);
+    if (p.type == TOK_END) {
+        snprintf(query->error, sizeof(query->error), "表达式为空");
+        return 0;
+    }
+    if (!parse_or(&p, &query->point_id)) {
+        return 0;
+    }
+    if (p.type != TOK_END) {
+        snprintf(query->error, sizeof(query->error), "表达式末尾有多余内容");
+        return 0;
+    }
+
+    // 检查求值栈深度
+    int depth = 0, max_depth = 0;
+    for (int i = 0; i < query->length; i++) {
+        if (query->code[i].opcode == OP_CMP) {
+            depth++;
+        } else if (query->code[i].opcode != OP_NOT) {
+            depth--;
+        }
+        if (depth > max_depth) {
+            max_depth = depth;
+        }
+    }
+    if (max_depth > QUERY_MAX_DEPTH) {
+        snprintf(query->error, sizeof(query->error), "表达式嵌套过深");
+        return 0;
+    }
+    return 1;
+}
+
+// 查询的数据来源：内存中的学生数据、流式读取的一段，或挂载的共享内存
+typedef struct {
+    const StudentSystem *system;
+    const StreamChunk *chunk;
+    const ShmRoster *shm;
+} QuerySource;
+
+// 取出一块学生的数值列（成绩为定点数）；一块64行总在同一个数据块内，可直接按数组访问
+static void load_column(const QuerySource *source, int field, int base, int n, int32_t *out) {
+    if (source->chunk != NULL) {
+        const DecodedBlock *rows = &source->chunk->rows;
+        const uint16_t *column = field >= FIELD_SUBJECT ? rows->scores + (size_t)(field - FIELD_SUBJECT) * rows->rows
+                                                        : source->chunk->averages;
+        if (field == FIELD_AGE) {
+            for (int i = 0; i < n; i++) out[i] = rows->ages[base + i];
+        } else {
+            for (int i = 0; i < n; i++) out[i] = column[base + i];
+        }
+        return;
+    }
+    if (source->shm != NULL) {
+        const ShmRoster *shm = source->shm;
+        const uint16_t *column = field >= FIELD_SUBJECT ? &shm_score(shm, field - FIELD_SUBJECT, 0) : shm->averages;
+        if (field == FIELD_AGE) {
+            for (int i = 0; i < n; i++) out[i] = shm->ages[base + i];
+        } else {
+            for (int i = 0; i < n; i++) out[i] = column[base + i];
+        }
+        return;
+    }
+    const StudentSystem *system = source->system;
+    if (field >= FIELD_SUBJECT) {
+        const uint16_t *column = chunk_row(system->scores[field - FIELD_SUBJECT], (uint32_t)base);
+        for (int i = 0; i < n; i++) out[i] = column[i];
+        return;
+    }
+    const HotRecord *r = hot_at(system, base);
+    if (field == FIELD_AGE) {
+        for (int i = 0; i < n; i++) out[i] = r[i].age;
+    } else {
+        for (int i = 0; i < n; i++) out[i] = r[i].average;
+    }
+}
+
+// 对一列整数做比较，生成位图（无分支，便于编译器向量化）
+static uint64_t compare_numbers(const int32_t *col, int n, int cmp, int32_t value) {
+    uint64_t mask = 0;
+    switch (cmp) {
+        case CMP_LT:
+            for (int i = 0; i < n; i++) mask |= (uint64_t)(col[i] < value) << i;
+            break;
+        case CMP_LE:
+            for (int i = 0; i < n; i++) mask |= (uint64_t)(col[i] <= value) << i;
+            break;
+        case CMP_GT:
+            for (int i = 0; i < n; i++) mask |= (uint64_t)(col[i] > value) << i;
+            break;
+        case CMP_GE:
+            for (int i = 0; i < n; i++) mask |= (uint64_t)(col[i] >= value) << i;
+            break;
+        case CMP_EQ:
+            for (int i = 0; i < n; i++) mask |= (uint64_t)(col[i] == value) << i;
+            break;
+        default:
+            for (int i = 0; i < n; i++) mask |= (uint64_t)(col[i] != value) << i;
+            break;
+    }
+    return mask;
+}
+
+// 对一块学生的学号或姓名做比较
+static uint64_t compare_strings(const QuerySource *source, int field, int base, int n, int cmp, const char *value,
+                                const char *key) {
+    uint64_t mask = 0;
+    size_t value_len = strlen(value);
+    // 姓名比较大小时按排序键：内存中和共享内存中的学生已有排序键，流式读取的一段逐字符比较
+    int collated = field == FIELD_NAME && cmp <= CMP_GE;
+    for (int i = 0; i < n; i++) {
+        const char *text;
+        int r;
+        if (source->chunk != NULL) {
+            text = field == FIELD_ID ? source->chunk->rows.ids[base + i] : source->chunk->rows.names[base + i];
+        } else if (source->shm != NULL) {
+            const uint32_t *offsets = field == FIELD_ID ? source->shm->ids
+                                      : collated ? source->shm->name_keys : source->shm->names;
+            text = shm_string(source->shm, offsets[base + i]);
+        } else if (collated) {
+            text = student_name_key_at(source->system, base + i);
+        } else {
+            text = field == FIELD_ID ? student_id_at(source->system, base + i)
+                                     : student_name_at(source->system, base + i);
+        }
+        if (collated) {
+            r = source->chunk != NULL ? collate_compare(text, value) : strcmp(text, key);
+        } else {
+            r = cmp == CMP_PREFIX ? strncmp(text, value, value_len) : strcmp(text, value);
+        }
+        int hit;
+        switch (cmp) {
+            case CMP_LT: hit = r < 0; break;
+            case CMP_LE: hit = r <= 0; break;
+            case CMP_GT: hit = r > 0; break;
+            case CMP_GE: hit = r >= 0; break;
+            case CMP_NE: hit = r != 0; break;
+            default: hit = r == 0; break;
+        }
+        mask |= (uint64_t)hit << i;
+    }
+    return mask;
+}
+
+// 在一块学生上运行字节码
+static uint64_t run_block(const Query *query, const QuerySource *source, int base, int n) {
+    uint64_t stack[QUERY_MAX_DEPTH];
+    int32_t column[QUERY_BLOCK];
+    uint64_t valid = n == 64 ? ~(uint64_t)0 : (((uint64_t)1 << n) - 1);
+    int top = 0;
+
+    for (int pc = 0; pc < query->length; pc++) {
+        const Instruction *ins = &query->code[pc];
+        switch (ins->opcode) {
+            case OP_CMP:
+                if (ins->field == FIELD_ID || ins->field == FIELD_NAME) {
+                    stack[top++] = compare_strings(source, ins->field, base, n, ins->cmp, query->strings[ins->str],
+                                                    query->keys[ins->str]);
+                } else {
+                    load_column(source, ins->field, base, n, column);
+                    stack[top++] = compare_numbers(column, n, ins->cmp, ins->value);
+                }
+                break;
+            case OP_AND:
+                top--;
+                stack[top - 1] &= stack[top];
+                break;
+            case OP_OR:
+                top--;
+                stack[top - 1] |= stack[top];
+                break;
+            default:
+                stack[top - 1] = ~stack[top - 1] & valid;
+                break;
+        }
+    }
+    return stack[0];
+}
+
+// 以第end条指令结尾的子表达式从哪条指令开始
+static int subexpression_start(const Query *query, int end) {
+    switch (query->code[end].opcode) {
+        case OP_CMP:
+            return end;
+        case OP_NOT:
+            return subexpression_start(query, end - 1);
+        default:
+            return subexpression_start(query, subexpression_start(query, end - 1) - 1);
+    }
+}
+
+// 收集顶层的合取项（只经 and 连接、整个表达式成立时必然成立）中的比较指令
+static int collect_conjuncts(const Query *query, int end, int *out, int count) {
+    const Instruction *ins = &query->code[end];
+    if (ins->opcode == OP_CMP && count < QUERY_MAX_CODE) {
+        out[count++] = end;
+    } else if (ins->opcode == OP_AND) {
+        int right = subexpression_start(query, end - 1);
+        count = collect_conjuncts(query, end - 1, out, count);
+        count = collect_conjuncts(query, right - 1, out, count);
+    }
+    return count;
+}
+
+static void mark_candidate(StudentSystem *system, int row, void *context) {
+    (void)system;
+    uint64_t *words = context;
+    words[row / 64] |= (uint64_t)1 << (row % 64);
+}
+
+// 用排序视图缩小范围：某个合取项是 字段 比较 常量（<、<=、>、>=、==），且有第一个排序键为该字段的视图时，
+// 在视图中只取出满足该项的学生，记入words作为候选。命中超过学生数的1/8时放弃（逐块扫描更快），返回0
+static int plan_view(const Query *query, StudentSystem *system, uint64_t *words) {
+    int conjuncts[QUERY_MAX_CODE];
+    if (system->views == NULL || query->length == 0) {
+        return 0;
+    }
+    int count = collect_conjuncts(query, query->length - 1, conjuncts, 0);
+    for (int c = 0; c < count; c++) {
+        const Instruction *ins = &query->code[conjuncts[c]];
+        // 姓名按排序键排序，只有比较大小时常量才有排序键
+        if (ins->cmp > CMP_EQ || (ins->field == FIELD_NAME && ins->cmp == CMP_EQ)) {
+            continue;
+        }
+        int view = find_view_by_field(system, ins->field);
+        if (view < 0) {
+            continue;
+        }
+        const char *text = ins->field == FIELD_ID ? query->strings[ins->str]
+                           : ins->field == FIELD_NAME ? query->keys[ins->str] : NULL;
+        int limit = system->count / 8;
+        if (walk_view_range(system, view, ins->cmp, ins->value, text, limit, mark_candidate, words) >= 0) {
+            return 1;
+        }
+        memset(words, 0, (size_t)(system->count + 63) / 64 * sizeof(uint64_t));
+    }
+    return 0;
+}
+
+// 执行查询，生成选择位图；成功返回1
+int query_execute(const Query *query, StudentSystem *system, Selection *selection) {
+    QuerySource source = {system, NULL, NULL};
+    int words = (system->count + 63) / 64;
+    selection->count = system->count;
+    selection->words = calloc(words > 0 ? words : 1, sizeof(uint64_t));
+    if (selection->words == NULL) {
+        return 0;
+    }
+
+    // 学号等值：先按学号定位，只需计算所在的一块
+    if (query->point_id >= 0) {
+        int index = find_student_by_id(system, query->strings[query->point_id]);
+        if (index != -1) {
+            int base = index / 64 * 64;
+            int n = system->count - base < 64 ? system->count - base : 64;
+            uint64_t bit = (uint64_t)1 << (index - base);
+            selection->words[index / 64] = run_block(query, &source, base, n) & bit;
+        }
+        return 1;
+    }
+
+    // 视图给出候选时只计算有候选的块，结果限于候选（合取项不成立的学生整个表达式也不成立）
+    if (plan_view(query, system, selection->words)) {
+        for (int base = 0; base < system->count; base += QUERY_BLOCK) {
+            uint64_t candidates = selection->words[base / 64];
+            if (candidates != 0) {
+                int n = system->count - base < QUERY_BLOCK ? system->count - base : QUERY_BLOCK;
+                selection->words[base / 64] = run_block(query, &source, base, n) & candidates;
+            }
+        }
+        return 1;
+    }
+
+    for (int base = 0; base < system->count; base += QUERY_BLOCK) {
+        int n = system->count - base < QUERY_BLOCK ? system->count - base : QUERY_BLOCK;
+        selection->words[base / 64] = run_block(query, &source, base, n);
+    }
+    return 1;
+}
+
+// 在挂载的共享内存上就地执行查询，结果写入selection；内存不足返回0
+int query_execute_shm(const Query *query, const ShmRoster *roster, Selection *selection) {
+    QuerySource source = {NULL, NULL, roster};
+    int count = (int)roster->header->count;
+    int words = (count + 63) / 64;
+    selection->count = count;
+    selection->words = calloc(words > 0 ? words : 1, sizeof(uint64_t));
+    if (selection->words == NULL) {
+        return 0;
+    }
+
+    if (query->point_id >= 0) {
+        int index = shm_find_student(roster, query->strings[query->point_id]);
+        if (index != -1) {
+            int base = index / 64 * 64;
+            int n = count - base < 64 ? count - base : 64;
+            selection->words[index / 64] = run_block(query, &source, base, n) & ((uint64_t)1 << (index - base));
+        }
+        return 1;
+    }
+
+    for (int base = 0; base < count; base += QUERY_BLOCK) {
+        int n = count - base < QUERY_BLOCK ? count - base : QUERY_BLOCK;
+        selection->words[base / 64] = run_block(query, &source, base, n);
+    }
+    return 1;
+}
+
+// 在流式读取的一段上执行查询：返回从base起n名（至多64名）学生的选择位图
+uint64_t query_match_chunk(const Query *query, const StreamChunk *chunk, uint32_t base, int n) {
+    QuerySource source = {NULL, chunk, NULL};
+    return run_block(query, &source, (int)base, n);
+}
+
+// 统计被选中的学生数量
+int selection_count(const Selection *selection) {
+    int total = 0;
+    for (int i = 0; i < (selection->count + 63) / 64; i++) {
+        total += __builtin_popcountll(selection->words[i]);
+    }
+    return total;
+}
+
+// 释放选择位图
+void selection_free(Selection *selection) {
+    free(selection->words);
+    selection->words = NULL;
+    selection->count = 0;
+}
@@ -0,0 +1,82 @@
+#ifndef QUERY_H
+#define QUERY_H
+
+#include <stdint.h>
+#include "student.h"
+#include "stream.h"
+#include "collate.h"
+#include "shmroster.h"
+
+#define QUERY_MAX_CODE 64           // 最大指令数
+#define QUERY_MAX_STRINGS 16        // 最多字符串常量数
+#define QUERY_MAX_DEPTH 32          // 求值栈深度
+#define QUERY_BLOCK 64              // 每块行数（与位图字长一致）
+
+// 查询字段；第k门科目的字段为 FIELD_SUBJECT + k
+typedef enum {
+    FIELD_ID,
+    FIELD_NAME,
+    FIELD_AGE,
+    FIELD_AVERAGE,
+    FIELD_SUBJECT
+} QueryField;
+
+// 比较运算符
+typedef enum {
+    CMP_LT,                     // <
+    CMP_LE,                     // <=
+    CMP_GT,                     // >
+    CMP_GE,                     // >=
+    CMP_EQ,                     // ==
+    CMP_NE,                     // !=
+    CMP_PREFIX                  // ^= 前缀匹配
+} CompareOp;
+
+// 字节码操作
+typedef enum {
+    OP_CMP,                     // 比较，结果位图入栈
+    OP_AND,
+    OP_OR,
+    OP_NOT
+} OpCode;
+
+// 一条指令：比较指令携带字段、运算符和常量
+typedef struct {
+    unsigned char opcode;
+    unsigned char field;
+    unsigned char cmp;
+    unsigned char str;          // 字符串常量下标
+    int32_t value;              // 数值常量（成绩为定点数）
+} Instruction;
+
+// 编译后的查询（后缀字节码）
+typedef struct {
+    Instruction code[QUERY_MAX_CODE];
+    int length;
+    char strings[QUERY_MAX_STRINGS][MAX_NAME_LEN];
+    char keys[QUERY_MAX_STRINGS][COLLATE_KEY_LEN(MAX_NAME_LEN)]; // 与姓名比较大小的常量的排序键
+    int string_count;
+    int point_id;               // 形如 id == "x" 的合取项，可走学号查找；-1表示无
+    char error[MAX_NAME_LEN + 64]; // 编译错误信息
+} Query;
+
+// 选择位图：第i位为1表示第i名学生被选中
+typedef struct {
+    uint64_t *words;
+    int count;                  // 覆盖的学生数量
+} Selection;
+
+// 函数声明
+int query_field(const Schema *schema, const char *name);
+int query_compile(Query *query, const Schema *schema, const char *text);
+int query_execute(const Query *query, StudentSystem *system, Selection *selection);
+int query_execute_shm(const Query *query, const ShmRoster *roster, Selection *selection);
+uint64_t query_match_chunk(const Query *query, const StreamChunk *chunk, uint32_t base, int n);
+int selection_count(const Selection *selection);
+void selection_free(Selection *selection);
+int remove_selected_students(StudentSystem *system, const Selection *selection);
+
+// 判断第i名学生是否被选中
+#define selection_test(sel, i) (((sel)->words[(i) / 64] >> ((i) % 64)) & 1)
+
+#endif
@@ -0,0 +1,306 @@
+#define _POSIX_C_SOURCE 200809L
+#include "replica.h"
+#include "changefeed.h"
+#include "config.h"
+#include <time.h>
+
+// 检查变更流的间隔（毫秒）
+static int replica_interval(void) {
+    char value[32];
+    if (config_get("replica_interval", value, sizeof(value)) && atoi(value) > 0) {
+        return atoi(value);
+    }
+    return REPLICA_INTERVAL_MS;
+}
+
+static void find_checkpoint(const ChangeRecord *record, void *context) {
+    uint64_t *from = context;
+    if (record->op == CHANGE_SAVED || record->op == CHANGE_LOADED) {
+        *from = record->position;
+    }
+}
+
+// 变更流中最近一条保存或加载记录给出的序号：数据文件至少包含此序号之前的变更，且这些变更仍保留在变更流中。
+// 变更流还不存在时主服务没有修改过数据，从序号1起即可
+static int latest_checkpoint(const char *path, uint64_t *from) {
+    uint64_t oldest = 0;
+    *from = 0;
+    int status = read_changes(path, 0, find_checkpoint, from, &oldest);
+    if (status == FEED_MISSING) {
+        *from = 1;
+        return 1;
+    }
+    return status == FEED_OK && *from > 0 && *from >= oldest;
+}
+
+// 按学号应用一条增删改：每个学号只在学号索引中查找一次。
+// 修改了学号而新学号尚不存在时原地修改（与主服务一样），不删除后再添加，免去删除时整体移动后面的学生；
+// 新学号已存在时删除原学号，按新学号覆盖
+static int apply_student(StudentSystem *system, const ChangeRecord *record) {
+    int before = record->has_before ? find_student_by_id(system, record->before.id) : -1;
+    if (!record->has_after) {
+        if (before != -1) {
+            remove_student(system, before);
+        }
+        return 1;
+    }
+    int after = record->has_before && strcmp(record->before.id, record->after.id) == 0
+                ? before : find_student_by_id(system, record->after.id);
+    if (after == -1) {
+        return before == -1 ? append_student(system, &record->after)
+                            : set_student(system, before, &record->after);
+    }
+    if (before != -1 && before != after) {
+        remove_student(system, before);
+        if (before < after) {
+            after--;
+        }
+    }
+    return set_student(system, after, &record->after);
+}
+
+// 之后的变更暂不应用，等保存记录后重新加载
+static void start_waiting(Replica *replica, const ChangeRecord *record) {
+    if (!replica->waiting) {
+        replica->waiting = 1;
+        replica->waiting_from = record->seq;
+    }
+}
+
+// 应用读到的一条变更（写锁内）
+static void apply_change(const ChangeRecord *record, void *context) {
+    Replica *replica = context;
+    if (replica->reload_from != 0) {
+        return;                         // 本轮已决定重新加载，其余记录重新加载后再重放
+    }
+    if (replica->pending == 0) {
+        // 本轮第一条未应用的变更：应用大量变更期间，查询到的延迟从它的写入时间算起
+        replica->pending = record->time;
+        pthread_mutex_lock(&replica->lock);
+        replica->pending_since = replica->pending;
+        pthread_mutex_unlock(&replica->lock);
+    }
+    replica->next = record->seq + 1;
+    switch (record->op) {
+        case CHANGE_INSERT:
+        case CHANGE_UPDATE:
+        case CHANGE_DELETE:
+            replica->last_change = record->seq;
+            if (!replica->waiting && !schema_same_subjects(record->schema, &replica->system->schema)) {
+                start_waiting(replica, record);     // 主服务改变了科目
+            }
+            if (!replica->waiting && !apply_student(replica->system, record)) {
+                fprintf(stderr, "警告：内存不足，副本暂停应用变更！\n");
+                start_waiting(replica, record);
+            }
+            break;
+        case CHANGE_RESET:
+            start_waiting(replica, record);
+            break;
+        case CHANGE_SAVED:
+            // 保存的快照若取在开始等待之前，文件中仍是被替换前的数据，继续等更晚的保存
+            replica->saved_from = record->position;
+            if (replica->waiting && record->position > replica->waiting_from) {
+                replica->reload_from = record->position;
+            }
+            break;
+        case CHANGE_LOADED:
+            // 上次保存之后的变更已被主服务丢弃（未保存就重新加载或重新启动）
+            if (replica->waiting || replica->last_change >= replica->saved_from) {
+                replica->reload_from = record->position;
+            }
+            break;
+    }
+    if (!replica->waiting && replica->reload_from == 0) {
+        replica->applied = record->seq;
+    }
+}
+
+// 一轮结束：已追上时不再有未应用的变更
+static void finish_pass(Replica *replica) {
+    if (!replica->waiting && replica->reload_from == 0) {
+        replica->pending = 0;
+    }
+}
+
+// 重新加载主服务的数据文件并整体替换副本的数据，之后从 reload_from 起重放。
+// 数据文件不存在时与主服务一样视为没有学生
+static int reload(Replica *replica) {
+    StudentSystem loaded;
+    init_system(&loaded);
+    int status = read_data_file(&loaded, replica->data_path);
+    if (status == FILE_OK || status == FILE_NOT_FOUND) {
+        StudentSystem *system = shared_write_begin(replica->roster);
+        if (status == FILE_NOT_FOUND) {
+            clear_students(system);
+            status = FILE_OK;
+        } else {
+            Snapshot snapshot;
+            take_snapshot(&loaded, &snapshot);
+            if (!restore_snapshot(system, &snapshot)) {
+                status = FILE_TOO_LARGE;
+            }
+            release_snapshot(&snapshot);
+        }
+        if (!shared_write_end(replica->roster)) {
+            fprintf(stderr, "警告：内存不足，重新加载暂未对查询生效！\n");
+        }
+    }
+    free_system(&loaded);
+    if (status != FILE_OK) {
+        if (!replica->reload_failed) {
+            fprintf(stderr, "警告：副本无法重新加载数据文件 %s，稍后重试！\n", replica->data_path);
+        }
+        replica->reload_failed = 1;
+        return 0;
+    }
+
+    replica->next = replica->reload_from;
+    replica->applied = replica->reload_from - 1;
+    replica->saved_from = replica->reload_from;
+    replica->last_change = 0;
+    replica->reload_from = 0;
+    replica->reload_failed = 0;
+    replica->waiting = 0;
+    replica->pending = 0;
+    return 1;
+}
+
+// 公布本次检查后的状态；head为0表示这次没能读取变更流
+static void publish(Replica *replica, uint64_t head) {
+    pthread_mutex_lock(&replica->lock);
+    replica->status.applied = replica->applied;
+    if (head > 0) {
+        replica->status.primary = head - 1;
+        replica->status.checked = (int64_t)time(NULL);
+    }
+    replica->status.waiting = replica->waiting;
+    replica->pending_since = replica->pending;
+    pthread_mutex_unlock(&replica->lock);
+}
+
+// 检查一次变更流，应用新的变更
+static void follow(Replica *replica) {
+    if (replica->reload_from != 0 && !reload(replica)) {
+        publish(replica, 0);
+        return;
+    }
+    uint64_t head = 0;
+    int status = change_feed_head(replica->feed_path, &head);
+    if (status == FEED_OK && head < replica->next) {
+        status = FEED_GAP;              // 变更流被删除后重新创建过
+    } else if (status == FEED_OK && head > replica->next) {
+        publish(replica, head);         // 先公布新的记录数，应用期间查询到的是落后的状态
+        replica->system = shared_write_begin(replica->roster);
+        status = read_changes(replica->feed_path, replica->next, apply_change, replica, NULL);
+        if (!shared_write_end(replica->roster)) {
+            fprintf(stderr, "警告：内存不足，复制的修改暂未对查询生效！\n");
+        }
+        finish_pass(replica);
+    }
+
+    if (status == FEED_GAP) {
+        // 要读的记录已被丢弃：从仍保留的最近一条保存或加载记录起重新加载；没有时等待下一次保存
+        uint64_t from;
+        if (!replica->waiting) {
+            replica->waiting = 1;
+            replica->pending = (int64_t)time(NULL);
+        }
+        replica->waiting_from = 0;
+        if (latest_checkpoint(replica->feed_path, &from)) {
+            replica->reload_from = from;
+        } else {
+            replica->next = 0;
+        }
+    } else if (status == FEED_ERROR) {
+        fprintf(stderr, "警告：读取变更流 %s 失败！\n", replica->feed_path);
+    }
+    publish(replica, status == FEED_OK || status == FEED_GAP ? head : 0);
+}
+
+// 复制线程：每隔 interval 毫秒检查一次，需要重新加载时立即进行
+static void *replica_main(void *arg) {
+    Replica *replica = arg;
+    pthread_mutex_lock(&replica->lock);
+    while (!replica->stop) {
+        pthread_mutex_unlock(&replica->lock);
+        follow(replica);
+        pthread_mutex_lock(&replica->lock);
+        if (!replica->stop && (replica->reload_from == 0 || replica->reload_failed)) {
+            struct timespec until;
+            clock_gettime(CLOCK_REALTIME, &until);
+            until.tv_sec += replica->interval / 1000;
+            until.tv_nsec += (long)(replica->interval % 1000) * 1000000L;
+            if (until.tv_nsec >= 1000000000L) {
+                until.tv_sec++;
+                until.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait(&replica->wake, &replica->lock, &until);
+        }
+    }
+    pthread_mutex_unlock(&replica->lock);
+    return NULL;
+}
+
+// 准备副本：找到重放的起点并把主服务的数据文件加载到system中（此时还没有其他线程）
+int open_replica(Replica *replica, StudentSystem *system, const char *data_path, const char *feed_path) {
+    memset(replica, 0, sizeof(*replica));
+    snprintf(replica->data_path, sizeof(replica->data_path), "%s", data_path);
+    snprintf(replica->feed_path, sizeof(replica->feed_path), "%s", feed_path);
+    replica->interval = replica_interval();
+
+    uint64_t from;
+    if (!latest_checkpoint(feed_path, &from)) {
+        fprintf(stderr, "错误：无法读取变更流 %s，或其中没有保存、加载记录（先在主服务上保存一次）！\n", feed_path);
+        return 0;
+    }
+    int status = read_data_file(system, data_path);
+    if (status != FILE_OK && status != FILE_NOT_FOUND) {
+        fprintf(stderr, "错误：无法读取数据文件 %s！\n", data_path);
+        return 0;
+    }
+    replica->next = from;
+    replica->saved_from = from;
+    replica->applied = from - 1;
+    replica->status.applied = replica->applied;
+    replica->status.primary = replica->applied;
+    replica->status.checked = (int64_t)time(NULL);
+    return 1;
+}
+
+// 启动复制线程，roster为服务的学生数据
+int start_replica(Replica *replica, SharedRoster *roster) {
+    replica->roster = roster;
+    pthread_mutex_init(&replica->lock, NULL);
+    pthread_cond_init(&replica->wake, NULL);
+    replica->running = pthread_create(&replica->thread, NULL, replica_main, replica) == 0;
+    if (!replica->running) {
+        pthread_mutex_destroy(&replica->lock);
+        pthread_cond_destroy(&replica->wake);
+    }
+    return replica->running;
+}
+
+void stop_replica(Replica *replica) {
+    if (!replica->running) {
+        return;
+    }
+    pthread_mutex_lock(&replica->lock);
+    replica->stop = 1;
+    pthread_cond_signal(&replica->wake);
+    pthread_mutex_unlock(&replica->lock);
+    pthread_join(replica->thread, NULL);
+    replica->running = 0;
+    pthread_mutex_destroy(&replica->lock);
+    pthread_cond_destroy(&replica->wake);
+}
+
+// 取复制状态（可在任意线程中调用）
+void replica_status(Replica *replica, ReplicaStatus *status) {
+    pthread_mutex_lock(&replica->lock);
+    *status = replica->status;
+    int64_t since = replica->pending_since;
+    pthread_mutex_unlock(&replica->lock);
+    int64_t now = (int64_t)time(NULL);
+    status->lag_seconds = since > 0 && now > since ? now - since : 0;
+}
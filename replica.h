@@ -0,0 +1,56 @@
+#ifndef REPLICA_H
+#define REPLICA_H
+
+#include <pthread.h>
+#include "shared.h"
+
+#define REPLICA_INTERVAL_MS 100     // 默认检查变更流的间隔（毫秒），可由配置项 replica_interval 修改
+
+// 只读副本：加载主服务的数据文件，之后持续读取主服务的变更流（changefeed.h）并应用，同时像 serve 一样响应查询。
+// 主服务与副本通过共享目录传递变更，副本只读取主服务的数据文件和变更流，不写入任何文件。
+// 变更按学号应用（添加和修改按学号覆盖，删除按学号删除），从数据文件实际包含的位置之前开始重放结果也相同，
+// 因此启动时从变更流中最近一条保存或加载记录给出的序号起重放即可。
+// 主服务恢复快照、改变科目，或重新加载数据文件而丢弃了副本已应用的变更时，副本暂停应用，
+// 等下一条保存记录后重新加载数据文件（期间继续以旧数据响应查询，落后的时间计入复制延迟）。
+
+// 复制状态
+typedef struct {
+    uint64_t applied;               // 已应用到的序号（数据包含此序号及之前的变更）
+    uint64_t primary;               // 最近一次检查时变更流中最后一条记录的序号
+    int64_t lag_seconds;            // 最早一条未应用的变更已写入多久，已追上时为0
+    int waiting;                    // 等待保存记录后重新加载数据文件
+    int64_t checked;                // 最近一次成功读取变更流的时间（Unix时间）
+} ReplicaStatus;
+
+typedef struct {
+    char data_path[256];            // 主服务的数据文件
+    char feed_path[256];            // 主服务的变更流
+    int interval;                   // 检查间隔（毫秒）
+    SharedRoster *roster;
+    pthread_t thread;
+    int running;
+    pthread_mutex_t lock;           // 保护 stop、status 和 pending_since
+    pthread_cond_t wake;
+    int stop;
+    ReplicaStatus status;           // 最近一次检查后的状态（lag_seconds 在查询时计算）
+    int64_t pending_since;          // 最早一条未应用的变更的写入时间，0表示没有
+    // 以下只由复制线程访问
+    StudentSystem *system;          // 正在应用变更的数据（写锁内）
+    uint64_t next;                  // 下一条要读的序号
+    uint64_t applied;
+    uint64_t reload_from;           // 非0时先重新加载数据文件，再从此序号起重放
+    uint64_t saved_from;            // 最近一条保存记录给出的序号
+    uint64_t last_change;           // 最近一条增删改记录的序号
+    int waiting;
+    uint64_t waiting_from;          // 开始等待的记录序号，此后取的快照才包含主服务替换后的数据
+    int reload_failed;              // 上次重新加载失败（只提示一次）
+    int64_t pending;                // 同 pending_since，检查结束时复制过去
+} Replica;
+
+// 函数声明
+int open_replica(Replica *replica, StudentSystem *system, const char *data_path, const char *feed_path);
+int start_replica(Replica *replica, SharedRoster *roster);
+void stop_replica(Replica *replica);
+void replica_status(Replica *replica, ReplicaStatus *status);
+
+#endif
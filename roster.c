@@ -0,0 +1,600 @@
+#include "student.h"
+#include "views.h"
+#include "changefeed.h"
+#include "parallel.h"
+#include "collate.h"
+
+// 取得可写的一行：块被快照共享时先复制一份
+static void *row_mut(ChunkTable **table, int index) {
+    void *row = chunk_row_mut(table, (uint32_t)index);
+    if (row == NULL) {
+        printf("错误：内存不足！\n");
+        exit(1);
+    }
+    return row;
+}
+
+#define hot_mut(system, i) ((HotRecord *)row_mut(&(system)->hot, i))
+#define cold_mut(system, i) ((ColdRecord *)row_mut(&(system)->cold, i))
+#define score_mut(system, k, i) ((uint16_t *)row_mut(&(system)->scores[k], i))
+#define slot_at(index, pos) (*(const uint32_t *)chunk_row((index)->slots, pos))
+#define slot_mut(index, pos) ((uint32_t *)row_mut(&(index)->slots, (int)(pos)))
+
+// FNV-1a 32位哈希
+static uint32_t hash_id(const char *id) {
+    uint32_t h = 2166136261u;
+    for (const unsigned char *p = (const unsigned char *)id; *p; p++) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// 在学号索引中查找学号所在的槽，找到返回1
+static int id_slot(const StudentSystem *system, const char *id, uint32_t *pos) {
+    const IdHash *index = &system->id_index;
+    for (uint32_t p = hash_id(id) & index->mask; ; p = (p + 1) & index->mask) {
+        uint32_t slot = slot_at(index, p);
+        if (slot == 0) {
+            return 0;
+        }
+        if (slot != ID_SLOT_DELETED && strcmp(student_id_at(system, slot - 1), id) == 0) {
+            *pos = p;
+            return 1;
+        }
+    }
+}
+
+// 把第row名学生的学号放入第一个空的（或已删除的）槽
+static void place_id(StudentSystem *system, int row) {
+    IdHash *index = &system->id_index;
+    uint32_t p = hash_id(student_id_at(system, row)) & index->mask;
+    while (slot_at(index, p) != 0 && slot_at(index, p) != ID_SLOT_DELETED) {
+        p = (p + 1) & index->mask;
+    }
+    if (slot_at(index, p) == 0) {
+        index->used++;
+    }
+    *slot_mut(index, p) = (uint32_t)row + 1;
+}
+
+// 按当前学生和容量重建学号索引（清除已删除的槽）；内存不足时不建立，查找退回逐个比较
+static void build_id_hash(StudentSystem *system) {
+    IdHash *index = &system->id_index;
+    uint32_t size = 16;
+    while (size < (uint32_t)system->capacity * 2) {
+        size <<= 1;
+    }
+    chunk_table_release(index->slots);
+    index->slots = chunk_table_new(sizeof(uint32_t));
+    if (index->slots != NULL && !chunk_table_reserve(&index->slots, size)) {
+        chunk_table_release(index->slots);
+        index->slots = NULL;
+    }
+    index->mask = size - 1;
+    index->used = 0;
+    for (int i = 0; index->slots != NULL && i < system->count; i++) {
+        place_id(system, i);
+    }
+}
+
+// 把第row名学生加入学号索引
+static void index_add(StudentSystem *system, int row) {
+    IdHash *index = &system->id_index;
+    if (index->slots == NULL) {
+        return;
+    }
+    if ((uint64_t)(index->used + 1) * 4 > (uint64_t)(index->mask + 1) * 3) {
+        build_id_hash(system);
+    } else {
+        place_id(system, row);
+    }
+}
+
+// 把第row名学生（按其当前学号）从学号索引中删除
+static void index_remove(StudentSystem *system, int row) {
+    uint32_t p;
+    if (system->id_index.slots != NULL && id_slot(system, student_id_at(system, row), &p)) {
+        *slot_mut(&system->id_index, p) = ID_SLOT_DELETED;
+    }
+}
+
+// 删除第row名学生后，其后的学生下标都减1：逐块改写槽的值
+static void index_shift(StudentSystem *system, int row) {
+    IdHash *index = &system->id_index;
+    uint32_t size = index->mask + 1;
+    for (uint32_t p = 0; index->slots != NULL && p < size; p += CHUNK_ROWS) {
+        uint32_t *slots = slot_mut(index, p);
+        uint32_t n = size - p < CHUNK_ROWS ? size - p : CHUNK_ROWS;
+        for (uint32_t j = 0; j < n; j++) {
+            if (slots[j] != ID_SLOT_DELETED && slots[j] > (uint32_t)row + 1) {
+                slots[j]--;
+            }
+        }
+    }
+}
+
+// 确保至少能容纳capacity名学生，成功返回1
+int reserve_students(StudentSystem *system, int capacity) {
+    if (capacity <= system->capacity) {
+        return 1;
+    }
+
+    int new_capacity = system->capacity > 0 ? system->capacity * 2 : INITIAL_CAPACITY;
+    if (new_capacity < capacity) {
+        new_capacity = capacity;
+    }
+
+    // 按块扩充，已有的块不移动
+    for (int k = 0; k < system->schema.count; k++) {
+        if (!chunk_table_reserve(&system->scores[k], (uint32_t)new_capacity)) {
+            return 0;
+        }
+    }
+    if (!chunk_table_reserve(&system->hot, (uint32_t)new_capacity)
+        || !chunk_table_reserve(&system->cold, (uint32_t)new_capacity)) {
+        return 0;
+    }
+    system->capacity = new_capacity;
+
+    // 过滤器和学号索引按容量重新分配
+    bloom_free(&system->id_filter);
+    if (!bloom_init(&system->id_filter, new_capacity)) {
+        return 0;
+    }
+    rebuild_id_index(system);
+    return 1;
+}
+
+// 由定点成绩计算第index名学生的加权平均分（四舍五入到百分之一分）
+static uint16_t fixed_average(const StudentSystem *system, int index) {
+    const Schema *schema = &system->schema;
+    uint32_t total = 0;
+    for (int k = 0; k < schema->count; k++) {
+        total += (uint32_t)schema->subjects[k].weight * score_at(system, k, index);
+    }
+    return (uint16_t)((total + schema->total_weight / 2) / schema->total_weight);
+}
+
+// 按列重新计算全部平均分：逐块逐列累加，每次只扫描一列连续内存
+void recompute_averages(StudentSystem *system) {
+    const Schema *schema = &system->schema;
+    uint32_t totals[CHUNK_ROWS];
+
+    for (int base = 0; base < system->count; base += CHUNK_ROWS) {
+        int rows = system->count - base < (int)CHUNK_ROWS ? system->count - base : (int)CHUNK_ROWS;
+        memset(totals, 0, sizeof(totals));
+        for (int k = 0; k < schema->count; k++) {
+            const uint16_t *column = chunk_row(system->scores[k], (uint32_t)base);
+            uint32_t weight = schema->subjects[k].weight;
+            for (int i = 0; i < rows; i++) {
+                totals[i] += weight * column[i];
+            }
+        }
+        HotRecord *hot = hot_mut(system, base);
+        for (int i = 0; i < rows; i++) {
+            hot[i].average = (uint16_t)((totals[i] + schema->total_weight / 2) / schema->total_weight);
+        }
+    }
+}
+
+// 取出第index名学生的完整信息
+void get_student(const StudentSystem *system, int index, Student *out) {
+    const HotRecord *r = hot_at(system, index);
+    out->id = student_id_at(system, index);
+    out->name = student_name_at(system, index);
+    out->age = r->age;
+    for (int k = 0; k < system->schema.count; k++) {
+        out->scores[k] = fixed_to_score(score_at(system, k, index));
+    }
+    out->average_score = fixed_to_score(r->average);
+}
+
+// 计算姓名的排序键存入字符串堆（相同的键只存一份），返回偏移；失败返回 STRHEAP_NONE
+static uint32_t intern_name_key(StringHeap *strings, const char *name) {
+    char buffer[COLLATE_KEY_LEN(MAX_NAME_LEN)];
+    size_t len = collate_key(name, buffer, sizeof(buffer));
+    if (len < sizeof(buffer)) {
+        return strheap_intern(strings, buffer);
+    }
+    char *key = malloc(len + 1);
+    if (key == NULL) {
+        return STRHEAP_NONE;
+    }
+    collate_key(name, key, len + 1);
+    uint32_t offset = strheap_intern(strings, key);
+    free(key);
+    return offset;
+}
+
+// 第index名学生的姓名和排序键在字符串堆中占用的字节数
+static size_t name_bytes(const StudentSystem *system, int index) {
+    return strlen(student_name_at(system, index)) + strlen(student_name_key_at(system, index)) + 2;
+}
+
+// 把学生信息写入第index条记录（平均分由成绩重新计算），成功返回1
+int set_student(StudentSystem *system, int index, const Student *student) {
+    ColdRecord cold = *cold_at(system, index);
+    int id_changed = strcmp(student_id_at(system, index), student->id) != 0;
+    int name_changed = strcmp(student_name_at(system, index), student->name) != 0;
+    if (id_changed) {
+        cold.id = strheap_add(system->strings, student->id);
+    }
+    if (name_changed) {
+        cold.name = strheap_intern(system->strings, student->name);
+        cold.name_key = intern_name_key(system->strings, student->name);
+    }
+    if (cold.id == STRHEAP_NONE || cold.name == STRHEAP_NONE || cold.name_key == STRHEAP_NONE) {
+        return 0;
+    }
+    system->string_garbage += (id_changed ? strlen(student_id_at(system, index)) + 1 : 0)
+                              + (name_changed ? name_bytes(system, index) : 0);
+    Student before;
+    get_student(system, index, &before);
+    views_unlink_row(system, index);
+    if (id_changed) {
+        index_remove(system, index);
+    }
+    *cold_mut(system, index) = cold;
+    if (id_changed) {
+        // 新学号加入过滤器和索引，原学号按删除处理
+        bloom_add(&system->id_filter, student->id);
+        if (bloom_remove(&system->id_filter)) {
+            rebuild_id_index(system);
+        } else {
+            index_add(system, index);
+        }
+    }
+
+    for (int k = 0; k < system->schema.count; k++) {
+        *score_mut(system, k, index) = score_to_fixed(student->scores[k]);
+    }
+    HotRecord *r = hot_mut(system, index);
+    r->age = (uint8_t)student->age;
+    r->average = fixed_average(system, index);
+    r->flags |= SLOT_DIRTY;
+    system->edits++;
+    views_link_row(system, index);
+    changes_update(system, &before, index);
+    return 1;
+}
+
+// 追加一名学生到系统末尾，成功返回1
+int append_student(StudentSystem *system, const Student *student) {
+    if (!reserve_students(system, system->count + 1)) {
+        return 0;
+    }
+
+    // 学号互不相同，不需要去重；姓名重复较多，去重存放
+    ColdRecord cold;
+    cold.id = strheap_add(system->strings, student->id);
+    cold.name = strheap_intern(system->strings, student->name);
+    cold.name_key = intern_name_key(system->strings, student->name);
+    if (cold.id == STRHEAP_NONE || cold.name == STRHEAP_NONE || cold.name_key == STRHEAP_NONE) {
+        return 0;
+    }
+    *cold_mut(system, system->count) = cold;
+    for (int k = 0; k < system->schema.count; k++) {
+        *score_mut(system, k, system->count) = score_to_fixed(student->scores[k]);
+    }
+    HotRecord *r = hot_mut(system, system->count);
+    r->flags = SLOT_DIRTY;
+    r->age = (uint8_t)student->age;
+    r->average = fixed_average(system, system->count);
+
+    system->count++;
+    system->edits++;
+    bloom_add(&system->id_filter, student->id);
+    index_add(system, system->count - 1);
+    views_add_row(system, system->count - 1);
+    changes_insert(system, system->count - 1);
+    return 1;
+}
+
+// 把一列中第index行之后的count-index-1行前移一行，按块整段移动
+static void shift_rows(ChunkTable **table, int index, int count) {
+    size_t size = (*table)->elem_size;
+    for (int i = index; i < count - 1; ) {
+        uint32_t span;
+        chunk_span(*table, (uint32_t)i, &span);
+        uint8_t *row = row_mut(table, i);
+        int n = (int)span - 1;
+        if (n > count - 1 - i) {
+            n = count - 1 - i;
+        }
+        memmove(row, row + size, (size_t)n * size);
+        i += n;
+        // 块的最后一行取下一块的第一行
+        if (i < count - 1) {
+            memcpy(row + (size_t)n * size, chunk_row(*table, (uint32_t)i + 1), size);
+            i++;
+        }
+    }
+}
+
+// 删除指定位置的学生
+void remove_student(StudentSystem *system, int index) {
+    changes_delete(system, index);
+    views_remove_row(system, index);
+    index_remove(system, index);
+    system->string_garbage += strlen(student_id_at(system, index)) + 1 + name_bytes(system, index);
+    for (int k = 0; k < system->schema.count; k++) {
+        shift_rows(&system->scores[k], index, system->count);
+    }
+    shift_rows(&system->hot, index, system->count);
+    shift_rows(&system->cold, index, system->count);
+    system->count--;
+    system->layout_changed = 1;
+    system->edits++;
+    if (bloom_remove(&system->id_filter)) {
+        rebuild_id_index(system);
+    } else {
+        index_shift(system, index);
+    }
+}
+
+// 把第from条记录移动到第to个位置（覆盖原内容）。
+// 学号索引随之指向to，第from条成为多余的副本，由调用者随后截去（或用 rebuild_id_index 重建）
+void move_student(StudentSystem *system, int from, int to) {
+    uint32_t from_slot, to_slot;
+    int has_from = system->id_index.slots != NULL && id_slot(system, student_id_at(system, from), &from_slot);
+    int has_to = system->id_index.slots != NULL && id_slot(system, student_id_at(system, to), &to_slot);
+    for (int k = 0; k < system->schema.count; k++) {
+        *score_mut(system, k, to) = score_at(system, k, from);
+    }
+    *hot_mut(system, to) = *hot_at(system, from);
+    *cold_mut(system, to) = *cold_at(system, from);
+    if (has_to) {
+        *slot_mut(&system->id_index, to_slot) = ID_SLOT_DELETED;
+    }
+    if (has_from) {
+        *slot_mut(&system->id_index, from_slot) = (uint32_t)to + 1;
+    }
+    system->layout_changed = 1;
+    system->edits++;
+    views_invalidate(system);
+}
+
+// 交换两条记录
+void swap_students(StudentSystem *system, int a, int b) {
+    uint32_t a_slot, b_slot;
+    int has_a = system->id_index.slots != NULL && id_slot(system, student_id_at(system, a), &a_slot);
+    int has_b = system->id_index.slots != NULL && id_slot(system, student_id_at(system, b), &b_slot);
+    for (int k = 0; k < system->schema.count; k++) {
+        uint16_t score = score_at(system, k, a);
+        *score_mut(system, k, a) = score_at(system, k, b);
+        *score_mut(system, k, b) = score;
+    }
+    HotRecord hot = *hot_at(system, a);
+    ColdRecord cold = *cold_at(system, a);
+    *hot_mut(system, a) = *hot_at(system, b);
+    *cold_mut(system, a) = *cold_at(system, b);
+    *hot_mut(system, b) = hot;
+    *cold_mut(system, b) = cold;
+    if (has_a) {
+        *slot_mut(&system->id_index, a_slot) = (uint32_t)b + 1;
+    }
+    if (has_b) {
+        *slot_mut(&system->id_index, b_slot) = (uint32_t)a + 1;
+    }
+    system->layout_changed = 1;
+    system->edits++;
+    views_invalidate(system);
+}
+
+// 按order重排一列：第i行取原来的第order[i]行，写入新的块表
+static ChunkTable *permute_column(const ChunkTable *table, int count, int capacity, const uint32_t *order) {
+    ChunkTable *permuted = chunk_table_new(table->elem_size);
+    if (permuted == NULL || !chunk_table_reserve(&permuted, (uint32_t)capacity)) {
+        chunk_table_release(permuted);
+        return NULL;
+    }
+    // 新块表未被共享，可以直接按块写入
+    size_t size = table->elem_size;
+    for (int i = 0; i < count; ) {
+        uint32_t span;
+        uint8_t *row = (uint8_t *)chunk_span(permuted, (uint32_t)i, &span);
+        for (uint32_t j = 0; j < span && i < count; j++, i++) {
+            memcpy(row + j * size, chunk_row(table, order[i]), size);
+        }
+    }
+    return permuted;
+}
+
+// 重排时各列互不相关，每列一个任务并行写入
+typedef struct {
+    const ChunkTable *columns[MAX_SUBJECTS + 2];
+    ChunkTable *permuted[MAX_SUBJECTS + 2];
+    int count;
+    int capacity;
+    const uint32_t *order;
+} PermuteColumns;
+
+static void permute_task(void *context, int column) {
+    PermuteColumns *work = context;
+    work->permuted[column] = permute_column(work->columns[column], work->count, work->capacity, work->order);
+}
+
+// 按排列重排全部学生：第i名学生为原来的第order[i]名。各列写入新的块表，快照仍引用原来的块；成功返回1
+int reorder_students(StudentSystem *system, const uint32_t *order) {
+    PermuteColumns work = {{NULL}, {NULL}, system->count, system->capacity, order};
+    int columns = system->schema.count + 2;
+    work.columns[0] = system->hot;
+    work.columns[1] = system->cold;
+    for (int k = 0; k < system->schema.count; k++) {
+        work.columns[k + 2] = system->scores[k];
+    }
+    parallel_for(columns, permute_task, &work);
+
+    int ok = 1;
+    for (int c = 0; c < columns; c++) {
+        ok = ok && work.permuted[c] != NULL;
+    }
+    if (!ok) {
+        for (int c = 0; c < columns; c++) {
+            chunk_table_release(work.permuted[c]);
+        }
+        return 0;
+    }
+
+    chunk_table_release(system->hot);
+    chunk_table_release(system->cold);
+    system->hot = work.permuted[0];
+    system->cold = work.permuted[1];
+    for (int k = 0; k < system->schema.count; k++) {
+        chunk_table_release(system->scores[k]);
+        system->scores[k] = work.permuted[k + 2];
+    }
+    build_id_hash(system);
+    system->layout_changed = 1;
+    system->edits++;
+    views_invalidate(system);
+    return 1;
+}
+
+// 保存或加载后清除修改标志（只复制确有修改标志的块）
+void mark_saved(StudentSystem *system) {
+    for (int i = 0; i < system->count; i++) {
+        if (hot_at(system, i)->flags & SLOT_DIRTY) {
+            hot_mut(system, i)->flags &= ~SLOT_DIRTY;
+        }
+    }
+    system->layout_changed = 0;
+}
+
+// 是否有尚未保存的修改
+int has_unsaved_changes(const StudentSystem *system) {
+    if (system->layout_changed) {
+        return 1;
+    }
+    for (int i = 0; i < system->count; i++) {
+        if (hot_at(system, i)->flags & SLOT_DIRTY) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// 清空所有学生（字符串堆换成新堆，旧堆在快照都释放后回收）
+void clear_students(StudentSystem *system) {
+    system->count = 0;
+    system->edits++;
+    system->layout_changed = 0;
+    strheap_release(system->strings);
+    system->strings = strheap_new();
+    if (system->strings == NULL) {
+        printf("错误：内存不足！\n");
+        exit(1);
+    }
+    system->string_garbage = 0;
+    rebuild_id_index(system);
+    views_invalidate(system);
+}
+
+// 字符串堆只追加：修改学号或姓名、删除学生后，原来的字符串仍留在堆中。
+// 估计的无用字节超过堆的一半时，把仍在使用的学号、姓名和排序键复制到新堆，冷数据换成指向新堆的新块表；
+// 快照、已发布的版本和记下的文件内容仍引用旧堆和旧块表，都释放后才回收。
+// 整理要遍历全部学生，由保存成功后调用（此时没有取自字符串堆的指针在使用）；内存不足时保持原样
+void compact_strings(StudentSystem *system) {
+    if (system->string_garbage < STRHEAP_SEGMENT_SIZE || system->string_garbage * 2 < system->strings->bytes) {
+        return;
+    }
+    StringHeap *strings = strheap_new();
+    ChunkTable *cold = chunk_table_new(sizeof(ColdRecord));
+    int ok = strings != NULL && cold != NULL && chunk_table_reserve(&cold, (uint32_t)system->capacity);
+    for (int i = 0; ok && i < system->count; i++) {
+        ColdRecord *r = chunk_row_mut(&cold, (uint32_t)i);
+        r->id = strheap_add(strings, student_id_at(system, i));
+        r->name = strheap_intern(strings, student_name_at(system, i));
+        r->name_key = strheap_intern(strings, student_name_key_at(system, i));
+        ok = r->id != STRHEAP_NONE && r->name != STRHEAP_NONE && r->name_key != STRHEAP_NONE;
+    }
+    if (!ok) {
+        strheap_release(strings);
+        chunk_table_release(cold);
+        return;
+    }
+    chunk_table_release(system->cold);
+    system->cold = cold;
+    strheap_release(system->strings);
+    system->strings = strings;
+    system->string_garbage = 0;
+}
+
+// 切换科目设置：按科目名保留已有成绩列，新增科目的成绩为0，成功返回1
+int apply_schema(StudentSystem *system, const Schema *schema) {
+    ChunkTable *columns[MAX_SUBJECTS] = {NULL};
+
+    // 先为新增科目分配成绩列，失败时原设置保持不变
+    for (int k = 0; k < schema->count; k++) {
+        if (schema_find(&system->schema, schema->subjects[k].name) != -1) {
+            continue;
+        }
+        columns[k] = chunk_table_new(sizeof(uint16_t));
+        if (columns[k] == NULL || !chunk_table_reserve(&columns[k], (uint32_t)system->capacity)) {
+            for (int j = 0; j <= k; j++) {
+                chunk_table_release(columns[j]);
+            }
+            return 0;
+        }
+    }
+    for (int k = 0; k < schema->count; k++) {
+        int old = schema_find(&system->schema, schema->subjects[k].name);
+        if (old != -1) {
+            columns[k] = system->scores[old];
+            system->scores[old] = NULL;
+        }
+    }
+    for (int k = 0; k < MAX_SUBJECTS; k++) {
+        chunk_table_release(system->scores[k]);
+        system->scores[k] = columns[k];
+    }
+
+    system->schema = *schema;
+    system->edits++;
+    recompute_averages(system);
+    views_invalidate(system);
+    return 1;
+}
+
+// 根据学号查找学生：过滤器判定一定不存在时直接返回，否则查学号索引
+int find_student_by_id(StudentSystem *system, const char *id) {
+    if (!bloom_may_contain(&system->id_filter, id)) {
+        return -1;
+    }
+    uint32_t p;
+    if (system->id_index.slots != NULL) {
+        if (id_slot(system, id, &p)) {
+            return (int)slot_at(&system->id_index, p) - 1;
+        }
+    } else {
+        for (int i = 0; i < system->count; i++) {
+            if (strcmp(student_id_at(system, i), id) == 0) {
+                return i;
+            }
+        }
+    }
+    __atomic_add_fetch(&system->id_filter.false_positives, 1, __ATOMIC_RELAXED);
+    return -1;
+}
+
+// 重建学号过滤器（布隆过滤器不支持删除，清除已删除学号留下的位）和学号索引
+void rebuild_id_index(StudentSystem *system) {
+    bloom_clear(&system->id_filter);
+    for (int i = 0; i < system->count; i++) {
+        bloom_add(&system->id_filter, student_id_at(system, i));
+    }
+    build_id_hash(system);
+}
+
+// 统计学生数据占用的内存（字节）
+size_t roster_memory(const StudentSystem *system) {
+    size_t total = chunk_table_memory(system->hot) + chunk_table_memory(system->cold);
+    for (int k = 0; k < system->schema.count; k++) {
+        total += chunk_table_memory(system->scores[k]);
+    }
+    if (system->id_index.slots != NULL) {
+        total += chunk_table_memory(system->id_index.slots);
+    }
+    return total + strheap_memory(system->strings) + system->id_filter.bit_count / 8;
+}
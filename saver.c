@@ -0,0 +1,206 @@
+#define _POSIX_C_SOURCE 200809L
+#include "saver.h"
+#include "config.h"
+#include "changefeed.h"
+#include "filesync.h"
+
+// 当前时间（秒，单调时钟）
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 保存线程：取出等待的快照写入文件。
+// 数据文件仍是取快照时的那一代才写入；这一代之后只有本线程写入过时，新快照包含写入过的内容，同样可以写入
+static void *saver_main(void *arg) {
+    Saver *saver = arg;
+    pthread_mutex_lock(&saver->lock);
+    for (;;) {
+        while (!saver->has_pending && !saver->stop) {
+            pthread_cond_wait(&saver->wake, &saver->lock);
+        }
+        if (!saver->has_pending) {
+            break;
+        }
+        Snapshot snapshot = saver->pending;
+        unsigned long edits = saver->pending_edits;
+        uint32_t from = saver->pending_generation;
+        uint32_t expected = saver->written != 0 && from == saver->written_from ? saver->written : from;
+        saver->has_pending = 0;
+        saver->busy = 1;
+        pthread_mutex_unlock(&saver->lock);
+
+        double start = now_seconds();
+        uint32_t generation = 0;
+        int status = save_snapshot_if_unchanged(&snapshot, saver->filename, expected, &generation);
+        double seconds = now_seconds() - start;
+        int count = snapshot.count;
+        uint64_t position = snapshot.change_seq;
+
+        pthread_mutex_lock(&saver->lock);
+        if (status == FILE_OK) {
+            if (saver->has_saved) {
+                release_snapshot(&saver->saved);
+            }
+            saver->saved = snapshot;
+            saver->has_saved = 1;
+            saver->saved_generation = generation;
+            saver->written_from = from;
+            saver->written = generation;
+        } else {
+            release_snapshot(&snapshot);
+        }
+        saver->busy = 0;
+        saver->finished = 1;
+        saver->status = status;
+        saver->saved_count = count;
+        saver->saved_edits = edits;
+        saver->saved_change_seq = position;
+        saver->seconds = seconds;
+        pthread_cond_broadcast(&saver->idle);
+    }
+    pthread_mutex_unlock(&saver->lock);
+    return NULL;
+}
+
+// 启动保存线程，成功返回1；失败时调用者应改为直接保存
+int saver_start(Saver *saver, const char *filename, int interval) {
+    memset(saver, 0, sizeof(*saver));
+    snprintf(saver->filename, sizeof(saver->filename), "%s", filename);
+    saver->interval = interval;
+    saver->last_save = time(NULL);
+    pthread_mutex_init(&saver->lock, NULL);
+    pthread_cond_init(&saver->wake, NULL);
+    pthread_cond_init(&saver->idle, NULL);
+    saver->running = pthread_create(&saver->thread, NULL, saver_main, saver) == 0;
+    return saver->running;
+}
+
+// 取快照并提交后台保存；上一次保存尚未开始时以新快照代替
+void saver_save(Saver *saver, StudentSystem *system) {
+    if (!saver->running) {
+        save_to_file(system);
+        return;
+    }
+    Snapshot snapshot;
+    take_snapshot(system, &snapshot);
+
+    pthread_mutex_lock(&saver->lock);
+    if (saver->has_pending) {
+        release_snapshot(&saver->pending);
+    }
+    saver->pending = snapshot;
+    saver->pending_edits = system->edits;
+    saver->pending_generation = system->file_generation;
+    saver->has_pending = 1;
+    saver->last_save = time(NULL);
+    pthread_cond_signal(&saver->wake);
+    pthread_mutex_unlock(&saver->lock);
+}
+
+// 等待已提交的保存全部写完
+static void wait_idle(Saver *saver) {
+    pthread_mutex_lock(&saver->lock);
+    while (saver->busy || saver->has_pending) {
+        pthread_cond_wait(&saver->idle, &saver->lock);
+    }
+    pthread_mutex_unlock(&saver->lock);
+}
+
+// 报告已完成的后台保存；保存后没有新的修改时清除修改标志。
+// 数据文件已被其他进程保存过时改为在前台合并后保存。有结果时返回1
+int saver_check(Saver *saver, StudentSystem *system) {
+    if (!saver->running) {
+        return 0;
+    }
+    pthread_mutex_lock(&saver->lock);
+    int has_saved = saver->has_saved;
+    Snapshot saved = saver->saved;
+    uint32_t generation = saver->saved_generation;
+    saver->has_saved = 0;
+    int finished = saver->finished;
+    int status = saver->status;
+    int count = saver->saved_count;
+    unsigned long edits = saver->saved_edits;
+    uint64_t position = saver->saved_change_seq;
+    double seconds = saver->seconds;
+    saver->finished = 0;
+    pthread_mutex_unlock(&saver->lock);
+
+    if (has_saved) {
+        remember_data_file(system, &saved, generation);
+    }
+    if (!finished) {
+        return 0;
+    }
+    if (status == FILE_CHANGED) {
+        printf("提示：数据文件 %s 已被其他进程保存过，改为合并后保存。\n", saver->filename);
+        wait_idle(saver);
+        save_to_file(system);
+        return 1;
+    }
+    if (status != FILE_OK) {
+        printf("错误：后台保存失败，数据文件 %s 保持不变！\n", saver->filename);
+        return 1;
+    }
+    if (system->edits == edits) {
+        mark_saved(system);
+    }
+    changes_saved(system, position);
+    compact_strings(system);
+    printf("后台保存完成：%d 名学生，耗时 %.3f 秒。\n", count, seconds);
+    return 1;
+}
+
+// 距上次保存超过自动保存间隔且有未保存的修改时，提交后台保存
+void saver_autosave(Saver *saver, StudentSystem *system) {
+    if (saver->interval <= 0 || difftime(time(NULL), saver->last_save) < saver->interval) {
+        return;
+    }
+    pthread_mutex_lock(&saver->lock);
+    int idle = !saver->busy && !saver->has_pending;
+    pthread_mutex_unlock(&saver->lock);
+    if (idle && has_unsaved_changes(system)) {
+        printf("自动保存中...\n");
+        saver_save(saver, system);
+    }
+}
+
+// 等待已提交的保存全部完成并报告结果
+void saver_finish(Saver *saver, StudentSystem *system) {
+    if (!saver->running) {
+        return;
+    }
+    wait_idle(saver);
+    saver_check(saver, system);
+}
+
+// 停止保存线程（已提交的保存会先完成）
+void saver_stop(Saver *saver) {
+    if (saver->running) {
+        pthread_mutex_lock(&saver->lock);
+        saver->stop = 1;
+        pthread_cond_signal(&saver->wake);
+        pthread_mutex_unlock(&saver->lock);
+        pthread_join(saver->thread, NULL);
+        saver->running = 0;
+    }
+    if (saver->has_saved) {
+        release_snapshot(&saver->saved);
+        saver->has_saved = 0;
+    }
+    pthread_mutex_destroy(&saver->lock);
+    pthread_cond_destroy(&saver->wake);
+    pthread_cond_destroy(&saver->idle);
+}
+
+// 从配置文件的 autosave 项读取自动保存间隔（秒），未设置为0
+int autosave_interval(void) {
+    char value[32];
+    if (!config_get("autosave", value, sizeof(value))) {
+        return 0;
+    }
+    int interval = atoi(value);
+    return interval > 0 ? interval : 0;
+}
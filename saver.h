@@ -0,0 +1,45 @@
+#ifndef SAVER_H
+#define SAVER_H
+
+#include <pthread.h>
+#include "student.h"
+
+// 后台保存：前台取快照后交给保存线程写入，写入期间可以继续修改数据
+typedef struct {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;            // 有新的保存任务或要求退出
+    pthread_cond_t idle;            // 一次保存完成
+    int running;                    // 保存线程是否已启动
+    int stop;
+    Snapshot pending;               // 等待写入的快照
+    unsigned long pending_edits;    // 取快照时的修改计数
+    uint32_t pending_generation;    // 取快照时记下的数据文件代数，文件已不是这一代时不写入
+    int has_pending;
+    int busy;                       // 正在写入
+    int finished;                   // 有尚未报告的保存结果
+    int status;                     // 最近一次保存的结果 FILE_*
+    int saved_count;                // 最近一次保存的学生数
+    unsigned long saved_edits;      // 最近一次保存对应的修改计数
+    uint64_t saved_change_seq;      // 最近一次保存的快照对应的变更流序号
+    Snapshot saved;                 // 最近一次写入成功的快照，报告时记为数据文件的内容（filesync.h）
+    int has_saved;
+    uint32_t saved_generation;      // 写入的代数
+    uint32_t written_from;          // 上一次写入成功的快照取快照时记下的代数
+    uint32_t written;               // 上一次写入的代数
+    double seconds;                 // 最近一次保存的耗时
+    int interval;                   // 自动保存间隔（秒），0为不自动保存
+    time_t last_save;               // 最近一次提交保存的时间
+    char filename[256];
+} Saver;
+
+// 函数声明
+int saver_start(Saver *saver, const char *filename, int interval);
+void saver_save(Saver *saver, StudentSystem *system);
+int saver_check(Saver *saver, StudentSystem *system);
+void saver_autosave(Saver *saver, StudentSystem *system);
+void saver_finish(Saver *saver, StudentSystem *system);
+void saver_stop(Saver *saver);
+int autosave_interval(void);
+
+#endif
@@ -0,0 +1,136 @@
+#include "schema.h"
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+// 默认科目：数学、英语、语文，权重相同
+void schema_init_default(Schema *schema) {
+    memset(schema, 0, sizeof(*schema));
+    schema_add(schema, "数学", "math", 1);
+    schema_add(schema, "英语", "english", 1);
+    schema_add(schema, "语文", "chinese", 1);
+}
+
+// 添加一门科目，成功返回1
+int schema_add(Schema *schema, const char *name, const char *alias, int weight) {
+    if (schema->count >= MAX_SUBJECTS || *name == '\0' || strlen(name) >= SUBJECT_NAME_LEN
+        || strlen(alias) >= SUBJECT_NAME_LEN || weight < 1 || weight > 100
+        || schema_find(schema, name) != -1 || (*alias && schema_find(schema, alias) != -1)) {
+        return 0;
+    }
+    Subject *subject = &schema->subjects[schema->count++];
+    strcpy(subject->name, name);
+    strcpy(subject->alias, alias);
+    subject->weight = (uint16_t)weight;
+    schema->total_weight += weight;
+    return 1;
+}
+
+// 按科目名或别名查找，返回下标，找不到返回-1
+int schema_find(const Schema *schema, const char *name) {
+    for (int i = 0; i < schema->count; i++) {
+        if (strcmp(schema->subjects[i].name, name) == 0
+            || (schema->subjects[i].alias[0] && strcmp(schema->subjects[i].alias, name) == 0)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 解析科目设置，格式为逗号分隔的 名称[/别名][:权重]，如 "数学/math:2, 英语, 物理/physics"
+int schema_parse(Schema *schema, const char *spec) {
+    char buffer[1024];
+    snprintf(buffer, sizeof(buffer), "%s", spec);
+    memset(schema, 0, sizeof(*schema));
+
+    for (char *item = strtok(buffer, ","); item != NULL; item = strtok(NULL, ",")) {
+        while (isspace((unsigned char)*item)) {
+            item++;
+        }
+        size_t len = strlen(item);
+        while (len > 0 && isspace((unsigned char)item[len - 1])) {
+            item[--len] = '\0';
+        }
+
+        int weight = 1;
+        char *colon = strchr(item, ':');
+        if (colon != NULL) {
+            *colon = '\0';
+            weight = atoi(colon + 1);
+        }
+        const char *alias = "";
+        char *slash = strchr(item, '/');
+        if (slash != NULL) {
+            *slash = '\0';
+            alias = slash + 1;
+        }
+        if (!schema_add(schema, item, alias, weight)) {
+            return 0;
+        }
+    }
+    return schema->count > 0;
+}
+
+// 从配置文件的 subjects 项读取科目设置，配置存在且有效时返回1
+int schema_load_config(Schema *schema) {
+    char spec[1024];
+    Schema parsed;
+    if (!config_get("subjects", spec, sizeof(spec))) {
+        return 0;
+    }
+    if (!schema_parse(&parsed, spec)) {
+        fprintf(stderr, "警告：%s 中的科目设置无效，已忽略。\n", CONFIG_FILENAME);
+        return 0;
+    }
+    *schema = parsed;
+    return 1;
+}
+
+// 以文件中的科目为准，追加配置文件中新增的科目
+void schema_merge_config(Schema *schema) {
+    Schema configured;
+    if (!schema_load_config(&configured)) {
+        return;
+    }
+    for (int k = 0; k < configured.count; k++) {
+        const Subject *subject = &configured.subjects[k];
+        if (schema_find(schema, subject->name) == -1) {
+            schema_add(schema, subject->name, subject->alias, subject->weight);
+        }
+    }
+}
+
+// 两个科目设置的科目（名称和顺序）是否相同
+int schema_same_subjects(const Schema *a, const Schema *b) {
+    if (a->count != b->count) {
+        return 0;
+    }
+    for (int k = 0; k < a->count; k++) {
+        if (strcmp(a->subjects[k].name, b->subjects[k].name) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// 按科目权重计算定点成绩的平均分（四舍五入到百分之一分）
+uint16_t schema_average(const Schema *schema, const uint16_t *scores) {
+    uint32_t total = 0;
+    for (int k = 0; k < schema->count; k++) {
+        total += (uint32_t)schema->subjects[k].weight * scores[k];
+    }
+    return (uint16_t)((total + schema->total_weight / 2) / schema->total_weight);
+}
+
+// 把科目设置格式化为可读文本（与配置文件格式相同）
+void schema_format(const Schema *schema, char *buffer, size_t size) {
+    size_t used = 0;
+    buffer[0] = '\0';
+    for (int i = 0; i < schema->count && used < size; i++) {
+        const Subject *s = &schema->subjects[i];
+        used += snprintf(buffer + used, size - used, "%s%s%s%s:%d", i > 0 ? ", " : "",
+                         s->name, s->alias[0] ? "/" : "", s->alias, s->weight);
+    }
+}
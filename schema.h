@@ -0,0 +1,40 @@
+#ifndef SCHEMA_H
+#define SCHEMA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MAX_SUBJECTS 32             // 科目数上限（只限制设置，记录按实际科目数分配）
+#define SUBJECT_NAME_LEN 32
+
+// 一门科目
+typedef struct {
+    char name[SUBJECT_NAME_LEN];    // 科目名，如"数学"
+    char alias[SUBJECT_NAME_LEN];   // 别名（可为空），如"math"，用于查询和CSV表头
+    uint16_t weight;                // 计算平均分时的权重
+} Subject;
+
+// 科目设置
+typedef struct {
+    Subject subjects[MAX_SUBJECTS];
+    int count;
+    uint32_t total_weight;          // 权重之和
+} Schema;
+
+// 函数声明
+void schema_init_default(Schema *schema);
+int schema_parse(Schema *schema, const char *spec);
+int schema_load_config(Schema *schema);
+int schema_add(Schema *schema, const char *name, const char *alias, int weight);
+int schema_find(const Schema *schema, const char *name);
+void schema_merge_config(Schema *schema);
+int schema_same_subjects(const Schema *a, const Schema *b);
+uint16_t schema_average(const Schema *schema, const uint16_t *scores);
+void schema_format(const Schema *schema, char *buffer, size_t size);
+
+// 显示用的科目名和表头用的短名
+#define subject_label(schema, k) ((schema)->subjects[k].name)
+#define subject_key(schema, k) \
+    ((schema)->subjects[k].alias[0] ? (schema)->subjects[k].alias : (schema)->subjects[k].name)
+
+#endif
@@ -0,0 +1,971 @@
+#define _POSIX_C_SOURCE 200809L
+#include "server.h"
+#include "protocol.h"
+#include "query.h"
+#include "parallel.h"
+#include "shared.h"
+#include "http.h"
+#include "changefeed.h"
+#include "filesync.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+// 服务模式：数据常驻内存，通过Unix域套接字响应请求（协议见 protocol.h）。
+// 事件循环线程用epoll收发所有连接的数据，已收到的完整请求帧成批交给工作线程处理；
+// 工作线程处理完后把响应放入完成队列，通过eventfd唤醒事件循环，用writev一次发送多个响应。
+// 查询类请求读取已发布的只读版本，不加锁，与修改并发执行；修改类请求之间互斥（shared.h）。
+// 配置了HTTP端口时，同一事件循环和工作线程也处理本机的HTTP请求（http.h），连接按协议区分。
+
+typedef struct Job Job;
+
+// 一个客户端连接。同一连接同时只有一批请求在处理，响应因此与请求顺序一致；
+// 客户端不读取响应、待发送的响应积压过多时，服务端也不再处理和读取它的请求
+typedef struct Connection Connection;
+struct Connection {
+    int fd;
+    Message input;                  // 已收到、尚未处理的字节
+    Message *output;                // 待发送的响应帧，按顺序排列
+    int output_count;
+    size_t output_bytes;            // 待发送的总字节数
+    size_t sent;                    // 第一个响应帧中已发送的字节数
+    uint32_t events;                // 当前向epoll登记的事件
+    int busy;                       // 有请求在工作线程中
+    int closing;                    // 对方已断开，请求处理完后释放（已不再登记epoll事件）
+    int closed;                     // 已关闭，本批epoll事件处理完后释放
+    int http;                       // HTTP连接（否则为二进制协议）
+    int last;                       // 已收到要求关闭连接的HTTP请求，响应发送完后关闭
+    Connection *prev;               // 全部连接的双向链表
+    Connection *next;
+};
+
+// 交给工作线程的一批请求
+struct Job {
+    Connection *connection;
+    uint8_t *requests;              // 连续的若干请求帧（含帧头；HTTP请求也按帧存放）
+    size_t length;
+    int count;                      // 请求帧数
+    int http;
+    Message *responses;             // 各请求对应的完整响应（帧或HTTP响应）
+    Job *next;
+};
+
+typedef struct {
+    SharedRoster roster;            // 学生数据
+    pthread_mutex_t save_lock;      // 同一时间只写一次数据文件
+    pthread_mutex_t queue_lock;     // 保护以下队列和stop
+    pthread_cond_t queue_wake;
+    Job *queue_head;
+    Job *queue_tail;
+    Job *done;                      // 已处理完、等待事件循环发送的请求
+    int stop;
+    int event_fd;
+    int epoll_fd;
+    Connection *connections;        // 全部连接（只由事件循环线程访问）
+    Connection *closed;             // 已关闭、等待释放的连接：同一批epoll事件中后面的事件可能仍指向它们
+    pthread_t workers[PARALLEL_MAX_THREADS];
+    int worker_count;
+    Replica *replica;               // 只读副本的复制线程（replica.h），主服务为NULL
+} Server;
+
+// epoll事件中用以区分非连接的描述符
+static int listen_tag, http_tag, event_tag, signal_tag;
+
+// 以错误信息作为响应
+static void put_error(Message *response, int status, const char *message) {
+    message_put_u8(response, (uint8_t)status);
+    message_put_str16(response, message);
+}
+
+// 读出并检查请求中的学生记录，平均分按当前科目设置重新计算
+static int read_student(Reader *reader, const Schema *schema, Student *s, char *id, char *name,
+                        Message *response) {
+    if (!proto_get_student(reader, s, id, name, MAX_NAME_LEN)) {
+        put_error(response, PROTO_INVALID, "学生记录格式不正确");
+        return 0;
+    }
+    if (!is_valid_id(id)) {
+        put_error(response, PROTO_INVALID, "学号格式不正确");
+        return 0;
+    }
+    if (name[0] == '\0' || s->age < 1 || s->age > 150) {
+        put_error(response, PROTO_INVALID, "姓名或年龄不正确");
+        return 0;
+    }
+    for (int k = 0; k < schema->count; k++) {
+        if (!is_valid_score(s->scores[k])) {
+            put_error(response, PROTO_INVALID, "成绩超出范围");
+            return 0;
+        }
+    }
+    calculate_average(schema, s);
+    return 1;
+}
+
+static void handle_search(Server *server, int reader_slot, Reader *reader, Message *response) {
+    char text[MAX_NAME_LEN * 4];
+    if (!reader_str16(reader, text, sizeof(text))) {
+        put_error(response, PROTO_INVALID, "查询条件过长");
+        return;
+    }
+    RosterVersion *version = shared_read_begin(&server->roster, reader_slot);
+    StudentSystem *system = &version->system;
+    Query query;
+    Selection selection;
+    if (!query_compile(&query, &system->schema, text)) {
+        put_error(response, PROTO_INVALID, query.error);
+    } else if (!query_execute(&query, system, &selection)) {
+        put_error(response, PROTO_ERROR, "内存不足");
+    } else {
+        message_put_u8(response, PROTO_OK);
+        message_put_u32(response, (uint32_t)selection_count(&selection));
+        for (int i = 0; i < selection.count; i++) {
+            if (selection_test(&selection, i)) {
+                Student s;
+                get_student(system, i, &s);
+                proto_put_student(response, system->schema.count, &s);
+            }
+        }
+        selection_free(&selection);
+    }
+    shared_read_end(&server->roster, reader_slot);
+}
+
+// 保存当前版本：写文件期间不妨碍读写，写完若期间没有新的修改才标记为已保存。
+// 数据文件加锁保存；其他进程在此期间保存过时，先在写锁内把对方的修改合并到服务的数据中（filesync.h），
+// 双方都修改过的学生以服务的数据为准
+static void handle_save(Server *server, int reader_slot, Message *response) {
+    Snapshot snapshot;
+    pthread_mutex_lock(&server->save_lock);
+    int lock = lock_data_file(FILENAME);
+    RosterVersion *version = shared_read_begin(&server->roster, reader_slot);
+    take_snapshot(&version->system, &snapshot);
+    unsigned long edits = version->system.edits;
+    uint32_t known = version->system.file_generation;
+    shared_read_end(&server->roster, reader_slot);
+
+    uint32_t current;
+    int status = lock < 0 ? FILE_WRITE_ERROR : FILE_OK;
+    if (status == FILE_OK && data_file_generation(FILENAME, &current) == FILE_OK && current != known) {
+        MergeReport report;
+        release_snapshot(&snapshot);
+        StudentSystem *system = shared_write_begin(&server->roster);
+        status = merge_data_file(system, FILENAME, 1, &report);
+        take_snapshot(system, &snapshot);
+        edits = system->edits;
+        if (!shared_write_end(&server->roster)) {
+            fprintf(stderr, "警告：内存不足，合并的修改暂未对查询生效！\n");
+        }
+        print_merge_report(stdout, &report);
+    }
+
+    uint64_t position = snapshot.change_seq;
+    if (status == FILE_OK) {
+        status = write_data_file(&snapshot, FILENAME);
+    }
+    if (status == FILE_OK) {
+        uint32_t generation;
+        data_file_generation(FILENAME, &generation);
+        StudentSystem *system = shared_write_begin(&server->roster);
+        if (system->edits == edits) {
+            mark_saved(system);
+        }
+        changes_saved(system, position);
+        remember_data_file(system, &snapshot, generation);
+        compact_strings(system);
+        shared_write_end(&server->roster);
+        message_put_u8(response, PROTO_OK);
+    } else {
+        release_snapshot(&snapshot);
+        put_error(response, PROTO_ERROR, status == FILE_CONFLICT ? "数据文件已被其他进程修改，与服务的修改冲突"
+                                                                 : "无法写入数据文件");
+    }
+    unlock_data_file(lock);
+    pthread_mutex_unlock(&server->save_lock);
+}
+
+// 开始一组修改：取得写锁，变更流改为成批写入
+static StudentSystem *begin_updates(Server *server) {
+    StudentSystem *system = shared_write_begin(&server->roster);
+    changes_begin_batch(system);
+    return system;
+}
+
+// 结束一组修改：变更一次写入并同步到磁盘（组提交），再发布新版本。
+// 这组请求的响应在此之后才交给事件循环发送，客户端收到确认时变更已持久
+static void end_updates(Server *server, StudentSystem *system) {
+    changes_end_batch(system);
+    if (!shared_write_end(&server->roster)) {
+        fprintf(stderr, "警告：内存不足，修改暂未对查询生效！\n");
+    }
+}
+
+static int is_update(int op) {
+    return op == PROTO_ADD || op == PROTO_MODIFY || op == PROTO_DELETE;
+}
+
+// 修改请求：添加、修改或删除一名学生（经学号索引定位，删除时其后的学生前移一行）；调用者持有写锁
+static void handle_update(StudentSystem *system, int op, Reader *reader, Message *response) {
+    char id[MAX_ID_LEN], name[MAX_NAME_LEN];
+    Student s;
+    if (op == PROTO_DELETE && !reader_str8(reader, id, sizeof(id))) {
+        put_error(response, PROTO_INVALID, "学号格式不正确");
+        return;
+    }
+    if (op == PROTO_DELETE) {
+        int index = find_student_by_id(system, id);
+        if (index == -1) {
+            message_put_u8(response, PROTO_NOT_FOUND);
+        } else {
+            remove_student(system, index);
+            message_put_u8(response, PROTO_OK);
+        }
+    } else if (read_student(reader, &system->schema, &s, id, name, response)) {
+        int index = find_student_by_id(system, id);
+        if (op == PROTO_ADD && index != -1) {
+            message_put_u8(response, PROTO_EXISTS);
+        } else if (op == PROTO_MODIFY && index == -1) {
+            message_put_u8(response, PROTO_NOT_FOUND);
+        } else if (op == PROTO_ADD ? append_student(system, &s) : set_student(system, index, &s)) {
+            message_put_u8(response, PROTO_OK);
+        } else {
+            put_error(response, PROTO_ERROR, "内存不足");
+        }
+    }
+}
+
+static void handle_request(Server *server, int reader_slot, const uint8_t *request, size_t length,
+                           Message *response);
+
+// 批量请求：先检查全部请求帧，再逐个处理，各响应帧依次写入response
+static void handle_batch(Server *server, int reader_slot, Reader *reader, Message *response) {
+    int count = reader_u16(reader);
+    size_t first = reader->pos;
+    for (int i = 0; i < count && !reader->failed; i++) {
+        uint32_t length = reader_u32(reader);
+        const uint8_t *request = reader_bytes(reader, length);
+        int op = request != NULL && length > 0 ? request[0] : 0;
+        if (op != PROTO_GET && op != PROTO_SEARCH && op != PROTO_STATS && op != PROTO_SCHEMA && op != PROTO_REPLICA) {
+            reader->failed = 1;
+        }
+    }
+    if (reader->failed || count > PROTO_MAX_BATCH || reader->pos != reader->length) {
+        put_error(response, PROTO_INVALID, "批量请求格式不正确或含有修改操作");
+        return;
+    }
+
+    message_put_u8(response, PROTO_OK);
+    message_put_u16(response, (uint16_t)count);
+    reader->pos = first;
+    for (int i = 0; i < count; i++) {
+        uint32_t length = reader_u32(reader);
+        const uint8_t *request = reader_bytes(reader, length);
+        size_t start = proto_begin_frame(response);
+        handle_request(server, reader_slot, request, length, response);
+        proto_end_frame(response, start);
+    }
+}
+
+// 处理一个请求帧，把响应（不含帧头）写入response；reader_slot为工作线程的读者登记位置
+static void handle_request(Server *server, int reader_slot, const uint8_t *request, size_t length,
+                           Message *response) {
+    Reader reader;
+    reader_init(&reader, request, length);
+    int op = reader_u8(&reader);
+    char id[MAX_ID_LEN];
+    RosterVersion *version;
+
+    switch (op) {
+        case PROTO_SCHEMA:
+            version = shared_read_begin(&server->roster, reader_slot);
+            message_put_u8(response, PROTO_OK);
+            proto_put_schema(response, &version->system.schema);
+            shared_read_end(&server->roster, reader_slot);
+            return;
+
+        case PROTO_GET: {
+            if (!reader_str8(&reader, id, sizeof(id))) {
+                put_error(response, PROTO_INVALID, "学号格式不正确");
+                return;
+            }
+            // 版本与当前数据共享学号索引，查找只探测几个槽
+            version = shared_read_begin(&server->roster, reader_slot);
+            int index = find_student_by_id(&version->system, id);
+            if (index == -1) {
+                message_put_u8(response, PROTO_NOT_FOUND);
+            } else {
+                Student s;
+                get_student(&version->system, index, &s);
+                message_put_u8(response, PROTO_OK);
+                proto_put_student(response, version->system.schema.count, &s);
+            }
+            shared_read_end(&server->roster, reader_slot);
+            return;
+        }
+
+        case PROTO_SEARCH:
+            handle_search(server, reader_slot, &reader, response);
+            return;
+
+        case PROTO_STATS: {
+            version = shared_read_begin(&server->roster, reader_slot);
+            const Statistics *stats = version_statistics(version);
+            if (stats == NULL) {
+                put_error(response, PROTO_ERROR, "内存不足");
+            } else {
+                message_put_u8(response, PROTO_OK);
+                proto_put_statistics(response, version->system.schema.count, stats);
+            }
+            shared_read_end(&server->roster, reader_slot);
+            return;
+        }
+
+        case PROTO_ADD:
+        case PROTO_MODIFY:
+        case PROTO_DELETE:
+        case PROTO_SAVE:
+            if (server->replica != NULL) {
+                put_error(response, PROTO_INVALID, "只读副本不能修改数据");
+            } else if (op == PROTO_SAVE) {
+                handle_save(server, reader_slot, response);
+            } else {
+                StudentSystem *system = begin_updates(server);
+                handle_update(system, op, &reader, response);
+                end_updates(server, system);
+            }
+            return;
+
+        case PROTO_REPLICA:
+            if (server->replica == NULL) {
+                message_put_u8(response, PROTO_NOT_FOUND);
+            } else {
+                ReplicaStatus status;
+                replica_status(server->replica, &status);
+                message_put_u8(response, PROTO_OK);
+                proto_put_replica(response, &status);
+            }
+            return;
+
+        case PROTO_BATCH:
+            handle_batch(server, reader_slot, &reader, response);
+            return;
+
+        default:
+            put_error(response, PROTO_INVALID, "未知操作");
+            return;
+    }
+}
+
+// 工作线程：取出请求处理，结果放入完成队列后唤醒事件循环
+static void *worker_main(void *arg) {
+    Server *server = arg;
+    int reader_slot = shared_register_reader(&server->roster);
+    pthread_mutex_lock(&server->queue_lock);
+    for (;;) {
+        while (server->queue_head == NULL && !server->stop) {
+            pthread_cond_wait(&server->queue_wake, &server->queue_lock);
+        }
+        if (server->queue_head == NULL) {
+            break;
+        }
+        Job *job = server->queue_head;
+        server->queue_head = job->next;
+        if (server->queue_head == NULL) {
+            server->queue_tail = NULL;
+        }
+        pthread_mutex_unlock(&server->queue_lock);
+
+        // 流水线发来的连续修改请求在同一次写锁内处理，变更流只同步一次磁盘、只发布一个版本；
+        // 遇到其他请求前结束这组修改，之后的查询能看到前面的修改
+        Reader frames;
+        StudentSystem *updating = NULL;
+        reader_init(&frames, job->requests, job->length);
+        for (int i = 0; i < job->count; i++) {
+            uint32_t length = reader_u32(&frames);
+            const uint8_t *request = reader_bytes(&frames, length);
+            if (job->http) {
+                RosterVersion *version = shared_read_begin(&server->roster, reader_slot);
+                http_respond(version, server->replica, (const char *)request, length, &job->responses[i]);
+                shared_read_end(&server->roster, reader_slot);
+                continue;
+            }
+            size_t start = proto_begin_frame(&job->responses[i]);
+            if (length > 0 && is_update(request[0]) && server->replica == NULL) {
+                if (updating == NULL) {
+                    updating = begin_updates(server);
+                }
+                Reader reader;
+                reader_init(&reader, request + 1, length - 1);
+                handle_update(updating, request[0], &reader, &job->responses[i]);
+            } else {
+                if (updating != NULL) {
+                    end_updates(server, updating);
+                    updating = NULL;
+                }
+                handle_request(server, reader_slot, request, length, &job->responses[i]);
+            }
+            proto_end_frame(&job->responses[i], start);
+        }
+        if (updating != NULL) {
+            end_updates(server, updating);
+        }
+
+        pthread_mutex_lock(&server->queue_lock);
+        job->next = server->done;
+        server->done = job;
+        uint64_t one = 1;
+        if (write(server->event_fd, &one, sizeof(one)) < 0) {
+            // 计数器已满时事件循环必然会被唤醒，无需处理
+        }
+    }
+    pthread_mutex_unlock(&server->queue_lock);
+    shared_unregister_reader(&server->roster, reader_slot);
+    return NULL;
+}
+
+// 按连接状态调整向epoll登记的事件：输入缓冲区满时不再读取，有待发送数据时等待可写
+static void update_events(Server *server, Connection *c) {
+    uint32_t events = 0;
+    if (!c->closing && !c->last && c->input.bytes.size < PROTO_FRAME_HEADER + PROTO_MAX_REQUEST) {
+        events |= EPOLLIN;
+    }
+    if (c->output_count > 0) {
+        events |= EPOLLOUT;
+    }
+    if (events != c->events) {
+        struct epoll_event event = {.events = events, .data.ptr = c};
+        epoll_ctl(server->epoll_fd, EPOLL_CTL_MOD, c->fd, &event);
+        c->events = events;
+    }
+}
+
+// 关闭连接并移出连接链表，内存留到本批事件处理完后由 release_closed 释放
+static void close_connection(Server *server, Connection *c) {
+    if (c->prev != NULL) {
+        c->prev->next = c->next;
+    } else {
+        server->connections = c->next;
+    }
+    if (c->next != NULL) {
+        c->next->prev = c->prev;
+    }
+    epoll_ctl(server->epoll_fd, EPOLL_CTL_DEL, c->fd, NULL);
+    close(c->fd);
+    c->closed = 1;
+    c->next = server->closed;
+    server->closed = c;
+}
+
+// 释放已关闭的连接
+static void release_closed(Server *server) {
+    while (server->closed != NULL) {
+        Connection *c = server->closed;
+        server->closed = c->next;
+        message_free(&c->input);
+        for (int i = 0; i < c->output_count; i++) {
+            message_free(&c->output[i]);
+        }
+        free(c->output);
+        free(c);
+    }
+}
+
+// 尽量发送待发送的响应，每次writev发送多个响应帧；出错返回0
+static int flush_output(Connection *c) {
+    while (c->output_count > 0) {
+        struct iovec iov[SERVER_MAX_IOV];
+        int n = c->output_count < SERVER_MAX_IOV ? c->output_count : SERVER_MAX_IOV;
+        for (int i = 0; i < n; i++) {
+            size_t skip = i == 0 ? c->sent : 0;
+            iov[i].iov_base = c->output[i].bytes.data + skip;
+            iov[i].iov_len = c->output[i].bytes.size - skip;
+        }
+        // 与send的MSG_NOSIGNAL不同，writev在对方已断开时会产生SIGPIPE，run_server已屏蔽该信号
+        ssize_t written = writev(c->fd, iov, n);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+
+        // 去掉已发送完的响应帧
+        c->output_bytes -= (size_t)written;
+        size_t left = (size_t)written + c->sent;
+        int done = 0;
+        while (done < c->output_count && left >= c->output[done].bytes.size) {
+            left -= c->output[done].bytes.size;
+            message_free(&c->output[done]);
+            done++;
+        }
+        c->sent = left;
+        memmove(c->output, c->output + done, (c->output_count - done) * sizeof(Message));
+        c->output_count -= done;
+        if (done < n) {
+            return 1;       // 发送缓冲区已满
+        }
+    }
+    return 1;
+}
+
+// 输入中从offset起的下一个完整请求：返回它占用的字节数，不完整返回0，
+// 格式不正确返回HTTP_INVALID（HTTP请求头过长返回HTTP_TOO_LARGE）；
+// body和body_length为交给工作线程的内容（二进制协议不含帧头）
+static size_t next_request(Connection *c, size_t offset, const uint8_t **body, size_t *body_length) {
+    const uint8_t *data = c->input.bytes.data + offset;
+    size_t size = c->input.bytes.size - offset;
+    if (c->http) {
+        int last;
+        size_t length = http_request_length(data, size, &last);
+        if (length != 0 && length != HTTP_INVALID && length != HTTP_TOO_LARGE) {
+            c->last = last;
+        }
+        *body = data;
+        *body_length = length;
+        return length;
+    }
+    if (size < PROTO_FRAME_HEADER) {
+        return 0;
+    }
+    uint32_t frame = proto_frame_length(data);
+    if (frame == 0 || frame > PROTO_MAX_REQUEST) {
+        return HTTP_INVALID;
+    }
+    *body = data + PROTO_FRAME_HEADER;
+    *body_length = frame;
+    return size < PROTO_FRAME_HEADER + frame ? 0 : PROTO_FRAME_HEADER + frame;
+}
+
+// 无法处理的HTTP请求：错误响应直接排在已有的响应之后（连接空闲时才会走到这里），发送完后关闭连接；
+// 内存不足返回0
+static int reject_request(Connection *c, size_t reason) {
+    Message response;
+    message_init(&response);
+    http_reject(reason, &response);
+    Message *output = response.failed ? NULL : realloc(c->output, (c->output_count + 1) * sizeof(Message));
+    if (output == NULL) {
+        message_free(&response);
+        return 0;
+    }
+    output[c->output_count++] = response;
+    c->output_bytes += response.bytes.size;
+    c->output = output;
+    c->last = 1;
+    return 1;
+}
+
+// 连接空闲、积压的响应不多时，把已收到的完整请求成批交给工作线程；二进制协议的请求格式不正确或内存不足返回0
+static int dispatch(Server *server, Connection *c) {
+    if (c->busy || c->last || c->output_bytes >= SERVER_OUTPUT_LIMIT) {
+        return 1;
+    }
+    Message requests;
+    message_init(&requests);
+    size_t used = 0;
+    int count = 0;
+    while (count < SERVER_MAX_PIPELINE && !c->last) {
+        const uint8_t *body;
+        size_t body_length;
+        size_t length = next_request(c, used, &body, &body_length);
+        if (length == HTTP_INVALID || length == HTTP_TOO_LARGE) {
+            if (count > 0) {
+                break;              // 先处理前面的请求，下一批再应答错误
+            }
+            message_free(&requests);
+            return c->http && reject_request(c, length);
+        }
+        if (length == 0) {
+            break;
+        }
+        size_t start = proto_begin_frame(&requests);
+        message_put(&requests, body, body_length);
+        proto_end_frame(&requests, start);
+        used += length;
+        count++;
+    }
+    if (count == 0 || requests.failed) {
+        int failed = requests.failed;
+        message_free(&requests);
+        return !failed;
+    }
+
+    Job *job = calloc(1, sizeof(Job));
+    if (job == NULL || (job->responses = calloc(count, sizeof(Message))) == NULL) {
+        free(job);
+        message_free(&requests);
+        return 0;
+    }
+    job->requests = requests.bytes.data;
+    job->length = requests.bytes.size;
+    job->count = count;
+    job->http = c->http;
+    job->connection = c;
+    message_consume(&c->input, used);
+    c->busy = 1;
+
+    pthread_mutex_lock(&server->queue_lock);
+    if (server->queue_tail != NULL) {
+        server->queue_tail->next = job;
+    } else {
+        server->queue_head = job;
+    }
+    server->queue_tail = job;
+    pthread_cond_signal(&server->queue_wake);
+    pthread_mutex_unlock(&server->queue_lock);
+    return 1;
+}
+
+// 把一批响应接到待发送的响应之后，内存不足返回0
+static int queue_output(Connection *c, Job *job) {
+    int failed = 0;
+    for (int i = 0; i < job->count; i++) {
+        failed |= job->responses[i].failed;
+    }
+    Message *output = failed ? NULL : realloc(c->output, (c->output_count + job->count) * sizeof(Message));
+    if (output == NULL) {
+        for (int i = 0; i < job->count; i++) {
+            message_free(&job->responses[i]);
+        }
+        return 0;
+    }
+    for (int i = 0; i < job->count; i++) {
+        output[c->output_count++] = job->responses[i];
+        c->output_bytes += job->responses[i].bytes.size;
+    }
+    c->output = output;
+    return 1;
+}
+
+// 连接可读：读到输入缓冲区满或暂无数据为止；对方断开或出错返回0
+static int read_input(Connection *c) {
+    uint8_t data[16384];
+    while (c->input.bytes.size < PROTO_FRAME_HEADER + PROTO_MAX_REQUEST) {
+        size_t room = PROTO_FRAME_HEADER + PROTO_MAX_REQUEST - c->input.bytes.size;
+        ssize_t n = recv(c->fd, data, room < sizeof(data) ? room : sizeof(data), 0);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        if (n == 0) {
+            return 0;
+        }
+        message_put(&c->input, data, (size_t)n);
+        if (c->input.failed) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// 处理一个连接上的事件
+static void connection_event(Server *server, Connection *c, uint32_t events) {
+    int ok = 1;
+    if (events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+        ok = read_input(c);
+    }
+    if (ok && (events & EPOLLOUT)) {
+        ok = flush_output(c);
+    }
+    if (ok) {
+        ok = dispatch(server, c);
+    }
+    if (ok && c->last && !c->busy && c->output_count == 0) {
+        ok = 0;                     // 最后一个HTTP响应已发送完
+    }
+    if (!ok) {
+        // 有请求正在处理时等处理完再释放；先不再登记epoll事件，否则已断开的连接会一直报告EPOLLHUP
+        if (c->busy) {
+            c->closing = 1;
+            epoll_ctl(server->epoll_fd, EPOLL_CTL_DEL, c->fd, NULL);
+            c->events = 0;
+        } else {
+            close_connection(server, c);
+        }
+        return;
+    }
+    update_events(server, c);
+}
+
+// 接受新连接；http表示来自HTTP监听套接字
+static void accept_connections(Server *server, int listen_fd, int http) {
+    for (;;) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0) {
+            return;
+        }
+        Connection *c = calloc(1, sizeof(Connection));
+        if (c == NULL) {
+            close(fd);
+            continue;
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        c->fd = fd;
+        c->http = http;
+        c->events = EPOLLIN;
+        struct epoll_event event = {.events = EPOLLIN, .data.ptr = c};
+        if (epoll_ctl(server->epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+            close(fd);
+            free(c);
+            continue;
+        }
+        c->next = server->connections;
+        if (c->next != NULL) {
+            c->next->prev = c;
+        }
+        server->connections = c;
+    }
+}
+
+// 取回工作线程处理完的请求，发送响应并取下一个请求
+static void finish_jobs(Server *server) {
+    uint64_t value;
+    if (read(server->event_fd, &value, sizeof(value)) < 0) {
+        // 没有计数时只是多检查一次完成队列
+    }
+    pthread_mutex_lock(&server->queue_lock);
+    Job *job = server->done;
+    server->done = NULL;
+    pthread_mutex_unlock(&server->queue_lock);
+
+    while (job != NULL) {
+        Job *next = job->next;
+        Connection *c = job->connection;
+        c->busy = 0;
+        if (c->closing) {
+            for (int i = 0; i < job->count; i++) {
+                message_free(&job->responses[i]);
+            }
+            close_connection(server, c);
+        } else if (!queue_output(c, job)) {
+            close_connection(server, c);
+        } else {
+            connection_event(server, c, EPOLLOUT);
+        }
+        free(job->responses);
+        free(job->requests);
+        free(job);
+        job = next;
+    }
+}
+
+// 创建监听套接字；已有同名套接字时，能连上说明服务已在运行，否则是残留文件，删除后重建
+static int open_listener(const char *path) {
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(address.sun_path)) {
+        fprintf(stderr, "错误：套接字路径过长: %s\n", path);
+        return -1;
+    }
+    strcpy(address.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (connect(fd, (struct sockaddr *)&address, sizeof(address)) == 0) {
+        fprintf(stderr, "错误：服务已在 %s 上运行！\n", path);
+        close(fd);
+        return -1;
+    }
+    unlink(path);
+    if (bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0) {
+        fprintf(stderr, "错误：无法在 %s 上监听！\n", path);
+        close(fd);
+        return -1;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+// 在127.0.0.1的port端口上监听HTTP请求
+static int open_http_listener(int port) {
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons((uint16_t)port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse = 1;
+    if (fd < 0 || setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) != 0
+        || bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0) {
+        fprintf(stderr, "错误：无法在 127.0.0.1:%d 上监听HTTP请求！\n", port);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return -1;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+// 释放剩余的连接（此时工作线程已退出，先取回处理完的请求）
+static void close_all(Server *server) {
+    for (Connection *c = server->connections; c != NULL; c = c->next) {
+        c->closing = 1;
+    }
+    finish_jobs(server);
+    while (server->connections != NULL) {
+        close_connection(server, server->connections);
+    }
+    release_closed(server);
+}
+
+// 服务模式主循环：直到收到SIGINT或SIGTERM；退出前保存未保存的修改。
+// replica不为NULL时作为只读副本运行：由复制线程应用主服务的变更，拒绝修改，退出时不保存
+int run_server(StudentSystem *system, const char *path, Replica *replica) {
+    Server server;
+    memset(&server, 0, sizeof(server));
+    if (!shared_init(&server.roster, system)) {
+        fprintf(stderr, "错误：内存不足！\n");
+        return 0;
+    }
+    server.replica = replica;
+
+    // 信号改由signalfd在事件循环中处理
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+    signal(SIGPIPE, SIG_IGN);       // 客户端断开时writev返回EPIPE，而不是终止进程
+
+    int listen_fd = open_listener(path);
+    int port = http_port();
+    int http_fd = port > 0 && listen_fd >= 0 ? open_http_listener(port) : -1;
+    if (listen_fd < 0 || (port > 0 && http_fd < 0)) {
+        if (listen_fd >= 0) {
+            close(listen_fd);
+            unlink(path);
+        }
+        shared_destroy(&server.roster);
+        return 0;
+    }
+    server.epoll_fd = epoll_create1(0);
+    server.event_fd = eventfd(0, EFD_NONBLOCK);
+    int signal_fd = signalfd(-1, &signals, SFD_NONBLOCK);
+    if (server.epoll_fd < 0 || server.event_fd < 0 || signal_fd < 0) {
+        fprintf(stderr, "错误：无法创建事件循环！\n");
+        close(listen_fd);
+        if (http_fd >= 0) {
+            close(http_fd);
+        }
+        unlink(path);
+        shared_destroy(&server.roster);
+        return 0;
+    }
+    struct epoll_event event = {.events = EPOLLIN, .data.ptr = &listen_tag};
+    epoll_ctl(server.epoll_fd, EPOLL_CTL_ADD, listen_fd, &event);
+    if (http_fd >= 0) {
+        event.data.ptr = &http_tag;
+        epoll_ctl(server.epoll_fd, EPOLL_CTL_ADD, http_fd, &event);
+    }
+    event.data.ptr = &event_tag;
+    epoll_ctl(server.epoll_fd, EPOLL_CTL_ADD, server.event_fd, &event);
+    event.data.ptr = &signal_tag;
+    epoll_ctl(server.epoll_fd, EPOLL_CTL_ADD, signal_fd, &event);
+
+    pthread_mutex_init(&server.save_lock, NULL);
+    pthread_mutex_init(&server.queue_lock, NULL);
+    pthread_cond_init(&server.queue_wake, NULL);
+    int threads = parallel_threads();
+    while (server.worker_count < threads
+           && pthread_create(&server.workers[server.worker_count], NULL, worker_main, &server) == 0) {
+        server.worker_count++;
+    }
+    if (server.worker_count == 0) {
+        fprintf(stderr, "错误：无法创建工作线程！\n");
+    }
+    int running = server.worker_count > 0;
+    if (running && replica != NULL && !start_replica(replica, &server.roster)) {
+        fprintf(stderr, "错误：无法创建复制线程！\n");
+        running = 0;
+    }
+    printf("服务已启动: %s（%d 名学生，%d 个工作线程），按 Ctrl+C 停止\n", path, system->count,
+           server.worker_count);
+    if (running && replica != NULL) {
+        ReplicaStatus status;
+        replica_status(replica, &status);
+        printf("只读副本: 跟随 %s，已应用到序号 %llu\n", replica->feed_path, (unsigned long long)status.applied);
+    }
+    if (http_fd >= 0) {
+        printf("HTTP接口: http://127.0.0.1:%d/\n", port);
+    }
+    fflush(stdout);
+
+    while (running) {
+        struct epoll_event events[SERVER_MAX_EVENTS];
+        int n = epoll_wait(server.epoll_fd, events, SERVER_MAX_EVENTS, -1);
+        if (n < 0 && errno != EINTR) {
+            break;
+        }
+        for (int i = 0; i < n; i++) {
+            void *tag = events[i].data.ptr;
+            if (tag == &listen_tag) {
+                accept_connections(&server, listen_fd, 0);
+            } else if (tag == &http_tag) {
+                accept_connections(&server, http_fd, 1);
+            } else if (tag == &event_tag) {
+                finish_jobs(&server);
+            } else if (tag == &signal_tag) {
+                // 读出信号，否则恢复信号屏蔽后仍会按默认方式处理
+                struct signalfd_siginfo info;
+                if (read(signal_fd, &info, sizeof(info)) == sizeof(info)) {
+                    running = 0;
+                }
+            } else if (!((Connection *)tag)->closed) {
+                connection_event(&server, tag, events[i].events);
+            }
+        }
+        release_closed(&server);
+    }
+
+    // 停止工作线程：队列中已有的请求处理完才退出
+    pthread_mutex_lock(&server.queue_lock);
+    server.stop = 1;
+    pthread_cond_broadcast(&server.queue_wake);
+    pthread_mutex_unlock(&server.queue_lock);
+    for (int i = 0; i < server.worker_count; i++) {
+        pthread_join(server.workers[i], NULL);
+    }
+    if (replica != NULL) {
+        stop_replica(replica);
+    }
+    close_all(&server);
+    close(listen_fd);
+    unlink(path);
+    if (http_fd >= 0) {
+        close(http_fd);
+    }
+    close(signal_fd);
+    close(server.event_fd);
+    close(server.epoll_fd);
+
+    int ok = 1;
+    if (replica == NULL && has_unsaved_changes(system)) {
+        MergeReport report;
+        ok = save_data_file(system, FILENAME, compression_enabled(), 1, &report) == FILE_OK;
+        print_merge_report(stdout, &report);
+        printf(ok ? "数据保存成功！\n" : "错误：无法保存数据文件 %s！\n", FILENAME);
+    }
+    shared_destroy(&server.roster);
+    pthread_mutex_destroy(&server.save_lock);
+    pthread_mutex_destroy(&server.queue_lock);
+    pthread_cond_destroy(&server.queue_wake);
+    pthread_sigmask(SIG_UNBLOCK, &signals, NULL);
+    printf("服务已停止\n");
+    return ok;
+}
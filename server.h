@@ -0,0 +1,15 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include "student.h"
+#include "replica.h"
+
+#define SERVER_MAX_EVENTS 64        // 每次epoll_wait取回的事件数
+#define SERVER_MAX_PIPELINE 256     // 一次交给工作线程的最多请求数（同一连接流水线发来的请求）
+#define SERVER_MAX_IOV 64           // 每次writev最多发送的响应数
+#define SERVER_OUTPUT_LIMIT (1 << 20) // 待发送的响应超过此字节数时暂停处理该连接的请求
+
+// 函数声明
+int run_server(StudentSystem *system, const char *path, Replica *replica);
+
+#endif
@@ -0,0 +1,279 @@
+#define _POSIX_C_SOURCE 200809L
+#include "shared.h"
+#include <unistd.h>
+
+// 为当前数据创建一个版本
+static RosterVersion *new_version(StudentSystem *system) {
+    RosterVersion *version = calloc(1, sizeof(RosterVersion));
+    if (version != NULL && !share_system(system, &version->system)) {
+        free(version);
+        return NULL;
+    }
+    return version;
+}
+
+static void free_version(RosterVersion *version) {
+    free_system(&version->system);
+    free(version->stats);
+    free(version);
+}
+
+// 释放已没有读者的版本：替换时纪元为r的版本，在所有读者的纪元都大于r后释放
+static void reclaim(SharedRoster *roster) {
+    uint64_t oldest = UINT64_MAX;
+    for (int i = 0; i < SHARED_MAX_READERS; i++) {
+        uint64_t epoch = __atomic_load_n(&roster->readers[i].epoch, __ATOMIC_SEQ_CST);
+        if (epoch != 0 && epoch < oldest) {
+            oldest = epoch;
+        }
+    }
+    RosterVersion **link = &roster->retired;
+    while (*link != NULL) {
+        RosterVersion *version = *link;
+        if (version->retired < oldest) {
+            *link = version->next;
+            free_version(version);
+            roster->retired_count--;
+        } else {
+            link = &version->next;
+        }
+    }
+}
+
+// 以system为写者的数据，发布第一个版本，成功返回1
+int shared_init(SharedRoster *roster, StudentSystem *system) {
+    memset(roster, 0, sizeof(*roster));
+    roster->system = system;
+    roster->epoch = 1;
+    roster->current = new_version(system);
+    if (roster->current == NULL) {
+        return 0;
+    }
+    pthread_mutex_init(&roster->write_lock, NULL);
+    return 1;
+}
+
+// 释放全部版本（此时不应再有读者）
+void shared_destroy(SharedRoster *roster) {
+    while (roster->retired != NULL) {
+        RosterVersion *next = roster->retired->next;
+        free_version(roster->retired);
+        roster->retired = next;
+    }
+    free_version(roster->current);
+    pthread_mutex_destroy(&roster->write_lock);
+    memset(roster, 0, sizeof(*roster));
+}
+
+// 登记一个读线程，返回登记位置；位置已满返回-1
+int shared_register_reader(SharedRoster *roster) {
+    for (int i = 0; i < SHARED_MAX_READERS; i++) {
+        int expected = 0;
+        if (__atomic_compare_exchange_n(&roster->readers[i].used, &expected, 1, 0, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_RELAXED)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void shared_unregister_reader(SharedRoster *roster, int reader) {
+    __atomic_store_n(&roster->readers[reader].epoch, 0, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&roster->readers[reader].used, 0, __ATOMIC_RELEASE);
+}
+
+// 开始读取：取得当前版本，在shared_read_end之前一直有效（不阻塞）
+RosterVersion *shared_read_begin(SharedRoster *roster, int reader) {
+    // 先登记纪元再取版本：写者若在登记之后检查读者，必然已能看到新版本的指针
+    uint64_t epoch = __atomic_load_n(&roster->epoch, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&roster->readers[reader].epoch, epoch, __ATOMIC_SEQ_CST);
+    return __atomic_load_n(&roster->current, __ATOMIC_SEQ_CST);
+}
+
+void shared_read_end(SharedRoster *roster, int reader) {
+    __atomic_store_n(&roster->readers[reader].epoch, 0, __ATOMIC_RELEASE);
+}
+
+// 开始修改：取得写锁，返回可修改的数据（写者之间互斥，不影响读者）
+StudentSystem *shared_write_begin(SharedRoster *roster) {
+    pthread_mutex_lock(&roster->write_lock);
+    return roster->system;
+}
+
+// 结束修改：数据有变化时发布新版本，回收旧版本后释放写锁。
+// 内存不足无法发布时返回0，读者继续看到旧版本，下次修改时再发布
+int shared_write_end(SharedRoster *roster) {
+    int ok = 1;
+    RosterVersion *old = roster->current;
+    if (roster->system->edits != old->system.edits) {
+        RosterVersion *version = new_version(roster->system);
+        if (version != NULL) {
+            __atomic_store_n(&roster->current, version, __ATOMIC_SEQ_CST);
+            old->retired = __atomic_fetch_add(&roster->epoch, 1, __ATOMIC_SEQ_CST);
+            old->next = roster->retired;
+            roster->retired = old;
+            roster->retired_count++;
+        } else {
+            ok = 0;
+        }
+    }
+    if (roster->retired != NULL) {
+        reclaim(roster);
+    }
+    pthread_mutex_unlock(&roster->write_lock);
+    return ok;
+}
+
+// 版本的统计结果：第一个需要的读者计算后原子地设置，其他读者直接使用；内存不足返回NULL
+const Statistics *version_statistics(RosterVersion *version) {
+    Statistics *stats = __atomic_load_n(&version->stats, __ATOMIC_ACQUIRE);
+    if (stats != NULL) {
+        return stats;
+    }
+    stats = malloc(sizeof(Statistics));
+    if (stats == NULL) {
+        return NULL;
+    }
+    if (!collect_statistics(&version->system, stats)) {
+        memset(stats, 0, sizeof(*stats));
+    }
+    Statistics *expected = NULL;
+    if (!__atomic_compare_exchange_n(&version->stats, &expected, stats, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        // 其他读者已先设置
+        free(stats);
+        stats = expected;
+    }
+    return stats;
+}
+
+// 压力测试的一个线程：99%按学号查找，1%修改一名学生的年龄
+typedef struct {
+    StudentSystem *system;          // 互斥锁模式下共用的数据
+    pthread_mutex_t *lock;          // 非NULL时为互斥锁模式
+    SharedRoster *roster;           // RCU模式
+    int *stop;
+    uint64_t seed;
+    unsigned long reads;
+    unsigned long writes;
+} StressWorker;
+
+// xorshift伪随机数
+static uint32_t next_random(uint64_t *seed) {
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return (uint32_t)(*seed >> 32);
+}
+
+// 修改第row名学生的年龄（写者已取得独占访问）
+static void stress_write(StudentSystem *system, uint32_t row) {
+    Student s;
+    get_student(system, (int)(row % (uint32_t)system->count), &s);
+    s.age = s.age % 150 + 1;
+    set_student(system, (int)(row % (uint32_t)system->count), &s);
+}
+
+static void *stress_main(void *arg) {
+    StressWorker *w = arg;
+    int reader = w->roster != NULL ? shared_register_reader(w->roster) : -1;
+    while (!__atomic_load_n(w->stop, __ATOMIC_RELAXED)) {
+        uint32_t r = next_random(&w->seed);
+        if (r % 100 == 0) {
+            if (w->lock != NULL) {
+                pthread_mutex_lock(w->lock);
+                stress_write(w->system, r / 100);
+                pthread_mutex_unlock(w->lock);
+            } else {
+                stress_write(shared_write_begin(w->roster), r / 100);
+                shared_write_end(w->roster);
+            }
+            w->writes++;
+            continue;
+        }
+
+        StudentSystem *system;
+        RosterVersion *version = NULL;
+        if (w->lock != NULL) {
+            pthread_mutex_lock(w->lock);
+            system = w->system;
+        } else {
+            version = shared_read_begin(w->roster, reader);
+            system = &version->system;
+        }
+        const char *id = student_id_at(system, r % (uint32_t)system->count);
+        if (find_student_by_id(system, id) < 0) {
+            fprintf(stderr, "错误：学号 %s 查找失败！\n", id);
+        }
+        if (w->lock != NULL) {
+            pthread_mutex_unlock(w->lock);
+        } else {
+            shared_read_end(w->roster, reader);
+        }
+        w->reads++;
+    }
+    if (reader >= 0) {
+        shared_unregister_reader(w->roster, reader);
+    }
+    return NULL;
+}
+
+// 运行一轮压力测试，返回实际线程数
+static int stress_round(StudentSystem *system, SharedRoster *roster, int threads, int seconds,
+                        unsigned long *reads, unsigned long *writes) {
+    pthread_mutex_t lock;
+    pthread_mutex_init(&lock, NULL);
+    StressWorker workers[SHARED_MAX_READERS];
+    pthread_t ids[SHARED_MAX_READERS];
+    int stop = 0, started = 0;
+    for (int i = 0; i < threads; i++) {
+        workers[i] = (StressWorker){system, roster == NULL ? &lock : NULL, roster, &stop,
+                                    0x9E3779B97F4A7C15ull * (uint64_t)(i + 1), 0, 0};
+        if (pthread_create(&ids[i], NULL, stress_main, &workers[i]) != 0) {
+            break;
+        }
+        started++;
+    }
+    sleep((unsigned)seconds);
+    __atomic_store_n(&stop, 1, __ATOMIC_RELAXED);
+    *reads = *writes = 0;
+    for (int i = 0; i < started; i++) {
+        pthread_join(ids[i], NULL);
+        *reads += workers[i].reads;
+        *writes += workers[i].writes;
+    }
+    pthread_mutex_destroy(&lock);
+    return started;
+}
+
+// 读写并发压力测试：threads个线程各运行seconds秒，先用一把互斥锁保护全部访问，
+// 再换成RCU（读者不加锁），比较两者的查找吞吐量。测试中的修改不保存
+int shared_stress(StudentSystem *system, int threads, int seconds) {
+    if (system->count == 0) {
+        printf("系统中没有学生记录！\n");
+        return 0;
+    }
+    if (threads < 1 || threads > SHARED_MAX_READERS) {
+        threads = threads < 1 ? 1 : SHARED_MAX_READERS;
+    }
+    // 测试中的修改不记入变更流
+    struct ChangeFeed *changes = system->changes;
+    system->changes = NULL;
+    unsigned long reads, writes;
+    int started = stress_round(system, NULL, threads, seconds, &reads, &writes);
+    double baseline = (double)reads / seconds;
+    printf("互斥锁: %d 个线程，查找 %.0f 次/秒，修改 %.0f 次/秒\n", started, baseline, (double)writes / seconds);
+
+    SharedRoster roster;
+    if (!shared_init(&roster, system)) {
+        system->changes = changes;
+        printf("错误：内存不足！\n");
+        return 0;
+    }
+    started = stress_round(system, &roster, threads, seconds, &reads, &writes);
+    shared_destroy(&roster);
+    system->changes = changes;
+    double rcu = (double)reads / seconds;
+    printf("RCU:    %d 个线程，查找 %.0f 次/秒，修改 %.0f 次/秒\n", started, rcu, (double)writes / seconds);
+    printf("读吞吐量为互斥锁的 %.2f 倍\n", baseline > 0 ? rcu / baseline : 0.0);
+    return 1;
+}
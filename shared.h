@@ -0,0 +1,51 @@
+#ifndef SHARED_H
+#define SHARED_H
+
+#include <pthread.h>
+#include "student.h"
+
+#define SHARED_MAX_READERS 64       // 最多同时登记的读线程数
+
+// 已发布的只读版本：数据与写者共享未修改的块（写时复制），发布后不再改变
+typedef struct RosterVersion RosterVersion;
+struct RosterVersion {
+    StudentSystem system;           // 只读副本（share_system）
+    Statistics *stats;              // 统计结果，首次使用时计算，原子地设置
+    uint64_t retired;               // 被新版本替换时的纪元
+    RosterVersion *next;            // 待回收链表
+};
+
+// 读线程的登记位置，各占一个缓存行，读者进出时互不干扰
+typedef struct {
+    uint64_t epoch;                 // 正在读的版本所在的纪元，0表示不在读
+    int used;
+    char pad[64 - sizeof(uint64_t) - sizeof(int)];
+} ReaderSlot;
+
+// 多读单写的学生数据（RCU）：
+// 读者取当前版本的指针后直接读取，不加锁也不等待写者；
+// 写者持写锁修改数据，结束时发布新版本替换当前版本。
+// 被替换的版本按纪元回收：等所有读者都已进入更新的纪元后才释放
+typedef struct {
+    StudentSystem *system;          // 写者修改的数据，只在写锁内访问
+    pthread_mutex_t write_lock;
+    RosterVersion *current;         // 当前版本（原子读写）
+    uint64_t epoch;                 // 全局纪元，每发布一个版本加1
+    ReaderSlot readers[SHARED_MAX_READERS];
+    RosterVersion *retired;         // 待回收的版本，只在写锁内访问
+    int retired_count;
+} SharedRoster;
+
+// 函数声明
+int shared_init(SharedRoster *roster, StudentSystem *system);
+void shared_destroy(SharedRoster *roster);
+int shared_register_reader(SharedRoster *roster);
+void shared_unregister_reader(SharedRoster *roster, int reader);
+RosterVersion *shared_read_begin(SharedRoster *roster, int reader);
+void shared_read_end(SharedRoster *roster, int reader);
+StudentSystem *shared_write_begin(SharedRoster *roster);
+int shared_write_end(SharedRoster *roster);
+const Statistics *version_statistics(RosterVersion *version);
+int shared_stress(StudentSystem *system, int threads, int seconds);
+
+#endif
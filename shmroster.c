@@ -0,0 +1,348 @@
+#define _POSIX_C_SOURCE 200809L
+#include "shmroster.h"
+#include "config.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define ALIGN8(n) (((n) + 7) & ~(uint64_t)7)
+
+// 共享内存名：配置项 shm_name，默认 SHM_NAME；名称须以'/'开头
+void shm_default_name(char *name, size_t size) {
+    if (!config_get("shm_name", name, size) || name[0] != '/') {
+        snprintf(name, size, "%s", SHM_NAME);
+    }
+}
+
+// FNV-1a 32位哈希
+static uint32_t hash_id(const char *id) {
+    uint32_t h = 2166136261u;
+    for (const unsigned char *c = (const unsigned char *)id; *c; c++) {
+        h ^= *c;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// 第generation代数据段的名称
+static void generation_name(char *buffer, size_t size, const char *name, uint64_t generation) {
+    snprintf(buffer, size, "%s.%llu", name, (unsigned long long)generation);
+}
+
+// 打开（必要时创建）控制段并映射为可写，失败返回NULL
+static ShmControl *open_control(const char *name, int *fd) {
+    *fd = shm_open(name, O_RDWR | O_CREAT, 0644);
+    if (*fd < 0) {
+        return NULL;
+    }
+    // 发布者之间互斥
+    struct flock lock = {.l_type = F_WRLCK, .l_whence = SEEK_SET};
+    struct stat st;
+    if (fcntl(*fd, F_SETLKW, &lock) != 0 || fstat(*fd, &st) != 0
+        || ((size_t)st.st_size < sizeof(ShmControl) && ftruncate(*fd, sizeof(ShmControl)) != 0)) {
+        close(*fd);
+        return NULL;
+    }
+    ShmControl *control = mmap(NULL, sizeof(ShmControl), PROT_READ | PROT_WRITE, MAP_SHARED, *fd, 0);
+    if (control == MAP_FAILED) {
+        close(*fd);
+        return NULL;
+    }
+    if (memcmp(control->magic, "STSC", 4) != 0 || control->format != SHM_FORMAT) {
+        memcpy(control->magic, "STSC", 4);
+        control->format = SHM_FORMAT;
+        __atomic_store_n(&control->generation, 0, __ATOMIC_RELEASE);
+    }
+    return control;
+}
+
+// 把学生数据写入新建的数据段
+static void fill_segment(const StudentSystem *system, ShmHeader *header, uint8_t *base) {
+    uint32_t n = header->count;
+    uint16_t *scores = (uint16_t *)(base + header->scores);
+    uint16_t *averages = (uint16_t *)(base + header->averages);
+    uint8_t *ages = base + header->ages;
+    uint32_t *ids = (uint32_t *)(base + header->ids);
+    uint32_t *names = (uint32_t *)(base + header->names);
+    uint32_t *name_keys = (uint32_t *)(base + header->name_keys);
+    uint32_t *index = (uint32_t *)(base + header->index);
+    char *strings = (char *)(base + header->strings);
+    uint32_t used = 0;
+
+    for (uint32_t i = 0; i < n; i++) {
+        const HotRecord *r = hot_at(system, i);
+        averages[i] = r->average;
+        ages[i] = r->age;
+        for (int k = 0; k < system->schema.count; k++) {
+            scores[(size_t)k * n + i] = score_at(system, k, i);
+        }
+        const char *texts[3] = {student_id_at(system, i), student_name_at(system, i), student_name_key_at(system, i)};
+        uint32_t *offsets[3] = {&ids[i], &names[i], &name_keys[i]};
+        for (int t = 0; t < 3; t++) {
+            size_t len = strlen(texts[t]) + 1;
+            memcpy(strings + used, texts[t], len);
+            *offsets[t] = used;
+            used += (uint32_t)len;
+        }
+
+        uint32_t pos = hash_id(texts[0]) & (header->index_size - 1);
+        while (index[pos] != 0) {
+            pos = (pos + 1) & (header->index_size - 1);
+        }
+        index[pos] = i + 1;
+    }
+}
+
+// 创建第generation代数据段并写入，成功返回1
+static int create_segment(const StudentSystem *system, const char *segment, uint64_t generation) {
+    uint32_t n = (uint32_t)system->count;
+    uint64_t string_bytes = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        string_bytes += strlen(student_id_at(system, i)) + strlen(student_name_at(system, i))
+                        + strlen(student_name_key_at(system, i)) + 3;
+    }
+    if (string_bytes > UINT32_MAX) {
+        return 0;
+    }
+    uint32_t index_size = 2;
+    while (index_size < 2 * (uint64_t)n) {
+        index_size *= 2;
+    }
+
+    ShmHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "STSD", 4);
+    header.format = SHM_FORMAT;
+    header.generation = generation;
+    header.published = time(NULL);
+    header.count = n;
+    header.index_size = index_size;
+    header.schema = system->schema;
+    if (!collect_statistics(system, &header.stats)) {
+        memset(&header.stats, 0, sizeof(header.stats));
+    }
+    uint64_t size = ALIGN8(sizeof(ShmHeader));
+    header.scores = size;
+    size = ALIGN8(size + (uint64_t)system->schema.count * n * sizeof(uint16_t));
+    header.averages = size;
+    size = ALIGN8(size + (uint64_t)n * sizeof(uint16_t));
+    header.ages = size;
+    size = ALIGN8(size + n);
+    header.ids = size;
+    size = ALIGN8(size + (uint64_t)n * sizeof(uint32_t));
+    header.names = size;
+    size = ALIGN8(size + (uint64_t)n * sizeof(uint32_t));
+    header.name_keys = size;
+    size = ALIGN8(size + (uint64_t)n * sizeof(uint32_t));
+    header.index = size;
+    size = ALIGN8(size + (uint64_t)index_size * sizeof(uint32_t));
+    header.strings = size;
+    size += string_bytes + 1;
+    header.size = size;
+
+    // 上次发布中途失败可能留下同名的段
+    int fd = shm_open(segment, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0 && errno == EEXIST) {
+        shm_unlink(segment);
+        fd = shm_open(segment, O_RDWR | O_CREAT | O_EXCL, 0644);
+    }
+    if (fd < 0) {
+        return 0;
+    }
+    uint8_t *base = MAP_FAILED;
+    if (ftruncate(fd, (off_t)size) == 0) {
+        base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (base == MAP_FAILED) {
+        shm_unlink(segment);
+        return 0;
+    }
+    // 新段内容全为0，哈希表无需清空
+    memcpy(base, &header, sizeof(header));
+    fill_segment(system, &header, base);
+    munmap(base, size);
+    return 1;
+}
+
+// 发布学生数据为新的一代，成功返回1，新代号存入*generation
+int shm_publish(const StudentSystem *system, const char *name, uint64_t *generation) {
+    int fd;
+    ShmControl *control = open_control(name, &fd);
+    if (control == NULL) {
+        return 0;
+    }
+    uint64_t old = __atomic_load_n(&control->generation, __ATOMIC_ACQUIRE);
+    char segment[SHM_NAME_LEN + 24];
+    generation_name(segment, sizeof(segment), name, old + 1);
+    int ok = create_segment(system, segment, old + 1);
+    if (ok) {
+        // 换代：此后挂载或刷新的读者看到新的一代
+        __atomic_store_n(&control->generation, old + 1, __ATOMIC_RELEASE);
+        if (old > 0) {
+            generation_name(segment, sizeof(segment), name, old);
+            shm_unlink(segment);
+        }
+        *generation = old + 1;
+    }
+    munmap(control, sizeof(ShmControl));
+    close(fd);     // 关闭描述符同时释放发布锁
+    return ok;
+}
+
+// 删除共享内存中的数据（已挂载的读者仍可读到各自的一代），成功返回1
+int shm_remove(const char *name) {
+    int fd;
+    ShmControl *control = open_control(name, &fd);
+    if (control == NULL) {
+        return 0;
+    }
+    uint64_t generation = __atomic_load_n(&control->generation, __ATOMIC_ACQUIRE);
+    if (generation > 0) {
+        char segment[SHM_NAME_LEN + 24];
+        generation_name(segment, sizeof(segment), name, generation);
+        shm_unlink(segment);
+    }
+    shm_unlink(name);
+    munmap(control, sizeof(ShmControl));
+    close(fd);
+    return generation > 0;
+}
+
+// 区域[offset, offset+bytes)是否在段内
+static int region_ok(const ShmHeader *header, uint64_t offset, uint64_t bytes) {
+    return offset <= header->size && bytes <= header->size - offset;
+}
+
+// 映射控制段记录的当前一代，替换已映射的一代，成功返回1
+static int map_generation(ShmRoster *roster) {
+    // 读出代号到打开数据段之间可能恰好换代，旧一代的名字已删除时重新读取代号
+    for (int attempt = 0; attempt < 8; attempt++) {
+        uint64_t generation = __atomic_load_n(&roster->control->generation, __ATOMIC_ACQUIRE);
+        if (generation == 0) {
+            return 0;
+        }
+        char segment[SHM_NAME_LEN + 24];
+        generation_name(segment, sizeof(segment), roster->name, generation);
+        int fd = shm_open(segment, O_RDONLY, 0);
+        if (fd < 0) {
+            if (errno == ENOENT) {
+                continue;
+            }
+            return 0;
+        }
+        struct stat st;
+        const ShmHeader *header = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(ShmHeader)) {
+            header = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        if (header == MAP_FAILED) {
+            return 0;
+        }
+
+        uint64_t n = header->count;
+        int ok = memcmp(header->magic, "STSD", 4) == 0 && header->format == SHM_FORMAT
+                 && header->generation == generation && header->size == (uint64_t)st.st_size
+                 && header->schema.count >= 0 && header->schema.count <= MAX_SUBJECTS
+                 && header->index_size >= 2 * n && (header->index_size & (header->index_size - 1)) == 0
+                 && region_ok(header, header->scores, (uint64_t)header->schema.count * n * sizeof(uint16_t))
+                 && region_ok(header, header->averages, n * sizeof(uint16_t))
+                 && region_ok(header, header->ages, n)
+                 && region_ok(header, header->ids, n * sizeof(uint32_t))
+                 && region_ok(header, header->names, n * sizeof(uint32_t))
+                 && region_ok(header, header->name_keys, n * sizeof(uint32_t))
+                 && region_ok(header, header->index, (uint64_t)header->index_size * sizeof(uint32_t))
+                 && header->strings < header->size && ((const char *)header)[header->size - 1] == '\0';
+        if (!ok) {
+            munmap((void *)header, (size_t)st.st_size);
+            return 0;
+        }
+
+        if (roster->header != NULL) {
+            munmap((void *)roster->header, roster->header->size);
+        }
+        const uint8_t *base = (const uint8_t *)header;
+        roster->header = header;
+        roster->generation = generation;
+        roster->scores = (const uint16_t *)(base + header->scores);
+        roster->averages = (const uint16_t *)(base + header->averages);
+        roster->ages = base + header->ages;
+        roster->ids = (const uint32_t *)(base + header->ids);
+        roster->names = (const uint32_t *)(base + header->names);
+        roster->name_keys = (const uint32_t *)(base + header->name_keys);
+        roster->index = (const uint32_t *)(base + header->index);
+        roster->strings = (const char *)(base + header->strings);
+        return 1;
+    }
+    return 0;
+}
+
+// 只读挂载已发布的学生数据，成功返回1
+int shm_attach(ShmRoster *roster, const char *name) {
+    memset(roster, 0, sizeof(*roster));
+    snprintf(roster->name, sizeof(roster->name), "%s", name);
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        return 0;
+    }
+    struct stat st;
+    const ShmControl *control = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(ShmControl)) {
+        control = mmap(NULL, sizeof(ShmControl), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (control == MAP_FAILED) {
+        return 0;
+    }
+    roster->control = control;
+    if (memcmp(control->magic, "STSC", 4) != 0 || control->format != SHM_FORMAT || !map_generation(roster)) {
+        shm_detach(roster);
+        return 0;
+    }
+    return 1;
+}
+
+// 已发布新的一代时改为挂载新的一代：换代返回1，没有变化返回0，
+// 失败返回-1（仍保留原来的一代）。此前取得的学生数据在换代后失效
+int shm_refresh(ShmRoster *roster) {
+    if (__atomic_load_n(&roster->control->generation, __ATOMIC_ACQUIRE) == roster->generation) {
+        return 0;
+    }
+    return map_generation(roster) ? 1 : -1;
+}
+
+void shm_detach(ShmRoster *roster) {
+    if (roster->header != NULL) {
+        munmap((void *)roster->header, roster->header->size);
+    }
+    if (roster->control != NULL) {
+        munmap((void *)roster->control, sizeof(ShmControl));
+    }
+    memset(roster, 0, sizeof(*roster));
+}
+
+// 取出第row名学生（学号和姓名指向共享内存）
+void shm_get_student(const ShmRoster *roster, uint32_t row, Student *out) {
+    out->id = shm_string(roster, roster->ids[row]);
+    out->name = shm_string(roster, roster->names[row]);
+    out->age = roster->ages[row];
+    for (int k = 0; k < roster->header->schema.count; k++) {
+        out->scores[k] = fixed_to_score(shm_score(roster, k, row));
+    }
+    out->average_score = fixed_to_score(roster->averages[row]);
+}
+
+// 按学号查哈希表，找不到返回-1
+int shm_find_student(const ShmRoster *roster, const char *id) {
+    uint32_t mask = roster->header->index_size - 1;
+    for (uint32_t pos = hash_id(id) & mask; roster->index[pos] != 0; pos = (pos + 1) & mask) {
+        uint32_t row = roster->index[pos] - 1;
+        if (strcmp(shm_string(roster, roster->ids[row]), id) == 0) {
+            return (int)row;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,73 @@
+#ifndef SHMROSTER_H
+#define SHMROSTER_H
+
+#include "student.h"
+
+#define SHM_NAME "/students"        // 默认共享内存名，可由配置项 shm_name 修改
+#define SHM_NAME_LEN 128
+#define SHM_FORMAT 1                // 共享内存布局版本
+
+// 共享内存中的学生数据，供其他进程只读挂载、就地查询。
+// 控制段（名为 SHM_NAME）只记录当前代号；每一代数据单独存放在名为"<名称>.<代号>"的段中，
+// 写完整后才把控制段的代号换成新的一代，随后删除旧一代的名字（已挂载的读者不受影响）。
+// 每一代发布后不再修改，读者看到的总是某一代完整的数据
+
+// 控制段
+typedef struct {
+    char magic[4];                  // "STSC"
+    uint32_t format;
+    uint64_t generation;            // 当前代号（原子读写），0表示尚未发布
+} ShmControl;
+
+// 数据段的头部；各部分的位置为相对段首的偏移，均按8字节对齐
+typedef struct {
+    char magic[4];                  // "STSD"
+    uint32_t format;
+    uint64_t generation;
+    uint64_t size;                  // 段的总字节数
+    time_t published;               // 发布时间
+    uint32_t count;                 // 学生数
+    uint32_t index_size;            // 学号哈希表的大小（2的幂）
+    Schema schema;
+    Statistics stats;               // 发布时的统计结果
+    uint64_t scores;                // 定点成绩 uint16_t，第k科第i名为 [k * count + i]
+    uint64_t averages;              // 平均分 uint16_t
+    uint64_t ages;                  // 年龄 uint8_t
+    uint64_t ids;                   // 学号、姓名、姓名排序键在字符串区中的偏移 uint32_t
+    uint64_t names;
+    uint64_t name_keys;
+    uint64_t index;                 // 学号哈希表 uint32_t，存放 下标+1，0表示空位
+    uint64_t strings;               // 字符串区
+} ShmHeader;
+
+// 读者挂载的一代数据
+typedef struct {
+    char name[SHM_NAME_LEN];
+    const ShmControl *control;
+    const ShmHeader *header;
+    uint64_t generation;
+    const uint16_t *scores;
+    const uint16_t *averages;
+    const uint8_t *ages;
+    const uint32_t *ids;
+    const uint32_t *names;
+    const uint32_t *name_keys;
+    const uint32_t *index;
+    const char *strings;
+} ShmRoster;
+
+// 读取挂载的数据
+#define shm_string(r, offset) ((r)->strings + (offset))
+#define shm_score(r, k, i) ((r)->scores[(size_t)(k) * (r)->header->count + (i)])
+
+// 函数声明
+void shm_default_name(char *name, size_t size);
+int shm_publish(const StudentSystem *system, const char *name, uint64_t *generation);
+int shm_remove(const char *name);
+int shm_attach(ShmRoster *roster, const char *name);
+int shm_refresh(ShmRoster *roster);
+void shm_detach(ShmRoster *roster);
+void shm_get_student(const ShmRoster *roster, uint32_t row, Student *out);
+int shm_find_student(const ShmRoster *roster, const char *id);
+
+#endif
@@ -0,0 +1,135 @@
+#include "student.h"
+#include "views.h"
+#include "changefeed.h"
+
+// 取当前数据的快照：只增加各列块表和字符串堆的引用，之后修改时才复制被改动的块
+int take_snapshot(StudentSystem *system, Snapshot *snapshot) {
+    memset(snapshot, 0, sizeof(*snapshot));
+    snapshot->taken = time(NULL);
+    snapshot->schema = system->schema;
+    for (int k = 0; k < system->schema.count; k++) {
+        snapshot->scores[k] = chunk_table_retain(system->scores[k]);
+    }
+    snapshot->hot = chunk_table_retain(system->hot);
+    snapshot->cold = chunk_table_retain(system->cold);
+    snapshot->count = system->count;
+    snapshot->strings = strheap_retain(system->strings);
+    snapshot->change_seq = system->change_seq;
+    return 1;
+}
+
+// 取当前数据的只读副本：与快照一样共享各列、字符串堆、学号过滤器的位数组和学号索引，
+// 可以像原数据一样查找、查询和统计，用free_system释放。成功返回1
+int share_system(const StudentSystem *system, StudentSystem *copy) {
+    memset(copy, 0, sizeof(*copy));
+    bloom_share(&copy->id_filter, &system->id_filter);
+    copy->id_index = system->id_index;
+    if (copy->id_index.slots != NULL) {
+        chunk_table_retain(copy->id_index.slots);
+    }
+    copy->schema = system->schema;
+    for (int k = 0; k < system->schema.count; k++) {
+        copy->scores[k] = chunk_table_retain(system->scores[k]);
+    }
+    copy->hot = chunk_table_retain(system->hot);
+    copy->cold = chunk_table_retain(system->cold);
+    copy->strings = strheap_retain(system->strings);
+    copy->count = system->count;
+    copy->capacity = system->capacity;
+    copy->edits = system->edits;
+    copy->change_seq = system->change_seq;
+    copy->file_generation = system->file_generation;
+    return 1;
+}
+
+// 释放快照（可在其他线程中调用）
+void release_snapshot(Snapshot *snapshot) {
+    for (int k = 0; k < snapshot->schema.count; k++) {
+        chunk_table_release(snapshot->scores[k]);
+    }
+    chunk_table_release(snapshot->hot);
+    chunk_table_release(snapshot->cold);
+    strheap_release(snapshot->strings);
+    memset(snapshot, 0, sizeof(*snapshot));
+}
+
+// 取出快照中第index名学生的完整信息
+void snapshot_get_student(const Snapshot *snapshot, int index, Student *out) {
+    const HotRecord *r = hot_at(snapshot, index);
+    out->id = student_id_at(snapshot, index);
+    out->name = student_name_at(snapshot, index);
+    out->age = r->age;
+    for (int k = 0; k < snapshot->schema.count; k++) {
+        out->scores[k] = fixed_to_score(score_at(snapshot, k, index));
+    }
+    out->average_score = fixed_to_score(r->average);
+}
+
+// 把当前数据恢复为快照的内容（共享快照的块，不复制数据），成功返回1
+int restore_snapshot(StudentSystem *system, const Snapshot *snapshot) {
+    // 容量以快照各列已分配的块为准
+    uint32_t chunks = snapshot->hot->count < snapshot->cold->count ? snapshot->hot->count : snapshot->cold->count;
+    for (int k = 0; k < snapshot->schema.count; k++) {
+        if (snapshot->scores[k]->count < chunks) {
+            chunks = snapshot->scores[k]->count;
+        }
+    }
+    BloomFilter filter;
+    if (!bloom_init(&filter, (int)(chunks * CHUNK_ROWS))) {
+        return 0;
+    }
+
+    for (int k = 0; k < MAX_SUBJECTS; k++) {
+        chunk_table_release(system->scores[k]);
+        system->scores[k] = k < snapshot->schema.count ? chunk_table_retain(snapshot->scores[k]) : NULL;
+    }
+    chunk_table_release(system->hot);
+    chunk_table_release(system->cold);
+    strheap_release(system->strings);
+    system->hot = chunk_table_retain(snapshot->hot);
+    system->cold = chunk_table_retain(snapshot->cold);
+    system->strings = strheap_retain(snapshot->strings);
+    system->schema = snapshot->schema;
+    system->count = snapshot->count;
+    system->capacity = (int)(chunks * CHUNK_ROWS);
+
+    bloom_free(&system->id_filter);
+    system->id_filter = filter;
+    rebuild_id_index(system);
+    system->layout_changed = 1;
+    system->edits++;
+    views_invalidate(system);
+    changes_reset(system);
+    return 1;
+}
+
+// 按名称查找保留的快照，找不到返回-1
+int find_snapshot(const StudentSystem *system, const char *name) {
+    for (int i = 0; i < system->snapshot_count; i++) {
+        if (strcmp(system->snapshots[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 取快照并以name保留在系统中，成功返回1
+int keep_snapshot(StudentSystem *system, const char *name) {
+    Snapshot *snapshots = realloc(system->snapshots, (system->snapshot_count + 1) * sizeof(Snapshot));
+    if (snapshots == NULL) {
+        return 0;
+    }
+    system->snapshots = snapshots;
+    Snapshot *snapshot = &snapshots[system->snapshot_count++];
+    take_snapshot(system, snapshot);
+    snprintf(snapshot->name, sizeof(snapshot->name), "%s", name);
+    return 1;
+}
+
+// 释放并移除第index个保留的快照
+void drop_snapshot(StudentSystem *system, int index) {
+    release_snapshot(&system->snapshots[index]);
+    memmove(&system->snapshots[index], &system->snapshots[index + 1],
+            (system->snapshot_count - index - 1) * sizeof(Snapshot));
+    system->snapshot_count--;
+}
@@ -0,0 +1,464 @@
+#define _POSIX_C_SOURCE 200809L
+#include "sortkey.h"
+#include "query.h"
+#include "parallel.h"
+
+// 解析排序规则：逗号分隔的 字段 [asc|desc|升序|降序]，省略方向为升序；成功返回1
+int sort_spec_parse(SortSpec *spec, const Schema *schema, const char *text) {
+    char buffer[512];
+    snprintf(buffer, sizeof(buffer), "%s", text);
+    memset(spec, 0, sizeof(*spec));
+
+    // 服务模式下多个工作线程会同时解析，不能用strtok
+    char *saved;
+    for (char *item = strtok_r(buffer, ",", &saved); item != NULL; item = strtok_r(NULL, ",", &saved)) {
+        char field[MAX_NAME_LEN] = "", order[16] = "";
+        char extra[2];
+        int words = sscanf(item, "%255s %15s %1s", field, order, extra);
+        if (words <= 0) {
+            snprintf(spec->error, sizeof(spec->error), "排序键不能为空");
+            return 0;
+        }
+        if (words > 2) {
+            snprintf(spec->error, sizeof(spec->error), "排序键格式应为 字段 [asc|desc]");
+            return 0;
+        }
+        if (spec->count == SORT_MAX_KEYS) {
+            snprintf(spec->error, sizeof(spec->error), "排序键最多 %d 个", SORT_MAX_KEYS);
+            return 0;
+        }
+
+        SortKey *key = &spec->keys[spec->count];
+        key->field = query_field(schema, field);
+        if (key->field == -1) {
+            snprintf(spec->error, sizeof(spec->error), "未知字段: %s", field);
+            return 0;
+        }
+        if (order[0] == '\0' || strcmp(order, "asc") == 0 || strcmp(order, "升序") == 0) {
+            key->descending = 0;
+        } else if (strcmp(order, "desc") == 0 || strcmp(order, "降序") == 0) {
+            key->descending = 1;
+        } else {
+            snprintf(spec->error, sizeof(spec->error), "未知排序方向: %s", order);
+            return 0;
+        }
+        spec->count++;
+    }
+    if (spec->count == 0) {
+        snprintf(spec->error, sizeof(spec->error), "缺少排序键");
+        return 0;
+    }
+    return 1;
+}
+
+// 排序规则中是否有姓名（此时参与比较的记录需要姓名的排序键）
+int sort_uses_name(const SortSpec *spec) {
+    for (int i = 0; i < spec->count; i++) {
+        if (spec->keys[i].field == FIELD_NAME) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// 按排序规则比较两名学生，a在前返回负数，b在前返回正数，各键都相同返回0
+int sort_compare(const SortSpec *spec, const SortRecord *a, const SortRecord *b) {
+    for (int i = 0; i < spec->count; i++) {
+        const SortKey *key = &spec->keys[i];
+        int r;
+        switch (key->field) {
+            case FIELD_ID:
+                r = strcmp(a->id, b->id);
+                break;
+            case FIELD_NAME:
+                r = strcmp(a->name_key, b->name_key);
+                break;
+            case FIELD_AGE:
+                r = (a->age > b->age) - (a->age < b->age);
+                break;
+            case FIELD_AVERAGE:
+                r = (a->average > b->average) - (a->average < b->average);
+                break;
+            default: {
+                int k = key->field - FIELD_SUBJECT;
+                r = (a->scores[k] > b->scores[k]) - (a->scores[k] < b->scores[k]);
+                break;
+            }
+        }
+        if (r != 0) {
+            return key->descending ? -r : r;
+        }
+    }
+    return 0;
+}
+
+// 内存中的多键排序：各排序键先规范化为无符号整数（降序时取反），按键的先后从高位到低位
+// 拼接成64位整数，一个字放不下时续到下一个字。之后比较两名学生只需比较这些整数，
+// 排序对下标排列做LSD基数排序：从最后一个字的最低位起逐趟分配，每趟都稳定，不做任何比较。
+// 学生较多时按线程数分段：名次计算各段并行排序后归并，基数排序每趟各段并行统计和分配
+
+// 学号或姓名及其所在行，用于计算名次
+typedef struct {
+    const char *text;
+    uint32_t row;
+} RankItem;
+
+static int compare_rank_items(const void *a, const void *b) {
+    const RankItem *x = a, *y = b;
+    return strcmp(x->text, y->text);
+}
+
+// 有效位数
+static int bit_width(uint32_t value) {
+    return value == 0 ? 0 : 32 - __builtin_clz(value);
+}
+
+// 学生分成blocks段，第b段为 [block_start(n, blocks, b), block_start(n, blocks, b + 1))
+static int block_start(int n, int blocks, int b) {
+    return (int)((int64_t)n * b / blocks);
+}
+
+// 并行排序的分段数：学生较少时不值得启动线程
+static int sort_blocks(int n) {
+    return n >= SORT_PARALLEL_MIN ? parallel_threads() : 1;
+}
+
+// 名次计算：各段分别排序，再逐轮两两归并相邻的有序段
+typedef struct {
+    RankItem *items;
+    RankItem *merged;
+    int n;
+    int blocks;
+    int width;                      // 本轮每个有序段包含的分段数
+} RankSort;
+
+static void sort_rank_block(void *context, int b) {
+    RankSort *sort = context;
+    int lo = block_start(sort->n, sort->blocks, b);
+    qsort(sort->items + lo, block_start(sort->n, sort->blocks, b + 1) - lo, sizeof(RankItem), compare_rank_items);
+}
+
+static void merge_rank_pair(void *context, int pair) {
+    RankSort *sort = context;
+    int first = pair * 2 * sort->width;
+    int lo = block_start(sort->n, sort->blocks, first);
+    int mid = block_start(sort->n, sort->blocks, first + sort->width < sort->blocks ? first + sort->width : sort->blocks);
+    int hi = block_start(sort->n, sort->blocks, first + 2 * sort->width < sort->blocks ? first + 2 * sort->width
+                                                                                       : sort->blocks);
+    int i = lo, j = mid, out = lo;
+    while (i < mid && j < hi) {
+        sort->merged[out++] = compare_rank_items(&sort->items[j], &sort->items[i]) < 0 ? sort->items[j++]
+                                                                                       : sort->items[i++];
+    }
+    memcpy(sort->merged + out, sort->items + i, (mid - i) * sizeof(RankItem));
+    memcpy(sort->merged + out + (mid - i), sort->items + j, (hi - j) * sizeof(RankItem));
+}
+
+// 计算学号或姓名的名次（姓名按排序键比较，键相同名次相同），返回最大名次；内存不足返回-1
+static int64_t string_ranks(const StudentSystem *system, int field, uint32_t *ranks) {
+    int n = system->count;
+    RankSort sort = {NULL, NULL, n, sort_blocks(n), 1};
+    sort.items = malloc((n > 0 ? n : 1) * sizeof(RankItem));
+    sort.merged = sort.blocks > 1 ? malloc((size_t)n * sizeof(RankItem)) : NULL;
+    if (sort.items == NULL || (sort.blocks > 1 && sort.merged == NULL)) {
+        free(sort.items);
+        free(sort.merged);
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        sort.items[i].text = field == FIELD_ID ? student_id_at(system, i) : student_name_key_at(system, i);
+        sort.items[i].row = (uint32_t)i;
+    }
+    parallel_for(sort.blocks, sort_rank_block, &sort);
+    for (; sort.width < sort.blocks; sort.width *= 2) {
+        int pairs = (sort.blocks + 2 * sort.width - 1) / (2 * sort.width);
+        parallel_for(pairs, merge_rank_pair, &sort);
+        RankItem *swap = sort.items;
+        sort.items = sort.merged;
+        sort.merged = swap;
+    }
+
+    RankItem *items = sort.items;
+    uint32_t rank = 0;
+    for (int i = 0; i < n; i++) {
+        if (i > 0 && strcmp(items[i].text, items[i - 1].text) != 0) {
+            rank++;
+        }
+        ranks[items[i].row] = rank;
+    }
+    free(sort.items);
+    free(sort.merged);
+    return rank;
+}
+
+// 把一个排序键的规范化值（降序时取反）拼接到字的低位，各段并行
+typedef struct {
+    const StudentSystem *system;
+    const SortKey *key;
+    const uint32_t *ranks;          // 学号或姓名的名次，其余字段直接读取
+    uint64_t *word;
+    int bits;
+    int n;
+    int blocks;
+} PackKey;
+
+static void pack_block(void *context, int b) {
+    PackKey *pack = context;
+    const StudentSystem *system = pack->system;
+    int field = pack->key->field;
+    uint32_t mask = pack->bits > 0 ? (uint32_t)((1ull << pack->bits) - 1) : 0;
+    for (int i = block_start(pack->n, pack->blocks, b); i < block_start(pack->n, pack->blocks, b + 1); i++) {
+        uint32_t value;
+        if (pack->ranks != NULL) {
+            value = pack->ranks[i];
+        } else if (field == FIELD_AGE) {
+            value = hot_at(system, i)->age;
+        } else if (field == FIELD_AVERAGE) {
+            value = hot_at(system, i)->average;
+        } else {
+            value = score_at(system, field - FIELD_SUBJECT, i);
+        }
+        if (pack->key->descending) {
+            value = mask - value;
+        }
+        pack->word[i] = (pack->word[i] << pack->bits) | value;
+    }
+}
+
+// 基数排序的一趟：各段分别统计本段的位段分布，再按 位段值优先、段号其次 的顺序确定各段的写入位置，
+// 各段并行分配；同一位段值内前面的段写在前面，段内保持原有顺序，因此仍然稳定
+typedef struct {
+    uint64_t *key_in;
+    uint64_t *key_out;
+    uint32_t *row_in;
+    uint32_t *row_out;
+    const uint64_t *word;
+    const uint32_t *order;
+    int n;
+    int blocks;
+    int shift;
+    uint32_t (*counts)[1 << SORT_RADIX_BITS]; // 每段一组计数，分配时改为写入位置
+} RadixPass;
+
+static void gather_block(void *context, int b) {
+    RadixPass *pass = context;
+    for (int i = block_start(pass->n, pass->blocks, b); i < block_start(pass->n, pass->blocks, b + 1); i++) {
+        pass->key_in[i] = pass->word[pass->order[i]];
+        pass->row_in[i] = pass->order[i];
+    }
+}
+
+static void count_block(void *context, int b) {
+    RadixPass *pass = context;
+    const uint32_t mask = (1u << SORT_RADIX_BITS) - 1;
+    uint32_t *counts = pass->counts[b];
+    memset(counts, 0, sizeof(pass->counts[b]));
+    for (int i = block_start(pass->n, pass->blocks, b); i < block_start(pass->n, pass->blocks, b + 1); i++) {
+        counts[(pass->key_in[i] >> pass->shift) & mask]++;
+    }
+}
+
+static void scatter_block(void *context, int b) {
+    RadixPass *pass = context;
+    const uint32_t mask = (1u << SORT_RADIX_BITS) - 1;
+    uint32_t *next = pass->counts[b];
+    for (int i = block_start(pass->n, pass->blocks, b); i < block_start(pass->n, pass->blocks, b + 1); i++) {
+        uint32_t slot = next[(pass->key_in[i] >> pass->shift) & mask]++;
+        pass->key_out[slot] = pass->key_in[i];
+        pass->row_out[slot] = pass->row_in[i];
+    }
+}
+
+// 按一个字的低bits位对order做稳定的LSD基数排序，学生较多时各趟分段并行
+static int radix_sort_word(const uint64_t *word, int bits, uint32_t *order, int n) {
+    RadixPass pass;
+    pass.n = n;
+    pass.blocks = sort_blocks(n);
+    pass.word = word;
+    pass.order = order;
+    uint64_t *keys = malloc(2 * (size_t)n * sizeof(uint64_t));
+    uint32_t *rows = malloc(2 * (size_t)n * sizeof(uint32_t));
+    pass.counts = malloc(pass.blocks * sizeof(*pass.counts));
+    if (keys == NULL || rows == NULL || pass.counts == NULL) {
+        free(keys);
+        free(rows);
+        free(pass.counts);
+        return 0;
+    }
+    pass.key_in = keys;
+    pass.key_out = keys + n;
+    pass.row_in = rows;
+    pass.row_out = rows + n;
+    parallel_for(pass.blocks, gather_block, &pass);
+
+    const uint32_t mask = (1u << SORT_RADIX_BITS) - 1;
+    for (pass.shift = 0; pass.shift < bits; pass.shift += SORT_RADIX_BITS) {
+        parallel_for(pass.blocks, count_block, &pass);
+        // 这一位段全部相同时不必分配
+        uint32_t first = (pass.key_in[0] >> pass.shift) & mask;
+        uint32_t same = 0;
+        for (int b = 0; b < pass.blocks; b++) {
+            same += pass.counts[b][first];
+        }
+        if (same == (uint32_t)n) {
+            continue;
+        }
+        uint32_t sum = 0;
+        for (uint32_t d = 0; d <= mask; d++) {
+            for (int b = 0; b < pass.blocks; b++) {
+                uint32_t c = pass.counts[b][d];
+                pass.counts[b][d] = sum;
+                sum += c;
+            }
+        }
+        parallel_for(pass.blocks, scatter_block, &pass);
+        uint64_t *key_swap = pass.key_in; pass.key_in = pass.key_out; pass.key_out = key_swap;
+        uint32_t *row_swap = pass.row_in; pass.row_in = pass.row_out; pass.row_out = row_swap;
+    }
+    memcpy(order, pass.row_in, (size_t)n * sizeof(uint32_t));
+    free(keys);
+    free(rows);
+    free(pass.counts);
+    return 1;
+}
+
+// 按排序规则计算内存中学生的稳定排序：order[i]为排在第i位的学生下标；成功返回1
+int sort_order(const StudentSystem *system, const SortSpec *spec, uint32_t *order) {
+    int n = system->count;
+    for (int i = 0; i < n; i++) {
+        order[i] = (uint32_t)i;
+    }
+    if (n < 2) {
+        return 1;
+    }
+
+    uint64_t *words[SORT_MAX_KEYS] = {NULL};
+    int word_bits[SORT_MAX_KEYS] = {0};
+    int word_count = 0;
+    uint32_t *ranks = NULL;
+    int ok = 1;
+
+    for (int k = 0; ok && k < spec->count; k++) {
+        PackKey pack = {system, &spec->keys[k], NULL, NULL, 0, n, sort_blocks(n)};
+        int field = spec->keys[k].field;
+        if (field == FIELD_ID || field == FIELD_NAME) {
+            if (ranks == NULL) {
+                ranks = malloc((size_t)n * sizeof(uint32_t));
+            }
+            int64_t max_rank = ranks != NULL ? string_ranks(system, field, ranks) : -1;
+            if (max_rank < 0) {
+                ok = 0;
+                break;
+            }
+            pack.ranks = ranks;
+            pack.bits = bit_width((uint32_t)max_rank);
+        } else {
+            pack.bits = field == FIELD_AGE ? 8 : SORT_SCORE_BITS;
+        }
+        if (pack.bits == 0) {
+            continue;
+        }
+        if (word_count == 0 || word_bits[word_count - 1] + pack.bits > 64) {
+            words[word_count] = calloc(n, sizeof(uint64_t));
+            ok = words[word_count] != NULL;
+            word_count++;
+            if (!ok) {
+                break;
+            }
+        }
+        pack.word = words[word_count - 1];
+        parallel_for(pack.blocks, pack_block, &pack);
+        word_bits[word_count - 1] += pack.bits;
+    }
+    free(ranks);
+
+    for (int w = word_count - 1; ok && w >= 0; w--) {
+        ok = radix_sort_word(words[w], word_bits[w], order, n);
+    }
+    for (int w = 0; w < word_count; w++) {
+        free(words[w]);
+    }
+    return ok;
+}
+
+// 按排序规则比较内存中的两名学生，各键都相同时按下标，与 sort_order 的稳定排序一致
+static int compare_rows(const StudentSystem *system, const SortSpec *spec, uint32_t a, uint32_t b) {
+    for (int i = 0; i < spec->count; i++) {
+        const SortKey *key = &spec->keys[i];
+        int r;
+        switch (key->field) {
+            case FIELD_ID:
+                r = strcmp(student_id_at(system, a), student_id_at(system, b));
+                break;
+            case FIELD_NAME:
+                r = strcmp(student_name_key_at(system, a), student_name_key_at(system, b));
+                break;
+            case FIELD_AGE:
+                r = (hot_at(system, a)->age > hot_at(system, b)->age) - (hot_at(system, a)->age < hot_at(system, b)->age);
+                break;
+            case FIELD_AVERAGE:
+                r = (hot_at(system, a)->average > hot_at(system, b)->average)
+                    - (hot_at(system, a)->average < hot_at(system, b)->average);
+                break;
+            default: {
+                int k = key->field - FIELD_SUBJECT;
+                r = (score_at(system, k, a) > score_at(system, k, b)) - (score_at(system, k, a) < score_at(system, k, b));
+                break;
+            }
+        }
+        if (r != 0) {
+            return key->descending ? -r : r;
+        }
+    }
+    return (a > b) - (a < b);
+}
+
+// 堆顶下沉：堆顶是已选出的学生中排在最后的
+static void sift_down(const StudentSystem *system, const SortSpec *spec, uint32_t *heap, int size, int i) {
+    for (;;) {
+        int largest = i, left = 2 * i + 1, right = left + 1;
+        if (left < size && compare_rows(system, spec, heap[left], heap[largest]) > 0) {
+            largest = left;
+        }
+        if (right < size && compare_rows(system, spec, heap[right], heap[largest]) > 0) {
+            largest = right;
+        }
+        if (largest == i) {
+            return;
+        }
+        uint32_t swap = heap[i];
+        heap[i] = heap[largest];
+        heap[largest] = swap;
+        i = largest;
+    }
+}
+
+// 按排序规则选出排在最前的n名学生，order[0..n)按名次排列（与 sort_order 的前n项相同），返回选出的人数。
+// 用n个元素的堆逐个筛选，O(count·log n)，不排序其余学生、不分配内存也不启动线程，适合在服务线程中使用
+int sort_top(const StudentSystem *system, const SortSpec *spec, uint32_t *order, int n) {
+    int size = 0;
+    if (n <= 0) {
+        return 0;
+    }
+    for (int i = 0; i < system->count; i++) {
+        if (size < n) {
+            order[size++] = (uint32_t)i;
+            for (int j = size - 1; j > 0 && compare_rows(system, spec, order[j], order[(j - 1) / 2]) > 0; j = (j - 1) / 2) {
+                uint32_t swap = order[j];
+                order[j] = order[(j - 1) / 2];
+                order[(j - 1) / 2] = swap;
+            }
+        } else if (compare_rows(system, spec, (uint32_t)i, order[0]) < 0) {
+            order[0] = (uint32_t)i;
+            sift_down(system, spec, order, size, 0);
+        }
+    }
+    // 堆排序：依次把堆顶（剩余中排在最后的）移到末尾
+    for (int end = size - 1; end > 0; end--) {
+        uint32_t swap = order[0];
+        order[0] = order[end];
+        order[end] = swap;
+        sift_down(system, spec, order, end, 0);
+    }
+    return size;
+}
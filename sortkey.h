@@ -0,0 +1,41 @@
+#ifndef SORTKEY_H
+#define SORTKEY_H
+
+#include "student.h"
+
+#define SORT_MAX_KEYS 8             // 最多排序键数
+#define SORT_RADIX_BITS 11          // 基数排序每趟的位数
+#define SORT_SCORE_BITS 14          // 定点成绩（0-10000）的位数
+#define SORT_PARALLEL_MIN 65536     // 学生数达到此值时并行排序
+
+// 一个排序键：字段（同查询字段 QueryField）和方向
+typedef struct {
+    int field;
+    int descending;
+} SortKey;
+
+// 排序规则：依次比较各键，如 "average desc, math desc, id asc"
+typedef struct {
+    SortKey keys[SORT_MAX_KEYS];
+    int count;
+    char error[MAX_NAME_LEN + 64];  // 解析错误信息
+} SortSpec;
+
+// 参与排序的一名学生（成绩为定点数）
+typedef struct {
+    char id[MAX_ID_LEN];
+    const char *name;
+    const char *name_key;           // 姓名的排序键（collate.h），只在按姓名排序时需要
+    uint8_t age;
+    uint16_t average;
+    uint16_t scores[MAX_SUBJECTS];
+} SortRecord;
+
+// 函数声明
+int sort_spec_parse(SortSpec *spec, const Schema *schema, const char *text);
+int sort_uses_name(const SortSpec *spec);
+int sort_compare(const SortSpec *spec, const SortRecord *a, const SortRecord *b);
+int sort_order(const StudentSystem *system, const SortSpec *spec, uint32_t *order);
+int sort_top(const StudentSystem *system, const SortSpec *spec, uint32_t *order, int n);
+
+#endif
@@ -0,0 +1,265 @@
+#define _POSIX_C_SOURCE 200809L
+#include "stream.h"
+
+// 释放一段
+static void free_chunk(StreamChunk *chunk) {
+    free_decoded_block(&chunk->rows);
+    free(chunk->averages);
+    chunk->averages = NULL;
+}
+
+// 从普通格式（含旧版格式）顺序读入至多STREAM_ROWS名学生
+static int read_plain_chunk(StudentStream *stream, StreamChunk *chunk) {
+    DecodedBlock *block = &chunk->rows;
+    uint32_t rows = stream->remaining < STREAM_ROWS ? stream->remaining : STREAM_ROWS;
+    int subjects = stream->schema.count;
+    block->rows = rows;
+    block->ids = malloc(rows * sizeof(*block->ids));
+    block->names = malloc(rows * sizeof(char *));
+    block->ages = malloc(rows);
+    block->scores = calloc((size_t)rows * subjects, sizeof(uint16_t));
+    uint32_t *name_offsets = malloc(rows * sizeof(uint32_t));
+    size_t used = 0, capacity = 0;
+    if (block->ids == NULL || block->names == NULL || block->ages == NULL || block->scores == NULL
+        || name_offsets == NULL) {
+        free(name_offsets);
+        return FILE_TOO_LARGE;
+    }
+
+    char name[STRHEAP_SEGMENT_SIZE];
+    uint16_t scores[MAX_SUBJECTS];
+    int status = FILE_OK;
+    for (uint32_t r = 0; status == FILE_OK && r < rows; r++) {
+        if (!read_data_record(&stream->data, block->ids[r], name, &block->ages[r], scores)) {
+            status = FILE_READ_ERROR;
+            break;
+        }
+        for (int k = 0; k < stream->data.schema.count; k++) {
+            block->scores[(size_t)k * rows + r] = scores[k];
+        }
+
+        // 姓名依次存入names_data，读完一段后再换算成指针
+        size_t len = strlen(name) + 1;
+        if (used + len > capacity) {
+            size_t grown = capacity > 0 ? capacity * 2 : 16 * STREAM_ROWS;
+            while (grown < used + len) {
+                grown *= 2;
+            }
+            char *data = realloc(block->names_data, grown);
+            if (data == NULL) {
+                status = FILE_TOO_LARGE;
+                break;
+            }
+            block->names_data = data;
+            capacity = grown;
+        }
+        memcpy(block->names_data + used, name, len);
+        name_offsets[r] = (uint32_t)used;
+        used += len;
+    }
+    if (status == FILE_OK) {
+        for (uint32_t r = 0; r < rows; r++) {
+            block->names[r] = block->names_data + name_offsets[r];
+        }
+        stream->remaining -= rows;
+    }
+    free(name_offsets);
+    return status;
+}
+
+// 从压缩格式读入下一块；文件中的科目少于流的科目设置时，补上成绩为0的列
+static int read_compressed_chunk(StudentStream *stream, StreamChunk *chunk) {
+    DecodedBlock *block = &chunk->rows;
+    int status = read_block(stream->data.file, &stream->index.entries[stream->next_block],
+                            stream->data.schema.count, block);
+    if (status != FILE_OK) {
+        return status;
+    }
+    stream->next_block++;
+
+    int file_subjects = stream->data.schema.count;
+    if (stream->schema.count > file_subjects) {
+        uint16_t *scores = realloc(block->scores, (size_t)block->rows * stream->schema.count * sizeof(uint16_t));
+        if (scores == NULL) {
+            return FILE_TOO_LARGE;
+        }
+        memset(scores + (size_t)block->rows * file_subjects, 0,
+               (size_t)block->rows * (stream->schema.count - file_subjects) * sizeof(uint16_t));
+        block->scores = scores;
+    }
+    return FILE_OK;
+}
+
+// 读入下一段并计算平均分；已读完时返回FILE_OK且段为空
+static int read_chunk(StudentStream *stream, StreamChunk *chunk) {
+    memset(chunk, 0, sizeof(*chunk));
+    int status;
+    if (stream->data.compressed) {
+        if (stream->next_block >= stream->index.count) {
+            return FILE_OK;
+        }
+        status = read_compressed_chunk(stream, chunk);
+    } else {
+        if (stream->remaining == 0) {
+            return FILE_OK;
+        }
+        status = read_plain_chunk(stream, chunk);
+    }
+
+    uint32_t rows = chunk->rows.rows;
+    if (status == FILE_OK) {
+        chunk->averages = malloc(rows * sizeof(uint16_t));
+        status = chunk->averages != NULL ? FILE_OK : FILE_TOO_LARGE;
+    }
+    if (status != FILE_OK) {
+        free_chunk(chunk);
+        return status;
+    }
+    for (uint32_t r = 0; r < rows; r++) {
+        uint16_t scores[MAX_SUBJECTS];
+        for (int k = 0; k < stream->schema.count; k++) {
+            scores[k] = chunk->rows.scores[(size_t)k * rows + r];
+        }
+        chunk->averages[r] = schema_average(&stream->schema, scores);
+    }
+    return FILE_OK;
+}
+
+// 读取线程：前台处理当前段时读入下一段
+static void *stream_main(void *arg) {
+    StudentStream *stream = arg;
+    pthread_mutex_lock(&stream->lock);
+    for (;;) {
+        while (stream->filled[stream->write_slot] && !stream->stop) {
+            pthread_cond_wait(&stream->space, &stream->lock);
+        }
+        if (stream->stop) {
+            break;
+        }
+        pthread_mutex_unlock(&stream->lock);
+
+        StreamChunk chunk;
+        int status = read_chunk(stream, &chunk);
+
+        pthread_mutex_lock(&stream->lock);
+        if (status != FILE_OK || chunk.rows.rows == 0) {
+            stream->status = status;
+            stream->done = 1;
+            pthread_cond_signal(&stream->ready);
+            break;
+        }
+        stream->chunks[stream->write_slot] = chunk;
+        stream->filled[stream->write_slot] = 1;
+        stream->write_slot ^= 1;
+        pthread_cond_signal(&stream->ready);
+    }
+    pthread_mutex_unlock(&stream->lock);
+    return NULL;
+}
+
+// 打开数据文件准备流式读取，成功返回FILE_OK
+int stream_open(StudentStream *stream, const char *filename) {
+    memset(stream, 0, sizeof(*stream));
+    int status = open_data_file(&stream->data, filename);
+    if (status != FILE_OK) {
+        return status;
+    }
+    stream->schema = stream->data.schema;
+    schema_merge_config(&stream->schema);
+    stream->remaining = stream->data.count;
+
+    if (stream->data.compressed) {
+        uint64_t total = 0;
+        int ok = read_block_index(stream->data.file, stream->data.index_offset, &stream->index);
+        for (uint32_t b = 0; ok && b < stream->index.count; b++) {
+            total += stream->index.entries[b].rows;
+        }
+        if (!ok || total != stream->data.count) {
+            free_block_index(&stream->index);
+            close_data_file(&stream->data);
+            return FILE_READ_ERROR;
+        }
+    }
+
+    pthread_mutex_init(&stream->lock, NULL);
+    pthread_cond_init(&stream->ready, NULL);
+    pthread_cond_init(&stream->space, NULL);
+    stream->threaded = pthread_create(&stream->thread, NULL, stream_main, stream) == 0;
+    return FILE_OK;
+}
+
+// 取下一段学生，之前取得的段随即释放；读完或出错时返回NULL（结果见stream->status）
+const StreamChunk *stream_next_chunk(StudentStream *stream) {
+    if (stream->holding) {
+        free_chunk(&stream->chunks[stream->read_slot]);
+        stream->holding = 0;
+        if (stream->threaded) {
+            pthread_mutex_lock(&stream->lock);
+            stream->filled[stream->read_slot] = 0;
+            pthread_cond_signal(&stream->space);
+            pthread_mutex_unlock(&stream->lock);
+            stream->read_slot ^= 1;
+        }
+    }
+
+    // 读取线程未能启动时在前台读取
+    if (!stream->threaded) {
+        if (stream->done) {
+            return NULL;
+        }
+        stream->status = read_chunk(stream, &stream->chunks[0]);
+        if (stream->status != FILE_OK || stream->chunks[0].rows.rows == 0) {
+            stream->done = 1;
+            return NULL;
+        }
+        stream->holding = 1;
+        return &stream->chunks[0];
+    }
+
+    pthread_mutex_lock(&stream->lock);
+    while (!stream->filled[stream->read_slot] && !stream->done) {
+        pthread_cond_wait(&stream->ready, &stream->lock);
+    }
+    int available = stream->filled[stream->read_slot];
+    pthread_mutex_unlock(&stream->lock);
+    if (!available) {
+        return NULL;
+    }
+    stream->holding = 1;
+    return &stream->chunks[stream->read_slot];
+}
+
+// 取出一段中第row名学生的完整信息（学号和姓名指向段内，随段释放）
+void stream_get_student(const StudentStream *stream, const StreamChunk *chunk, uint32_t row, Student *out) {
+    const DecodedBlock *block = &chunk->rows;
+    out->id = block->ids[row];
+    out->name = block->names[row];
+    out->age = block->ages[row];
+    for (int k = 0; k < stream->schema.count; k++) {
+        out->scores[k] = fixed_to_score(block->scores[(size_t)k * block->rows + row]);
+    }
+    out->average_score = fixed_to_score(chunk->averages[row]);
+}
+
+// 停止读取线程并释放全部资源（只用于打开成功的流）
+void stream_close(StudentStream *stream) {
+    if (stream->threaded) {
+        pthread_mutex_lock(&stream->lock);
+        stream->stop = 1;
+        pthread_cond_signal(&stream->space);
+        pthread_mutex_unlock(&stream->lock);
+        pthread_join(stream->thread, NULL);
+        for (int i = 0; i < 2; i++) {
+            if (stream->filled[i]) {
+                free_chunk(&stream->chunks[i]);
+            }
+        }
+    } else if (stream->holding) {
+        free_chunk(&stream->chunks[0]);
+    }
+    pthread_mutex_destroy(&stream->lock);
+    pthread_cond_destroy(&stream->ready);
+    pthread_cond_destroy(&stream->space);
+    free_block_index(&stream->index);
+    close_data_file(&stream->data);
+}
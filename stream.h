@@ -0,0 +1,44 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <pthread.h>
+#include "student.h"
+#include "blockfile.h"
+
+#define STREAM_ROWS BLOCK_ROWS      // 普通格式每段读入的学生数（压缩格式每段为一块）
+
+// 流式读取的一段学生：各列与解码后的压缩块相同，另附按科目设置计算的平均分
+typedef struct {
+    DecodedBlock rows;              // 成绩按流的科目设置存放，共 schema.count 列
+    uint16_t *averages;
+} StreamChunk;
+
+// 流式读取数据文件：读取线程预先读入下一段，前台处理当前段，内存占用与学生总数无关
+typedef struct {
+    DataFile data;
+    Schema schema;                  // 与加载时相同：以文件为准，追加配置文件中新增的科目
+    BlockIndex index;               // 压缩格式的块索引
+    uint32_t next_block;            // 下一块（压缩格式）
+    uint32_t remaining;             // 尚未读入的学生数（普通格式）
+    StreamChunk chunks[2];          // 当前段与预读段轮流使用
+    int filled[2];
+    int read_slot;                  // 前台取用的段
+    int write_slot;                 // 读取线程写入的段
+    int holding;                    // 前台是否持有 read_slot 段
+    int done;                       // 已读完或出错
+    int stop;
+    int status;                     // 读取结果 FILE_*
+    int threaded;                   // 读取线程是否已启动（否则在前台读取）
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t ready;           // 有新的一段或已读完
+    pthread_cond_t space;           // 有空闲的段或要求退出
+} StudentStream;
+
+// 函数声明
+int stream_open(StudentStream *stream, const char *filename);
+const StreamChunk *stream_next_chunk(StudentStream *stream);
+void stream_get_student(const StudentStream *stream, const StreamChunk *chunk, uint32_t row, Student *out);
+void stream_close(StudentStream *stream);
+
+#endif
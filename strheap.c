@@ -0,0 +1,134 @@
+#include "strheap.h"
+#include <stdlib.h>
+#include <string.h>
+
+// FNV-1a 32位哈希
+static uint32_t hash_text(const char *text) {
+    uint32_t h = 2166136261u;
+    for (const unsigned char *c = (const unsigned char *)text; *c; c++) {
+        h ^= *c;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// 初始化字符串堆，成功返回1
+int strheap_init(StringHeap *heap) {
+    memset(heap, 0, sizeof(*heap));
+    heap->segments = calloc(STRHEAP_MAX_SEGMENTS, sizeof(char *));
+    return heap->segments != NULL;
+}
+
+// 释放字符串堆
+void strheap_free(StringHeap *heap) {
+    if (heap->segments != NULL) {
+        for (uint32_t i = 0; i < heap->segment_count; i++) {
+            free(heap->segments[i]);
+        }
+    }
+    free(heap->segments);
+    free(heap->table);
+    memset(heap, 0, sizeof(*heap));
+}
+
+// 创建一个引用计数为1的字符串堆，失败返回NULL
+StringHeap *strheap_new(void) {
+    StringHeap *heap = malloc(sizeof(StringHeap));
+    if (heap != NULL && !strheap_init(heap)) {
+        free(heap);
+        return NULL;
+    }
+    if (heap != NULL) {
+        heap->refs = 1;
+    }
+    return heap;
+}
+
+// 释放字符串堆的一个引用
+void strheap_release(StringHeap *heap) {
+    if (heap != NULL && __atomic_sub_fetch(&heap->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+        strheap_free(heap);
+        free(heap);
+    }
+}
+
+// 存放一个字符串（不去重），返回偏移；失败返回 STRHEAP_NONE
+uint32_t strheap_add(StringHeap *heap, const char *text) {
+    size_t len = strlen(text) + 1;
+    if (len > STRHEAP_SEGMENT_SIZE) {
+        return STRHEAP_NONE;
+    }
+
+    // 当前段放不下时开启新段，字符串不跨段
+    if (heap->segment_count == 0 || heap->used + len > STRHEAP_SEGMENT_SIZE) {
+        if (heap->segment_count >= STRHEAP_MAX_SEGMENTS) {
+            return STRHEAP_NONE;
+        }
+        char *segment = malloc(STRHEAP_SEGMENT_SIZE);
+        if (segment == NULL) {
+            return STRHEAP_NONE;
+        }
+        heap->segments[heap->segment_count++] = segment;
+        heap->used = 0;
+    }
+
+    uint32_t offset = ((heap->segment_count - 1) << STRHEAP_SEGMENT_BITS) | heap->used;
+    memcpy(heap->segments[heap->segment_count - 1] + heap->used, text, len);
+    heap->used += len;
+    heap->bytes += len;
+    return offset;
+}
+
+// 扩大去重哈希表并重新插入
+static int grow_table(StringHeap *heap) {
+    uint32_t size = heap->table_size ? heap->table_size * 2 : 1024;
+    uint32_t *table = calloc(size, sizeof(uint32_t));
+    if (table == NULL) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < heap->table_size; i++) {
+        uint32_t entry = heap->table[i];
+        if (entry == 0) {
+            continue;
+        }
+        uint32_t pos = hash_text(strheap_get(heap, entry - 1)) & (size - 1);
+        while (table[pos] != 0) {
+            pos = (pos + 1) & (size - 1);
+        }
+        table[pos] = entry;
+    }
+    free(heap->table);
+    heap->table = table;
+    heap->table_size = size;
+    return 1;
+}
+
+// 存放一个字符串，相同内容只存一份，返回偏移；失败返回 STRHEAP_NONE
+uint32_t strheap_intern(StringHeap *heap, const char *text) {
+    if (heap->entries * 4 >= heap->table_size * 3 && !grow_table(heap)) {
+        return STRHEAP_NONE;
+    }
+
+    uint32_t pos = hash_text(text) & (heap->table_size - 1);
+    while (heap->table[pos] != 0) {
+        uint32_t offset = heap->table[pos] - 1;
+        if (strcmp(strheap_get(heap, offset), text) == 0) {
+            return offset;
+        }
+        pos = (pos + 1) & (heap->table_size - 1);
+    }
+
+    uint32_t offset = strheap_add(heap, text);
+    if (offset != STRHEAP_NONE) {
+        heap->table[pos] = offset + 1;
+        heap->entries++;
+    }
+    return offset;
+}
+
+// 统计字符串堆占用的内存（字节）
+size_t strheap_memory(const StringHeap *heap) {
+    return (size_t)heap->segment_count * STRHEAP_SEGMENT_SIZE
+           + (size_t)heap->table_size * sizeof(uint32_t)
+           + STRHEAP_MAX_SEGMENTS * sizeof(char *);
+}
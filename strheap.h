@@ -0,0 +1,46 @@
+#ifndef STRHEAP_H
+#define STRHEAP_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define STRHEAP_SEGMENT_BITS 16
+#define STRHEAP_SEGMENT_SIZE (1u << STRHEAP_SEGMENT_BITS)   // 每段64KB
+#define STRHEAP_MAX_SEGMENTS 16384                          // 最多1GB字符串
+#define STRHEAP_NONE UINT32_MAX                             // 无效偏移
+
+// 字符串堆：字符串按段连续存放，用32位偏移引用。
+// 段一经分配不再移动，因此取得的字符串指针在堆释放前一直有效。
+// 堆只追加不修改，快照与当前数据共享同一个堆，最后一个引用释放时才释放
+typedef struct {
+    int refs;                   // 引用计数（strheap_new创建的堆）
+    char **segments;            // 段表
+    uint32_t segment_count;
+    uint32_t used;              // 当前段已用字节
+    uint32_t *table;            // 去重哈希表，存放 偏移+1，0表示空位
+    uint32_t table_size;        // 哈希表大小（2的幂）
+    uint32_t entries;           // 哈希表中的字符串数
+    size_t bytes;               // 已存放的字符串总字节数
+} StringHeap;
+
+// 函数声明
+int strheap_init(StringHeap *heap);
+void strheap_free(StringHeap *heap);
+uint32_t strheap_add(StringHeap *heap, const char *text);
+uint32_t strheap_intern(StringHeap *heap, const char *text);
+size_t strheap_memory(const StringHeap *heap);
+StringHeap *strheap_new(void);
+void strheap_release(StringHeap *heap);
+
+// 增加字符串堆的引用
+static inline StringHeap *strheap_retain(StringHeap *heap) {
+    __atomic_add_fetch(&heap->refs, 1, __ATOMIC_RELAXED);
+    return heap;
+}
+
+// 取得偏移处的字符串
+static inline const char *strheap_get(const StringHeap *heap, uint32_t offset) {
+    return heap->segments[offset >> STRHEAP_SEGMENT_BITS] + (offset & (STRHEAP_SEGMENT_SIZE - 1));
+}
+
+#endif
@@ -1,9 +1,50 @@
 #include "student.h"
+#include "sortkey.h"
+#include "query.h"
+#include "views.h"
+#include "changefeed.h"
+#include "filesync.h"
 
 // 初始化系统
 void init_system(StudentSystem *system) {
-    system->count = 0;
-    memset(system->students, 0, sizeof(system->students));
+    memset(system, 0, sizeof(*system));
+    // 科目设置：配置文件优先，否则为默认三科；加载数据文件时以文件中的设置为准
+    schema_init_default(&system->schema);
+    schema_load_config(&system->schema);
+    // 各列先建空块表，数据块和过滤器随容量一起分配
+    for (int k = 0; k < system->schema.count; k++) {
+        system->scores[k] = chunk_table_new(sizeof(uint16_t));
+    }
+    system->hot = chunk_table_new(sizeof(HotRecord));
+    system->cold = chunk_table_new(sizeof(ColdRecord));
+    system->strings = strheap_new();
+    int ok = system->hot != NULL && system->cold != NULL && system->strings != NULL;
+    for (int k = 0; k < system->schema.count; k++) {
+        ok = ok && system->scores[k] != NULL;
+    }
+    if (!ok || !reserve_students(system, INITIAL_CAPACITY)) {
+        printf("错误：内存不足！\n");
+        exit(1);
+    }
+}
+
+// 释放系统占用的内存
+void free_system(StudentSystem *system) {
+    while (system->snapshot_count > 0) {
+        drop_snapshot(system, system->snapshot_count - 1);
+    }
+    free(system->snapshots);
+    free_views(system);
+    close_change_feed(system);
+    remember_data_file(system, NULL, 0);
+    for (int k = 0; k < MAX_SUBJECTS; k++) {
+        chunk_table_release(system->scores[k]);
+    }
+    chunk_table_release(system->hot);
+    chunk_table_release(system->cold);
+    strheap_release(system->strings);
+    bloom_free(&system->id_filter);
+    chunk_table_release(system->id_index.slots);
 }
 
 // 显示主菜单
@@ -23,9 +64,13 @@ void display_menu() {
     printf("请选择操作: ");
 }
 
-// 计算平均成绩
-void calculate_average(Student *student) {
-    student->average_score = (student->math_score + student->english_score + student->chinese_score) / 3.0;
+// 计算平均成绩（按科目权重加权）
+void calculate_average(const Schema *schema, Student *student) {
+    float total = 0;
+    for (int k = 0; k < schema->count; k++) {
+        total += schema->subjects[k].weight * student->scores[k];
+    }
+    student->average_score = total / schema->total_weight;
 }
 
 // 验证学号格式
@@ -46,36 +91,42 @@ int is_valid_score(float score) {
     return score >= 0 && score <= 100;
 }
 
+// 读取一门成绩，输入不正确时重新输入；输入结束返回0
+int read_score(const char *prompt, float *score) {
+    while (1) {
+        printf("%s", prompt);
+        int result = scanf("%f", score);
+        if (result == EOF) {
+            return 0;
+        }
+        if (result != 1 || !is_valid_score(*score)) {
+            printf("错误：成绩应在0-100之间！\n");
+            clear_input_buffer();
+            continue;
+        }
+        return 1;
+    }
+}
+
 // 清空输入缓冲区
 void clear_input_buffer() {
     int c;
     while ((c = getchar()) != '\n' && c != EOF);
 }
 
-// 根据学号查找学生
-int find_student_by_id(StudentSystem *system, const char *id) {
-    for (int i = 0; i < system->count; i++) {
-        if (strcmp(system->students[i].id, id) == 0) {
-            return i;
-        }
-    }
-    return -1;
-}
-
 // 添加学生
 int add_student(StudentSystem *system) {
-    if (system->count >= MAX_STUDENTS) {
-        printf("错误：学生数量已达上限！\n");
-        return 0;
-    }
-
     Student new_student;
+    char id[MAX_NAME_LEN];
+    char name[MAX_NAME_LEN];
+    new_student.id = id;
+    new_student.name = name;
     printf("\n=== 添加学生 ===\n");
     
     // 输入学号
     do {
         printf("请输入学号: ");
-        scanf("%s", new_student.id);
+        scanf("%255s", id);
         
         if (!is_valid_id(new_student.id)) {
             printf("错误：学号格式不正确！\n");
@@ -91,7 +142,7 @@ int add_student(StudentSystem *system) {
     
     // 输入姓名
     printf("请输入姓名: ");
-    scanf("%s", new_student.name);
+    scanf("%255s", name);
     
     // 输入年龄
     do {
@@ -105,39 +156,19 @@ int add_student(StudentSystem *system) {
     } while (1);
     
     // 输入各科成绩
-    do {
-        printf("请输入数学成绩: ");
-        if (scanf("%f", &new_student.math_score) != 1 || !is_valid_score(new_student.math_score)) {
-            printf("错误：成绩应在0-100之间！\n");
-            clear_input_buffer();
-            continue;
-        }
-        break;
-    } while (1);
-    
-    do {
-        printf("请输入英语成绩: ");
-        if (scanf("%f", &new_student.english_score) != 1 || !is_valid_score(new_student.english_score)) {
-            printf("错误：成绩应在0-100之间！\n");
-            clear_input_buffer();
-            continue;
-        }
-        break;
-    } while (1);
-    
-    do {
-        printf("请输入语文成绩: ");
-        if (scanf("%f", &new_student.chinese_score) != 1 || !is_valid_score(new_student.chinese_score)) {
-            printf("错误：成绩应在0-100之间！\n");
-            clear_input_buffer();
-            continue;
+    for (int k = 0; k < system->schema.count; k++) {
+        char prompt[SUBJECT_NAME_LEN + 32];
+        snprintf(prompt, sizeof(prompt), "请输入%s成绩: ", subject_label(&system->schema, k));
+        if (!read_score(prompt, &new_student.scores[k])) {
+            return 0;
         }
-        break;
-    } while (1);
+    }
     
-    calculate_average(&new_student);
-    system->students[system->count] = new_student;
-    system->count++;
+    calculate_average(&system->schema, &new_student);
+    if (!append_student(system, &new_student)) {
+        printf("错误：内存不足，添加失败！\n");
+        return 0;
+    }
     
     printf("学生添加成功！\n");
     return 1;
@@ -150,10 +181,10 @@ int delete_student(StudentSystem *system) {
         return 0;
     }
     
-    char id[MAX_ID_LEN];
+    char id[MAX_NAME_LEN];
     printf("\n=== 删除学生 ===\n");
     printf("请输入要删除的学生学号: ");
-    scanf("%s", id);
+    scanf("%255s", id);
     
     int index = find_student_by_id(system, id);
     if (index == -1) {
@@ -161,15 +192,12 @@ int delete_student(StudentSystem *system) {
         return 0;
     }
     
-    printf("确认删除学生 %s (%s)? (y/n): ", system->students[index].name, system->students[index].id);
+    printf("确认删除学生 %s (%s)? (y/n): ", student_name_at(system, index), student_id_at(system, index));
     char confirm;
     scanf(" %c", &confirm);
     
     if (confirm == 'y' || confirm == 'Y') {
-        for (int i = index; i < system->count - 1; i++) {
-            system->students[i] = system->students[i + 1];
-        }
-        system->count--;
+        remove_student(system, index);
         printf("学生删除成功！\n");
         return 1;
     } else {
@@ -185,10 +213,10 @@ int modify_student(StudentSystem *system) {
         return 0;
     }
     
-    char id[MAX_ID_LEN];
+    char id[MAX_NAME_LEN];
     printf("\n=== 修改学生信息 ===\n");
     printf("请输入要修改的学生学号: ");
-    scanf("%s", id);
+    scanf("%255s", id);
     
     int index = find_student_by_id(system, id);
     if (index == -1) {
@@ -196,101 +224,189 @@ int modify_student(StudentSystem *system) {
         return 0;
     }
     
-    Student *student = &system->students[index];
+    Student current;
+    Student *student = &current;
+    char name[MAX_NAME_LEN];
+    get_student(system, index, student);
     printf("当前学生信息:\n");
-    printf("学号: %s\n", student->id);
-    printf("姓名: %s\n", student->name);
-    printf("年龄: %d\n", student->age);
-    printf("数学: %.2f\n", student->math_score);
-    printf("英语: %.2f\n", student->english_score);
-    printf("语文: %.2f\n", student->chinese_score);
+    print_student_detail(&system->schema, student);
     
     int choice;
     printf("\n请选择要修改的项目:\n");
     printf("1. 姓名\n");
     printf("2. 年龄\n");
-    printf("3. 数学成绩\n");
-    printf("4. 英语成绩\n");
-    printf("5. 语文成绩\n");
+    for (int k = 0; k < system->schema.count; k++) {
+        printf("%d. %s成绩\n", k + 3, subject_label(&system->schema, k));
+    }
     printf("请选择: ");
     scanf("%d", &choice);
     
-    switch (choice) {
-        case 1:
-            printf("请输入新姓名: ");
-            scanf("%s", student->name);
-            break;
-        case 2:
-            do {
-                printf("请输入新年龄: ");
-                if (scanf("%d", &student->age) != 1 || student->age < 1 || student->age > 150) {
-                    printf("错误：年龄输入不正确！\n");
-                    clear_input_buffer();
-                    continue;
-                }
-                break;
-            } while (1);
-            break;
-        case 3:
-            do {
-                printf("请输入新数学成绩: ");
-                if (scanf("%f", &student->math_score) != 1 || !is_valid_score(student->math_score)) {
-                    printf("错误：成绩应在0-100之间！\n");
-                    clear_input_buffer();
-                    continue;
-                }
-                break;
-            } while (1);
-            break;
-        case 4:
-            do {
-                printf("请输入新英语成绩: ");
-                if (scanf("%f", &student->english_score) != 1 || !is_valid_score(student->english_score)) {
-                    printf("错误：成绩应在0-100之间！\n");
-                    clear_input_buffer();
-                    continue;
-                }
-                break;
-            } while (1);
-            break;
-        case 5:
-            do {
-                printf("请输入新语文成绩: ");
-                if (scanf("%f", &student->chinese_score) != 1 || !is_valid_score(student->chinese_score)) {
-                    printf("错误：成绩应在0-100之间！\n");
-                    clear_input_buffer();
-                    continue;
-                }
-                break;
-            } while (1);
+    if (choice == 1) {
+        printf("请输入新姓名: ");
+        scanf("%255s", name);
+        student->name = name;
+    } else if (choice == 2) {
+        do {
+            printf("请输入新年龄: ");
+            if (scanf("%d", &student->age) != 1 || student->age < 1 || student->age > 150) {
+                printf("错误：年龄输入不正确！\n");
+                clear_input_buffer();
+                continue;
+            }
             break;
-        default:
-            printf("无效选择！\n");
+        } while (1);
+    } else if (choice >= 3 && choice < 3 + system->schema.count) {
+        char prompt[SUBJECT_NAME_LEN + 32];
+        snprintf(prompt, sizeof(prompt), "请输入新%s成绩: ", subject_label(&system->schema, choice - 3));
+        if (!read_score(prompt, &student->scores[choice - 3])) {
             return 0;
+        }
+    } else {
+        printf("无效选择！\n");
+        return 0;
     }
     
-    calculate_average(student);
+    calculate_average(&system->schema, student);
+    if (!set_student(system, index, student)) {
+        printf("错误：内存不足，修改失败！\n");
+        return 0;
+    }
     printf("学生信息修改成功！\n");
     return 1;
 }
 
-// 显示所有学生
-void display_all_students(StudentSystem *system) {
+// 打印表头
+void print_table_header(const Schema *schema) {
+    printf("%-10s %-15s %-5s", "学号", "姓名", "年龄");
+    for (int k = 0; k < schema->count; k++) {
+        printf(" %-8s", subject_label(schema, k));
+    }
+    printf(" %-8s\n", "平均分");
+    for (int k = 0; k < 37 + 9 * schema->count; k++) {
+        putchar('-');
+    }
+    putchar('\n');
+}
+
+// 打印一行学生信息
+void print_student_row(const Schema *schema, const Student *s) {
+    printf("%-10s %-15s %-5d", s->id, s->name, s->age);
+    for (int k = 0; k < schema->count; k++) {
+        printf(" %-8.2f", s->scores[k]);
+    }
+    printf(" %-8.2f\n", s->average_score);
+}
+
+// 逐行显示一名学生的全部信息
+void print_student_detail(const Schema *schema, const Student *s) {
+    printf("学号: %s\n", s->id);
+    printf("姓名: %s\n", s->name);
+    printf("年龄: %d\n", s->age);
+    for (int k = 0; k < schema->count; k++) {
+        printf("%s: %.2f\n", subject_label(schema, k), s->scores[k]);
+    }
+}
+
+// 显示一名学生（按视图顺序显示时逐个调用）
+static void show_student(StudentSystem *system, int index, void *context) {
+    (void)context;
+    Student s;
+    get_student(system, index, &s);
+    print_student_row(&system->schema, &s);
+}
+
+// 显示所有学生：view为排序视图的序号，-1表示按当前顺序
+void display_all_students(StudentSystem *system, int view) {
     if (system->count == 0) {
         printf("系统中没有学生记录！\n");
         return;
     }
     
+    if (view >= 0) {
+        printf("\n=== 所有学生信息（视图 %s） ===\n", view_at(system, view)->name);
+        print_table_header(&system->schema);
+        if (!walk_view(system, view, show_student, NULL)) {
+            printf("错误：内存不足！\n");
+        }
+        return;
+    }
+    
     printf("\n=== 所有学生信息 ===\n");
-    printf("%-10s %-15s %-5s %-8s %-8s %-8s %-8s\n", 
-           "学号", "姓名", "年龄", "数学", "英语", "语文", "平均分");
-    printf("----------------------------------------------------------------\n");
+    print_table_header(&system->schema);
+    for (int i = 0; i < system->count; i++) {
+        show_student(system, i, NULL);
+    }
+}
+
+// 注册了排序视图时让用户选择显示顺序，返回视图序号，-1表示按当前顺序
+int choose_view(StudentSystem *system) {
+    if (system->count == 0 || !refresh_views(system) || view_count(system) == 0) {
+        return -1;
+    }
+    
+    printf("\n0. 当前顺序\n");
+    for (int i = 0; i < view_count(system); i++) {
+        printf("%d. 视图 %s（%s）\n", i + 1, view_at(system, i)->name, view_at(system, i)->keys);
+    }
+    printf("请选择显示顺序: ");
+    int choice;
+    if (scanf("%d", &choice) != 1 || choice < 0 || choice > view_count(system)) {
+        printf("无效选择，按当前顺序显示。\n");
+        return -1;
+    }
+    return choice - 1;
+}
+
+// 按查询表达式显示学生，返回匹配数量，表达式错误返回-1
+int display_matching_students(StudentSystem *system, const char *expression) {
+    Query query;
+    Selection selection;
+    
+    if (!query_compile(&query, &system->schema, expression)) {
+        printf("查询错误：%s\n", query.error);
+        return -1;
+    }
+    if (!query_execute(&query, system, &selection)) {
+        printf("错误：内存不足！\n");
+        return -1;
+    }
     
+    int found = selection_count(&selection);
+    if (found > 0) {
+        Student s;
+        print_table_header(&system->schema);
+        for (int i = 0; i < system->count; i++) {
+            if (selection_test(&selection, i)) {
+                get_student(system, i, &s);
+                print_student_row(&system->schema, &s);
+            }
+        }
+    }
+    printf("共找到 %d 名学生。\n", found);
+    selection_free(&selection);
+    return found;
+}
+
+// 按选择位图批量删除学生（一次遍历压缩数组），返回删除数量
+int remove_selected_students(StudentSystem *system, const Selection *selection) {
+    int kept = 0;
     for (int i = 0; i < system->count; i++) {
-        Student *s = &system->students[i];
-        printf("%-10s %-15s %-5d %-8.2f %-8.2f %-8.2f %-8.2f\n",
-               s->id, s->name, s->age, s->math_score, s->english_score, s->chinese_score, s->average_score);
+        if (i < selection->count && selection_test(selection, i)) {
+            changes_delete(system, i);
+            continue;
+        }
+        if (kept != i) {
+            move_student(system, i, kept);
+        }
+        kept++;
+    }
+    int removed = system->count - kept;
+    system->count = kept;
+    if (removed > 0) {
+        rebuild_id_index(system);
+        views_invalidate(system);
     }
+    return removed;
 }
 
 // 查找学生
@@ -304,25 +420,23 @@ void search_student(StudentSystem *system) {
     printf("\n=== 查找学生 ===\n");
     printf("1. 按学号查找\n");
     printf("2. 按姓名查找\n");
+    printf("3. 按条件查找（如 math < 60 and age >= 18）\n");
     printf("请选择查找方式: ");
     scanf("%d", &choice);
     
     switch (choice) {
         case 1: {
-            char id[MAX_ID_LEN];
+            char id[MAX_NAME_LEN];
             printf("请输入学号: ");
-            scanf("%s", id);
+            scanf("%255s", id);
             
             int index = find_student_by_id(system, id);
             if (index != -1) {
-                Student *s = &system->students[index];
+                Student found;
+                Student *s = &found;
+                get_student(system, index, s);
                 printf("\n找到学生:\n");
-                printf("学号: %s\n", s->id);
-                printf("姓名: %s\n", s->name);
-                printf("年龄: %d\n", s->age);
-                printf("数学: %.2f\n", s->math_score);
-                printf("英语: %.2f\n", s->english_score);
-                printf("语文: %.2f\n", s->chinese_score);
+                print_student_detail(&system->schema, s);
                 printf("平均分: %.2f\n", s->average_score);
             } else {
                 printf("未找到该学生！\n");
@@ -332,21 +446,19 @@ void search_student(StudentSystem *system) {
         case 2: {
             char name[MAX_NAME_LEN];
             printf("请输入姓名: ");
-            scanf("%s", name);
+            scanf("%255s", name);
             
             int found = 0;
             for (int i = 0; i < system->count; i++) {
-                if (strcmp(system->students[i].name, name) == 0) {
+                if (strcmp(student_name_at(system, i), name) == 0) {
                     if (!found) {
                         printf("\n找到学生:\n");
-                        printf("%-10s %-15s %-5s %-8s %-8s %-8s %-8s\n", 
-                               "学号", "姓名", "年龄", "数学", "英语", "语文", "平均分");
-                        printf("----------------------------------------------------------------\n");
+                        print_table_header(&system->schema);
                         found = 1;
                     }
-                    Student *s = &system->students[i];
-                    printf("%-10s %-15s %-5d %-8.2f %-8.2f %-8.2f %-8.2f\n",
-                           s->id, s->name, s->age, s->math_score, s->english_score, s->chinese_score, s->average_score);
+                    Student s;
+                    get_student(system, i, &s);
+                    print_student_row(&system->schema, &s);
                 }
             }
             
@@ -355,139 +467,255 @@ void search_student(StudentSystem *system) {
             }
             break;
         }
+        case 3: {
+            char expression[256];
+            printf("请输入查询条件: ");
+            clear_input_buffer();
+            if (fgets(expression, sizeof(expression), stdin) == NULL) {
+                break;
+            }
+            expression[strcspn(expression, "\n")] = '\0';
+            printf("\n");
+            display_matching_students(system, expression);
+            break;
+        }
         default:
             printf("无效选择！\n");
     }
 }
 
-// 按成绩排序
-void sort_students(StudentSystem *system) {
-    if (system->count == 0) {
-        printf("系统中没有学生记录！\n");
+// 注册（adding为1）或删除排序视图
+static void manage_views(StudentSystem *system, int adding) {
+    char name[MAX_NAME_LEN];
+    for (int i = 0; i < view_count(system); i++) {
+        printf("视图 %s: %s\n", view_at(system, i)->name, view_at(system, i)->keys);
+    }
+    if (!adding && view_count(system) == 0) {
+        printf("尚未注册排序视图！\n");
         return;
     }
     
+    printf("请输入视图名: ");
+    scanf("%255s", name);
+    if (!adding) {
+        int index = find_view(system, name);
+        if (index == -1) {
+            printf("未找到该视图！\n");
+            return;
+        }
+        drop_view(system, index);
+        printf("视图已删除。\n");
+        return;
+    }
+    
+    char keys[VIEW_KEYS_LEN];
+    char error[MAX_NAME_LEN + 64];
+    printf("请输入排序键（逗号分隔，每项为 字段 [asc|desc]）: ");
+    clear_input_buffer();
+    if (fgets(keys, sizeof(keys), stdin) == NULL) {
+        return;
+    }
+    keys[strcspn(keys, "\n")] = '\0';
+    if (!add_view(system, name, keys, error, sizeof(error))) {
+        printf("注册失败：%s\n", error);
+        return;
+    }
+    printf("视图 %s 已注册，可在“显示所有学生”中按此顺序显示。\n", name);
+}
+
+// 按成绩排序
+void sort_students(StudentSystem *system) {
     printf("\n=== 学生排序 ===\n");
     printf("1. 按平均分升序\n");
     printf("2. 按平均分降序\n");
+    printf("3. 自定义排序键（如 average desc, math desc, id asc）\n");
+    printf("4. 注册排序视图（添加、修改、删除学生后自动保持有序）\n");
+    printf("5. 删除排序视图\n");
     printf("请选择排序方式: ");
     
     int choice;
     scanf("%d", &choice);
     
-    // 冒泡排序
-    for (int i = 0; i < system->count - 1; i++) {
-        for (int j = 0; j < system->count - 1 - i; j++) {
-            int should_swap = 0;
-            
-            if (choice == 1) { // 升序
-                should_swap = system->students[j].average_score > system->students[j + 1].average_score;
-            } else if (choice == 2) { // 降序
-                should_swap = system->students[j].average_score < system->students[j + 1].average_score;
-            }
-            
-            if (should_swap) {
-                Student temp = system->students[j];
-                system->students[j] = system->students[j + 1];
-                system->students[j + 1] = temp;
-            }
-        }
+    // 视图可以在没有学生时注册
+    if (choice == 4 || choice == 5) {
+        manage_views(system, choice == 4);
+        return;
+    }
+    if (system->count == 0) {
+        printf("系统中没有学生记录！\n");
+        return;
     }
     
-    if (choice == 1 || choice == 2) {
-        printf("排序完成！\n");
-        display_all_students(system);
+    // 键相同的学生保持原有顺序
+    char keys[256];
+    if (choice == 1) {
+        snprintf(keys, sizeof(keys), "average asc");
+    } else if (choice == 2) {
+        snprintf(keys, sizeof(keys), "average desc");
+    } else if (choice == 3) {
+        printf("请输入排序键（逗号分隔，每项为 字段 [asc|desc]）: ");
+        clear_input_buffer();
+        if (fgets(keys, sizeof(keys), stdin) == NULL) {
+            return;
+        }
+        keys[strcspn(keys, "\n")] = '\0';
     } else {
         printf("无效选择！\n");
+        return;
     }
+    
+    SortSpec spec;
+    if (!sort_spec_parse(&spec, &system->schema, keys)) {
+        printf("排序键错误：%s\n", spec.error);
+        return;
+    }
+    uint32_t *order = malloc((size_t)system->count * sizeof(uint32_t));
+    if (order == NULL || !sort_order(system, &spec, order) || !reorder_students(system, order)) {
+        free(order);
+        printf("错误：内存不足！\n");
+        return;
+    }
+    free(order);
+    
+    printf("排序完成！\n");
+    display_all_students(system, -1);
 }
 
-// 统计信息
-void calculate_statistics(StudentSystem *system) {
+// 统计全部学生，没有学生时返回0
+int collect_statistics(const StudentSystem *system, Statistics *out) {
     if (system->count == 0) {
-        printf("系统中没有学生记录！\n");
-        return;
+        return 0;
     }
     
-    float total_math = 0, total_english = 0, total_chinese = 0, total_average = 0;
-    float max_average = system->students[0].average_score;
-    float min_average = system->students[0].average_score;
+    // 定点成绩用整数累加，没有浮点误差；每科一列，按块逐列顺序扫描
+    const Schema *schema = &system->schema;
+    Statistics stats;
+    stats.count = system->count;
+    for (int k = 0; k < schema->count; k++) {
+        long long total = 0;
+        uint16_t high = score_at(system, k, 0), low = high;
+        for (int base = 0; base < system->count; ) {
+            uint32_t span;
+            const uint16_t *column = chunk_span(system->scores[k], (uint32_t)base, &span);
+            int rows = system->count - base < (int)span ? system->count - base : (int)span;
+            for (int i = 0; i < rows; i++) {
+                total += column[i];
+                high = column[i] > high ? column[i] : high;
+                low = column[i] < low ? column[i] : low;
+            }
+            base += rows;
+        }
+        stats.totals[k] = total;
+        stats.highest[k] = high;
+        stats.lowest[k] = low;
+    }
+    
+    long long total_average = 0;
+    uint16_t max_average = hot_at(system, 0)->average;
+    uint16_t min_average = max_average;
     int max_index = 0, min_index = 0;
     
     for (int i = 0; i < system->count; i++) {
-        Student *s = &system->students[i];
-        total_math += s->math_score;
-        total_english += s->english_score;
-        total_chinese += s->chinese_score;
-        total_average += s->average_score;
+        const HotRecord *r = hot_at(system, i);
+        total_average += r->average;
         
-        if (s->average_score > max_average) {
-            max_average = s->average_score;
+        if (r->average > max_average) {
+            max_average = r->average;
             max_index = i;
         }
         
-        if (s->average_score < min_average) {
-            min_average = s->average_score;
+        if (r->average < min_average) {
+            min_average = r->average;
             min_index = i;
         }
     }
     
+    stats.total_average = total_average;
+    stats.max_average = max_average;
+    stats.min_average = min_average;
+    snprintf(stats.max_id, sizeof(stats.max_id), "%s", student_id_at(system, max_index));
+    snprintf(stats.max_name, sizeof(stats.max_name), "%s", student_name_at(system, max_index));
+    snprintf(stats.min_id, sizeof(stats.min_id), "%s", student_id_at(system, min_index));
+    snprintf(stats.min_name, sizeof(stats.min_name), "%s", student_name_at(system, min_index));
+    *out = stats;
+    return 1;
+}
+
+// 统计信息
+void calculate_statistics(StudentSystem *system) {
+    Statistics stats;
+    if (!collect_statistics(system, &stats)) {
+        printf("系统中没有学生记录！\n");
+        return;
+    }
+    print_statistics(&system->schema, &stats);
+    printf("\n内存占用: %.1f KB（每名学生热数据 %zu 字节、冷数据 %zu 字节，字符串 %zu 字节）\n",
+           roster_memory(system) / 1024.0, sizeof(HotRecord), sizeof(ColdRecord), system->strings->bytes);
+    print_filter_stats(system);
+}
+
+// 显示统计结果
+void print_statistics(const Schema *schema, const Statistics *stats) {
+    double scale = (double)SCORE_SCALE * stats->count;
     printf("\n=== 统计信息 ===\n");
-    printf("学生总数: %d\n", system->count);
-    printf("平均成绩:\n");
-    printf("  数学: %.2f\n", total_math / system->count);
-    printf("  英语: %.2f\n", total_english / system->count);
-    printf("  语文: %.2f\n", total_chinese / system->count);
-    printf("  总平均: %.2f\n", total_average / system->count);
-    printf("\n最高分学生: %s (%s) - %.2f\n", 
-           system->students[max_index].name, system->students[max_index].id, max_average);
-    printf("最低分学生: %s (%s) - %.2f\n", 
-           system->students[min_index].name, system->students[min_index].id, min_average);
+    printf("学生总数: %d\n", stats->count);
+    printf("平均成绩（最高 / 最低）:\n");
+    for (int k = 0; k < schema->count; k++) {
+        printf("  %s: %.2f（%.2f / %.2f）\n", subject_label(schema, k), stats->totals[k] / scale,
+               fixed_to_score(stats->highest[k]), fixed_to_score(stats->lowest[k]));
+    }
+    printf("  总平均: %.2f\n", stats->total_average / scale);
+    printf("\n最高分学生: %s (%s) - %.2f\n", stats->max_name, stats->max_id, fixed_to_score(stats->max_average));
+    printf("最低分学生: %s (%s) - %.2f\n", stats->min_name, stats->min_id, fixed_to_score(stats->min_average));
+}
+
+// 显示学号过滤器的运行指标
+void print_filter_stats(StudentSystem *system) {
+    BloomFilter *f = &system->id_filter;
+    printf("\n学号过滤器: %zu 位, %d 个学号（其中已删除 %d 个）, 理论误判率 %.3f%%\n",
+           f->bit_count, f->key_count, f->stale_count, bloom_expected_fp_rate(f) * 100);
+    printf("  查询 %lu 次, 直接排除 %lu 次, 误判 %lu 次 (实测误判率 %.3f%%)\n",
+           f->queries, f->rejected, f->false_positives, bloom_observed_fp_rate(f) * 100);
 }
 
 // 保存到文件
+// 其他进程在此期间保存过时合并对方的修改；双方修改了同一名学生时询问是否以本次的修改为准
 int save_to_file(StudentSystem *system) {
-    FILE *file = fopen(FILENAME, "wb");
-    if (file == NULL) {
+    MergeReport report;
+    int status = save_data_file(system, FILENAME, compression_enabled(), 0, &report);
+    print_merge_report(stdout, &report);
+    if (status == FILE_CONFLICT) {
+        printf("是否以本次的修改为准保存？(y/n): ");
+        char choice = 'n';
+        if (scanf(" %c", &choice) != 1 || (choice != 'y' && choice != 'Y')) {
+            printf("数据未保存。\n");
+            return 0;
+        }
+        status = save_data_file(system, FILENAME, compression_enabled(), 1, &report);
+        print_merge_report(stdout, &report);
+    }
+    if (status != FILE_OK) {
         printf("错误：无法创建文件！\n");
         return 0;
     }
-    
-    fwrite(&system->count, sizeof(int), 1, file);
-    fwrite(system->students, sizeof(Student), system->count, file);
-    
-    fclose(file);
     printf("数据保存成功！\n");
     return 1;
 }
 
 // 从文件加载
 int load_from_file(StudentSystem *system) {
-    FILE *file = fopen(FILENAME, "rb");
-    if (file == NULL) {
-        printf("提示：数据文件不存在，将创建新的数据文件。\n");
-        return 0;
-    }
-    
-    if (fread(&system->count, sizeof(int), 1, file) != 1) {
-        printf("错误：读取文件失败！\n");
-        fclose(file);
-        return 0;
-    }
-    
-    if (system->count > MAX_STUDENTS) {
-        printf("错误：文件中的学生数量超过系统限制！\n");
-        fclose(file);
-        return 0;
-    }
-    
-    if (fread(system->students, sizeof(Student), system->count, file) != system->count) {
-        printf("错误：读取学生数据失败！\n");
-        fclose(file);
-        return 0;
+    switch (read_data_file(system, FILENAME)) {
+        case FILE_OK:
+            printf("数据加载成功！共加载 %d 名学生。\n", system->count);
+            return 1;
+        case FILE_NOT_FOUND:
+            printf("提示：数据文件不存在，将创建新的数据文件。\n");
+            return 0;
+        case FILE_TOO_LARGE:
+            printf("错误：文件中的学生数量超过系统限制！\n");
+            return 0;
+        default:
+            printf("错误：读取学生数据失败！\n");
+            return 0;
     }
-    
-    fclose(file);
-    printf("数据加载成功！共加载 %d 名学生。\n", system->count);
-    return 1;
-}
\ No newline at end of file
+}
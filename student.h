@@ -4,45 +4,218 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "bloom.h"
+#include "chunk.h"
+#include "strheap.h"
+#include "schema.h"
 
-#define MAX_STUDENTS 100
-#define MAX_NAME_LEN 50
+#define INITIAL_CAPACITY 128    // 初始容量，不足时自动扩充
+#define MAX_NAME_LEN 256        // 姓名输入缓冲区长度（存储不受此限制）
 #define MAX_ID_LEN 20
 #define FILENAME "students.dat"
+#define SNAPSHOT_NAME_LEN 32
 
-// 学生结构体
+// 文件读写状态
+enum {
+    FILE_OK = 0,
+    FILE_NOT_FOUND,
+    FILE_READ_ERROR,
+    FILE_WRITE_ERROR,
+    FILE_TOO_LARGE,
+    FILE_CHANGED,               // 数据文件在加载或上次保存后被其他进程保存过
+    FILE_CONFLICT               // 合并时双方修改了同一名学生（filesync.h）
+};
+
+// 学生信息视图：用于输入、显示和交换，字符串指向字符串堆或调用者的缓冲区
 typedef struct {
-    char id[MAX_ID_LEN];        // 学号
-    char name[MAX_NAME_LEN];    // 姓名
+    const char *id;             // 学号
+    const char *name;           // 姓名
     int age;                    // 年龄
-    float math_score;           // 数学成绩
-    float english_score;        // 英语成绩
-    float chinese_score;        // 语文成绩
-    float average_score;        // 平均成绩
+    float scores[MAX_SUBJECTS]; // 各科成绩，顺序与科目设置一致
+    float average_score;        // 平均成绩（按科目权重加权）
 } Student;
 
+// 学生记录按访问频率拆成几部分，用同一个下标访问：
+// 各科成绩按科目分列存放，以百分之一分为单位的定点数（0-10000）；
+// 热数据供排序、统计和筛选扫描；
+// 冷数据只在显示和按学号查找时访问，学号和姓名存放在字符串堆中，只保存偏移。
+// 每一部分都是一个块表（chunk.h），快照与当前数据共享未修改的块
+typedef struct {
+    uint16_t average;           // 平均成绩
+    uint8_t age;                // 年龄（1-150）
+    uint8_t flags;              // 槽位标志 SLOT_*
+} HotRecord;
+
+typedef struct {
+    uint32_t id;                // 学号偏移
+    uint32_t name;              // 姓名偏移
+    uint32_t name_key;          // 姓名排序键偏移（collate.h），设置姓名时计算
+} ColdRecord;
+
+// 槽位标志
+#define SLOT_DIRTY 0x01         // 加载或保存后被添加或修改过
+
+// 快照：某一时刻学生数据的只读版本，取快照只增加引用计数，与学生数量无关
+typedef struct {
+    char name[SNAPSHOT_NAME_LEN]; // 快照名
+    time_t taken;               // 创建时间
+    Schema schema;
+    ChunkTable *scores[MAX_SUBJECTS];
+    ChunkTable *hot;
+    ChunkTable *cold;
+    int count;
+    StringHeap *strings;
+    uint64_t change_seq;        // 取快照时的 change_seq，保存后记入变更流
+} Snapshot;
+
+// 统计结果（定点成绩），内存中的数据和流式读取共用
+typedef struct {
+    int count;                  // 学生数量
+    long long totals[MAX_SUBJECTS]; // 各科总分
+    uint16_t highest[MAX_SUBJECTS];
+    uint16_t lowest[MAX_SUBJECTS];
+    long long total_average;    // 平均分之和
+    uint16_t max_average;
+    uint16_t min_average;
+    char max_id[MAX_ID_LEN];    // 最高分和最低分学生
+    char max_name[MAX_NAME_LEN];
+    char min_id[MAX_ID_LEN];
+    char min_name[MAX_NAME_LEN];
+} Statistics;
+
+// 学号索引：学号到下标的开放定址哈希表（线性探测），按学号查找只需探测几个槽。
+// 槽与学号过滤器的位数组一样存放在块表中（每行一个槽），被各版本共享，修改时只复制被改动的块
+typedef struct {
+    ChunkTable *slots;          // 槽的值为学生下标+1，0为空，ID_SLOT_DELETED为已删除；NULL表示未建立，查找时逐个比较
+    uint32_t mask;              // 槽数-1，槽数为2的幂，不少于容量的2倍
+    uint32_t used;              // 非空的槽数（含已删除），超过槽数的3/4时重建
+} IdHash;
+
+#define ID_SLOT_DELETED UINT32_MAX
+
+struct ViewSet;
+struct ChangeFeed;
+
 // 学生管理系统结构体
 typedef struct {
-    Student students[MAX_STUDENTS];
+    Schema schema;              // 科目设置
+    ChunkTable *scores[MAX_SUBJECTS]; // 每科一列成绩，只分配 schema.count 列
+    ChunkTable *hot;            // 热数据
+    ChunkTable *cold;           // 冷数据
     int count;                  // 当前学生数量
+    int capacity;               // 已分配的记录数
+    StringHeap *strings;        // 学号和姓名
+    size_t string_garbage;      // 字符串堆中已不再引用的字节数（估计值：姓名去重存放，可能仍被其他学生使用）
+    BloomFilter id_filter;      // 学号过滤器，快速排除不存在的学号
+    IdHash id_index;            // 学号索引
+    int layout_changed;         // 保存后是否删除或重排过学生
+    unsigned long edits;        // 修改计数，每次修改加1（后台保存据此判断保存后是否又有修改）
+    uint64_t change_seq;        // 本进程写入变更流的下一个序号，加载后还没有写入时为0
+    Snapshot *snapshots;        // 保留的快照
+    int snapshot_count;
+    struct ViewSet *views;      // 排序视图（views.h），未注册视图时为NULL
+    struct ChangeFeed *changes; // 变更流（changefeed.h），未启用时为NULL
+    Snapshot *file_base;        // 最近一次加载或保存时数据文件的内容，保存时据此合并（filesync.h），NULL表示文件不存在
+    uint32_t file_generation;   // 最近一次加载或保存时数据文件的代数
 } StudentSystem;
 
+// 成绩与定点数互相转换
+#define SCORE_SCALE 100
+#define score_to_fixed(score) ((uint16_t)((score) * SCORE_SCALE + 0.5f))
+#define fixed_to_score(value) ((float)(value) / SCORE_SCALE)
+
 // 函数声明
 void init_system(StudentSystem *system);
+void free_system(StudentSystem *system);
 void display_menu();
 int add_student(StudentSystem *system);
 int delete_student(StudentSystem *system);
 int modify_student(StudentSystem *system);
-void display_all_students(StudentSystem *system);
+void display_all_students(StudentSystem *system, int view);
+int choose_view(StudentSystem *system);
 void search_student(StudentSystem *system);
 void sort_students(StudentSystem *system);
 void calculate_statistics(StudentSystem *system);
+int collect_statistics(const StudentSystem *system, Statistics *out);
+void print_statistics(const Schema *schema, const Statistics *stats);
+void print_filter_stats(StudentSystem *system);
 int save_to_file(StudentSystem *system);
 int load_from_file(StudentSystem *system);
-void calculate_average(Student *student);
-int find_student_by_id(StudentSystem *system, const char *id);
+void calculate_average(const Schema *schema, Student *student);
 void clear_input_buffer();
 int is_valid_id(const char *id);
 int is_valid_score(float score);
+void print_table_header(const Schema *schema);
+void print_student_row(const Schema *schema, const Student *s);
+void print_student_detail(const Schema *schema, const Student *s);
+int read_score(const char *prompt, float *score);
+int display_matching_students(StudentSystem *system, const char *expression);
+
+// 存储访问（roster.c）
+int reserve_students(StudentSystem *system, int capacity);
+void get_student(const StudentSystem *system, int index, Student *out);
+int set_student(StudentSystem *system, int index, const Student *student);
+int append_student(StudentSystem *system, const Student *student);
+void remove_student(StudentSystem *system, int index);
+void move_student(StudentSystem *system, int from, int to);
+void swap_students(StudentSystem *system, int a, int b);
+int reorder_students(StudentSystem *system, const uint32_t *order);
+void mark_saved(StudentSystem *system);
+void compact_strings(StudentSystem *system);
+int has_unsaved_changes(const StudentSystem *system);
+void clear_students(StudentSystem *system);
+int apply_schema(StudentSystem *system, const Schema *schema);
+void recompute_averages(StudentSystem *system);
+int find_student_by_id(StudentSystem *system, const char *id);
+void rebuild_id_index(StudentSystem *system);
+size_t roster_memory(const StudentSystem *system);
+
+// 按下标读取（当前数据和快照均可用），修改须通过上面的存储访问函数
+#define hot_at(s, i) ((const HotRecord *)chunk_row((s)->hot, (uint32_t)(i)))
+#define cold_at(s, i) ((const ColdRecord *)chunk_row((s)->cold, (uint32_t)(i)))
+#define score_at(s, k, i) (*(const uint16_t *)chunk_row((s)->scores[k], (uint32_t)(i)))
+#define student_id_at(s, i) strheap_get((s)->strings, cold_at(s, i)->id)
+#define student_name_at(s, i) strheap_get((s)->strings, cold_at(s, i)->name)
+#define student_name_key_at(s, i) strheap_get((s)->strings, cold_at(s, i)->name_key)
+
+// 快照（snapshot.c）
+int take_snapshot(StudentSystem *system, Snapshot *snapshot);
+void release_snapshot(Snapshot *snapshot);
+void snapshot_get_student(const Snapshot *snapshot, int index, Student *out);
+int restore_snapshot(StudentSystem *system, const Snapshot *snapshot);
+int keep_snapshot(StudentSystem *system, const char *name);
+int find_snapshot(const StudentSystem *system, const char *name);
+void drop_snapshot(StudentSystem *system, int index);
+int share_system(const StudentSystem *system, StudentSystem *copy);
+
+// 数据文件（datafile.c）
+// 打开的数据文件：文件头和科目设置已读出，文件位置在第一条记录（或第一块）处
+typedef struct {
+    FILE *file;
+    int version;                // 格式版本，旧版格式为0
+    int compressed;             // 是否为分块压缩格式
+    uint32_t count;             // 学生数量
+    uint32_t generation;        // 代数，每次保存加1，旧文件为0
+    uint64_t index_offset;      // 压缩格式的块索引位置
+    Schema schema;              // 文件中的科目设置
+    char temp[512];             // 写入时的临时文件名
+} DataFile;
+
+int open_data_file(DataFile *data, const char *filename);
+int read_data_record(DataFile *data, char *id, char *name, uint8_t *age, uint16_t *scores);
+void close_data_file(DataFile *data);
+int create_data_file(DataFile *data, const char *filename, const Schema *schema, uint32_t count);
+void write_data_record(DataFile *data, const char *id, const char *name, uint8_t age, const uint16_t *scores);
+int commit_data_file(DataFile *data, const char *filename);
+void abort_data_file(DataFile *data);
+int write_data_file(const Snapshot *snapshot, const char *filename);
+int write_data_file_as(const Snapshot *snapshot, const char *filename, int compressed);
+int read_data_file(StudentSystem *system, const char *filename);
+int data_file_generation(const char *filename, uint32_t *generation);
+int lookup_data_file(const char *filename, const char *id, Schema *schema, Student *out,
+                     char *name, size_t name_size);
+int compression_enabled(void);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,176 @@
+#!/bin/bash
+
+# 学生管理系统回归检查脚本
+# 检查并发读者与版本发布（RCU回收、学号过滤器和学号索引的写时复制）以及历史文件的分帧与截断恢复。
+# 在临时目录中运行，不影响当前目录的数据文件；全部通过时退出码为0
+
+if [ ! -f "./student_management" ]; then
+    echo "错误：找不到可执行文件，请先运行 'make' 编译程序"
+    exit 1
+fi
+
+BIN="$(pwd)/student_management"
+WORK="$(mktemp -d)"
+FAILED=0
+SERVER=
+trap '[ -n "$SERVER" ] && kill -INT $SERVER 2> /dev/null; rm -rf "$WORK"' EXIT
+cd "$WORK" || exit 1
+cp "$BIN" ./student_management
+
+pass() {
+    echo "✅ $1"
+}
+
+fail() {
+    echo "❌ $1"
+    FAILED=$((FAILED + 1))
+}
+
+echo "=== 学生管理系统回归检查 ==="
+echo "工作目录：$WORK"
+
+# 准备5000名学生
+(
+    echo "id,name,age,math,english,chinese,average"
+    seq 0 4999 | awk '{printf "T%05d,学生%d,%d,%d.00,%d.00,%d.00,0\n", $1, $1 % 97, 18 + $1 % 10, $1 % 101, ($1 * 7) % 101, ($1 * 3) % 101}'
+) > seed.csv
+if ./student_management import seed.csv > import.out 2>&1; then
+    pass "导入5000名学生"
+else
+    fail "导入学生失败"
+    cat import.out
+    exit 1
+fi
+
+echo ""
+echo "=== 1. 并发读者与版本发布 ==="
+
+# stress：读线程不加锁按学号查找，写线程每次修改后发布新版本，被替换的版本按纪元回收；
+# 读到已回收或不完整的版本时会查找失败（或崩溃）
+if ./student_management stress 4 2 > stress.out 2> stress.err && grep -q "^RCU:" stress.out; then
+    if grep -q "查找失败" stress.err; then
+        fail "stress：读者在版本发布期间查找失败"
+        head -5 stress.err
+    else
+        pass "stress：4个线程并发查找和修改，读者未查找失败"
+    fi
+else
+    fail "stress 异常退出"
+    cat stress.err
+fi
+
+# serve：流水线和批量查询的同时，另一个客户端逐个修改学生，每次修改都发布新版本
+rm -f students.sock
+./student_management serve > serve.out 2>&1 &
+SERVER=$!
+for i in $(seq 50); do
+    [ -S students.sock ] && break
+    sleep 0.1
+done
+if [ ! -S students.sock ]; then
+    fail "服务未能启动"
+    cat serve.out
+else
+    (
+        for i in $(seq 0 299); do
+            ./student_management client modify "T$(printf %05d "$i")" "改$i" 20 1 2 3 > /dev/null || echo "修改失败 $i"
+        done
+    ) > modify.out 2>&1 &
+    MODIFIER=$!
+    ./student_management client bench 2 1 > bench.out 2>&1
+    BENCH=$?
+    wait $MODIFIER
+    if [ $BENCH -ne 0 ] || grep -q "请求失败" bench.out; then
+        fail "服务压测期间有请求失败"
+        cat bench.out
+    else
+        pass "服务压测与并发修改同时进行，查询全部成功"
+    fi
+    if [ -s modify.out ]; then
+        fail "并发修改失败"
+        head -5 modify.out
+    else
+        pass "300次修改全部成功"
+    fi
+
+    # 新添加的学号要加入过滤器和索引，已发布的版本与当前数据共享它们（写时复制）
+    for i in $(seq 0 99); do
+        ./student_management client add "N$(printf %05d "$i")" "新$i" 19 60 70 80 > /dev/null || echo "添加失败 $i"
+    done > add.out 2>&1
+    for i in $(seq 0 99); do
+        ./student_management client get "N$(printf %05d "$i")" | grep -q "新$i" || echo "查不到 N$(printf %05d "$i")"
+    done >> add.out 2>&1
+    if ./student_management client get T00299 | grep -q "改299"; then
+        true
+    else
+        echo "T00299 的修改未生效" >> add.out
+    fi
+    if [ -s add.out ]; then
+        fail "新版本中的学生不正确"
+        head -5 add.out
+    else
+        pass "添加的100名学生和修改后的学生都能从新版本查到"
+    fi
+
+    kill -INT $SERVER
+    wait $SERVER
+    SERVER=
+    if grep -q "服务已停止" serve.out; then
+        pass "服务正常停止并保存"
+    else
+        fail "服务未正常停止"
+        cat serve.out
+    fi
+    COUNT=$(./student_management search 'id ^= "N"' 2>/dev/null | grep -c "^N")
+    if [ "$COUNT" -eq 100 ]; then
+        pass "重新加载后有100名新添加的学生"
+    else
+        fail "重新加载后新添加的学生为 $COUNT 名，应为100名"
+    fi
+fi
+
+echo ""
+echo "=== 2. 历史文件 ==="
+
+./student_management term close 春季 > /dev/null && ./student_management term close 秋季 > /dev/null
+if [ "$(./student_management term list | grep -c "名学生")" -eq 2 ]; then
+    pass "结转两个学期"
+else
+    fail "结转学期失败"
+fi
+cp students.hist good.hist
+
+# 最后一个学期只写了一部分（结转中断）：加载时截去，之前的学期完好
+truncate -s -7 students.hist
+./student_management term list > list.out 2> list.err
+if [ $? -eq 0 ] && grep -q "未写完" list.err && grep -q "春季" list.out && ! grep -q "秋季" list.out; then
+    pass "末尾残缺的学期被截去，之前的学期完好"
+else
+    fail "末尾残缺的历史文件处理不正确"
+    cat list.out list.err
+fi
+if ./student_management term close 冬季 > /dev/null && [ "$(./student_management term list 2> /dev/null | grep -c "名学生")" -eq 2 ]; then
+    pass "截断后可以继续结转学期"
+else
+    fail "截断后结转学期失败"
+fi
+
+# 中间的学期损坏（校验和不符）：报告错误，不当作残缺的末尾截去
+cp good.hist students.hist
+printf '\xff' | dd of=students.hist bs=1 seek=200 conv=notrunc 2> /dev/null
+cp students.hist bad.hist
+if ./student_management term list > /dev/null 2> list.err; then
+    fail "损坏的历史文件未被发现"
+elif cmp -s bad.hist students.hist; then
+    pass "损坏的历史文件被拒绝，文件未被截断"
+else
+    fail "损坏的历史文件被修改"
+fi
+
+echo ""
+if [ $FAILED -eq 0 ]; then
+    echo "全部检查通过！"
+    exit 0
+fi
+echo "共 $FAILED 项检查失败！"
+exit 1
@@ -0,0 +1,547 @@
+#include "views.h"
+#include "query.h"
+
+// 节点中保存的一个排序键的值：学号和姓名的排序键指向字符串堆，其余为整数
+typedef union {
+    uint32_t number;
+    const char *text;
+} ViewValue;
+
+struct ViewNode {
+    ViewNode *left;
+    ViewNode *right;
+    uint32_t slot;                  // 学生的槽号
+    int height;
+    ViewValue values[];             // 各排序键的值，顺序与排序规则一致
+};
+
+// 槽号slot之前在用的槽号数，即该学生当前的下标
+static uint32_t slot_rank(const struct ViewSet *set, uint32_t slot) {
+    uint32_t rank = 0;
+    for (uint32_t i = slot; i > 0; i -= i & -i) {
+        rank += set->slots[i];
+    }
+    return rank;
+}
+
+// 槽号slot改为在用（delta为1）或空闲（delta为-1）
+static void slot_update(struct ViewSet *set, uint32_t slot, int delta) {
+    for (uint32_t i = slot + 1; i <= set->slot_capacity; i += i & -i) {
+        set->slots[i] += (uint32_t)delta;
+    }
+}
+
+// 第index名学生的槽号：在树状数组上按位逐级查找
+static uint32_t slot_of(const struct ViewSet *set, uint32_t index) {
+    uint32_t step = 1;
+    while (step * 2 <= set->slot_capacity) {
+        step *= 2;
+    }
+    uint32_t pos = 0, remaining = index + 1;
+    for (; step > 0; step /= 2) {
+        if (pos + step <= set->slot_capacity && set->slots[pos + step] < remaining) {
+            pos += step;
+            remaining -= set->slots[pos];
+        }
+    }
+    return pos;
+}
+
+// 重新分配槽号：前used个槽号在用（第i名学生的槽号为i），成功返回1
+static int reset_slots(struct ViewSet *set, uint32_t used) {
+    uint32_t capacity = used * 2 > INITIAL_CAPACITY ? used * 2 : INITIAL_CAPACITY;
+    uint32_t *slots = malloc((capacity + 1) * sizeof(uint32_t));
+    if (slots == NULL) {
+        return 0;
+    }
+    // 第i项管辖 (i - lowbit(i), i] 这一段
+    slots[0] = 0;
+    for (uint32_t i = 1; i <= capacity; i++) {
+        uint32_t low = i - (i & -i);
+        uint32_t high = i < used ? i : used;
+        slots[i] = high > low ? high - low : 0;
+    }
+    free(set->slots);
+    set->slots = slots;
+    set->slot_capacity = capacity;
+    set->slot_used = used;
+    return 1;
+}
+
+// 取出第row名学生在排序规则各键上的值
+static void row_values(const StudentSystem *system, const SortSpec *spec, int row, ViewValue *values) {
+    for (int i = 0; i < spec->count; i++) {
+        int field = spec->keys[i].field;
+        if (field == FIELD_ID) {
+            values[i].text = student_id_at(system, row);
+        } else if (field == FIELD_NAME) {
+            values[i].text = student_name_key_at(system, row);
+        } else if (field == FIELD_AGE) {
+            values[i].number = hot_at(system, row)->age;
+        } else if (field == FIELD_AVERAGE) {
+            values[i].number = hot_at(system, row)->average;
+        } else {
+            values[i].number = score_at(system, field - FIELD_SUBJECT, row);
+        }
+    }
+}
+
+// 比较一名学生与树中的节点：各键依次比较，都相同时槽号小的在前（与排序菜单的稳定排序一致）
+static int compare_node(const SortSpec *spec, const ViewValue *values, uint32_t slot, const ViewNode *node) {
+    for (int i = 0; i < spec->count; i++) {
+        int field = spec->keys[i].field;
+        int r;
+        if (field == FIELD_ID || field == FIELD_NAME) {
+            r = strcmp(values[i].text, node->values[i].text);
+        } else {
+            r = (values[i].number > node->values[i].number) - (values[i].number < node->values[i].number);
+        }
+        if (r != 0) {
+            return spec->keys[i].descending ? -r : r;
+        }
+    }
+    return (slot > node->slot) - (slot < node->slot);
+}
+
+static ViewNode *new_node(const StudentSystem *system, const SortSpec *spec, int row, uint32_t slot) {
+    ViewNode *node = malloc(sizeof(ViewNode) + spec->count * sizeof(ViewValue));
+    if (node != NULL) {
+        node->left = node->right = NULL;
+        node->slot = slot;
+        node->height = 1;
+        row_values(system, spec, row, node->values);
+    }
+    return node;
+}
+
+static void free_tree(ViewNode *node) {
+    if (node != NULL) {
+        free_tree(node->left);
+        free_tree(node->right);
+        free(node);
+    }
+}
+
+static int height(const ViewNode *node) {
+    return node != NULL ? node->height : 0;
+}
+
+static void update_height(ViewNode *node) {
+    int left = height(node->left), right = height(node->right);
+    node->height = (left > right ? left : right) + 1;
+}
+
+static ViewNode *rotate_right(ViewNode *node) {
+    ViewNode *left = node->left;
+    node->left = left->right;
+    left->right = node;
+    update_height(node);
+    update_height(left);
+    return left;
+}
+
+static ViewNode *rotate_left(ViewNode *node) {
+    ViewNode *right = node->right;
+    node->right = right->left;
+    right->left = node;
+    update_height(node);
+    update_height(right);
+    return right;
+}
+
+// 左右子树高度差超过1时旋转，返回调整后的子树根
+static ViewNode *rebalance(ViewNode *node) {
+    update_height(node);
+    int balance = height(node->left) - height(node->right);
+    if (balance > 1) {
+        if (height(node->left->left) < height(node->left->right)) {
+            node->left = rotate_left(node->left);
+        }
+        return rotate_right(node);
+    }
+    if (balance < -1) {
+        if (height(node->right->right) < height(node->right->left)) {
+            node->right = rotate_right(node->right);
+        }
+        return rotate_left(node);
+    }
+    return node;
+}
+
+static ViewNode *insert_node(const SortSpec *spec, ViewNode *root, ViewNode *node) {
+    if (root == NULL) {
+        return node;
+    }
+    if (compare_node(spec, node->values, node->slot, root) < 0) {
+        root->left = insert_node(spec, root->left, node);
+    } else {
+        root->right = insert_node(spec, root->right, node);
+    }
+    return rebalance(root);
+}
+
+// 从子树中摘下最左的节点
+static ViewNode *take_first(ViewNode *root, ViewNode **first) {
+    if (root->left == NULL) {
+        *first = root;
+        return root->right;
+    }
+    root->left = take_first(root->left, first);
+    return rebalance(root);
+}
+
+// 从子树中摘下与values和slot相同的节点（存入*removed），返回调整后的子树根
+static ViewNode *remove_node(const SortSpec *spec, ViewNode *root, const ViewValue *values, uint32_t slot,
+                             ViewNode **removed) {
+    if (root == NULL) {
+        return NULL;
+    }
+    int r = compare_node(spec, values, slot, root);
+    if (r < 0) {
+        root->left = remove_node(spec, root->left, values, slot, removed);
+    } else if (r > 0) {
+        root->right = remove_node(spec, root->right, values, slot, removed);
+    } else {
+        *removed = root;
+        if (root->left == NULL || root->right == NULL) {
+            return root->left != NULL ? root->left : root->right;
+        }
+        // 用右子树中最小的节点接替
+        ViewNode *next;
+        ViewNode *right = take_first(root->right, &next);
+        next->left = root->left;
+        next->right = right;
+        return rebalance(next);
+    }
+    return rebalance(root);
+}
+
+// 由已排好的下标建平衡树（此时槽号与下标相同），每个节点取区间的中点
+static ViewNode *build_tree(const StudentSystem *system, const SortSpec *spec, const uint32_t *order, int lo, int hi,
+                            int *ok) {
+    if (lo >= hi || !*ok) {
+        return NULL;
+    }
+    int mid = lo + (hi - lo) / 2;
+    ViewNode *node = new_node(system, spec, (int)order[mid], order[mid]);
+    if (node == NULL) {
+        *ok = 0;
+        return NULL;
+    }
+    node->left = build_tree(system, spec, order, lo, mid, ok);
+    node->right = build_tree(system, spec, order, mid + 1, hi, ok);
+    update_height(node);
+    return node;
+}
+
+// 压缩前把各节点的槽号换成学生当前的下标
+static void renumber(const struct ViewSet *set, ViewNode *node) {
+    if (node != NULL) {
+        renumber(set, node->left);
+        renumber(set, node->right);
+        node->slot = slot_rank(set, node->slot);
+    }
+}
+
+static void walk_node(StudentSystem *system, const ViewNode *node,
+                      void (*visit)(StudentSystem *system, int row, void *context), void *context) {
+    if (node != NULL) {
+        walk_node(system, node->left, visit, context);
+        visit(system, (int)slot_rank(system->views, node->slot), context);
+        walk_node(system, node->right, visit, context);
+    }
+}
+
+// 删除第index个视图（不检查是否为最后一个）
+static void remove_view(struct ViewSet *set, int index) {
+    free_tree(set->views[index].root);
+    memmove(&set->views[index], &set->views[index + 1], (set->count - index - 1) * sizeof(SortedView));
+    set->count--;
+}
+
+// 注册排序视图，成功返回1；失败时错误信息写入error
+int add_view(StudentSystem *system, const char *name, const char *keys, char *error, size_t size) {
+    if (name[0] == '\0' || strlen(name) >= VIEW_NAME_LEN) {
+        snprintf(error, size, "视图名应为1-%d个字符", VIEW_NAME_LEN - 1);
+        return 0;
+    }
+    if (find_view(system, name) != -1) {
+        snprintf(error, size, "视图 %s 已存在", name);
+        return 0;
+    }
+    if (view_count(system) == MAX_VIEWS) {
+        snprintf(error, size, "最多注册 %d 个视图", MAX_VIEWS);
+        return 0;
+    }
+    SortSpec spec;
+    if (strlen(keys) >= VIEW_KEYS_LEN || !sort_spec_parse(&spec, &system->schema, keys)) {
+        snprintf(error, size, "%s", strlen(keys) >= VIEW_KEYS_LEN ? "排序键过长" : spec.error);
+        return 0;
+    }
+
+    if (system->views == NULL) {
+        system->views = calloc(1, sizeof(struct ViewSet));
+        if (system->views == NULL) {
+            snprintf(error, size, "内存不足");
+            return 0;
+        }
+    }
+    struct ViewSet *set = system->views;
+    SortedView *view = &set->views[set->count++];
+    memset(view, 0, sizeof(*view));
+    snprintf(view->name, sizeof(view->name), "%s", name);
+    snprintf(view->keys, sizeof(view->keys), "%s", keys);
+    view->spec = spec;
+
+    // 已有视图的槽号与下标未必相同，连同新视图一起重建
+    set->stale = 1;
+    if (!refresh_views(system)) {
+        drop_view(system, set->count - 1);
+        snprintf(error, size, "内存不足");
+        return 0;
+    }
+    return 1;
+}
+
+// 按名称查找视图，找不到返回-1
+int find_view(const StudentSystem *system, const char *name) {
+    for (int i = 0; i < view_count(system); i++) {
+        if (strcmp(system->views->views[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 删除视图；最后一个视图删除后释放全部
+void drop_view(StudentSystem *system, int index) {
+    remove_view(system->views, index);
+    if (system->views->count == 0) {
+        free_views(system);
+    }
+}
+
+int view_count(const StudentSystem *system) {
+    return system->views != NULL ? system->views->count : 0;
+}
+
+const SortedView *view_at(const StudentSystem *system, int index) {
+    return &system->views->views[index];
+}
+
+// 需要时重建全部视图：按排序规则排出顺序后直接建平衡树。
+// 科目设置改变后已不存在的字段使视图失效，失效的视图被删除；内存不足返回0
+int refresh_views(StudentSystem *system) {
+    struct ViewSet *set = system->views;
+    if (set == NULL || !set->stale) {
+        return 1;
+    }
+    for (int v = 0; v < set->count; v++) {
+        free_tree(set->views[v].root);
+        set->views[v].root = NULL;
+    }
+    uint32_t *order = malloc((system->count > 0 ? system->count : 1) * sizeof(uint32_t));
+    if (order == NULL || !reset_slots(set, (uint32_t)system->count)) {
+        free(order);
+        return 0;
+    }
+
+    for (int v = 0; v < set->count; ) {
+        SortedView *view = &set->views[v];
+        if (!sort_spec_parse(&view->spec, &system->schema, view->keys)) {
+            printf("提示：排序视图 %s 已失效（%s），已删除。\n", view->name, view->spec.error);
+            remove_view(set, v);
+            continue;
+        }
+        int ok = sort_order(system, &view->spec, order);
+        view->root = build_tree(system, &view->spec, order, 0, ok ? system->count : 0, &ok);
+        if (!ok) {
+            free(order);
+            return 0;
+        }
+        v++;
+    }
+    free(order);
+    set->stale = 0;
+    if (set->count == 0) {
+        free_views(system);
+    }
+    return 1;
+}
+
+// 按视图顺序依次访问全部学生，visit收到学生的下标；视图需要重建而内存不足时返回0
+int walk_view(StudentSystem *system, int index, void (*visit)(StudentSystem *system, int row, void *context),
+              void *context) {
+    if (!refresh_views(system) || index >= view_count(system)) {
+        return 0;
+    }
+    walk_node(system, system->views->views[index].root, visit, context);
+    return 1;
+}
+
+// 按第一个排序键的范围访问：节点的值与常量比较（r为 值-常量 的符号），按比较运算符判断本节点是否满足，
+// 以及取值更小、更大的一侧还可能有满足的节点（键相同的节点按槽号分在两侧）；降序的视图两侧对调
+typedef struct {
+    StudentSystem *system;
+    const SortKey *key;
+    int cmp;
+    int64_t number;
+    const char *text;
+    int visited;
+    int limit;
+    void (*visit)(StudentSystem *system, int row, void *context);
+    void *context;
+} RangeWalk;
+
+static int walk_range_node(RangeWalk *walk, const ViewNode *node) {
+    if (node == NULL) {
+        return 1;
+    }
+    int r;
+    if (walk->key->field == FIELD_ID || walk->key->field == FIELD_NAME) {
+        r = strcmp(node->values[0].text, walk->text);
+    } else {
+        r = ((int64_t)node->values[0].number > walk->number) - ((int64_t)node->values[0].number < walk->number);
+    }
+    int hit, lower, upper;
+    switch (walk->cmp) {
+        case CMP_LT: hit = r < 0; lower = 1; upper = r < 0; break;
+        case CMP_LE: hit = r <= 0; lower = 1; upper = r <= 0; break;
+        case CMP_GT: hit = r > 0; lower = r > 0; upper = 1; break;
+        case CMP_GE: hit = r >= 0; lower = r >= 0; upper = 1; break;
+        default: hit = r == 0; lower = r >= 0; upper = r <= 0; break;
+    }
+    const ViewNode *smaller = walk->key->descending ? node->right : node->left;
+    const ViewNode *larger = walk->key->descending ? node->left : node->right;
+    if (lower && !walk_range_node(walk, smaller)) {
+        return 0;
+    }
+    if (hit) {
+        if (++walk->visited > walk->limit) {
+            return 0;
+        }
+        walk->visit(walk->system, (int)slot_rank(walk->system->views, node->slot), walk->context);
+    }
+    return !upper || walk_range_node(walk, larger);
+}
+
+// 找第一个排序键为field的视图（需要时先重建），没有返回-1
+int find_view_by_field(StudentSystem *system, int field) {
+    if (system->views == NULL || !refresh_views(system)) {
+        return -1;
+    }
+    for (int v = 0; v < view_count(system); v++) {
+        if (system->views->views[v].spec.keys[0].field == field) {
+            return v;
+        }
+    }
+    return -1;
+}
+
+// 在第index个视图中访问第一个排序键满足 键 cmp 常量 的学生（cmp为CMP_LT到CMP_EQ）：
+// 学号、姓名与text比较（姓名为排序键），其余字段与number比较。只走满足条件的子树，O(log n + 命中数)。
+// 返回访问的学生数；超过limit时中止并返回-1，调用者改为逐个扫描
+int walk_view_range(StudentSystem *system, int index, int cmp, int64_t number, const char *text, int limit,
+                    void (*visit)(StudentSystem *system, int row, void *context), void *context) {
+    const SortedView *view = &system->views->views[index];
+    RangeWalk walk = {system, &view->spec.keys[0], cmp, number, text, 0, limit, visit, context};
+    return walk_range_node(&walk, view->root) ? walk.visited : -1;
+}
+
+// 释放全部视图
+void free_views(StudentSystem *system) {
+    struct ViewSet *set = system->views;
+    if (set == NULL) {
+        return;
+    }
+    for (int v = 0; v < set->count; v++) {
+        free_tree(set->views[v].root);
+    }
+    free(set->slots);
+    free(set);
+    system->views = NULL;
+}
+
+// 视图已建好时才逐个调整节点，否则留待使用时整体重建
+static struct ViewSet *live_views(StudentSystem *system) {
+    struct ViewSet *set = system->views;
+    return set != NULL && !set->stale ? set : NULL;
+}
+
+// 把第index名学生按当前数据插入各视图
+void views_link_row(StudentSystem *system, int index) {
+    struct ViewSet *set = live_views(system);
+    if (set == NULL) {
+        return;
+    }
+    uint32_t slot = slot_of(set, (uint32_t)index);
+    for (int v = 0; v < set->count; v++) {
+        SortedView *view = &set->views[v];
+        ViewNode *node = new_node(system, &view->spec, index, slot);
+        if (node == NULL) {
+            set->stale = 1;
+            return;
+        }
+        view->root = insert_node(&view->spec, view->root, node);
+    }
+}
+
+// 把第index名学生从各视图中摘下（在修改其数据之前调用）
+void views_unlink_row(StudentSystem *system, int index) {
+    struct ViewSet *set = live_views(system);
+    if (set == NULL) {
+        return;
+    }
+    uint32_t slot = slot_of(set, (uint32_t)index);
+    for (int v = 0; v < set->count; v++) {
+        SortedView *view = &set->views[v];
+        ViewValue values[SORT_MAX_KEYS];
+        ViewNode *removed = NULL;
+        row_values(system, &view->spec, index, values);
+        view->root = remove_node(&view->spec, view->root, values, slot, &removed);
+        if (removed == NULL) {
+            // 视图与数据不一致，整体重建
+            set->stale = 1;
+            return;
+        }
+        free(removed);
+    }
+}
+
+// 新学生追加为第index名后调用：分配新的槽号并插入各视图
+void views_add_row(StudentSystem *system, int index) {
+    struct ViewSet *set = live_views(system);
+    if (set == NULL) {
+        return;
+    }
+    // 槽号用完时按当前下标重新编号，已删除学生的槽号随之回收
+    if (set->slot_used == set->slot_capacity) {
+        for (int v = 0; v < set->count; v++) {
+            renumber(set, set->views[v].root);
+        }
+        if (!reset_slots(set, (uint32_t)index)) {
+            set->stale = 1;
+            return;
+        }
+    }
+    slot_update(set, set->slot_used++, 1);
+    views_link_row(system, index);
+}
+
+// 删除第index名学生之前调用：从各视图摘下并释放其槽号
+void views_remove_row(StudentSystem *system, int index) {
+    struct ViewSet *set = live_views(system);
+    if (set == NULL) {
+        return;
+    }
+    uint32_t slot = slot_of(set, (uint32_t)index);
+    views_unlink_row(system, index);
+    slot_update(set, slot, -1);
+}
+
+// 学生被整体替换、重排或科目设置改变，视图留待使用时重建
+void views_invalidate(StudentSystem *system) {
+    if (system->views != NULL) {
+        system->views->stale = 1;
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef VIEWS_H
+#define VIEWS_H
+
+#include "student.h"
+#include "sortkey.h"
+
+#define MAX_VIEWS 8                 // 最多注册的排序视图数
+#define VIEW_NAME_LEN 32
+#define VIEW_KEYS_LEN 256
+
+typedef struct ViewNode ViewNode;
+
+// 排序视图：按排序规则保持有序的平衡树（AVL），学生增删改时只调整该学生的节点
+typedef struct {
+    char name[VIEW_NAME_LEN];
+    char keys[VIEW_KEYS_LEN];       // 排序键原文，重建时重新解析（科目设置可能已改变）
+    SortSpec spec;
+    ViewNode *root;
+} SortedView;
+
+// 全部排序视图。树节点以槽号标识学生：槽号按添加顺序分配，删除学生不改变其余学生的槽号，
+// 槽号的先后就是学生在数组中的先后。树状数组记录哪些槽号在用，由槽号换算下标或反过来
+struct ViewSet {
+    SortedView views[MAX_VIEWS];
+    int count;
+    int stale;                      // 学生被整体替换、重排或科目设置改变后，使用前整体重建
+    uint32_t *slots;                // 树状数组（下标从1开始），第s+1项起记录槽号s是否在用
+    uint32_t slot_capacity;
+    uint32_t slot_used;             // 已分配的槽号数
+};
+
+// 函数声明
+int add_view(StudentSystem *system, const char *name, const char *keys, char *error, size_t size);
+int find_view(const StudentSystem *system, const char *name);
+void drop_view(StudentSystem *system, int index);
+int view_count(const StudentSystem *system);
+const SortedView *view_at(const StudentSystem *system, int index);
+int refresh_views(StudentSystem *system);
+int walk_view(StudentSystem *system, int index, void (*visit)(StudentSystem *system, int row, void *context),
+              void *context);
+int find_view_by_field(StudentSystem *system, int field);
+int walk_view_range(StudentSystem *system, int index, int cmp, int64_t number, const char *text, int limit,
+                    void (*visit)(StudentSystem *system, int row, void *context), void *context);
+void free_views(StudentSystem *system);
+
+// 存储访问函数在修改学生时调用（roster.c）
+void views_add_row(StudentSystem *system, int index);
+void views_remove_row(StudentSystem *system, int index);
+void views_unlink_row(StudentSystem *system, int index);
+void views_link_row(StudentSystem *system, int index);
+void views_invalidate(StudentSystem *system);
+
+#endif